@@ -24,8 +24,9 @@ class Engine;
 }  // namespace backtesting::engine
 
 namespace backtesting::main {
+class BacktestContext;
 class Backtesting;
-}
+}  // namespace backtesting::main
 
 namespace backtesting::order {
 class Order;
@@ -72,6 +73,9 @@ namespace backtesting::analyzer {
 class BACKTESTING_API Analyzer {
   friend class Backtesting;
 
+  // 컨텍스트 전환 시 인스턴스 교체용
+  friend class main::BacktestContext;
+
  public:
   static shared_ptr<Analyzer>& GetAnalyzer();
 
@@ -88,6 +92,9 @@ class BACKTESTING_API Analyzer {
   /// 마지막 거래 내역을 반환하는 함수
   [[nodiscard]] Trade GetLastTrade() const;
 
+  /// 거래 내역에 추가된 거래 수를 반환하는 함수
+  [[nodiscard]] size_t GetNumTrades() const;
+
   /// 이번 백테스팅의 결과가 저장될 메인 폴더의 경로를 반환하는 함수
   [[nodiscard]] string GetMainDirectory() const;
 
@@ -115,6 +122,10 @@ class BACKTESTING_API Analyzer {
   /// 로컬 저장소에서 찾을 수 없을 때에는 원격 저장소로 fallback
   void SaveBackBoard() const;
 
+  /// 구간별 시간 분석 표를 출력하고 Chrome 트레이스 JSON 파일을
+  /// 저장하는 함수. BACKTESTING_ENABLE_PROFILING 빌드에서만 호출됨
+  void SaveProfile() const;
+
   /// 해당 회차의 백테스팅의 로그를 지정된 폴더에 저장하는 함수
   void SaveBacktestingLog() const;
 
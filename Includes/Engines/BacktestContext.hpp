@@ -0,0 +1,143 @@
+#pragma once
+
+// 표준 라이브러리
+#include <memory>
+#include <utility>
+
+// 내부 헤더
+#include "Engines/Export.hpp"
+
+// 전방 선언
+namespace backtesting::analyzer {
+class Analyzer;
+}
+
+namespace backtesting::bar {
+class BarHandler;
+}
+
+namespace backtesting::engine {
+class Config;
+class Engine;
+}  // namespace backtesting::engine
+
+namespace backtesting::order {
+class OrderHandler;
+}
+
+namespace backtesting::strategy {
+class Strategy;
+}
+
+// 네임 스페이스
+using namespace std;
+
+namespace backtesting::main {
+
+using analyzer::Analyzer;
+using bar::BarHandler;
+using engine::Config;
+using engine::Engine;
+using order::OrderHandler;
+using strategy::Strategy;
+
+/**
+ * 엔진, 바 핸들러, 주문 핸들러, 분석기, 설정, 전략과 거래소 정보를 하나의
+ * 백테스팅 상태로 소유하는 클래스.
+ *
+ * 기존 싱글톤 API(Backtesting, Engine::GetEngine 등)와 전략 및 지표가
+ * 참조하는 핸들러는 활성화된 컨텍스트의 상태를 가리키며, 활성화된 컨텍스트가
+ * 없으면 기본 상태를 가리킴. 따라서 여러 백테스팅 상태(바 데이터, 설정,
+ * 전략, 결과)를 각자의 컨텍스트에 유지하며 번갈아 실행할 수 있음.
+ *
+ * ※ 주의 사항 ※\n
+ * - 싱글톤과 정적 상태는 프로세스 전역이므로 한 번에 하나의 컨텍스트만
+ *   활성화되며, 다른 컨텍스트의 활성화는 앞선 컨텍스트가 비활성화될 때까지
+ *   대기함. 여러 백테스팅을 동시에 실행하려면 프로세스를 나누어야 함\n
+ * - 로거, 지표 캐시, 중지 요청 등 프로세스 자원은 모든 컨텍스트가 공유함\n
+ * - 컨텍스트가 활성화된 동안 다른 스레드에서 기본 상태를 사용하면 안 됨
+ *
+ * 사용 예:
+ *   BacktestContext context;
+ *   context.Run([] {
+ *     Backtesting::SetConfig().SetInitialBalance(10000) ...;
+ *     Backtesting::AddBarData(...);
+ *     Strategy::AddStrategy<MyStrategy>("전략");
+ *     Backtesting::RunBacktesting();
+ *   });
+ */
+class BACKTESTING_API BacktestContext final {
+ public:
+  /// 컨텍스트가 활성화된 동안 유지되는 객체.
+  /// 소멸 시 컨텍스트를 비활성화하고 이전 상태를 복구함
+  class BACKTESTING_API Scope final {
+   public:
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    friend class BacktestContext;
+
+    explicit Scope(BacktestContext& context);
+
+    BacktestContext& context_;
+  };
+
+  /// 비어있는 바 데이터와 설정을 가진 새 엔진 상태로 컨텍스트를 생성하는
+  /// 생성자. 다른 컨텍스트가 활성화되어 있으면 비활성화될 때까지 대기
+  BacktestContext();
+  ~BacktestContext();
+
+  BacktestContext(const BacktestContext&) = delete;
+  BacktestContext& operator=(const BacktestContext&) = delete;
+
+  /// 컨텍스트를 활성화하는 함수.
+  /// 반환된 Scope가 소멸될 때까지 모든 싱글톤 접근이 이 컨텍스트를 가리킴
+  [[nodiscard]] Scope Activate();
+
+  /// 컨텍스트를 활성화한 상태로 함수를 실행하고 결과를 반환하는 함수
+  template <typename Function>
+  decltype(auto) Run(Function&& function) {
+    const Scope scope = Activate();
+    return std::forward<Function>(function)();
+  }
+
+  /// 컨텍스트가 활성화되어 있는지 여부를 반환하는 함수
+  [[nodiscard]] bool IsActive() const;
+
+  /// 활성화된 컨텍스트를 반환하는 함수. 기본 상태 사용 중이면 nullptr
+  [[nodiscard]] static BacktestContext* GetActiveContext();
+
+  /// 컨텍스트의 엔진을 반환하는 함수
+  [[nodiscard]] shared_ptr<Engine> GetEngine() const;
+
+  /// 컨텍스트의 바 핸들러를 반환하는 함수
+  [[nodiscard]] shared_ptr<BarHandler> GetBarHandler() const;
+
+  /// 컨텍스트의 주문 핸들러를 반환하는 함수
+  [[nodiscard]] shared_ptr<OrderHandler> GetOrderHandler() const;
+
+  /// 컨텍스트의 분석기를 반환하는 함수
+  [[nodiscard]] shared_ptr<Analyzer> GetAnalyzer() const;
+
+  /// 컨텍스트의 설정을 반환하는 함수. 설정 전이면 nullptr
+  [[nodiscard]] shared_ptr<Config> GetConfig() const;
+
+  /// 컨텍스트에 추가된 전략을 반환하는 함수. 추가 전이면 nullptr
+  [[nodiscard]] shared_ptr<Strategy> GetStrategy() const;
+
+ private:
+  /// 컨텍스트가 소유하는 상태.
+  /// 활성화 중에는 싱글톤과 맞바꾼 이전 상태를 보관함
+  struct State;
+
+  unique_ptr<State> state_;
+  bool is_active_;
+
+  /// 보관 중인 상태와 싱글톤 및 정적 상태를 맞바꾸는 함수
+  void SwapState() const;
+};
+
+}  // namespace backtesting::main
@@ -40,6 +40,8 @@ namespace backtesting::main {
     break;                                                          \
   }
 
+struct ServerJob;
+
 class BACKTESTING_API Backtesting {
  public:
   Backtesting() = delete;
@@ -51,19 +53,43 @@ class BACKTESTING_API Backtesting {
   /// 서버 모드 여부를 반환하는 함수
   static bool IsServerMode();
 
-  /// 백테스팅 중지 요청 여부를 반환하는 함수
+  /// 실행 중인 서버 작업의 중지 요청 여부를 반환하는 함수
   static bool IsStopRequested();
 
+  /// 실행 중인 서버 작업의 아이디를 반환하는 함수.
+  /// 서버 작업이 아니면 빈 문자열을 반환
+  static string GetRunningJobId();
+
   /// 백테스팅을 실행하는 함수
   static void RunBacktesting();
 
-  /// 서버용 메인 실행
+  /**
+   * 서버용 메인 실행.
+   *
+   * stdin의 runSingleBacktesting, fetchOrUpdateBarData 명령을 작업 큐에
+   * 추가하여 도착 순서대로 실행함. 명령 Json의 jobId가 작업 아이디가 되며,
+   * 없으면 순번으로 생성됨. 작업 상태가 바뀔 때마다 "작업 상태<Json>"
+   * 줄이 출력됨.
+   *
+   * stopSingleBacktesting <작업 아이디>는 해당 작업만, 아이디 없는
+   * stopSingleBacktesting은 대기 및 실행 중인 모든 작업을 취소함
+   */
   static void RunServer();
 
-  /// 서버용 단일 백테스팅 실행 함수
+  /**
+   * RunServer의 작업 큐가 작업마다 호출하는 서버 작업 실행 함수.
+   *
+   * 실행 중에는 작업의 취소 토큰이 중지 요청이 되며, 작업이 실패하면
+   * 예외를 그대로 던져 작업 큐가 FAILED 상태를 출력하게 함
+   */
+  static void RunServerJob(const ServerJob& job);
+
+  /// 서버용 단일 백테스팅 실행 함수.
+  /// 실패하면 오류를 로깅하고 엔진 코어를 초기화한 후 예외를 다시 던짐
   static void RunSingleBacktesting(const string& json_str);
 
-  /// 서버용 바 데이터 다운로드/업데이트 함수
+  /// 서버용 바 데이터 다운로드/업데이트 함수.
+  /// 요청 작업이 하나라도 실패하면 나머지 작업을 마친 후 예외를 던짐
   static void FetchOrUpdateBarData(const string& json_str);
 
   /// 엔진에 설정값을 추가하는 함수.
@@ -176,6 +202,8 @@ class BACKTESTING_API Backtesting {
   /// 트레이딩(돋보기, 참조): 디렉토리/심볼 이름/타임프레임/타임프레임.parquet\n
   /// 마크 가격: 디렉토리/심볼 이름/타임프레임.parquet
   ///
+  /// 파일 옆에 업데이트 조각의 매니페스트가 있으면 조각도 함께 읽음
+  ///
   /// @param symbol_names 바 데이터로 추가할 심볼 이름들
   /// @param timeframe 추가할 데이터의 타임프레임
   /// @param klines_directory Parquet 파일들이 위치한 데이터 폴더
@@ -237,8 +265,11 @@ class BACKTESTING_API Backtesting {
   // 서버 모드 플래그
   static bool server_mode_;
 
-  // 중지 요청 플래그
-  static atomic<bool> stop_requested_;
+  // 실행 중인 서버 작업의 취소 토큰. 실행 중인 작업이 없으면 nullptr
+  static atomic<const atomic<bool>*> running_job_cancel_token_;
+
+  // 실행 중인 서버 작업의 아이디. 작업 스레드에서만 읽고 씀
+  static string running_job_id_;
 
   // DLL 로더 저장소
   static vector<shared_ptr<StrategyLoader>> dll_loaders_;
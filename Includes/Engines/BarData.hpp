@@ -76,6 +76,9 @@ class BACKTESTING_API BarData final {
   /// 심볼 인덱스와 바 인덱스에 해당되는 바를 반환하는 함수
   [[nodiscard]] Bar& GetBar(int symbol_idx, size_t bar_idx);
 
+  /// 심볼 인덱스에 해당되는 심볼의 모든 바를 반환하는 함수
+  [[nodiscard]] const vector<Bar>& GetBars(int symbol_idx) const;
+
   /// 심볼 인덱스에 해당되는 바 데이터 경로를 반환하는 함수
   [[nodiscard]] string GetBarDataPath(int symbol_idx) const;
 
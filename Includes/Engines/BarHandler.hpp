@@ -9,8 +9,9 @@
 
 // 전방 선언
 namespace backtesting::main {
+class BacktestContext;
 class Backtesting;
-}
+}  // namespace backtesting::main
 
 namespace arrow {
 class Table;
@@ -27,6 +28,9 @@ namespace backtesting::bar {
 class BACKTESTING_API BarHandler final : public BaseBarHandler {
   friend class Backtesting;
 
+  // 컨텍스트 전환 시 인스턴스 교체용
+  friend class main::BacktestContext;
+
  public:
   // 싱글톤 특성 유지
   BarHandler(const BarHandler&) = delete;             // 복사 생성자 삭제
@@ -35,6 +39,20 @@ class BACKTESTING_API BarHandler final : public BaseBarHandler {
   /// BarHandler의 싱글톤 인스턴스를 반환하는 함수
   static shared_ptr<BarHandler>& GetBarHandler();
 
+  /// 지표를 여러 스레드에서 계산할 때 스레드마다 사용하는 현재 상태.
+  /// 설정된 스레드에서는 현재 바 데이터 유형, 심볼 인덱스, 바 인덱스를
+  /// 공유 상태 대신 이 상태에서 설정하고 반환함
+  struct EvaluationContext {
+    BarDataType bar_data_type = REFERENCE;
+    string reference_timeframe;
+    int symbol_index = -1;
+    size_t bar_index = 0;
+  };
+
+  /// 현재 스레드에서 사용할 평가 상태를 설정하는 함수.
+  /// nullptr이면 공유 상태를 사용
+  static void SetEvaluationContext(EvaluationContext* context);
+
   /// 주어진 파일 경로에서 Parquet 데이터를 읽고
   /// 지정된 바 데이터 유형으로 처리하여 바 핸들러에 추가하는 함수
   ///
@@ -21,12 +21,17 @@ class Analyzer;
 
 namespace backtesting::engine {
 class Config;
-}
+struct CachedJsonFile;
+}  // namespace backtesting::engine
 
 namespace backtesting::logger {
 class Logger;
 }
 
+namespace backtesting::main {
+class BacktestContext;
+}
+
 // 네임 스페이스
 using namespace std;
 using namespace nlohmann;
@@ -43,14 +48,20 @@ class BACKTESTING_API BaseEngine {
   // config_ 접근용
   friend class Config;
 
+  // 컨텍스트 전환 시 설정 및 거래소 정보 교체용
+  friend class main::BacktestContext;
+
  public:
   /// 거래소 정보를 엔진에 추가하는 함수.
+  /// 파일이 이전 추가 후 바뀌지 않았으면 파싱된 정보를 재사용함
   static void AddExchangeInfo(const string& exchange_info_path);
 
   /// 레버리지 구간을 엔진에 추가하는 함수.
+  /// 파일이 이전 추가 후 바뀌지 않았으면 파싱된 구간을 재사용함
   static void AddLeverageBracket(const string& leverage_bracket_path);
 
   /// 펀딩 비율을 엔진에 추가하는 함수.
+  /// 파일이 이전 추가 후 바뀌지 않았으면 파싱된 비율을 재사용함
   static void AddFundingRates(const vector<string>& symbol_names,
                               const string& funding_rates_directory);
 
@@ -114,13 +125,11 @@ class BACKTESTING_API BaseEngine {
 
   /// 현재 자금을 로그하는 함수
   __forceinline void LogBalance() {
-    logger_->Log(
-        BALANCE_L,
-        format("지갑 자금 [{}] | 사용한 마진 [{}] | 사용 가능 자금 [{}]",
-               FormatDollar(wallet_balance_, true),
-               FormatDollar(used_margin_, true),
-               FormatDollar(GetAvailableBalance(), true)),
-        __FILE__, __LINE__);
+    LOG_DEFERRED(logger_, BALANCE_L,
+                 "지갑 자금 [{}] | 사용한 마진 [{}] | 사용 가능 자금 [{}]",
+                 DollarValue{wallet_balance_, true},
+                 DollarValue{used_margin_, true},
+                 DollarValue{GetAvailableBalance(), true});
   }
 
   /// '='로 콘솔창을 분리하는 로그를 발생시키는 함수
@@ -147,16 +156,16 @@ class BACKTESTING_API BaseEngine {
   unordered_map<string, int64_t>
       reference_bar_time_diff_;  /// 참조 바 사이의 타임스탬프 차이
 
-  /// 거래소 정보
-  static json exchange_info_;
+  /// 거래소 정보. 심볼 인덱스는 PERPETUAL 계약의 symbols 배열 인덱스
+  static shared_ptr<const CachedJsonFile> exchange_info_;
   static string exchange_info_path_;
 
-  /// 레버리지 구간
-  static json leverage_bracket_;
+  /// 레버리지 구간. 심볼 인덱스는 최상위 배열 인덱스
+  static shared_ptr<const CachedJsonFile> leverage_bracket_;
   static string leverage_bracket_path_;
 
   /// 펀딩 비율 (벡터는 심볼 순서)
-  static vector<json> funding_rates_;
+  static vector<shared_ptr<const CachedJsonFile>> funding_rates_;
   static vector<string> funding_rates_paths_;
 
   // 심볼별 거래소 정보
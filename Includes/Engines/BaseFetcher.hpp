@@ -1,7 +1,11 @@
 #pragma once
 
 // 표준 라이브러리
+#include <cstdint>
+#include <functional>
 #include <future>
+#include <stdexcept>
+#include <string>
 
 // 외부 라이브러리
 #include "nlohmann/json_fwd.hpp"
@@ -21,14 +25,44 @@ using namespace backtesting::logger;
 
 namespace backtesting::fetcher {
 
+/// 요청이 HTTP 429나 418 응답으로 Rate Limit에 걸렸을 때 발생하는 에러
+class BACKTESTING_API RateLimitExceeded final : public runtime_error {
+ public:
+  RateLimitExceeded(const string& message, const long response_code)
+      : runtime_error(message), response_code_(response_code) {}
+
+  /// 429 또는 418 응답 코드를 반환하는 함수
+  [[nodiscard]] long GetResponseCode() const { return response_code_; }
+
+ private:
+  long response_code_;
+};
+
 /**
- * 비동기와 HTTP를 사용하여 Fetch하는 함수를 제공하는 클래스
+ * 비동기와 HTTP를 사용하여 Fetch하는 함수를 제공하는 클래스.
+ *
+ * 요청은 고정된 수의 HTTP 작업 스레드에서 실행되며, 작업 스레드들은 CURL
+ * 핸들과 연결을 유지하고 DNS, TLS 세션 캐시를 공유하므로 같은 호스트에 대한
+ * 연속된 요청은 핸드셰이크를 다시 하지 않음
  */
 class BACKTESTING_API BaseFetcher {
+ public:
+  /// HTTP 작업 스레드들을 종료하는 함수.
+  /// 프로세스 종료 전 진행 중인 요청이 없을 때 엔진 정리 과정에서 호출
+  static void ShutdownHttpClients();
+
  protected:
   BaseFetcher();
   ~BaseFetcher();
 
+  /// 응답 코드, 응답 헤더 전체 문자열, 요청을 보낸 시간(Unix ms)을 받는
+  /// 응답 관찰 함수
+  using ResponseObserver = function<void(long, const string&, int64_t)>;
+
+  /// 응답을 받을 때마다 실패 여부와 관계없이 호출할 관찰 함수를 등록하는
+  /// 함수. 연결에 실패하여 응답이 없으면 호출하지 않음
+  static void SetResponseObserver(ResponseObserver observer);
+
   /**
    * 제공된 URL에서 주어진 파라미터를 사용하여 데이터를 가져오는 함수
    *
@@ -48,9 +82,32 @@ class BACKTESTING_API BaseFetcher {
       const string& header_msg = "", const string& api_key_env_var = "",
       const string& api_secret_env_var = "");
 
+  /**
+   * Fetch와 같은 요청을 보내되 응답 본문을 파싱하지 않고 그대로 반환하는
+   * 함수.
+   *
+   * 큰 응답을 Json 트리 없이 직접 파싱할 때 사용함.
+   *
+   * @return 응답 본문 문자열을 포함하는 future 객체
+   */
+  [[nodiscard]] static future<string> FetchText(
+      const string& url, const unordered_map<string, string>& params = {},
+      bool need_signature = false, bool sort_params = false,
+      const string& header_msg = "", const string& api_key_env_var = "",
+      const string& api_secret_env_var = "");
+
  private:
   static shared_ptr<Logger>& logger_;
 
+  /// 요청을 동기적으로 보내고 응답 본문을 반환하는 함수.
+  /// 응답이 실패하면 runtime_error를, 429나 418이면 RateLimitExceeded를 던짐
+  static string Request(const string& url,
+                        const unordered_map<string, string>& params,
+                        bool need_signature, bool sort_params,
+                        const string& header_msg,
+                        const string& api_key_env_var,
+                        const string& api_secret_env_var);
+
   /**
    * 주어진 쿼리 매개변수를 사용하여 기본 URL에 전체 파라미터를 포함한 URL을
    * 구축하는 함수.
@@ -54,6 +54,13 @@ using namespace logger;
 using namespace utils;
 }  // namespace backtesting
 
+/// 현재 심볼 이름을 접두사로 붙여 지연 포맷팅 로그를 기록하는 매크로.
+/// 주문 핸들러의 멤버 함수 내에서만 사용 가능
+#define LOG_SYMBOL_DEFERRED(log_level, fmt, ...)             \
+  LOG_DEFERRED(logger_, log_level, "[{}] " fmt,              \
+               symbol_names_[bar_->GetCurrentSymbolIndex()], \
+               ##__VA_ARGS__)
+
 namespace backtesting::order {
 
 // 주문 시그널을 나타나는 열거형 클래스
@@ -137,7 +144,9 @@ class BACKTESTING_API BaseOrderHandler {
   /// 현재 심볼과 바에서 청산이 이루어졌는지 여부를 반환하는 함수
   [[nodiscard]] __forceinline bool IsJustExited() const { return just_exited_; }
 
-  /// 심볼 이름으로 포맷된 로그를 발생시키는 함수
+  /// 심볼 이름으로 포맷된 로그를 발생시키는 함수.
+  ///
+  /// 반복 호출되는 경로에서는 포맷팅이 지연되는 LOG_SYMBOL_DEFERRED 사용
   __forceinline void LogFormattedInfo(const LogLevel log_level,
                                       const string& formatted_message,
                                       const char* file, const int line) {
@@ -1,24 +1,27 @@
 ﻿#pragma once
 
 // 표준 라이브러리
-#include <chrono>
-#include <condition_variable>
-#include <mutex>
+#include <cstdint>
 #include <string>
 
 // 내부 헤더
 #include "Engines/BaseFetcher.hpp"
 #include "Engines/Export.hpp"
+#include "Engines/KlineParser.hpp"
 
 // 전방 선언
 namespace arrow {
-class Array;
+class Table;
 }
 
 namespace backtesting::logger {
 class Logger;
 }
 
+namespace backtesting::fetcher {
+class WeightLimiter;
+}
+
 // 네임 스페이스
 using namespace std;
 using namespace backtesting::logger;
@@ -115,6 +118,10 @@ class BACKTESTING_API BinanceFetcher final : public BaseFetcher {
   /// 바이낸스 레버리지 구간을 Fecth하고 json 형식으로 저장하는 함수
   void FetchLeverageBracket(const string& leverage_bracket_path) const;
 
+  /// 선물 엔드 포인트와 이를 사용하는 모든 URL을 변경하는 함수.
+  /// 로컬 모의 서버로 요청을 보낼 때 사용
+  static void SetFuturesEndpoint(const string& futures_endpoint);
+
  private:
   static shared_ptr<Logger>& logger_;  // 로그용 객체
 
@@ -136,50 +143,49 @@ class BACKTESTING_API BinanceFetcher final : public BaseFetcher {
   string mark_price_klines_directory_;  // 마크 Klines 폴더 경로
   string funding_rates_directory_;      // Funding Rate 폴더 경로
 
-  // 바이낸스 REQUEST_WEIGHT 제한을 위한 토큰 버킷
-  class BACKTESTING_API TokenBucket {
-   public:
-    TokenBucket() = delete;
-
-    static TokenBucket& GetBinanceLimiter();
-
-    void Acquire(double weight = 1.0);
-
-   private:
-    /// @param capacity 최대 누적 weight
-    /// @param refill_per_sec 초당 회복량
-    TokenBucket(double capacity, double refill_per_sec);
+  /// 모든 바이낸스 요청이 공유하는 REQUEST_WEIGHT 제한기를 반환하는 함수.
+  /// 처음 호출할 때 모든 응답의 헤더를 제한기에 반영하도록 등록함
+  static WeightLimiter& GetWeightLimiter();
 
-    // 내부적으로 토큰을 보충하는 함수
-    void refill();
+  // WeightLimiter 요청 헬퍼
+  static void AcquireBinanceWeight(int64_t weight);
 
-    static TokenBucket* limiter_;
-    double capacity_;     // 최대 누적 weight
-    double tokens_;       // 현재 보유 weight
-    double refill_rate_;  // 초당 회복 weight
+  /// 429 응답 후 같은 요청을 다시 보낸다는 경고를 기록하는 함수
+  static void LogRateLimitRetry(int num_retries);
 
-    chrono::time_point<chrono::steady_clock> last_refill_;
-    mutex mutex_;
-    condition_variable cv_;
-  };
-
-  // TokenBucket 요청 헬퍼
-  static void AcquireBinanceWeight(double weight);
+  /// 캔들스틱 요청 파라미터의 limit에 따른 바이낸스 weight를 반환하는 함수
+  static int64_t GetKlinesWeight(const unordered_map<string, string>& params);
 
   /**
    * Binance API를 사용하여 지정된 URL과 파라미터에 대한
-   * 캔들스틱 데이터를 연속적으로 Fetch하는 함수
+   * 캔들스틱 데이터를 연속적으로 Fetch하는 함수.
+   *
+   * 앞으로 가져오는 긴 기간은 구간으로 나눠 동시에 요청한 후 순서대로 이어
+   * 붙임
    *
    * @param url 데이터를 가져올 API의 URL
    * @param params 요청에 사용될 파라미터
    * @param forward 데이터를 가져오는 방향. true이면 데이터를 앞으로
    *                가져오고, false이면 데이터를 뒤로 가져옴
-   * @return 가져온 데이터를 나타내는 deque의 비동기 future 객체
+   * @return 가져온 캔들스틱 데이터를 열별로 담은 비동기 future 객체
    */
-  static future<vector<json>> FetchKlines(
+  static future<KlineColumns> FetchKlines(
+      const string& url, const unordered_map<string, string>& params,
+      bool forward);
+
+  /// 파라미터의 기간을 페이지 단위로 순서대로 요청하여 반환하는 함수.
+  /// 각 페이지의 응답 본문은 ParseKlines로 열별 버퍼에 바로 파싱함
+  static KlineColumns FetchKlinePages(
       const string& url, const unordered_map<string, string>& params,
       bool forward);
 
+  /**
+   * 캔들스틱 요청 기간을 동시에 요청할 구간들로 나누는 함수.
+   * 나눌 필요가 없거나 나눌 수 없으면 빈 벡터를 반환
+   */
+  static vector<pair<int64_t, int64_t>> PlanKlineSlices(
+      const string& url, const unordered_map<string, string>& params);
+
   /**
    * Binance API를 사용하여 지정된 URL과 파라미터에 대한
    * 펀딩 비율 데이터를 연속적으로 Fetch하는 함수
@@ -199,55 +205,34 @@ class BACKTESTING_API BinanceFetcher final : public BaseFetcher {
    */
   static string GetFilenameWithTimeframe(const string& timeframe);
 
-  /**
-   * 주어진 JSON 형식의 kline 데이터를 빌더로 구성된 벡터에 추가한 뒤
-   * Arrow Array로 변환하여 반환
-   *
-   * @param klines 추가할 klines 데이터를 포함하는 JSON 객체의 deque
-   * @return 변환된 Arrow Array Vector
-   */
-  static vector<shared_ptr<arrow::Array>> GetArraysAddedKlines(
-      const vector<json>& klines);
-
-  /**
-   * 주어진 klines 데이터를 변환하여 더 쉽게 다룰 수 있는 형식으로 변환하는
-   * 함수.
-   *
-   * 현물 데이터와 선물 데이터의 데이터 조정 시 double 형식의 가격
-   * 데이터가 필요하므로 가격 데이터는 double로 변환.
-   *
-   * @param klines 변환할 klines 데이터를 포함하는 deque
-   * @param drop_latest 변환 과정에서 최신 데이터를 포함하지 않을지를
-   *                    결정하는 플래그. true일 경우 최신 데이터 행을 제거
-   * @return 변환된 klines 데이터를 포함하는 deque
-   */
-  static vector<json> TransformKlines(const vector<json>& klines,
-                                      bool drop_latest);
-
   /**
    * 주어진 현물 klines와 선물 klines 데이터를 병합하여 조정된 klines 데이터를
    * 반환하는 함수.
    *
-   * @param spot_klines 병합할 현물 klines 데이터의 deque
-   * @param futures_klines 병합할 선물 klines 데이터의 deque
-   * @return 현물 데이터와 선물 데이터가 병합된 새로운 klines deque
+   * @param spot_klines 병합할 현물 klines 데이터
+   * @param futures_klines 병합할 선물 klines 데이터
+   * @return 현물 데이터와 선물 데이터가 병합된 새로운 klines 데이터
    */
-  static vector<json> ConcatKlines(const vector<json>& spot_klines,
-                                   const vector<json>& futures_klines);
+  static KlineColumns ConcatKlines(const KlineColumns& spot_klines,
+                                   const KlineColumns& futures_klines);
 
   /**
-   * 주어진 klines 데이터를 Parquet 파일로 변환하고 저장하는 함수
+   * 주어진 klines 데이터를 캔들스틱 데이터셋의 기본 파일로 저장하는 함수
    *
-   * @param klines 저장할 klines 데이터를 포함하는 JSON 객체의 deque
+   * @param klines 저장할 klines 데이터
    * @param directory_path 데이터를 저장할 폴더의 경로
    * @param file_name 파일 이름
    * @param save_split_files 분할 저장을 할지 결정하는 플래그
    * @param reset_directory 저장 폴더를 초기화하고 저장하는지 결정하는 플래그
    */
-  static void SaveKlines(const vector<json>& klines,
+  static void SaveKlines(const KlineColumns& klines,
                          const string& directory_path, const string& file_name,
                          bool save_split_files, bool reset_directory);
 
+  /// 캔들스틱 데이터를 Open Time, OHLCV, Close Time 열의 Table로 변환하는
+  /// 함수
+  static shared_ptr<arrow::Table> MakeKlinesTable(const KlineColumns& klines);
+
   /// 백슬래시를 모두 슬래시로 변환하여 반환하는 함수
   static string ConvertBackslashToSlash(const string& path_string);
 
@@ -19,6 +19,14 @@ enum class BarDataType;
 namespace logger {
 class Logger;
 }
+
+namespace main {
+class BacktestContext;
+}
+
+namespace numeric {
+enum class ComparisonMode;
+}
 }  // namespace backtesting
 
 // 네임 스페이스
@@ -27,6 +35,7 @@ namespace backtesting {
 using namespace engine;
 using namespace order;
 using namespace logger;
+using namespace numeric;
 }  // namespace backtesting
 
 namespace backtesting::engine {
@@ -54,6 +63,9 @@ struct BACKTESTING_API Period {
 
 /// 엔진의 사전 설정값을 담당하는 빌더 클래스
 class BACKTESTING_API Config final {
+  // 컨텍스트 전환 시 경로 설정 교체용
+  friend class main::BacktestContext;
+
  public:
   Config();
   ~Config();
@@ -108,6 +120,31 @@ class BACKTESTING_API Config final {
   // 바 돋보기 기능을 사용할지 여부를 설정하는 함수
   Config& SetUseBarMagnifier(bool use_bar_magnifier);
 
+  // 지표 계산 값을 프로젝트 폴더/Caches/Indicators 폴더에 캐시하여
+  // 같은 바 데이터와 지표 설정에서 다시 계산하지 않을지 여부를 설정하는 함수
+  Config& SetUseIndicatorCache(bool use_indicator_cache);
+
+  // 지표를 백테스팅 전에 모두 계산하지 않고, 심볼별로 처음 참조될 때
+  // 계산할지 여부를 설정하는 함수.
+  // 전략에서 참조하지 않는 지표와 심볼은 계산하지 않으며,
+  // 플롯하는 지표는 지표 데이터 저장 전에 남은 심볼을 모두 계산함
+  Config& SetUseLazyIndicator(bool use_lazy_indicator);
+
+  // 백테스팅 전 지표 계산에 사용할 스레드 개수를 설정하는 함수.
+  // 기본값은 1(순차 계산)이며, 0이면 하드웨어 스레드 개수를 사용.
+  // 2 이상이면 의존 관계가 없는 지표와 심볼을 동시에 계산하므로 커스텀 지표는
+  // 정적 변수 등 다른 지표와 공유하는 상태를 가지면 안 되고, 다른 지표는
+  // 생성자 인수로 받아 참조해야 함. 지연 계산 사용 시에는 순차 계산함
+  Config& SetIndicatorThreads(int indicator_threads);
+
+  // 전략에서 Numeric 값(지표 및 바 데이터 값)을 비교할 때의 비교 방식을
+  // 설정하는 함수. 기본값은 상대 오차 비교(RELATIVE)이며,
+  // ABSOLUTE는 tolerance 이하의 차이를 같은 값으로, EXACT는 오차 없이 비교.
+  // 엔진 내부의 가격 및 수량 비교에는 영향을 주지 않음.
+  // RELATIVE 이외의 비교 방식은 BACKTESTING_RUNTIME_COMPARISON 빌드에서만 사용
+  Config& SetComparisonMode(ComparisonMode comparison_mode,
+                            double tolerance = 0);
+
   // 초기 자금을 설정하는 함수
   Config& SetInitialBalance(double initial_balance);
 
@@ -159,6 +196,11 @@ class BACKTESTING_API Config final {
   [[nodiscard]] static string GetStrategySourcePath();
   [[nodiscard]] optional<Period> GetBacktestPeriod() const;
   [[nodiscard]] optional<bool> GetUseBarMagnifier() const;
+  [[nodiscard]] bool GetUseIndicatorCache() const;
+  [[nodiscard]] bool GetUseLazyIndicator() const;
+  [[nodiscard]] int GetIndicatorThreads() const;
+  [[nodiscard]] ComparisonMode GetComparisonMode() const;
+  [[nodiscard]] double GetComparisonTolerance() const;
   [[nodiscard]] double GetInitialBalance() const;
   [[nodiscard]] double GetTakerFeePercentage() const;
   [[nodiscard]] double GetMakerFeePercentage() const;
@@ -208,6 +250,21 @@ class BACKTESTING_API Config final {
   /// 바 돋보기 사용 여부
   optional<bool> use_bar_magnifier_;
 
+  /// 지표 계산 값 캐시 사용 여부
+  bool use_indicator_cache_;
+
+  /// 지표 지연 계산 사용 여부
+  bool use_lazy_indicator_;
+
+  /// 지표 계산 스레드 개수. 0이면 하드웨어 스레드 개수
+  int indicator_threads_;
+
+  /// Numeric 비교 방식
+  ComparisonMode comparison_mode_;
+
+  /// ABSOLUTE 비교 방식의 절대 오차
+  double comparison_tolerance_;
+
   /// 초기 자금
   double initial_balance_;
 
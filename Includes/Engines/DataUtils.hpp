@@ -2,6 +2,7 @@
 
 // 표준 라이브러리
 #include <any>
+#include <format>
 #include <future>
 #include <locale>
 #include <regex>
@@ -139,6 +140,19 @@ BACKTESTING_API void TableToParquet(const shared_ptr<arrow::Table>& table,
                                     bool save_split_files,
                                     bool reset_directory);
 
+/**
+ * 주어진 테이블을 10000행씩 나눠 [시작 Open Time 초]_[끝 Open Time 초].parquet
+ * 이름의 분할 파일들로 저장하는 함수.
+ *
+ * 분할 파일은 차트에서 필요한 구간만 읽는 데 사용함.
+ *
+ * @param table 저장할 데이터를 포함하는 Table 객체에 대한 shared_ptr.
+ *              0번 열은 Open Time이어야 함
+ * @param directory_path 분할 파일을 저장할 폴더의 경로
+ */
+BACKTESTING_API void TableToSplitParquet(const shared_ptr<arrow::Table>& table,
+                                         const string& directory_path);
+
 /// Json을 지정된 경로에 파일로 저장하는 함수
 BACKTESTING_API void JsonToFile(future<json> data, const string& file_path);
 
@@ -175,6 +189,20 @@ inline locale global_locale("en_US.UTF-8");
 /// 값을 주어진 정밀도의 string으로 변환하여 반환하는 함수
 BACKTESTING_API string ToFixedString(double value, int precision);
 
+/// 포맷 시 FormatDollar로 변환되는 금액 래퍼.
+/// LOG_DEFERRED 인자로 전달하면 문자열 변환이 백그라운드 스레드로 지연됨
+struct DollarValue {
+  double price;
+  bool use_rounding;
+};
+
+/// 포맷 시 ToFixedString으로 변환되는 값 래퍼.
+/// LOG_DEFERRED 인자로 전달하면 문자열 변환이 백그라운드 스레드로 지연됨
+struct FixedValue {
+  double value;
+  int precision;
+};
+
 /// 환경 변수 값을 가져오는 함수
 [[nodiscard]] BACKTESTING_API string GetEnvVariable(const string& env_var);
 
@@ -397,3 +425,22 @@ template <typename T, typename U>
 }
 
 }  // namespace backtesting::utils
+
+template <>
+struct std::formatter<backtesting::utils::DollarValue> : formatter<string> {
+  auto format(const backtesting::utils::DollarValue& dollar,
+              format_context& ctx) const {
+    return formatter<string>::format(
+        backtesting::utils::FormatDollar(dollar.price, dollar.use_rounding),
+        ctx);
+  }
+};
+
+template <>
+struct std::formatter<backtesting::utils::FixedValue> : formatter<string> {
+  auto format(const backtesting::utils::FixedValue& fixed,
+              format_context& ctx) const {
+    return formatter<string>::format(
+        backtesting::utils::ToFixedString(fixed.value, fixed.precision), ctx);
+  }
+};
@@ -1,6 +1,7 @@
 #pragma once
 
 // 표준 라이브러리
+#include <cstdint>
 #include <mutex>
 #include <string>
 #include <unordered_map>
@@ -9,6 +10,7 @@
 // 내부 헤더
 #include "Engines/BaseEngine.hpp"
 #include "Engines/Export.hpp"
+#include "Engines/ProgressReporter.hpp"
 
 // 전방 선언
 namespace backtesting::bar {
@@ -28,6 +30,10 @@ class SymbolInfo;
 class OrderHandler;
 }  // namespace backtesting::order
 
+namespace backtesting::main {
+class BacktestContext;
+}
+
 // 네임 스페이스
 using namespace std;
 namespace backtesting {
@@ -70,6 +76,9 @@ class BACKTESTING_API Engine final : public BaseEngine {
   // ExecuteStrategy 접근용
   friend class OrderHandler;
 
+  // 컨텍스트 전환 시 인스턴스 교체용
+  friend class main::BacktestContext;
+
  public:
   // 싱글톤 특성 유지
   Engine(const Engine&) = delete;             // 복사 생성자 삭제
@@ -162,6 +171,10 @@ class BACKTESTING_API Engine final : public BaseEngine {
   // 심볼 이름들
   vector<string> symbol_names_;
 
+  // ===========================================================================
+  ProgressReporter progress_;  // 서버 모드의 진행 상황 프레임 출력
+  size_t num_processed_bars_;  // 지금까지 처리한 트레이딩 바 수
+
   /// Engine의 싱글톤 인스턴스를 초기화하는 함수
   void ResetEngine();
 
@@ -198,6 +211,36 @@ class BACKTESTING_API Engine final : public BaseEngine {
   /// 전략에서 사용하는 지표들을 계산하고 저장하는 함수
   void InitializeIndicators() const;
 
+  /// 여러 스레드로 미리 준비한 지표의 준비 결과
+  enum class IndicatorPreparation : uint8_t {
+    NONE,        // 준비하지 않음
+    CACHED,      // 캐시에서 불러옴
+    CALCULATED,  // 계산함
+    RESUMED      // 스냅샷에서 이어서 계산함
+  };
+
+  /**
+   * 계산 값을 가진 지표들을 캐시에서 불러오고, 캐시되지 않은 지표들은 의존
+   * 관계에 따라 여러 스레드로 계산하는 함수.
+   *
+   * 같은 지표의 심볼들은 순서대로 계산하고, 의존 지표의 같은 심볼 계산이
+   * 끝난 심볼은 다른 지표 및 심볼과 동시에 계산함.
+   * 스냅샷에서 이어서 계산할 수 있는 지표는 지표 전체를 하나의 작업으로 계산
+   *
+   * @param canonical_of 각 지표가 계산 값을 공유하는 지표의 인덱스
+   * @param indicator_indices 지표별 인덱스
+   * @param cache_keys 지표별 디스크 캐시 키
+   * @param snapshot_keys 지표별 스냅샷 키
+   * @param num_threads 계산 스레드 개수
+   * @param preparations 지표별 준비 결과를 기록할 벡터
+   * @return 모든 작업 완료 여부. 중지 요청 시 false
+   */
+  bool PrepareIndicatorsInParallel(
+      const vector<size_t>& canonical_of,
+      const unordered_map<const Indicator*, size_t>& indicator_indices,
+      const vector<string>& cache_keys, const vector<string>& snapshot_keys,
+      size_t num_threads, vector<IndicatorPreparation>& preparations) const;
+
   /// 백테스팅의 메인 로직을 실행하는 함수
   void BacktestingMain();
 
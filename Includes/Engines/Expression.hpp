@@ -0,0 +1,262 @@
+#pragma once
+
+// 표준 라이브러리
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+// 내부 헤더
+#include "Engines/BarData.hpp"
+#include "Engines/Export.hpp"
+#include "Engines/IndicatorState.hpp"
+
+// 전방 선언
+namespace backtesting::indicator {
+class Indicator;
+}
+
+// 네임 스페이스
+using namespace std;
+
+/**
+ * 바 데이터와 지표를 조합하는 지표 식을 만들고 계산하는 모듈.
+ *
+ * 식은 연산 노드의 DAG로 만들어지며, CompiledExpression으로 컴파일하면
+ * 같은 부분식을 하나로 합친 명령 목록이 됨. 명령 목록은 바마다 모든 명령을
+ * 순서대로 한 번씩 실행하므로, 원소별 연산과 이동 윈도우 연산의 중간 값은
+ * 바 개수만큼의 버퍼로 저장되지 않고 윈도우 상태만 유지됨.
+ *
+ * 전략에서는 ExpressionIndicator 지표로 추가하여 사용하며, 컴파일된 식은
+ * 엔진 없이 바 데이터만으로도 계산할 수 있음.
+ *
+ * 사용 예: Sma(BarTrueRange(), 14) / close
+ *
+ * ※ 유효하지 않은 값 처리 ※\n
+ * - 원소별 연산: NaN이 전파됨. Max, Min은 입력 중 NaN이 있으면 NaN\n
+ * - 이동 윈도우 연산: 내장 지표와 같이 유한하지 않은 입력은 누적하지 않고,
+ *   계산 가능한 상태이면 직전 값을, 아니면 NaN을 반환\n
+ * - Shift: 입력을 그대로 지연시키며, 이전 바가 부족하면 NaN
+ */
+namespace backtesting::expression {
+
+using indicator::Indicator;
+using indicator::IndicatorState;
+
+/// 식 노드의 연산 종류
+enum class ExpressionOp {
+  // 바 데이터
+  OPEN,
+  HIGH,
+  LOW,
+  CLOSE,
+  VOLUME,
+
+  // 상수와 다른 지표의 값
+  CONSTANT,
+  SOURCE,
+
+  // 원소별 연산
+  ADD,
+  SUBTRACT,
+  MULTIPLY,
+  DIVIDE,
+  NEGATE,
+  ABS,
+  MAX,
+  MIN,
+
+  // n봉 전 값
+  SHIFT,
+
+  // 이동 윈도우 연산
+  SMA,
+  EMA,
+  STDDEV,
+  HIGHEST,
+  LOWEST
+};
+
+/// 식 DAG의 노드
+struct ExpressionNode {
+  ExpressionOp op;
+  vector<shared_ptr<const ExpressionNode>> inputs;
+  double constant;    // CONSTANT의 값
+  size_t period;      // SHIFT의 지연 바 개수 및 이동 윈도우의 길이
+  Indicator* source;  // SOURCE의 지표
+};
+
+/// 지표 식. 복사 시 노드를 공유하므로 가볍게 전달 가능
+class BACKTESTING_API Expression {
+ public:
+  /// 상수 식을 만드는 생성자
+  Expression(double constant);  // NOLINT(*-explicit-constructor)
+
+  /// 다른 지표의 값을 참조하는 식을 만드는 생성자.
+  /// 참조할 지표는 식을 사용하는 지표와 같은 타임프레임이어야 함
+  Expression(Indicator& source);  // NOLINT(*-explicit-constructor)
+
+  /// 노드로 식을 만드는 생성자
+  explicit Expression(shared_ptr<const ExpressionNode> node);
+
+  /// 식의 루트 노드를 반환하는 함수
+  [[nodiscard]] const shared_ptr<const ExpressionNode>& GetNode() const;
+
+  /// 식의 정규화 서명을 반환하는 함수.
+  /// 참조 지표는 GetSourceIndicators의 순서에 따른 위치로 기록됨
+  [[nodiscard]] string GetSignature() const;
+
+  /// 식이 참조하는 지표들을 처음 참조된 순서대로 반환하는 함수
+  [[nodiscard]] vector<Indicator*> GetSourceIndicators() const;
+
+ private:
+  shared_ptr<const ExpressionNode> node_;
+};
+
+/// 바의 시가
+[[nodiscard]] BACKTESTING_API Expression BarOpen();
+
+/// 바의 고가
+[[nodiscard]] BACKTESTING_API Expression BarHigh();
+
+/// 바의 저가
+[[nodiscard]] BACKTESTING_API Expression BarLow();
+
+/// 바의 종가
+[[nodiscard]] BACKTESTING_API Expression BarClose();
+
+/// 바의 거래량
+[[nodiscard]] BACKTESTING_API Expression BarVolume();
+
+/// 바의 True Range. 첫 바는 NaN
+[[nodiscard]] BACKTESTING_API Expression BarTrueRange();
+
+/// 식의 period봉 전 값
+[[nodiscard]] BACKTESTING_API Expression Shift(const Expression& expression,
+                                               size_t period);
+
+/// 식의 절댓값
+[[nodiscard]] BACKTESTING_API Expression Abs(const Expression& expression);
+
+/// 두 식 중 큰 값
+[[nodiscard]] BACKTESTING_API Expression Max(const Expression& lhs,
+                                             const Expression& rhs);
+
+/// 두 식 중 작은 값
+[[nodiscard]] BACKTESTING_API Expression Min(const Expression& lhs,
+                                             const Expression& rhs);
+
+/// 식의 단순 이동 평균
+[[nodiscard]] BACKTESTING_API Expression Sma(const Expression& expression,
+                                             size_t period);
+
+/// 식의 지수 이동 평균. 첫 period개 값의 평균으로 시작
+[[nodiscard]] BACKTESTING_API Expression Ema(const Expression& expression,
+                                             size_t period);
+
+/// 식의 이동 모표준편차
+[[nodiscard]] BACKTESTING_API Expression StdDev(const Expression& expression,
+                                                size_t period);
+
+/// 식의 이동 최댓값
+[[nodiscard]] BACKTESTING_API Expression
+RollingMax(const Expression& expression, size_t period);
+
+/// 식의 이동 최솟값
+[[nodiscard]] BACKTESTING_API Expression
+RollingMin(const Expression& expression, size_t period);
+
+BACKTESTING_API Expression operator+(const Expression& lhs,
+                                     const Expression& rhs);
+BACKTESTING_API Expression operator-(const Expression& lhs,
+                                     const Expression& rhs);
+BACKTESTING_API Expression operator*(const Expression& lhs,
+                                     const Expression& rhs);
+BACKTESTING_API Expression operator/(const Expression& lhs,
+                                     const Expression& rhs);
+BACKTESTING_API Expression operator-(const Expression& expression);
+
+/**
+ * 식을 한 번의 바 순회로 계산하는 명령 목록으로 컴파일한 클래스.
+ *
+ * 같은 서명의 부분식은 하나의 명령으로 합쳐지며, 명령은 입력이 항상 먼저
+ * 실행되도록 정렬됨. 윈도우 상태는 심볼마다 Reset으로 초기화해야 함
+ */
+class BACKTESTING_API CompiledExpression {
+ public:
+  explicit CompiledExpression(const Expression& expression);
+
+  /// 모든 윈도우 상태를 초기화하는 함수
+  void Reset();
+
+  /**
+   * 바 하나를 반영하여 식의 다음 값을 계산하는 함수
+   * @param bar 현재 바
+   * @param source_values 참조 지표들의 현재 값. GetNumSources 크기
+   * @return 현재 바의 식 값
+   */
+  [[nodiscard]] double Step(const bar::Bar& bar,
+                            span<const double> source_values);
+
+  /**
+   * 바들을 순서대로 반영하여 모든 바의 식 값을 계산하는 함수.
+   * 윈도우 상태를 초기화하지 않으므로 이전 계산에 이어서 계산됨
+   * @param bars 바 데이터
+   * @param sources 참조 지표들의 바 데이터와 같은 크기의 값
+   * @param output 바 데이터와 같은 크기의 출력 버퍼
+   */
+  void Evaluate(span<const bar::Bar> bars,
+                span<const span<const double>> sources, span<double> output);
+
+  /// 윈도우 상태를 기록하는 함수
+  void SaveState(IndicatorState& state) const;
+
+  /// SaveState로 기록한 윈도우 상태를 복구하는 함수.
+  /// 기록된 상태가 명령 목록과 맞지 않으면 false를 반환
+  [[nodiscard]] bool LoadState(IndicatorState& state);
+
+  /// 부분식을 합친 후의 명령 개수를 반환하는 함수
+  [[nodiscard]] size_t GetNumInstructions() const;
+
+  /// 참조 지표의 개수를 반환하는 함수
+  [[nodiscard]] size_t GetNumSources() const;
+
+ private:
+  /// 명령 하나. 입력은 앞선 명령의 인덱스
+  struct Instruction {
+    ExpressionOp op;
+    size_t lhs;  // 첫 입력 명령 또는 SOURCE의 참조 지표 인덱스
+    size_t rhs;  // 두 번째 입력 명령
+    size_t period;
+    double constant;
+  };
+
+  /// SHIFT와 이동 윈도우 명령의 상태
+  struct WindowState {
+    vector<double> buffer;  // 최근 입력의 원형 버퍼
+    size_t position = 0;    // 원형 버퍼의 다음 기록 위치
+    size_t count = 0;       // 누적된 입력 개수
+    size_t index = 0;       // 이동 최댓값 및 최솟값의 입력 인덱스
+    double sum = 0;
+    double sum_sq = 0;
+    double previous = 0;  // 직전 계산 값
+    bool ready = false;   // 윈도우가 채워졌는지 여부
+    deque<pair<double, size_t>> extremes;  // 이동 최댓값 및 최솟값 후보
+  };
+
+  vector<Instruction> instructions_;
+  vector<WindowState> states_;  // 명령별 상태. 상태가 없는 명령은 비어있음
+  vector<double> values_;       // 명령별 현재 바의 값
+  vector<double> source_values_;  // Evaluate에서 사용하는 참조 지표 값
+  size_t num_sources_;
+
+  /// SHIFT 또는 이동 윈도우 명령에 입력 하나를 반영하는 함수
+  double StepWindow(const Instruction& instruction, WindowState& state,
+                    double value) const;
+};
+
+}  // namespace backtesting::expression
+using namespace backtesting::expression;
@@ -0,0 +1,100 @@
+#pragma once
+
+// 표준 라이브러리
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+// 내부 헤더
+#include "Engines/Export.hpp"
+
+// 네임 스페이스
+using namespace std;
+
+namespace backtesting::fetcher {
+
+/// 시장 데이터 요청 작업 종류
+enum class FetchJobKind { CONTINUOUS_KLINES, MARK_PRICE_KLINES, FUNDING_RATES };
+
+/// 시장 데이터 요청 작업
+struct FetchJob {
+  FetchJobKind kind;
+  string symbol;
+  string timeframe;  // 펀딩 비율은 빈 문자열
+  string directory;  // 저장 폴더
+};
+
+/**
+ * 미리 계획한 시장 데이터 요청 작업들을 크기가 제한된 작업 스레드들에서
+ * 실행하는 클래스.
+ *
+ * 작업은 계획된 순서대로 꺼내지며 각 작업 스레드는 한 번에 하나의 작업을
+ * 실행함. 요청 Weight는 모든 스레드가 BinanceFetcher의 토큰 버킷을 공유하여
+ * 제한하므로 작업 스레드 수는 응답 대기 시간을 겹치는 정도만 결정함.
+ *
+ * 긴 기간의 캔들스틱은 PlanTimeSlices로 나눈 구간들을 동시에 요청한 후 구간
+ * 순서대로 이어 붙임.
+ */
+class BACKTESTING_API FetchScheduler final {
+ public:
+  using Handler = function<void(const FetchJob&)>;
+  using ErrorCallback = function<void(const FetchJob&, const exception_ptr&)>;
+  using StopPredicate = function<bool()>;
+
+  /// 작업 스레드 수의 상한
+  static constexpr size_t max_workers = 16;
+
+  /// @param num_workers 동시에 실행할 최대 작업 수 (1 ~ max_workers)
+  explicit FetchScheduler(size_t num_workers);
+
+  /**
+   * 모든 작업이 끝날 때까지 작업들을 실행하는 함수.
+   *
+   * 작업이 예외를 던지면 오류 콜백을 호출한 후 나머지 작업을 계속 실행함.
+   * 중지 조건이 참이 되면 남은 작업은 시작하지 않음.
+   *
+   * @return 시작된 작업 수
+   */
+  size_t Run(const vector<FetchJob>& jobs, const Handler& handler,
+             const ErrorCallback& error_callback,
+             const StopPredicate& stop_requested = nullptr) const;
+
+  /**
+   * 같은 파일을 저장하는 작업들 중 처음 작업만 남기는 함수.
+   *
+   * 같은 종류, 심볼, 타임프레임, 저장 폴더의 작업은 같은 파일과 매니페스트를
+   * 쓰므로 동시에 실행되면 서로의 결과를 덮어씀. 폴더는 정규화하여 비교하며
+   * 남은 작업의 순서는 유지함.
+   */
+  [[nodiscard]] static vector<FetchJob> RemoveDuplicateJobs(
+      const vector<FetchJob>& jobs);
+
+  /**
+   * 캔들스틱 요청 기간을 동시에 요청할 구간들로 나누는 함수.
+   *
+   * 구간은 페이지 단위로 정렬되며, 구간마다 최소 페이지 수 이상이 되도록
+   * 구간 수를 줄임. 각 구간은 [시작, 끝] Open Time 범위이며 서로 겹치지 않음.
+   *
+   * @param begin_time 첫 캔들의 Open Time
+   * @param end_time 마지막으로 요청할 Open Time
+   * @param interval 캔들 사이의 시간 간격 (ms)
+   * @param page_size 요청 한 번에 받는 최대 캔들 수
+   * @param max_slices 최대 구간 수
+   * @param min_pages_per_slice 구간별 최소 페이지 수
+   */
+  [[nodiscard]] static vector<pair<int64_t, int64_t>> PlanTimeSlices(
+      int64_t begin_time, int64_t end_time, int64_t interval, int64_t page_size,
+      size_t max_slices, int64_t min_pages_per_slice);
+
+  /// 동시에 실행할 최대 작업 수를 반환하는 함수
+  [[nodiscard]] size_t GetNumWorkers() const;
+
+ private:
+  size_t num_workers_;
+};
+
+}  // namespace backtesting::fetcher
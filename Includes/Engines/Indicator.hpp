@@ -4,6 +4,9 @@
 #include <filesystem>
 #include <format>
 #include <memory>
+#include <span>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
 // 내부 헤더
@@ -14,6 +17,9 @@
 #include "Engines/DataUtils.hpp"
 #include "Engines/Engine.hpp"
 #include "Engines/Export.hpp"
+#include "Engines/Expression.hpp"
+#include "Engines/IndicatorOutput.hpp"
+#include "Engines/IndicatorState.hpp"
 #include "Engines/Logger.hpp"
 #include "Engines/Numeric.hpp"
 #include "Engines/Plot.hpp"
@@ -70,6 +76,8 @@ using namespace utils;
 
 namespace backtesting::indicator {
 
+class IndicatorTestAccess;
+
 /**
  * 전략 구현 시 사용하는 커스텀 지표를 생성하기 위한 추상 클래스
  *
@@ -83,6 +91,9 @@ namespace backtesting::indicator {
  *
  *    Initialize → 지표 계산 시 최초 1회 실행\n
  *    Calculate → 각 바마다 값을 계산하여 반환\n
+ *    CalculateBatch (선택) → 심볼의 모든 바를 한 번에 계산\n
+ *    SaveState, LoadState (선택) → 바가 추가된 다음 실행에서 이어서
+ *                                 계산하기 위한 상태 저장 및 복구\n
  *
  * 2. 상속받은 지표 생성자에는 [지표 이름, 타임프레임, Plot 객체]를
  *    동일한 순서로 반드시 포함해야 함\n
@@ -91,6 +102,11 @@ namespace backtesting::indicator {
  *    Indicator& 타입의 인수를 받아 [] 연산자로 참조하여 사용하면 됨.\n
  *    ※ 주의: 인수로 넣을 다른 지표는 커스텀 지표보다 먼저 정의되어야 함.
  *
+ *    Indicator& 인수는 지표의 의존성으로 기록되며, 클래스, 타임프레임,
+ *    의존 지표, 파라미터가 모두 같은 지표는 먼저 추가된 지표의 계산 값을
+ *    공유하고 다시 계산하지 않음. 따라서 지표의 계산은 생성자 인수와 바
+ *    데이터만으로 결정되어야 함.\n
+ *
  * 4. 커스텀 지표를 계산할 때, 커스텀 지표의 타임프레임과 다른 타임프레임의
  *    지표는 사용 불가능\n
  *
@@ -98,6 +114,10 @@ namespace backtesting::indicator {
  *    동일하고, 지정된 경로에 존재할 때만 소스 파일 탐지.
  *    (프로젝트 폴더/Includes/Indicators/클래스명.hpp 그리고
  *     프로젝트 폴더/Sources/cpp/Indicators/클래스명.cpp)\n
+ *
+ * 6. 지표 계산 스레드를 2개 이상으로 설정하면 다른 지표와 심볼이 동시에
+ *    계산되므로, 커스텀 지표는 정적 변수 등 다른 지표와 공유하는 상태를
+ *    가지면 안 되며 참조할 지표는 생성자 인수로 받아야 함\n
  */
 class BACKTESTING_API Indicator {
   // 지표 및 설정 저장 시 output_ 및 plot_ 접근용
@@ -112,6 +132,10 @@ class BACKTESTING_API Indicator {
   // 생성자 및 IncreaseCreationCounter 함수 접근용
   friend class Strategy;
 
+  // 단위 테스트에서 엔진 없이 지표 생성 시 IncreaseCreationCounter 함수
+  // 접근용
+  friend class IndicatorTestAccess;
+
  public:
   // 지표 반환 시 참조 타입으로 받는 것을 강요하기 위하여
   // 복사 생성자, 할당 연산자 삭제
@@ -128,6 +152,11 @@ class BACKTESTING_API Indicator {
   /// 지표의 타임프레임을 설정하는 함수
   void SetTimeframe(const string& timeframe);
 
+  /// 지표 계산 값의 저장 방식을 설정하는 함수. 계산 전에만 설정 가능.
+  /// 저장 방식이 다른 중복 지표끼리는 가장 정밀한 저장 방식을 사용하며,
+  /// 지연 계산 지표와 지연 계산 지표가 참조하는 지표는 압축하지 않음
+  void SetOutputStorage(OutputStorage output_storage);
+
   /// 트레이딩 바 데이터의 타임프레임보다 큰 타임프레임의 지표인지 설정하는 함수
   /// 지표 참조 시 빠른 방법 판단을 위하여 설정
   void SetHigherTimeframeIndicator();
@@ -141,9 +170,15 @@ class BACKTESTING_API Indicator {
   /// 해당 지표의 타임프레임을 반환하는 함수
   [[nodiscard]] string GetTimeframe() const;
 
+  /// 해당 지표의 계산 값 저장 방식을 반환하는 함수
+  [[nodiscard]] OutputStorage GetOutputStorage() const;
+
   /// 해당 지표의 소스 파일 경로를 반환하는 함수
   string GetSourcePath();
 
+  /// 해당 지표가 생성자 인수로 받은 의존 지표들을 반환하는 함수
+  [[nodiscard]] const vector<Indicator*>& GetSourceIndicators() const;
+
   /// 해당 지표의 헤더 파일 경로를 반환하는 함수
   string GetHeaderPath();
 
@@ -312,6 +347,47 @@ class BACKTESTING_API Indicator {
   /// 각 바에서 지표를 계산하는 함수. 메인 로직을 작성.
   virtual Numeric<double> Calculate() = 0;
 
+  /**
+   * 현재 심볼의 모든 바에서 지표를 한 번에 계산하는 함수.
+   *
+   * 오버라이드 시 바마다 Calculate를 호출하는 대신 심볼마다 한 번 호출되므로
+   * 전체 시계열을 하나의 루프로 계산할 수 있음. 다른 지표의 값은 GetSeries
+   * 함수로 참조하며, Initialize는 심볼마다 이 함수보다 먼저 호출됨.
+   *
+   * 기본 구현은 false를 반환하며, 이 경우 바마다 Calculate를 호출하여 계산.
+   * SaveState를 오버라이드한 지표는 반환 시점의 상태가 마지막 바까지
+   * Calculate로 계산한 상태와 같아야 함
+   *
+   * @param output 계산된 값을 저장할 현재 심볼의 바 개수 크기의 버퍼
+   * @return 일괄 계산 여부
+   */
+  virtual bool CalculateBatch(span<double> output);
+
+  /**
+   * 현재 심볼의 마지막 바까지 계산한 상태를 기록하는 함수.
+   *
+   * 오버라이드하면 지표 캐시 사용 시 계산 상태가 스냅샷으로 저장되며,
+   * 바가 추가된 다음 실행에서는 처음부터 다시 계산하지 않고 LoadState로
+   * 상태를 복구한 뒤 추가된 바만 Calculate로 계산함.
+   *
+   * 기본 구현은 false를 반환하며, 이 경우 스냅샷을 저장하지 않음
+   *
+   * @param state 멤버 변수들을 기록할 상태
+   * @return 상태 기록 여부
+   */
+  virtual bool SaveState(IndicatorState& state) const;
+
+  /**
+   * SaveState로 기록한 상태를 복구하는 함수. 심볼마다 Initialize 후 호출됨
+   * @param state SaveState에서 기록한 순서대로 읽을 상태
+   * @return 상태 복구 여부. false면 해당 심볼을 처음부터 계산
+   */
+  virtual bool LoadState(IndicatorState& state);
+
+  /// 일괄 계산 중 참조할 다른 지표의 현재 심볼의 모든 계산된 값을 반환하는
+  /// 함수. 참조할 지표는 계산 중인 지표와 같은 타임프레임이어야 함
+  [[nodiscard]] static span<const double> GetSeries(const Indicator& source);
+
  private:
   // 카운터는 커스텀 지표 생성 시 Strategy 클래스의 AddIndicator 함수 사용을
   // 강제하기 위한 목적
@@ -328,22 +404,30 @@ class BACKTESTING_API Indicator {
   string timeframe_;                        // 지표의 타임프레임
   string class_name_;                       // 지표의 클래스 이름
   vector<double> input_;                    // 지표의 파라미터
-  vector<vector<Numeric<double>>> output_;  // 지표의 계산된 값: 심볼<값>
+  shared_ptr<IndicatorOutput>
+      output_;  // 지표의 계산된 값: 심볼<값>. 중복 지표끼리 공유
   bool is_calculated_;                 // 지표가 계산되었는지 확인하는 플래그
+  OutputStorage output_storage_;       // 계산 값 저장 방식
+  bool is_output_discarded_;           // 계산 값을 버렸는지 확인하는 플래그
+  bool is_lazy_;  // 심볼별로 처음 참조될 때 계산하는 지표인지 확인하는 플래그
   vector<size_t> reference_num_bars_;  /// 지표의 타임프레임에 해당되는
                                        /// 참조 바 데이터의 심볼별 바 개수
 
+  vector<Indicator*> source_indicators_;  /// 생성자 인수로 받은 의존 지표들
+  string signature_;  /// 클래스와 파라미터로 만든 정규화 서명.
+                      /// 비어있으면 계산 값 공유 대상이 아님
+
+  bool capture_states_;  /// 심볼별 계산 후 스냅샷용 상태를 기록할지 여부
+  vector<vector<uint8_t>> symbol_states_;  /// 심볼별 마지막 바의 계산 상태
+  string resumed_output_key_;  /// 이어서 계산한 스냅샷의 이전 계산 값 캐시 키
+
   string header_path_;  /// 커스텀 지표의 헤더 파일 경로
                         /// → 백테스팅 종료 후 소스 코드 저장 목적
   string source_path_;  /// 커스텀 지표의 소스 파일 경로
                         /// → 백테스팅 종료 후 소스 코드 저장 목적
 
-  // 지표가 현재 계산 중인지 확인하는 플래그.
-  // 지표 계산 시 사용하는 다른 지표가 계산하는 지표와 다른 타임프레임을 가질 수
-  // 없게 검사할 때 사용
-  static bool is_calculating_;           // 현재 지표 계산 중인지 여부
-  static string calculating_name_;       // 계산 중인 지표의 이름
-  static string calculating_timeframe_;  // 계산 중인 지표의 타임프레임
+  bool is_scheduled_;  /// 여러 스레드에서 심볼별로 계산 중인 지표인지
+                       /// 확인하는 플래그
   bool
       is_higher_timeframe_indicator_;  /// 트레이딩 바의 타임프레임보다 큰
                                        /// 타임프레임의 지표인지 확인하는 플래그
@@ -366,6 +450,128 @@ class BACKTESTING_API Indicator {
 
   /// 지표 생성 카운터를 증가시키는 함수
   static void IncreaseCreationCounter();
+
+  /// 지표 생성자 인수에서 수집한 의존 지표와 파라미터 서명
+  struct Dependencies {
+    vector<Indicator*> source_indicators;
+    string signature;
+    bool can_share = true;
+
+    /// 생성자 인수 하나를 의존 지표 또는 파라미터 서명으로 기록하는 함수
+    template <typename Arg>
+    void Append(const Arg& arg) {
+      using Type = remove_cvref_t<Arg>;
+
+      if constexpr (is_base_of_v<Indicator, Type>) {
+        // 의존 지표는 정규화 시 계산 값을 공유하는 지표로 치환되므로
+        // 서명에는 위치만 기록
+        source_indicators.push_back(
+            const_cast<Indicator*>(static_cast<const Indicator*>(&arg)));
+        signature += "|@";
+      } else if constexpr (is_same_v<Type, Expression>) {
+        // 식이 참조하는 지표도 의존 지표이며, 식의 서명에는 참조 지표들이
+        // 처음 참조된 순서의 위치로 기록됨
+        for (auto* source : arg.GetSourceIndicators()) {
+          source_indicators.push_back(source);
+        }
+
+        signature += format("|{}", arg.GetSignature());
+      } else if constexpr (is_arithmetic_v<Type>) {
+        signature += format("|{}", arg);
+      } else if constexpr (is_enum_v<Type>) {
+        signature += format("|{}", static_cast<underlying_type_t<Type>>(arg));
+      } else if constexpr (is_convertible_v<const Type&, string_view>) {
+        signature += format("|\"{}\"", string_view(arg));
+      } else {
+        can_share = false;
+      }
+    }
+  };
+
+  /// 지표 생성자 인수들에서 의존 지표와 파라미터 서명을 수집하는 함수.
+  /// 생성자로 인수가 이동되기 전에 호출해야 함
+  template <typename CustomIndicator, typename... Args>
+  static Dependencies CollectDependencies(const Args&... args) {
+    Dependencies dependencies;
+    dependencies.signature = typeid(CustomIndicator).name();
+    (dependencies.Append(args), ...);
+
+    // 서명을 만들 수 없는 인수가 있으면 계산 값 공유 대상에서 제외
+    if (!dependencies.can_share) {
+      dependencies.signature.clear();
+    }
+
+    return dependencies;
+  }
+
+  /// 수집한 의존 지표와 파라미터 서명을 설정하는 함수
+  void SetDependencies(Dependencies&& dependencies);
+
+  /// 같은 계산을 하는 지표의 계산 값을 공유하는 함수
+  void ShareOutput(const Indicator& canonical);
+
+  /// 검증 및 로그 없이 지표의 계산 값과 계산 상태를 공유하는 함수
+  void AttachOutput(const Indicator& canonical);
+
+  /// 캐시 키에 해당되는 캐시 파일을 매핑하여 계산 값으로 사용하는 함수.
+  /// 캐시 파일이 없거나 바 데이터와 맞지 않으면 false를 반환
+  bool LoadCachedOutput(const string& key);
+
+  /// 계산 값을 캐시 키에 해당되는 캐시 파일로 저장하는 함수
+  void SaveCachedOutput(const string& key) const;
+
+  /// 스냅샷 키에 해당되는 스냅샷에서 상태를 복구하여 추가된 바만 계산하는
+  /// 함수. 스냅샷이 없거나 바 데이터의 앞부분이 다르면 false를 반환
+  bool ResumeFromSnapshot(const string& key);
+
+  /// 계산 중 기록한 심볼별 상태를 스냅샷 키에 해당되는 스냅샷 파일로
+  /// 저장하는 함수
+  /// @param key 스냅샷 키
+  /// @param output_key 현재 계산 값이 저장된 캐시 파일의 키
+  void SaveSnapshot(const string& key, const string& output_key);
+
+  /// 현재 심볼의 계산 상태를 기록하는 함수
+  void CaptureState(int symbol_idx);
+
+  /// 지표 타임프레임의 바 데이터와 심볼별 바 개수를 설정하는 함수
+  void PrepareBarData();
+
+  /// 현재 바 데이터 환경에서 심볼 인덱스에 해당되는 심볼의 모든 바를
+  /// 계산하는 함수
+  void CalculateSymbol(int symbol_idx);
+
+  /// 모든 심볼을 계산 대기 상태로 두고 처음 참조될 때 계산하도록 설정하는
+  /// 함수
+  void PrepareLazyOutput();
+
+  /// 지연 계산 지표에서 심볼 인덱스에 해당되는 심볼이 아직 계산되지 않았으면
+  /// 계산하는 함수. 호출 시점의 바 데이터 환경과 계산 상태는 유지됨
+  void EvaluateLazySymbol(int symbol_idx);
+
+  /// 지연 계산 지표에서 아직 계산되지 않은 모든 심볼을 계산하는 함수
+  void EvaluateRemainingSymbols();
+
+  /// 심볼별 계산 작업을 여러 스레드에서 실행하기 전에 바 데이터와 계산 값
+  /// 버퍼를 준비하는 함수. 계산이 끝나면 FinishScheduledCalculation 호출 필요
+  void BeginScheduledCalculation();
+
+  /// 심볼 인덱스에 해당되는 심볼의 모든 바를 계산하는 함수.
+  /// 현재 스레드에 BarHandler의 평가 상태가 설정되어 있어야 하며,
+  /// 같은 지표의 심볼들은 동시에 계산하면 안 됨
+  void CalculateScheduledSymbol(int symbol_idx);
+
+  /// 모든 심볼의 계산 작업이 끝난 지표를 계산 완료 상태로 설정하는 함수
+  void FinishScheduledCalculation();
+
+  /// 계산 중인 지표가 의존 지표로 받았고 심볼별로 계산 중인 지표인지
+  /// 확인하는 함수. 작업 순서상 현재 심볼의 계산이 끝나 있으므로 참조 가능
+  [[nodiscard]] bool IsScheduledSourceOfCalculating() const;
+
+  /// 계산 값을 압축된 버퍼로 교체하는 함수
+  void ReplaceOutput(shared_ptr<IndicatorOutput> output);
+
+  /// 계산 값을 버리고 더 이상 참조할 수 없게 하는 함수
+  void DiscardOutput();
 };
 
 }  // namespace backtesting::indicator
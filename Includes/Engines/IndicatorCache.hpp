@@ -0,0 +1,69 @@
+#pragma once
+
+// 표준 라이브러리
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// 내부 헤더
+#include "Engines/Export.hpp"
+
+// 전방 선언
+namespace backtesting::bar {
+class BarData;
+}
+
+// 네임 스페이스
+using namespace std;
+
+namespace backtesting::indicator {
+
+/**
+ * 지표 계산 값의 디스크 캐시 키와 경로를 만드는 클래스.
+ *
+ * 캐시 키는 지표의 클래스와 파라미터 서명, 타임프레임, 헤더 및 소스 파일의
+ * 내용 해시, 참조 바 데이터의 지문, 의존 지표들의 캐시 키로 구성되므로
+ * 이 중 하나라도 바뀌면 다시 계산됨.
+ *
+ * 스냅샷 키는 캐시 키에서 바 데이터의 지문을 제외한 것으로, 바가 추가된
+ * 다음 실행에서도 같은 키로 이전 실행의 계산 상태를 찾을 수 있음.
+ *
+ * 캐시 파일과 스냅샷 파일은 프로젝트 폴더/Caches/Indicators 폴더에 저장됨
+ */
+class BACKTESTING_API IndicatorCache final {
+ public:
+  IndicatorCache() = delete;
+
+  /// 바이트 열의 64비트 해시(XXH64)를 반환하는 함수.
+  /// 이전 해시를 seed로 넘겨 여러 바이트 열을 이어서 해시할 수 있음
+  [[nodiscard]] static uint64_t Hash(const void* data, size_t size,
+                                     uint64_t seed = 0);
+
+  /// 파일 내용의 해시를 16진수 문자열로 반환하는 함수.
+  /// 파일을 읽을 수 없으면 빈 문자열을 반환
+  [[nodiscard]] static string HashFile(const string& path);
+
+  /// 바 데이터의 심볼 이름과 모든 바로 만든 지문을 16진수 문자열로 반환하는
+  /// 함수
+  [[nodiscard]] static string FingerprintBarData(bar::BarData& bar_data);
+
+  /// FingerprintBarData와 같은 지문을 반환하되, 같은 바 데이터 객체의 지문은
+  /// 객체가 해제되거나 심볼이 추가될 때까지 재사용하는 함수.
+  /// 서버 모드에서 바 데이터가 상주하는 연속 실행은 전체 바를 다시 해시하지
+  /// 않음
+  [[nodiscard]] static string GetBarDataFingerprint(
+      const shared_ptr<bar::BarData>& bar_data);
+
+  /// 심볼 인덱스에 해당되는 심볼의 이름과 처음부터 바 개수만큼의 바로 만든
+  /// 해시를 반환하는 함수
+  [[nodiscard]] static uint64_t HashBars(bar::BarData& bar_data, int symbol_idx,
+                                         size_t num_bars);
+
+  /// 캐시 키에 해당되는 캐시 파일 경로를 반환하는 함수
+  [[nodiscard]] static string GetCachePath(const string& key);
+
+  /// 스냅샷 키에 해당되는 스냅샷 파일 경로를 반환하는 함수
+  [[nodiscard]] static string GetSnapshotPath(const string& key);
+};
+
+}  // namespace backtesting::indicator
@@ -0,0 +1,162 @@
+#pragma once
+
+// 표준 라이브러리
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+// 내부 헤더
+#include "Engines/BarData.hpp"
+#include "Engines/Export.hpp"
+
+namespace backtesting::numeric {
+enum class ComparisonMode;
+}
+
+// 네임 스페이스
+using namespace std;
+
+/**
+ * 내장 지표의 일괄 계산에 사용하는 SIMD 커널 모음.
+ *
+ * 모든 커널은 스칼라, AVX2, AVX-512 구현을 가지며 최초 호출 시 CPU 기능을
+ * 감지하여 사용 가능한 가장 넓은 구현을 선택함. x86이 아닌 환경에서는 항상
+ * 스칼라 구현을 사용함.
+ *
+ * 이동 윈도우 커널은 입력을 윈도우 길이의 구간으로 나눠 구간별 누적값과
+ * 역누적값을 구한 뒤, 두 값을 SIMD로 결합하여 모든 바의 윈도우 값을 계산함
+ * (van Herk/Gil-Werman 방식).
+ *
+ * 이동 윈도우 커널은 입력 앞쪽의 NaN 구간(상위 지표의 준비 구간)을 건너뛰어
+ * 스칼라 지표와 같은 위치부터 값을 계산하며, 그 뒤에 유한하지 않은 값이
+ * 있으면 계산하지 않고 false를 반환함. 이 경우 호출자는 바마다 계산하는
+ * 경로로 대체해야 함.
+ *
+ * ※ 스칼라 지표와의 호환성 ※\n
+ * - RollingMax, RollingMin, TrueRange: 스칼라 지표와 비트 단위로 동일\n
+ * - RollingMean, RollingStandardDeviation: 합산 순서가 달라 스칼라 지표와
+ *   반올림 오차만큼 다를 수 있음. 윈도우 합의 상대 오차는 윈도우 길이 ×
+ *   2^-52 이내이며, 분산의 차이는 스칼라 지표의 누적 제곱합 오차인
+ *   바 수 × 2^-52 × 최대 제곱값 이내임\n
+ * - CrossOver, CrossUnder: Numeric 비교 연산자로 바마다 비교한 결과와 동일
+ */
+namespace backtesting::kernel {
+
+/// 커널 구현의 SIMD 수준
+enum class SimdLevel { SCALAR, AVX2, AVX512 };
+
+/// 현재 CPU와 OS가 지원하는 가장 높은 SIMD 수준을 감지하여 반환하는 함수
+[[nodiscard]] BACKTESTING_API SimdLevel DetectSimdLevel();
+
+/// 커널이 현재 사용하는 SIMD 수준을 반환하는 함수
+[[nodiscard]] BACKTESTING_API SimdLevel GetSimdLevel();
+
+/// 커널이 사용할 SIMD 수준을 설정하는 함수.
+/// 테스트 및 벤치마크용이며, 감지된 수준보다 높게 설정할 수 없음
+BACKTESTING_API void SetSimdLevel(SimdLevel simd_level);
+
+/// SIMD 수준을 문자열로 반환하는 함수
+[[nodiscard]] BACKTESTING_API string SimdLevelToString(SimdLevel simd_level);
+
+/**
+ * 입력의 단순 이동 평균을 계산하는 함수
+ * @param input 입력 시계열
+ * @param period 윈도우 길이
+ * @param output 입력과 같은 크기의 출력 버퍼
+ * @return 계산 여부. 준비 구간 이후 유한하지 않은 값이 있으면 false
+ */
+BACKTESTING_API bool RollingMean(span<const double> input, size_t period,
+                                 span<double> output);
+
+/**
+ * 입력의 이동 모표준편차를 계산하는 함수
+ * @param input 입력 시계열
+ * @param period 윈도우 길이
+ * @param output 입력과 같은 크기의 출력 버퍼
+ * @return 계산 여부. 준비 구간 이후 유한하지 않은 값이 있으면 false
+ */
+BACKTESTING_API bool RollingStandardDeviation(span<const double> input,
+                                              size_t period,
+                                              span<double> output);
+
+/**
+ * 입력의 이동 최댓값을 계산하는 함수
+ * @param input 입력 시계열
+ * @param period 윈도우 길이
+ * @param output 입력과 같은 크기의 출력 버퍼
+ * @return 계산 여부. 준비 구간 이후 유한하지 않은 값이 있으면 false
+ */
+BACKTESTING_API bool RollingMax(span<const double> input, size_t period,
+                                span<double> output);
+
+/**
+ * 입력의 이동 최솟값을 계산하는 함수
+ * @param input 입력 시계열
+ * @param period 윈도우 길이
+ * @param output 입력과 같은 크기의 출력 버퍼
+ * @return 계산 여부. 준비 구간 이후 유한하지 않은 값이 있으면 false
+ */
+BACKTESTING_API bool RollingMin(span<const double> input, size_t period,
+                                span<double> output);
+
+/**
+ * 바 데이터의 True Range를 계산하는 함수. 첫 바는 NaN
+ * @param bars 한 심볼의 바 데이터
+ * @param output 바 데이터와 같은 크기의 출력 버퍼
+ */
+BACKTESTING_API void TrueRange(span<const bar::Bar> bars, span<double> output);
+
+/**
+ * lhs가 rhs를 상향 돌파한 바를 찾는 함수.
+ * 현재 바에서 lhs > rhs이고 이전 바에서 lhs <= rhs이면 1, 아니면 0이며,
+ * 비교는 Numeric 비교 연산자와 같은 비교 방식(ComparisonPolicy)을 따름.
+ * 첫 바는 0
+ * @param lhs 입력 시계열
+ * @param rhs lhs와 같은 크기의 입력 시계열
+ * @param output lhs와 같은 크기의 출력 버퍼
+ */
+BACKTESTING_API void CrossOver(span<const double> lhs, span<const double> rhs,
+                               span<uint8_t> output);
+
+/**
+ * lhs가 rhs를 하향 돌파한 바를 찾는 함수.
+ * 현재 바에서 lhs < rhs이고 이전 바에서 lhs >= rhs이면 1, 아니면 0이며,
+ * 비교는 Numeric 비교 연산자와 같은 비교 방식(ComparisonPolicy)을 따름.
+ * 첫 바는 0
+ * @param lhs 입력 시계열
+ * @param rhs lhs와 같은 크기의 입력 시계열
+ * @param output lhs와 같은 크기의 출력 버퍼
+ */
+BACKTESTING_API void CrossUnder(span<const double> lhs, span<const double> rhs,
+                                span<uint8_t> output);
+
+/**
+ * 지정한 비교 방식으로 lhs가 rhs를 상향 돌파한 바를 찾는 함수.
+ * ComparisonPolicy의 설정과 관계없이 Comparison<mode>로 비교하므로 빌드
+ * 옵션과 관계없이 모든 비교 방식을 사용할 수 있음
+ * @param lhs 입력 시계열
+ * @param rhs lhs와 같은 크기의 입력 시계열
+ * @param output lhs와 같은 크기의 출력 버퍼
+ * @param mode 비교 방식
+ * @param tolerance ABSOLUTE 방식의 절대 오차
+ */
+BACKTESTING_API void CrossOver(span<const double> lhs, span<const double> rhs,
+                               span<uint8_t> output,
+                               numeric::ComparisonMode mode, double tolerance);
+
+/**
+ * 지정한 비교 방식으로 lhs가 rhs를 하향 돌파한 바를 찾는 함수.
+ * ComparisonPolicy의 설정과 관계없이 Comparison<mode>로 비교하므로 빌드
+ * 옵션과 관계없이 모든 비교 방식을 사용할 수 있음
+ * @param lhs 입력 시계열
+ * @param rhs lhs와 같은 크기의 입력 시계열
+ * @param output lhs와 같은 크기의 출력 버퍼
+ * @param mode 비교 방식
+ * @param tolerance ABSOLUTE 방식의 절대 오차
+ */
+BACKTESTING_API void CrossUnder(span<const double> lhs, span<const double> rhs,
+                                span<uint8_t> output,
+                                numeric::ComparisonMode mode, double tolerance);
+
+}  // namespace backtesting::kernel
@@ -0,0 +1,172 @@
+#pragma once
+
+// 표준 라이브러리
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+// 내부 헤더
+#include "Engines/Export.hpp"
+
+// 네임 스페이스
+using namespace std;
+
+namespace backtesting::indicator {
+
+/// 지표 계산 값의 저장 방식
+enum class OutputStorage {
+  DOUBLE,  // 계산된 double 값을 그대로 저장 (기본값)
+  FLOAT,   // float로 변환하고 앞쪽 NaN 구간은 저장하지 않음.
+           // 표시용이나 정밀도가 낮아도 되는 지표용
+  DISCARD  // 다른 지표의 계산에만 사용하고, 마지막으로 사용된 후 버림.
+           // 전략에서 참조하거나 플롯할 수 없음
+};
+
+/// 지표 캐시 파일의 헤더 구조체
+struct BACKTESTING_API IndicatorCacheHeader {
+  char magic[8];         // "BTINDCAC"
+  uint32_t version;      // 캐시 형식 버전
+  uint32_t key_size;     // 헤더 뒤에 기록된 캐시 키의 바이트 수
+  uint64_t num_symbols;  // 심볼 개수
+};
+
+static_assert(sizeof(IndicatorCacheHeader) == 24);
+
+/**
+ * 지표의 심볼별 계산 값을 담는 버퍼 클래스.
+ *
+ * 계산 시에는 모든 심볼의 double 값을 하나의 연속된 메모리에 저장하며,
+ * 직접 할당하거나 캐시 파일을 쓰기 시 복사(copy-on-write)로 매핑하여 생성됨.
+ * 매핑된 버퍼는 파일을 읽어 복사하지 않고 페이지 단위로 필요할 때 로딩됨.
+ *
+ * 계산이 끝난 버퍼는 ToFloat 함수로 앞쪽 NaN 구간을 제외한 float 버퍼로
+ * 압축할 수 있으며, 압축된 버퍼는 Get 함수로만 참조 가능함.
+ *
+ * 지연 계산 시에는 모든 심볼을 계산 대기 상태로 표시한 뒤, 심볼별로 계산이
+ * 끝날 때마다 계산 완료로 표시함. 계산 값을 공유하는 지표들은 버퍼와 함께
+ * 계산 상태도 공유함.
+ *
+ * ※ 캐시 파일 형식 ※\n
+ * [IndicatorCacheHeader][캐시 키 (8바이트 정렬)]
+ * [심볼별 바 개수 uint64 × 심볼 개수][심볼별 값 double × 바 개수]...
+ */
+class BACKTESTING_API IndicatorOutput final {
+ public:
+  /// 심볼별 바 개수만큼 연속된 double 메모리를 할당하는 생성자
+  explicit IndicatorOutput(const vector<size_t>& num_bars);
+  ~IndicatorOutput();
+
+  IndicatorOutput(const IndicatorOutput&) = delete;
+  IndicatorOutput& operator=(const IndicatorOutput&) = delete;
+
+  /**
+   * 캐시 파일을 매핑하여 버퍼를 생성하는 함수
+   * @param path 캐시 파일 경로
+   * @param key 캐시 파일에 기록되어 있어야 하는 캐시 키
+   * @param num_bars 캐시 파일에 기록되어 있어야 하는 심볼별 바 개수
+   * @return 매핑된 버퍼. 파일이 없거나 형식, 키, 바 개수가 다르면 nullptr
+   */
+  [[nodiscard]] static shared_ptr<IndicatorOutput> Map(
+      const string& path, const string& key, const vector<size_t>& num_bars);
+
+  /**
+   * double 버퍼를 캐시 파일로 저장하는 함수.
+   * 임시 파일에 기록한 뒤 이름을 바꾸므로 중단되어도 손상된 파일이 남지 않음
+   * @param path 캐시 파일 경로
+   * @param key 캐시 파일에 기록할 캐시 키
+   * @return 저장 성공 여부. 압축되었거나 계산이 완료되지 않은 버퍼는
+   *         저장하지 않음
+   */
+  [[nodiscard]] bool Save(const string& path, const string& key) const;
+
+  /// 모든 심볼을 계산 대기 상태로 표시하는 함수
+  void MarkAllPending();
+
+  /// 심볼 인덱스에 해당되는 심볼을 계산 완료로 표시하는 함수
+  void MarkCalculated(size_t symbol_idx);
+
+  /// 심볼 인덱스에 해당되는 심볼이 계산 대기 상태인지 여부를 반환하는 함수
+  [[nodiscard]] bool IsPending(const size_t symbol_idx) const {
+    return num_pending_symbols_ != 0 && pending_symbols_[symbol_idx] != 0;
+  }
+
+  /// 모든 심볼의 계산이 완료되었는지 여부를 반환하는 함수
+  [[nodiscard]] bool IsComplete() const { return num_pending_symbols_ == 0; }
+
+  /// 앞쪽 NaN 구간을 제외한 값을 float로 변환한 버퍼를 반환하는 함수
+  [[nodiscard]] shared_ptr<IndicatorOutput> ToFloat() const;
+
+  /// 심볼 인덱스에 해당되는 심볼의 모든 double 값을 반환하는 연산자.
+  /// 압축되지 않은 버퍼에서만 사용 가능
+  [[nodiscard]] span<double> operator[](const size_t symbol_idx) const {
+    const auto& symbol = symbols_[symbol_idx];
+    return {symbol.values, symbol.num_bars};
+  }
+
+  /// 심볼 인덱스와 바 인덱스에 해당되는 값을 반환하는 함수
+  [[nodiscard]] double Get(const size_t symbol_idx,
+                           const size_t bar_idx) const {
+    const auto& symbol = symbols_[symbol_idx];
+    if (bar_idx < symbol.leading_nans) {
+      return NAN;
+    }
+
+    const size_t value_idx = bar_idx - symbol.leading_nans;
+    return symbol.values != nullptr
+               ? symbol.values[value_idx]
+               : static_cast<double>(symbol.float_values[value_idx]);
+  }
+
+  /// 심볼 개수를 반환하는 함수
+  [[nodiscard]] size_t size() const { return symbols_.size(); }
+
+  /// 심볼 인덱스에 해당되는 심볼의 바 개수를 반환하는 함수
+  [[nodiscard]] size_t GetNumBars(const size_t symbol_idx) const {
+    return symbols_[symbol_idx].num_bars;
+  }
+
+  /// float로 압축된 버퍼인지 여부를 반환하는 함수
+  [[nodiscard]] bool IsCompacted() const;
+
+  /// 캐시 파일을 매핑한 버퍼인지 여부를 반환하는 함수
+  [[nodiscard]] bool IsMapped() const;
+
+  /// 값 저장에 사용하는 바이트 수를 반환하는 함수
+  [[nodiscard]] size_t GetMemoryUsage() const;
+
+ private:
+  IndicatorOutput() = default;
+
+  /// 심볼 하나의 값 범위
+  struct SymbolValues {
+    double* values;       // double로 저장된 값. float로 압축되면 nullptr
+    float* float_values;  // float로 압축된 값
+    size_t leading_nans;  // 저장하지 않은 앞쪽 NaN 구간의 길이
+    size_t num_bars;      // 전체 바 개수
+  };
+
+  vector<double> storage_;       // 직접 할당한 경우의 값 저장소
+  vector<float> float_storage_;  // float로 압축한 경우의 값 저장소
+  vector<SymbolValues> symbols_;
+
+  // 지연 계산 시 심볼별 계산 대기 여부와 계산 대기 중인 심볼 개수
+  vector<uint8_t> pending_symbols_;
+  size_t num_pending_symbols_ = 0;
+
+  // 캐시 파일을 매핑한 경우의 매핑 정보
+  void* mapped_data_ = nullptr;
+  size_t mapped_size_ = 0;
+
+#ifdef _WIN32
+  void* file_handle_ = nullptr;
+  void* mapping_handle_ = nullptr;
+#endif
+
+  /// 매핑을 해제하는 함수
+  void Unmap();
+};
+
+}  // namespace backtesting::indicator
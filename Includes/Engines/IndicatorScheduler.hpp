@@ -0,0 +1,96 @@
+#pragma once
+
+// 표준 라이브러리
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+// 내부 헤더
+#include "Engines/Export.hpp"
+
+// 네임 스페이스
+using namespace std;
+
+namespace backtesting::indicator {
+
+/**
+ * 의존 관계가 있는 지표 계산 작업들을 스레드 풀에서 실행하는 클래스.
+ *
+ * 작업은 의존하는 작업이 모두 완료되면 실행 가능해지며, 실행 가능한 작업
+ * 중에서는 먼저 추가된 작업부터 빈 스레드에 배정됨. 작업 하나가 예외를
+ * 던지면 아직 시작하지 않은 작업은 실행하지 않고, WaitFor에서 해당 예외를
+ * 다시 던짐.
+ *
+ * 소멸 시 아직 시작하지 않은 작업을 취소하고 실행 중인 작업이 끝날 때까지
+ * 대기함
+ */
+class BACKTESTING_API IndicatorScheduler final {
+ public:
+  IndicatorScheduler() = default;
+  ~IndicatorScheduler();
+
+  IndicatorScheduler(const IndicatorScheduler&) = delete;
+  IndicatorScheduler& operator=(const IndicatorScheduler&) = delete;
+
+  /**
+   * 작업을 추가하는 함수. Start 전에만 호출 가능
+   * @param task 실행할 작업
+   * @param dependencies 먼저 완료되어야 하는 작업들의 인덱스.
+   *                     이 작업보다 먼저 추가된 작업이어야 함
+   * @return 추가된 작업의 인덱스
+   */
+  size_t AddTask(function<void()> task, const vector<size_t>& dependencies);
+
+  /// 지정된 개수의 스레드로 작업 실행을 시작하는 함수
+  void Start(size_t num_threads);
+
+  /**
+   * 모든 작업이 끝날 때까지 최대 timeout만큼 대기하는 함수.
+   * 실패한 작업이 있으면 남은 작업이 정리된 뒤 해당 예외를 다시 던짐
+   * @return 모든 작업이 끝났는지 여부
+   */
+  bool WaitFor(chrono::milliseconds timeout);
+
+  /// 아직 시작하지 않은 작업을 취소하고 실행 중인 작업이 끝날 때까지
+  /// 대기하는 함수
+  void Cancel();
+
+  /// 추가된 작업의 개수를 반환하는 함수
+  [[nodiscard]] size_t GetNumTasks() const;
+
+ private:
+  struct Task {
+    function<void()> run;
+    vector<size_t> dependents;  // 이 작업이 끝나야 실행 가능한 작업들
+    size_t num_dependencies;    // 아직 끝나지 않은 의존 작업 개수
+  };
+
+  vector<Task> tasks_;
+
+  // 실행 가능한 작업. 인덱스가 작은 작업부터 실행
+  priority_queue<size_t, vector<size_t>, greater<>> ready_tasks_;
+
+  mutex mutex_;
+  condition_variable ready_cv_;     // 실행 가능한 작업 또는 종료 알림
+  condition_variable finished_cv_;  // 작업 완료 알림
+
+  vector<thread> workers_;
+  size_t num_running_ = 0;   // 실행 중인 작업 개수
+  size_t num_finished_ = 0;  // 완료된 작업 개수
+  bool is_stopping_ = false;
+  exception_ptr error_;  // 처음 실패한 작업의 예외
+
+  /// 실행 가능한 작업을 꺼내 실행하는 스레드 함수
+  void RunWorker();
+
+  /// 작업 스레드들이 모두 종료될 때까지 대기하는 함수
+  void JoinWorkers();
+};
+
+}  // namespace backtesting::indicator
@@ -0,0 +1,131 @@
+#pragma once
+
+// 표준 라이브러리
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// 내부 헤더
+#include "Engines/Export.hpp"
+
+// 네임 스페이스
+using namespace std;
+
+namespace backtesting::indicator {
+
+/**
+ * 지표의 한 심볼 계산 상태를 바이트 열로 기록하고 읽는 클래스.
+ *
+ * 지표의 SaveState에서 Write로 멤버 변수들을 기록하고, LoadState에서 같은
+ * 순서로 Read하여 복구함. 기록된 값보다 많이 읽으면 예외가 발생하며,
+ * 이 경우 해당 심볼은 처음부터 다시 계산됨
+ */
+class BACKTESTING_API IndicatorState final {
+ public:
+  IndicatorState() = default;
+  explicit IndicatorState(vector<uint8_t> data);
+
+  /// 값 하나를 기록하는 함수
+  template <typename T>
+    requires is_trivially_copyable_v<T>
+  void Write(const T& value) {
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+    data_.insert(data_.end(), bytes, bytes + sizeof(T));
+  }
+
+  /// 벡터의 크기와 모든 값을 기록하는 함수
+  template <typename T>
+    requires is_trivially_copyable_v<T>
+  void Write(const vector<T>& values) {
+    Write(static_cast<uint64_t>(values.size()));
+
+    const auto* bytes = reinterpret_cast<const uint8_t*>(values.data());
+    data_.insert(data_.end(), bytes, bytes + values.size() * sizeof(T));
+  }
+
+  /// 값 하나를 읽는 함수
+  template <typename T>
+    requires is_trivially_copyable_v<T>
+  void Read(T& value) {
+    ReadBytes(&value, sizeof(T));
+  }
+
+  /// 벡터의 크기와 모든 값을 읽는 함수
+  template <typename T>
+    requires is_trivially_copyable_v<T>
+  void Read(vector<T>& values) {
+    uint64_t size;
+    Read(size);
+
+    if (size > (data_.size() - read_offset_) / sizeof(T)) {
+      throw runtime_error("지표 상태의 벡터 크기가 기록된 크기를 넘습니다.");
+    }
+
+    values.resize(size);
+    ReadBytes(values.data(), size * sizeof(T));
+  }
+
+  /// 기록된 바이트 열을 반환하는 함수
+  [[nodiscard]] const vector<uint8_t>& GetData() const;
+
+  /// 기록된 바이트 열을 이동하여 반환하는 함수
+  [[nodiscard]] vector<uint8_t> Release();
+
+ private:
+  vector<uint8_t> data_;
+  size_t read_offset_ = 0;
+
+  /// 읽기 위치에서 바이트 열을 복사하고 읽기 위치를 이동하는 함수
+  void ReadBytes(void* destination, size_t size);
+};
+
+/**
+ * 지표의 심볼별 계산 상태 스냅샷을 파일로 저장하고 불러오는 클래스.
+ *
+ * 스냅샷은 저장 시점의 심볼별 바 개수와 해당 바들의 해시, 마지막 바까지
+ * 계산한 상태, 그리고 그 시점의 계산 값이 저장된 캐시 파일의 키를 가짐.
+ * 다음 실행에서 바 데이터의 앞부분이 저장 시점의 바들과 같으면 저장된
+ * 계산 값을 복사하고, 상태를 복구하여 추가된 바만 계산함.
+ *
+ * ※ 스냅샷 파일 형식 ※\n
+ * [식별자 8바이트][버전 uint32][키 크기 uint32][심볼 개수 uint64][키]
+ * [계산 값 캐시 키 크기 uint64][계산 값 캐시 키]
+ * [바 개수 uint64][바 해시 uint64][상태 크기 uint64][상태] × 심볼 개수
+ */
+class BACKTESTING_API IndicatorSnapshot final {
+ public:
+  /// 한 심볼의 스냅샷
+  struct Symbol {
+    uint64_t num_bars;      // 저장 시점의 바 개수
+    uint64_t bars_hash;     // 저장 시점까지의 바 해시
+    vector<uint8_t> state;  // 마지막 바까지 계산한 상태
+  };
+
+  string output_key;       // 저장 시점의 계산 값이 저장된 캐시 파일의 키
+  vector<Symbol> symbols;  // 심볼별 스냅샷
+
+  /**
+   * 스냅샷 파일을 불러오는 함수
+   * @param path 스냅샷 파일 경로
+   * @param key 스냅샷 파일에 기록되어 있어야 하는 스냅샷 키
+   * @return 불러온 스냅샷. 파일이 없거나 형식 또는 키가 다르면 nullptr
+   */
+  [[nodiscard]] static shared_ptr<IndicatorSnapshot> Load(const string& path,
+                                                          const string& key);
+
+  /**
+   * 스냅샷을 파일로 저장하는 함수.
+   * 임시 파일에 기록한 뒤 이름을 바꾸므로 중단되어도 손상된 파일이 남지 않음
+   * @param path 스냅샷 파일 경로
+   * @param key 스냅샷 파일에 기록할 스냅샷 키
+   * @return 저장 성공 여부
+   */
+  [[nodiscard]] bool Save(const string& path, const string& key) const;
+};
+
+}  // namespace backtesting::indicator
@@ -0,0 +1,63 @@
+#pragma once
+
+// 표준 라이브러리
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+// 외부 라이브러리
+#include "nlohmann/json.hpp"
+
+// 내부 헤더
+#include "Engines/Export.hpp"
+
+// 네임 스페이스
+using namespace std;
+using namespace nlohmann;
+
+namespace backtesting::engine {
+
+/// 파싱된 Json 파일
+struct CachedJsonFile {
+  json data;
+
+  /// 심볼 이름 → Json 배열 내 인덱스. 인덱서 없이 불러오면 비어있음
+  unordered_map<string, size_t> symbol_indices;
+};
+
+/**
+ * 파싱된 Json 파일을 프로세스에 상주시키는 캐시 클래스.
+ *
+ * 파일은 경로별로 마지막 수정 시각과 크기를 함께 저장하며, 둘 중 하나라도
+ * 바뀌었을 때만 다시 파싱함. 따라서 서버 모드에서 같은 파일을 사용하는
+ * 연속된 백테스팅은 파싱과 심볼 인덱스 생성을 건너뜀.
+ *
+ * 캐시된 Json은 공유되므로 읽기 전용으로만 사용해야 함
+ */
+class BACKTESTING_API JsonFileCache final {
+ public:
+  JsonFileCache() = delete;
+
+  /// 파싱된 Json으로 심볼 이름 → 배열 인덱스를 만드는 함수
+  using Indexer = function<unordered_map<string, size_t>(const json&)>;
+
+  /**
+   * 파일을 파싱한 Json을 반환하는 함수.
+   * 파일이 마지막 파싱 후 바뀌지 않았으면 캐시된 Json을 반환
+   *
+   * @param path Json 파일 경로
+   * @param description 오류 메시지에 사용할 파일 설명 (예: 거래소 정보)
+   * @param indexer 다시 파싱했을 때 심볼 인덱스를 만드는 함수
+   * @param reused 캐시된 Json을 재사용했는지 여부를 받을 포인터
+   */
+  [[nodiscard]] static shared_ptr<const CachedJsonFile> Load(
+      const string& path, const string& description,
+      const Indexer& indexer = nullptr, bool* reused = nullptr);
+
+  /// 캐시된 모든 Json을 제거하는 함수
+  static void Clear();
+};
+
+}  // namespace backtesting::engine
@@ -0,0 +1,118 @@
+#pragma once
+
+// 표준 라이브러리
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// 내부 헤더
+#include "Engines/Export.hpp"
+
+// 전방 선언
+namespace arrow {
+class Table;
+}
+
+// 네임 스페이스
+using namespace std;
+
+namespace backtesting::utils {
+
+/// 캔들스틱 데이터셋을 구성하는 Parquet 파일 하나의 정보
+struct KlinePart {
+  string file_name;  // 기본 파일은 기본 파일 이름, 조각은 조각 폴더 기준 이름
+  int64_t num_rows;
+  int64_t first_open_time;
+  int64_t last_open_time;
+  int64_t last_close_time;
+};
+
+/// 기본 파일과 그 뒤에 이어지는 조각 파일들의 목록
+struct BACKTESTING_API KlineManifest {
+  KlinePart base;
+  vector<KlinePart> fragments;
+
+  /// 데이터셋 전체의 캔들 수를 반환하는 함수
+  [[nodiscard]] int64_t GetNumRows() const;
+
+  /// 데이터셋의 마지막 캔들을 반환하는 함수
+  [[nodiscard]] const KlinePart& GetLastPart() const;
+};
+
+/**
+ * 캔들스틱 Parquet 파일을 기본 파일과 추가분 조각 파일들로 나눠 저장하는
+ * 데이터셋 클래스.
+ *
+ * 기본 파일(예: 1h.parquet)은 기존 경로를 그대로 사용하고, 업데이트로 받은
+ * 캔들은 기본 파일 옆의 조각 폴더(예: 1h.fragments)에 새 파일로만 저장함.
+ * 어떤 조각이 유효한지는 기본 파일 옆의 매니페스트(예: 1h.manifest.json)에
+ * 기록하므로 업데이트 시 기존 데이터를 읽거나 다시 쓰지 않음.
+ *
+ * 조각 수가 max_fragments에 도달하면 모든 조각을 기본 파일로 합침.
+ * 매니페스트가 없으면 기본 파일만으로 이루어진 데이터셋으로 취급하므로
+ * 직접 만든 Parquet 파일도 그대로 읽을 수 있음.
+ */
+class BACKTESTING_API KlineDataset final {
+ public:
+  KlineDataset() = delete;
+
+  /// 기본 파일로 합치기 전까지 유지할 최대 조각 수
+  static constexpr size_t max_fragments = 32;
+
+  /**
+   * 테이블을 기본 파일로 저장하고 매니페스트를 기본 파일만으로 초기화하는
+   * 함수. 기존 조각은 모두 삭제함.
+   *
+   * 테이블의 0번 열은 Open Time, 6번 열은 Close Time이어야 함.
+   *
+   * @param table 저장할 캔들스틱 테이블
+   * @param base_path 기본 파일 경로
+   * @param save_split_files 차트용 분할 파일을 저장할지 결정하는 플래그
+   * @param reset_directory 저장 폴더를 초기화하고 저장하는지 결정하는 플래그
+   */
+  static void WriteBase(const shared_ptr<arrow::Table>& table,
+                        const string& base_path, bool save_split_files,
+                        bool reset_directory);
+
+  /**
+   * 마지막 캔들 이후의 캔들들을 조각 파일로 추가하는 함수.
+   * 조각 수가 max_fragments에 도달하면 기본 파일로 합침
+   *
+   * @param table 추가할 캔들스틱 테이블. 기본 파일과 스키마가 같아야 함
+   * @param base_path 기본 파일 경로
+   * @param save_split_files 차트용 분할 파일을 저장할지 결정하는 플래그
+   * @param reset_directory 합칠 때 저장 폴더를 초기화하는지 결정하는 플래그
+   */
+  static void Append(const shared_ptr<arrow::Table>& table,
+                     const string& base_path, bool save_split_files,
+                     bool reset_directory);
+
+  /**
+   * 매니페스트를 읽어 반환하는 함수.
+   *
+   * 매니페스트가 없으면 기본 파일의 Open Time과 Close Time 열만 읽어 만든 후
+   * 저장함.
+   */
+  [[nodiscard]] static KlineManifest LoadManifest(const string& base_path);
+
+  /**
+   * 기본 파일과 조각 파일들을 병렬로 읽어 하나의 청크로 합친 테이블을
+   * 반환하는 함수
+   *
+   * @param base_paths 기본 파일 경로 목록
+   * @param column_indices 읽을 컬럼의 인덱스 목록 (빈 벡터면 모든 컬럼 읽기)
+   * @return 기본 파일 경로 순서대로 합쳐진 테이블들
+   */
+  [[nodiscard]] static vector<shared_ptr<arrow::Table>> ReadBatch(
+      const vector<string>& base_paths, const vector<int>& column_indices);
+
+  /// 기본 파일 경로에 대한 매니페스트 경로를 반환하는 함수
+  [[nodiscard]] static string GetManifestPath(const string& base_path);
+
+  /// 기본 파일 경로에 대한 조각 폴더 경로를 반환하는 함수
+  [[nodiscard]] static string GetFragmentDirectory(const string& base_path);
+};
+
+}  // namespace backtesting::utils
@@ -0,0 +1,66 @@
+#pragma once
+
+// 표준 라이브러리
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+// 내부 헤더
+#include "Engines/Export.hpp"
+
+// 전방 선언
+namespace arrow {
+class Array;
+}
+
+// 네임 스페이스
+using namespace std;
+
+namespace backtesting::fetcher {
+
+/// 캔들스틱 데이터를 열별로 저장하는 구조체. 모든 열의 길이는 같음
+struct BACKTESTING_API KlineColumns {
+  vector<int64_t> open_time;
+  vector<double> open;
+  vector<double> high;
+  vector<double> low;
+  vector<double> close;
+  vector<double> volume;
+  vector<int64_t> close_time;
+
+  /// 캔들 수를 반환하는 함수
+  [[nodiscard]] size_t Size() const;
+
+  /// 캔들이 없는지 여부를 반환하는 함수
+  [[nodiscard]] bool Empty() const;
+
+  /// 다른 캔들스틱 데이터를 뒤에 이어 붙이는 함수
+  void Append(const KlineColumns& other);
+
+  /// 마지막 캔들을 제거하는 함수. 비어있으면 아무 것도 하지 않음
+  void PopBack();
+
+  /// 모든 열을 Open Time, OHLCV, Close Time 순서의 Arrow Array로 변환하는
+  /// 함수
+  [[nodiscard]] vector<shared_ptr<arrow::Array>> ToArrays() const;
+};
+
+/**
+ * 바이낸스 캔들스틱 응답 본문을 Json 트리 없이 열별 버퍼에 바로 추가하는
+ * 함수.
+ *
+ * 응답은 [[Open Time, "Open", "High", "Low", "Close", "Volume", Close Time,
+ * ...], ...] 형식이며, 가격과 거래량은 문자열로 들어오므로 double로 변환함.
+ * 8번째 이후 필드는 무시함. SAX 방식으로 파싱하므로 추가로 사용하는 메모리는
+ * 응답 본문 크기에 비례함.
+ *
+ * @param body 응답 본문
+ * @param columns 캔들을 추가할 열별 버퍼
+ * @return 본문이 캔들스틱 배열이면 true, 오류 응답 등 객체이면 false.
+ *         형식이 잘못된 경우 runtime_error를 던짐
+ */
+BACKTESTING_API bool ParseKlines(string_view body, KlineColumns& columns);
+
+}  // namespace backtesting::fetcher
@@ -15,14 +15,23 @@
 // 표준 라이브러리
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <format>
 #include <fstream>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
 #include <thread>
+#include <tuple>
+#include <type_traits>
 
 // 내부 헤더
 #include "Engines/Export.hpp"
+#include "Engines/MappedLogFile.hpp"
 
 // 전방 선언
 namespace backtesting::analyzer {
@@ -78,9 +87,238 @@ namespace backtesting::logger {
 enum class LogLevel { DEBUG_L, INFO_L, WARN_L, ERROR_L, BALANCE_L };
 using enum LogLevel;
 
+/// 컴파일 타임 최소 로그 레벨 (0: DEBUG, 1: INFO, 2: WARN, 3: ERROR).
+/// 이 값보다 낮은 레벨의 LOG_DEFERRED 호출은 인자 생성까지 통째로 제거됨
+#ifndef BACKTESTING_MIN_LOG_LEVEL
+#define BACKTESTING_MIN_LOG_LEVEL 0
+#endif
+
+/// 로그 레벨의 필터링 순위를 반환하는 함수.
+/// BALANCE는 INFO와 같은 파일에 기록되므로 INFO와 같은 순위로 취급
+constexpr int GetLogLevelRank(const LogLevel level) {
+  return level == BALANCE_L ? static_cast<int>(INFO_L)
+                            : static_cast<int>(level);
+}
+
+/**
+ * 지연 포맷팅 로그를 기록하는 매크로.
+ *
+ * 포맷 문자열과 파일/라인 정보는 호출 지점마다 하나씩 생성되는 정적 LogSite에
+ * 저장되고, 인자는 원본 그대로 스레드별 링 버퍼에 복사되어 백그라운드
+ * 스레드에서 포맷팅됨.
+ *
+ * 레벨이 컴파일 타임 혹은 런타임 필터에 걸리면 인자 표현식은 평가되지 않음.
+ * 포맷 문자열은 문자열 리터럴이어야 하며, 인자와의 호환성은 컴파일 타임에
+ * 검사됨.
+ */
+#define LOG_DEFERRED(logger_ptr, log_level, fmt, ...) \
+  LOG_DEFERRED_IMPL(logger_ptr, log_level, false, fmt, ##__VA_ARGS__)
+
+/// 콘솔에도 출력하는 LOG_DEFERRED 매크로.
+/// 콘솔 출력 역시 백그라운드 스레드에서 진행됨
+#define LOG_DEFERRED_CONSOLE(logger_ptr, log_level, fmt, ...) \
+  LOG_DEFERRED_IMPL(logger_ptr, log_level, true, fmt, ##__VA_ARGS__)
+
+#define LOG_DEFERRED_IMPL(logger_ptr, log_level, to_console, fmt, ...)        \
+  do {                                                                        \
+    if constexpr (backtesting::logger::GetLogLevelRank(log_level) >=          \
+                  BACKTESTING_MIN_LOG_LEVEL) {                                \
+      if ((logger_ptr)->IsLevelEnabled(log_level)) {                          \
+        static constexpr backtesting::logger::LogSite log_site{               \
+            log_level, fmt, __FILE__, __LINE__, to_console};                  \
+        (logger_ptr)->LogDeferred(log_site, ##__VA_ARGS__);                   \
+      }                                                                       \
+    }                                                                         \
+    if (false) {                                                              \
+      (void)std::format(fmt, ##__VA_ARGS__); /* 컴파일 타임 포맷 검사 전용 */ \
+    }                                                                         \
+  } while (false)
+
+/**
+ * 지연 포맷팅 로그의 호출 지점 정보를 담는 구조체.
+ *
+ * 호출 지점마다 정적 객체로 하나만 존재하므로 객체의 주소가 곧
+ * 포맷 문자열 및 파일/라인의 ID 역할을 함
+ */
+struct LogSite {
+  LogLevel level;      // 로그 레벨
+  const char* format;  // std::format 형식의 포맷 문자열
+  const char* file;    // 로그가 생성된 파일 (__FILE__)
+  int line;            // 로그가 생성된 라인 (__LINE__)
+  bool log_to_console;  // 콘솔에 로그를 출력할지 결정하는 플래그
+};
+
+/**
+ * 링 버퍼에 저장되는 고정 크기 바이너리 로그 레코드.
+ *
+ * 포맷팅되지 않은 인자를 그대로 저장하며, 백그라운드 스레드에서
+ * format_fn을 통해 문자열로 복원됨.
+ *
+ * format_fn이 nullptr이면 생산자 스레드에서 포맷팅을 마친 라인이며,
+ * args_size 바이트의 라인이 이어지는 슬롯들의 args에 나뉘어 저장됨
+ */
+struct alignas(64) LogRecord {
+  static constexpr size_t record_size = 256;
+  static constexpr size_t header_size = 40;
+  static constexpr size_t args_capacity = record_size - header_size;
+
+  // 백테스팅 진행 중이 아닐 때의 바 시각
+  static constexpr int64_t no_bar_time = INT64_MIN;
+
+  const LogSite* site;  // 호출 지점
+  void (*format_fn)(const LogRecord& record, string& out);  // 인자 포맷 함수
+  int64_t timestamp;     // 로그 발생 시각 (초 단위 time_t)
+  int64_t bar_time;      // 로그 발생 시점의 바 Open Time (Unix Timestamp ms)
+  uint32_t args_size;    // 저장된 인자 바이트 수
+  uint32_t run_id;       // 로그를 발생시킨 실행 ID (0이면 기본 로그)
+  char args[args_capacity];
+};
+
+static_assert(sizeof(LogRecord) == LogRecord::record_size);
+
+/**
+ * 생산자 스레드 하나와 백그라운드 스레드 하나가 공유하는 SPSC 링 버퍼.
+ *
+ * 생산자 스레드마다 하나씩 할당되므로 전체적으로는 락 없는 MPSC 큐로 동작
+ */
+struct alignas(64) LogRecordRing {
+  static constexpr size_t capacity = 4096;  // 레코드 개수 (2의 거듭제곱)
+  static constexpr size_t wake_threshold = capacity / 4;  // 소비자 기상 기준
+
+  LogRecord records[capacity];
+  alignas(64) atomic<size_t> head{0};  // 생산자 쓰기 위치
+  alignas(64) atomic<size_t> tail{0};  // 소비자 읽기 위치
+  alignas(64) atomic<bool> in_use{false};  // 생산자 스레드 생존 여부
+
+  /// 다음에 쓸 레코드 슬롯을 반환하는 함수. 가득 찼으면 nullptr 반환
+  [[nodiscard]] LogRecord* TryReserve() noexcept {
+    const size_t current_head = head.load(memory_order_relaxed);
+
+    if (UNLIKELY(current_head - tail.load(memory_order_acquire) >= capacity)) {
+      return nullptr;
+    }
+
+    return &records[current_head & (capacity - 1)];
+  }
+
+  /// 연속된 num_slots개의 슬롯을 예약하고 첫 슬롯의 위치를 position에
+  /// 저장하는 함수. 공간이 부족하면 false 반환
+  [[nodiscard]] bool TryReserve(const size_t num_slots,
+                                size_t& position) noexcept {
+    const size_t current_head = head.load(memory_order_relaxed);
+
+    if (UNLIKELY(current_head + num_slots - tail.load(memory_order_acquire) >
+                 capacity)) {
+      return false;
+    }
+
+    position = current_head;
+    return true;
+  }
+
+  /// 위치에 해당하는 레코드 슬롯을 반환하는 함수
+  [[nodiscard]] LogRecord& At(const size_t position) noexcept {
+    return records[position & (capacity - 1)];
+  }
+
+  /// 예약한 슬롯들의 쓰기를 완료하고 대기 중인 레코드 수를 반환하는 함수
+  size_t Commit(const size_t num_slots = 1) noexcept {
+    const size_t next_head = head.load(memory_order_relaxed) + num_slots;
+    head.store(next_head, memory_order_release);
+
+    return next_head - tail.load(memory_order_relaxed);
+  }
+};
+
+namespace log_detail {
+
+/// 문자열 계열 타입인지 판단하는 컨셉
+template <typename T>
+concept StringLike = is_convertible_v<const T&, string_view>;
+
+/// 인자 하나를 레코드에 직렬화/역직렬화하는 코덱.
+/// 문자열은 [길이 + 문자]로, 그 외 타입은 trivially copyable 값 그대로 저장
+template <typename T>
+struct ArgCodec {
+  static_assert(is_trivially_copyable_v<T>,
+                "LOG_DEFERRED 인자는 문자열이거나 trivially copyable "
+                "타입이어야 합니다.");
+
+  using Decoded = T;
+
+  static bool Encode(char*& dst, const char* end, const T& value) noexcept {
+    if (UNLIKELY(dst + sizeof(T) > end)) {
+      return false;
+    }
+
+    memcpy(dst, &value, sizeof(T));
+    dst += sizeof(T);
+    return true;
+  }
+
+  static T Decode(const char*& src) noexcept {
+    T value;
+    memcpy(&value, src, sizeof(T));
+    src += sizeof(T);
+    return value;
+  }
+};
+
+template <typename T>
+  requires StringLike<T>
+struct ArgCodec<T> {
+  using Decoded = string_view;
+
+  static bool Encode(char*& dst, const char* end, const T& value) noexcept {
+    const string_view sv(value);
+    const auto len = static_cast<uint32_t>(sv.size());
+
+    if (UNLIKELY(dst + sizeof(len) + len > end)) {
+      return false;
+    }
+
+    memcpy(dst, &len, sizeof(len));
+    memcpy(dst + sizeof(len), sv.data(), len);
+    dst += sizeof(len) + len;
+    return true;
+  }
+
+  static string_view Decode(const char*& src) noexcept {
+    uint32_t len;
+    memcpy(&len, src, sizeof(len));
+
+    const string_view sv(src + sizeof(len), len);
+    src += sizeof(len) + len;
+    return sv;
+  }
+};
+
+/// 레코드의 인자를 복원하여 포맷 문자열에 적용하는 함수.
+/// 인스턴스의 주소가 레코드에 저장되어 백그라운드 스레드에서 호출됨
+template <typename... Args>
+void FormatRecord(const LogRecord& record, string& out) {
+  const char* src = record.args;
+
+  // 중괄호 초기화는 왼쪽에서 오른쪽 평가 순서가 보장되므로 순차 역직렬화 가능
+  const tuple<typename ArgCodec<Args>::Decoded...> decoded{
+      ArgCodec<Args>::Decode(src)...};
+
+  apply(
+      [&](const auto&... values) {
+        vformat_to(back_inserter(out), record.site->format,
+                   make_format_args(values...));
+      },
+      decoded);
+}
+
+}  // namespace log_detail
+
 /**
  * 하드웨어 레벨 최적화된 고성능 비동기 로깅 버퍼
  * 멀티 버퍼링과 캐시 라인 정렬을 통한 극한 성능 최적화
+ *
+ * 쓰기는 Logger의 쓰기 락을 보유한 스레드만 가능하며,
+ * 플러시 대기 중인 버퍼는 백그라운드 스레드가 단독으로 소유함
  */
 struct BACKTESTING_API alignas(64) FastLogBuffer {
   static constexpr size_t buffer_size =
@@ -135,7 +373,9 @@ struct BACKTESTING_API alignas(64) FastLogBuffer {
      */
     void reset() noexcept {
       write_pos.store(0, memory_order_relaxed);
-      ready_to_flush.store(false, memory_order_relaxed);
+
+      // 생산자가 플래그를 확인한 후 비워진 위치를 보도록 release로 저장
+      ready_to_flush.store(false, memory_order_release);
     }
   };
 
@@ -160,17 +400,18 @@ struct BACKTESTING_API alignas(64) FastLogBuffer {
       return true;
     }
 
-    // 버퍼 전환 (Relaxed ordering으로 최적화)
-    if (const size_t next_buf = (buf_idx + 1) % max_buffers;
-        current_buffer.compare_exchange_weak(const_cast<size_t&>(buf_idx),
-                                             next_buf, memory_order_relaxed,
-                                             memory_order_relaxed)) {
-      buffer.ready_to_flush.store(true, memory_order_release);
-      PREFETCH_WRITE(&buffers[next_buf]);
+    // 다음 버퍼가 아직 플러시 중이라면 덮어쓰지 않도록 전환하지 않음
+    const size_t next_buf = (buf_idx + 1) % max_buffers;
+    if (UNLIKELY(buffers[next_buf].ready_to_flush.load(memory_order_acquire))) {
+      return false;
     }
 
-    const size_t new_buf_idx = current_buffer.load(memory_order_relaxed);
-    return buffers[new_buf_idx].try_write(msg, len);
+    // 버퍼 전환
+    buffer.ready_to_flush.store(true, memory_order_release);
+    current_buffer.store(next_buf, memory_order_release);
+    PREFETCH_WRITE(&buffers[next_buf]);
+
+    return buffers[next_buf].try_write(msg, len);
   }
 };
 
@@ -213,7 +454,11 @@ class BACKTESTING_API Logger final {
       const string& backtesting_log_name = "backtesting.log");
 
   /**
-   * 지정된 로그 레벨과 파일 및 라인 정보를 사용하여 메시지를 기록하는 함수
+   * 지정된 로그 레벨과 파일 및 라인 정보를 사용하여 메시지를 기록하는 함수.
+   *
+   * 라인은 호출 스레드에서 포맷팅되지만 LOG_DEFERRED와 같은 스레드별 링
+   * 버퍼를 거쳐 기록되므로 같은 스레드의 지연 로그와 순서가 유지됨
+   *
    * @param log_level 로그 메시지의 레벨
    * @param message 기록할 로그 메시지
    * @param file 로그가 생성된 파일의 이름. __FILE__로 지정
@@ -232,6 +477,96 @@ class BACKTESTING_API Logger final {
   void LogNoFormat(const LogLevel& log_level, const string& message,
                    bool log_to_console = false);
 
+  /**
+   * 포맷팅 없이 바이너리 레코드로 로그를 기록하는 함수.
+   * 직접 호출하지 않고 LOG_DEFERRED 매크로를 통해 호출해야 함
+   *
+   * 인자는 스레드별 링 버퍼에 그대로 복사되고 포맷팅은 백그라운드 스레드에서
+   * 진행됨. 링 버퍼가 가득 찼거나 인자가 레코드 크기를 초과하면
+   * 즉시 포맷팅하여 Log 함수로 기록함
+   *
+   * @param site 호출 지점 정보
+   * @param args 포맷 인자들
+   */
+  template <typename... Args>
+  void LogDeferred(const LogSite& site, const Args&... args) {
+    LogRecordRing* ring = GetThreadRecordRing();
+
+    if (LogRecord* record = ring ? ring->TryReserve() : nullptr) [[likely]] {
+      char* dst = record->args;
+      const char* end = record->args + LogRecord::args_capacity;
+
+      if ((log_detail::ArgCodec<decay_t<Args>>::Encode(dst, end, args) &&
+           ...)) [[likely]] {
+        record->site = &site;
+        record->format_fn = &log_detail::FormatRecord<decay_t<Args>...>;
+        record->timestamp = chrono::system_clock::to_time_t(
+            chrono::system_clock::now());
+        record->args_size = static_cast<uint32_t>(dst - record->args);
+        record->run_id = GetThreadRunId();
+        record->bar_time = GetThreadBarTime();
+
+        // 일정 개수 이상 쌓였을 때만 백그라운드 스레드를 깨움
+        if (ring->Commit() == LogRecordRing::wake_threshold) [[unlikely]] {
+          NotifyLoggingThread();
+        }
+
+        return;
+      }
+    }
+
+    // 레코드에 담을 수 없는 경우 즉시 포맷팅
+    Log(site.level, vformat(site.format, make_format_args(args...)), site.file,
+        site.line, site.log_to_console);
+  }
+
+  /// 지정된 로그 레벨이 런타임 필터를 통과하는지 반환하는 함수
+  [[nodiscard]] static bool IsLevelEnabled(const LogLevel log_level) {
+    return GetLogLevelRank(log_level) >=
+           min_log_level_.load(memory_order_relaxed);
+  }
+
+  /// LOG_DEFERRED로 기록할 최소 로그 레벨을 런타임에 설정하는 함수
+  static void SetMinLogLevel(LogLevel log_level);
+
+  /// 동시에 등록 가능한 실행의 최대 개수
+  static constexpr uint32_t max_log_runs = 64;
+
+  /**
+   * 동시에 진행되는 백테스팅 실행의 로그 라우팅을 등록하는 함수.
+   *
+   * 반환된 실행 ID가 설정된 스레드의 로그는 실행 태그가 붙어 공용 레벨별
+   * 로그에 기록되고, 백테스팅 로그는 공용 파일 대신 실행 전용 파일에 기록됨
+   *
+   * @param run_tag 로그 라인에 붙일 실행 태그
+   * @param run_log_path 실행 전용 백테스팅 로그 파일 경로
+   * @return 실행 ID (1 이상)
+   */
+  uint32_t RegisterRun(const string& run_tag, const string& run_log_path);
+
+  /**
+   * 실행의 남은 로그를 모두 기록하고 실행 전용 파일을 닫는 함수.
+   * 해당 실행의 모든 스레드가 로깅을 마친 후 호출해야 함
+   * @param run_id RegisterRun이 반환한 실행 ID
+   */
+  void UnregisterRun(uint32_t run_id);
+
+  /// 현재 스레드의 실행 ID를 설정하는 함수. 0이면 기본 로그로 라우팅
+  static void SetThreadRunId(uint32_t run_id);
+
+  /// 현재 스레드의 실행 ID를 반환하는 함수
+  [[nodiscard]] static uint32_t GetThreadRunId();
+
+  /**
+   * 현재 스레드가 진행 중인 바의 Open Time을 설정하는 함수.
+   * 설정된 동안의 로그 라인에는 바 시각이 붙어 백테스팅 기간으로 조회 가능
+   * @param bar_time 바 Open Time. LogRecord::no_bar_time이면 생략
+   */
+  static void SetThreadBarTime(int64_t bar_time);
+
+  /// 현재 스레드가 진행 중인 바의 Open Time을 반환하는 함수
+  [[nodiscard]] static int64_t GetThreadBarTime();
+
   /**
    * 로거 소멸자 - 백그라운드 쓰레드 정리
    */
@@ -274,12 +609,34 @@ class BACKTESTING_API Logger final {
   ofstream info_log_;
   ofstream warn_log_;
   ofstream error_log_;
-  ofstream backtesting_log_;
+  MappedLogFile backtesting_log_;  // 인덱스 조회를 위해 메모리 매핑으로 기록
 
   // 백그라운드 스레드 관리
   atomic<bool> stop_logging_;
   thread logging_thread_;
 
+  // 백그라운드 스레드 대기/기상 관리
+  mutex wake_mutex_;
+  condition_variable wake_cv_;
+  atomic<bool> logging_thread_sleeping_;
+
+  // LOG_DEFERRED 런타임 최소 로그 레벨 순위
+  static atomic<int> min_log_level_;
+
+  // 링 버퍼 소비는 한 번에 한 스레드만 가능하므로 소비 구간 보호
+  mutex drain_mutex_;
+
+  // 로그 버퍼 쓰기 락 (잠금 순서: run_sinks_mutex_ → write_mutex_ →
+  // file_mutex_). 링 버퍼를 소비하는 스레드와 링 버퍼를 사용할 수 없는
+  // 드문 경우에만 잠기므로 생산자끼리는 경합하지 않음
+  mutex write_mutex_;
+
+  // 파일 스트림 쓰기 락
+  mutex file_mutex_;
+
+  // 실행 등록/해제 및 실행 전용 버퍼 플러시 보호
+  mutex run_sinks_mutex_;
+
   /// Logger의 리소스를 안전하게 해제하는 함수
   void Shutdown();
 
@@ -304,21 +661,44 @@ class BACKTESTING_API Logger final {
    */
   void ProcessMultiBuffer();
 
+  /**
+   * 포맷팅을 마친 라인을 현재 스레드의 링 버퍼에 넣는 함수.
+   *
+   * 링 버퍼가 가득 차면 직접 소비하여 공간을 만들고, 링 버퍼를 사용할 수
+   * 없으면 대기 중인 레코드를 먼저 기록한 후 로그 버퍼에 바로 씀
+   *
+   * @param log_level 로그 레벨
+   * @param data 쓰기할 데이터
+   * @param len 데이터 길이
+   * @param run_id 백테스팅 로그를 라우팅할 실행 ID
+   */
+  void StageLine(LogLevel log_level, const char* data, size_t len,
+                 uint32_t run_id);
+
   /**
    * 하드웨어 레벨 최적화된 버퍼 쓰기 함수
    * @param log_level 로그 레벨
    * @param data 쓰기할 데이터
    * @param len 데이터 길이
+   * @param run_id 백테스팅 로그를 라우팅할 실행 ID
    */
-  void WriteToBuffersFast(LogLevel log_level, const char* data, size_t len);
+  void WriteToBuffersFast(LogLevel log_level, const char* data, size_t len,
+                          uint32_t run_id);
 
   /**
    * 버퍼가 플러시 준비되었는지 확인하고 플러시하는 함수
    * @param buffer 확인할 버퍼
-   * @param file 쓰기할 파일 스트림
+   * @param file 쓰기할 파일 (ofstream 혹은 MappedLogFile)
    * @return 플러시 작업 수행 여부
    */
-  static bool FlushBufferIfReady(FastLogBuffer& buffer, ofstream& file);
+  template <typename LogFile>
+  bool FlushBufferIfReady(FastLogBuffer& buffer, LogFile& file);
+
+  /**
+   * 등록된 실행들의 전용 버퍼 중 플러시 준비된 버퍼를 플러시하는 함수
+   * @return 플러시 작업 수행 여부
+   */
+  bool FlushRunBuffersIfReady();
 
   /**
    * 모든 버퍼를 플러시하는 함수
@@ -329,23 +709,52 @@ class BACKTESTING_API Logger final {
    * 지정된 버퍼 인덱스의 버퍼를 플러시하는 함수
    * @param buffer 플러시할 버퍼
    * @param buffer_idx 버퍼 인덱스
-   * @param file 쓰기할 파일 스트림
+   * @param file 쓰기할 파일 (ofstream 혹은 MappedLogFile)
    */
+  template <typename LogFile>
   static void FlushBuffer(FastLogBuffer& buffer, size_t buffer_idx,
-                          ofstream& file);
+                          LogFile& file);
+
+  /**
+   * 현재 스레드 전용 레코드 링 버퍼를 반환하는 함수.
+   * 스레드의 첫 호출 시 종료된 스레드의 링 버퍼를 재사용하거나 새로 할당하며,
+   * 링 버퍼 개수가 한도에 도달하면 nullptr을 반환함
+   */
+  static LogRecordRing* GetThreadRecordRing();
+
+  /// 잠든 백그라운드 스레드를 깨우는 함수
+  void NotifyLoggingThread();
+
+  /**
+   * 모든 스레드의 링 버퍼에 쌓인 레코드를 포맷팅하여 로그 버퍼에 쓰는 함수
+   * @return 처리한 레코드 존재 여부
+   */
+  bool DrainRecordRings();
 
   /**
    * 빠른 메시지 포맷팅 함수
    * @param buffer 포맷팅 결과를 저장할 버퍼
    * @param level 로그 레벨
+   * @param run_tag 실행 태그. nullptr이면 생략
    * @param file 파일명
    * @param line 라인 번호
    * @param message 메시지
+   * @param log_time 로그 발생 시각
+   * @param bar_time 바 Open Time. LogRecord::no_bar_time이면 생략
    * @return 포맷팅된 메시지 길이
    */
   static size_t FormatMessageFast(char* buffer, LogLevel level,
-                                  const char* file, int line,
-                                  const char* message);
+                                  const char* run_tag, const char* file,
+                                  int line, const char* message,
+                                  time_t log_time, int64_t bar_time);
+
+  /**
+   * 실행 ID에 해당하는 실행 태그를 반환하는 함수.
+   * 태그는 등록 중에 바뀌지 않으므로 락 없이 읽을 수 있음
+   * @param run_id 실행 ID
+   * @return 실행 태그. 등록되지 않은 실행이면 nullptr
+   */
+  static const char* GetRunTag(uint32_t run_id);
 
   /**
    * 로그 레벨을 문자열로 변환하는 함수
@@ -361,6 +770,13 @@ class BACKTESTING_API Logger final {
    */
   static const char* ExtractFilename(const char* filepath);
 
+  /**
+   * 로그 레벨을 콘솔 출력용 문자열로 변환하는 함수
+   * @param level 로그 레벨
+   * @return 콘솔 출력용 레벨 문자열
+   */
+  static const char* GetConsoleLevelString(LogLevel level);
+
   /**
    * 콘솔에 로그 메시지를 출력하는 함수
    * @param level 로그 레벨 문자열
@@ -369,4 +785,41 @@ class BACKTESTING_API Logger final {
   static void ConsoleLog(const string& level, const string& message);
 };
 
+/**
+ * 스코프 동안 현재 스레드의 실행 ID를 설정하는 RAII 클래스.
+ * 스코프를 벗어나면 이전 실행 ID로 복원됨
+ */
+class LogRunScope final {
+ public:
+  explicit LogRunScope(const uint32_t run_id)
+      : previous_run_id_(Logger::GetThreadRunId()) {
+    Logger::SetThreadRunId(run_id);
+  }
+
+  ~LogRunScope() { Logger::SetThreadRunId(previous_run_id_); }
+
+  LogRunScope(const LogRunScope&) = delete;
+  LogRunScope& operator=(const LogRunScope&) = delete;
+
+ private:
+  uint32_t previous_run_id_;
+};
+
+/**
+ * 스코프 동안 현재 스레드의 바 시각 설정을 보존하는 RAII 클래스.
+ * 스코프를 벗어나면 이전 바 시각으로 복원됨
+ */
+class LogBarTimeScope final {
+ public:
+  LogBarTimeScope() : previous_bar_time_(Logger::GetThreadBarTime()) {}
+
+  ~LogBarTimeScope() { Logger::SetThreadBarTime(previous_bar_time_); }
+
+  LogBarTimeScope(const LogBarTimeScope&) = delete;
+  LogBarTimeScope& operator=(const LogBarTimeScope&) = delete;
+
+ private:
+  int64_t previous_bar_time_;
+};
+
 }  // namespace backtesting::logger
@@ -0,0 +1,157 @@
+#pragma once
+
+// 표준 라이브러리
+#include <cstdint>
+#include <fstream>
+#include <ios>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// 내부 헤더
+#include "Engines/Export.hpp"
+
+// 네임 스페이스
+using namespace std;
+
+namespace backtesting::logger {
+
+/// 로그 인덱스 파일의 헤더 구조체
+struct BACKTESTING_API LogIndexHeader {
+  char magic[8];        // "BTLOGIDX"
+  uint32_t version;     // 인덱스 형식 버전
+  uint32_t entry_size;  // 엔트리 하나의 바이트 수
+};
+
+/// 로그 라인 하나의 위치와 메타데이터를 담는 인덱스 엔트리 구조체
+struct BACKTESTING_API LogIndexEntry {
+  int64_t bar_time;    // 바 Open Time (Unix Timestamp ms, 없으면 INT64_MIN)
+  uint64_t offset;     // 로그 파일 내 라인 시작 바이트 오프셋
+  uint32_t length;     // 개행 문자를 포함한 라인 바이트 수
+  uint16_t symbol_id;  // 심볼 테이블 인덱스 (심볼이 없으면 no_symbol)
+  uint8_t level;       // LogLevel 순서 (DEBUG, INFO, WARN, ERROR, BALANCE)
+  uint8_t reserved;    // 정렬용 예약 필드
+};
+
+static_assert(sizeof(LogIndexHeader) == 16);
+static_assert(sizeof(LogIndexEntry) == 24);
+
+/**
+ * 고정 크기 세그먼트 단위로 메모리 매핑하여 기록하는 로그 파일 클래스.
+ *
+ * 파일은 세그먼트 크기 단위로 미리 확장되고 현재 세그먼트만 매핑되어
+ * 기록되며, 닫을 때 실제 기록된 크기로 잘라냄.
+ *
+ * 기록된 각 로그 라인의 (바 시각, 레벨, 심볼, 오프셋)은 사이드카 인덱스
+ * 파일(.idx)에, 심볼 이름은 한 줄에 하나씩 심볼 테이블 파일(.sym)에 기록되어
+ * 전체 로그를 스캔하지 않고 범위 조회가 가능함.
+ *
+ * Logger의 파일 스트림을 대체하도록 ofstream과 같은 인터페이스를 제공하며,
+ * 실패 시 예외 대신 is_open()이 false가 됨
+ */
+class BACKTESTING_API MappedLogFile final {
+ public:
+  static constexpr uint64_t segment_size = 64ULL * 1024 * 1024;  // 64MB
+  static constexpr uint16_t no_symbol = UINT16_MAX;  // 심볼이 없는 라인
+  static constexpr int64_t no_bar_time = INT64_MIN;  // 바 시각이 없는 라인
+
+  MappedLogFile() = default;
+  ~MappedLogFile();
+
+  MappedLogFile(const MappedLogFile&) = delete;
+  MappedLogFile& operator=(const MappedLogFile&) = delete;
+
+  /**
+   * 로그 파일과 사이드카 파일들을 여는 함수
+   * @param path 로그 파일 경로
+   * @param mode ios::trunc가 포함되면 새로 시작, 아니면 이어서 기록
+   */
+  void open(const string& path, ios::openmode mode = ios::out | ios::app);
+
+  /// 파일이 열려있는지 여부를 반환하는 함수
+  [[nodiscard]] bool is_open() const;
+
+  /**
+   * 데이터를 현재 세그먼트에 기록하고 완성된 라인을 인덱싱하는 함수
+   * @param data 기록할 데이터
+   * @param len 데이터 길이
+   * @return 자기 자신에 대한 참조
+   */
+  MappedLogFile& write(const char* data, streamsize len);
+
+  /// 인덱스와 심볼 테이블을 파일에 반영하는 함수.
+  /// 매핑된 세그먼트는 OS 페이지 캐시를 통해 다른 프로세스에서도 즉시 보임
+  void flush();
+
+  /// 매핑을 해제하고 파일을 실제 기록된 크기로 잘라낸 뒤 닫는 함수
+  void close();
+
+  /**
+   * 로그 파일을 사이드카 파일들과 함께 이동하는 함수
+   * @param from 원본 로그 파일 경로
+   * @param to 대상 로그 파일 경로
+   */
+  static void Rename(const string& from, const string& to);
+
+  /// 로그 파일 경로에 대응하는 인덱스 파일 경로를 반환하는 함수
+  [[nodiscard]] static string GetIndexPath(const string& log_path);
+
+  /// 로그 파일 경로에 대응하는 심볼 테이블 파일 경로를 반환하는 함수
+  [[nodiscard]] static string GetSymbolTablePath(const string& log_path);
+
+ private:
+  string path_;
+
+#ifdef _WIN32
+  void* file_handle_ = nullptr;
+  void* mapping_handle_ = nullptr;
+#else
+  int fd_ = -1;
+#endif
+
+  char* segment_data_ = nullptr;  // 현재 매핑된 세그먼트 시작 주소
+  uint64_t segment_idx_ = 0;      // 현재 매핑된 세그먼트 번호
+  uint64_t written_size_ = 0;     // 실제 기록된 바이트 수
+
+  // 사이드카 인덱스
+  ofstream index_file_;
+  vector<string> symbols_;
+  unordered_map<string, uint16_t> symbol_ids_;
+  size_t num_saved_symbols_ = 0;  // 심볼 테이블 파일에 기록된 심볼 수
+
+  // 세그먼트 경계나 write 경계에서 잘린 라인
+  string pending_line_;
+  uint64_t pending_line_offset_ = 0;
+
+  // 같은 바의 시각 문자열 변환 결과 캐시
+  char cached_bar_time_text_[19] = {};
+  int64_t cached_bar_time_ = no_bar_time;
+
+  /// 지정된 세그먼트를 매핑하는 함수. 필요하면 파일을 확장함
+  bool MapSegment(uint64_t segment_idx);
+
+  /// 현재 세그먼트의 매핑을 해제하는 함수
+  void UnmapSegment();
+
+  /// 기록된 데이터에서 완성된 라인들을 찾아 인덱싱하는 함수
+  void IndexLines(const char* data, size_t len, uint64_t offset);
+
+  /**
+   * 로그 라인 하나를 파싱하여 인덱스 엔트리를 기록하는 함수.
+   * "[시각] [레벨] ([BAR 바 시각]) ([실행 태그]) [파일:라인] | ([심볼...])
+   * 메시지" 형식이 아닌 라인은 인덱싱하지 않음
+   */
+  void IndexLine(string_view line, uint64_t offset);
+
+  /// UTC 바 시각 문자열을 Unix Timestamp ms로 변환하는 함수
+  int64_t ParseBarTime(const char* time_text);
+
+  /// 심볼 이름의 심볼 테이블 인덱스를 반환하는 함수. 없으면 새로 추가
+  uint16_t GetSymbolId(string_view symbol);
+
+  /// 새로 추가된 심볼들을 심볼 테이블 파일에 기록하는 함수
+  void SaveSymbols();
+};
+
+}  // namespace backtesting::logger
@@ -1,13 +1,245 @@
 #pragma once
 
+// 표준 라이브러리
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
 // 내부 헤더
 #include "Engines/DataUtils.hpp"
 
 // 네임 스페이스
 using namespace std;
 
+/// 비교 방식을 실행 중에 바꿀 수 있는지 여부 (0: RELATIVE 고정, 1: 선택).
+/// 0이면 Numeric 비교 연산자가 비교 방식을 읽지 않고 RELATIVE 비교로
+/// 컴파일되며, RELATIVE 이외의 비교 방식은 설정할 수 없음
+#ifndef BACKTESTING_RUNTIME_COMPARISON
+#define BACKTESTING_RUNTIME_COMPARISON 0
+#endif
+
 namespace backtesting::numeric {
 
+/// Numeric 비교 연산자의 부동 소수점 비교 방식
+enum class ComparisonMode {
+  RELATIVE,  // 절대 오차 또는 상대 오차 이내를 같은 값으로 비교 (기본값)
+  ABSOLUTE,  // 지정된 절대 오차 이내를 같은 값으로 비교
+  EXACT      // 오차 없이 비교
+};
+
+/**
+ * 비교 방식별 부동 소수점 비교 함수들.
+ *
+ * 컴파일 시점에 비교 방식을 고정하여 비교할 때 사용하며, 정수 타입은 비교
+ * 방식과 관계없이 오차 없이 비교함. NaN과의 비교는 IsDiff만 true를 반환함.
+ *
+ * - RELATIVE: utils::IsEqual 등과 같은 결과. tolerance는 사용하지 않음\n
+ * - ABSOLUTE: 두 값의 차이가 tolerance 이하면 같은 값\n
+ * - EXACT: 내장 비교 연산자와 같은 결과. tolerance는 사용하지 않음
+ */
+template <ComparisonMode Mode>
+struct Comparison {
+  template <typename T, typename U>
+  [[nodiscard]] __forceinline static bool IsEqual(T a, U b,
+                                                  double tolerance) noexcept {
+    using CommonType = common_type_t<T, U>;
+
+    if constexpr (Mode == ComparisonMode::EXACT ||
+                  !is_floating_point_v<CommonType>) {
+      return static_cast<CommonType>(a) == static_cast<CommonType>(b);
+    } else if constexpr (Mode == ComparisonMode::ABSOLUTE) {
+      return std::abs(static_cast<CommonType>(a) -
+                      static_cast<CommonType>(b)) <=
+             static_cast<CommonType>(tolerance);
+    } else {
+      return utils::IsEqual(a, b);
+    }
+  }
+
+  template <typename T, typename U>
+  [[nodiscard]] __forceinline static bool IsDiff(T a, U b,
+                                                 double tolerance) noexcept {
+    if constexpr (Mode == ComparisonMode::RELATIVE &&
+                  is_floating_point_v<common_type_t<T, U>>) {
+      return utils::IsDiff(a, b);
+    } else {
+      return !IsEqual(a, b, tolerance);
+    }
+  }
+
+  template <typename T, typename U>
+  [[nodiscard]] __forceinline static bool IsGreater(T a, U b,
+                                                    double tolerance) noexcept {
+    using CommonType = common_type_t<T, U>;
+
+    if constexpr (Mode == ComparisonMode::EXACT ||
+                  !is_floating_point_v<CommonType>) {
+      return static_cast<CommonType>(a) > static_cast<CommonType>(b);
+    } else if constexpr (Mode == ComparisonMode::ABSOLUTE) {
+      return static_cast<CommonType>(a) - static_cast<CommonType>(b) >
+             static_cast<CommonType>(tolerance);
+    } else {
+      return utils::IsGreater(a, b);
+    }
+  }
+
+  template <typename T, typename U>
+  [[nodiscard]] __forceinline static bool IsGreaterOrEqual(
+      T a, U b, double tolerance) noexcept {
+    using CommonType = common_type_t<T, U>;
+
+    if constexpr (Mode == ComparisonMode::EXACT ||
+                  !is_floating_point_v<CommonType>) {
+      return static_cast<CommonType>(a) >= static_cast<CommonType>(b);
+    } else if constexpr (Mode == ComparisonMode::ABSOLUTE) {
+      return static_cast<CommonType>(b) - static_cast<CommonType>(a) <=
+             static_cast<CommonType>(tolerance);
+    } else {
+      return utils::IsGreaterOrEqual(a, b);
+    }
+  }
+
+  template <typename T, typename U>
+  [[nodiscard]] __forceinline static bool IsLess(T a, U b,
+                                                 double tolerance) noexcept {
+    if constexpr (Mode == ComparisonMode::RELATIVE &&
+                  is_floating_point_v<common_type_t<T, U>>) {
+      return utils::IsLess(a, b);
+    } else {
+      return IsGreater(b, a, tolerance);
+    }
+  }
+
+  template <typename T, typename U>
+  [[nodiscard]] __forceinline static bool IsLessOrEqual(
+      T a, U b, double tolerance) noexcept {
+    if constexpr (Mode == ComparisonMode::RELATIVE &&
+                  is_floating_point_v<common_type_t<T, U>>) {
+      return utils::IsLessOrEqual(a, b);
+    } else {
+      return IsGreaterOrEqual(b, a, tolerance);
+    }
+  }
+};
+
+/**
+ * Numeric 비교 연산자가 사용하는 비교 방식을 관리하는 클래스.
+ *
+ * 엔진 초기화 시 Config의 설정으로 지정됨. BACKTESTING_RUNTIME_COMPARISON
+ * 빌드가 아니면 비교 방식은 RELATIVE로 고정되어 비교마다 비교 방식을 읽지
+ * 않으며, 다른 비교 방식을 설정하면 예외가 발생함
+ */
+class BACKTESTING_API ComparisonPolicy final {
+ public:
+  /// 비교 방식을 실행 중에 바꿀 수 있는 빌드인지 여부
+  static constexpr bool kRuntimeMode = BACKTESTING_RUNTIME_COMPARISON != 0;
+
+  /// 비교 방식과 ABSOLUTE 방식의 절대 오차를 설정하는 함수
+  static void Set(ComparisonMode mode, double tolerance);
+
+  [[nodiscard]] static ComparisonMode GetMode();
+  [[nodiscard]] static double GetTolerance();
+
+  template <typename T, typename U>
+  [[nodiscard]] __forceinline static bool IsEqual(T a, U b) noexcept {
+    if constexpr (!kRuntimeMode) {
+      return Comparison<ComparisonMode::RELATIVE>::IsEqual(a, b, 0);
+    }
+
+    switch (mode_) {
+      case ComparisonMode::EXACT: {
+        return Comparison<ComparisonMode::EXACT>::IsEqual(a, b, tolerance_);
+      }
+
+      case ComparisonMode::ABSOLUTE: {
+        return Comparison<ComparisonMode::ABSOLUTE>::IsEqual(a, b, tolerance_);
+      }
+
+      default: {
+        return Comparison<ComparisonMode::RELATIVE>::IsEqual(a, b, tolerance_);
+      }
+    }
+  }
+
+  template <typename T, typename U>
+  [[nodiscard]] __forceinline static bool IsDiff(T a, U b) noexcept {
+    if constexpr (!kRuntimeMode) {
+      return Comparison<ComparisonMode::RELATIVE>::IsDiff(a, b, 0);
+    }
+
+    return !IsEqual(a, b);
+  }
+
+  template <typename T, typename U>
+  [[nodiscard]] __forceinline static bool IsGreater(T a, U b) noexcept {
+    if constexpr (!kRuntimeMode) {
+      return Comparison<ComparisonMode::RELATIVE>::IsGreater(a, b, 0);
+    }
+
+    switch (mode_) {
+      case ComparisonMode::EXACT: {
+        return Comparison<ComparisonMode::EXACT>::IsGreater(a, b, tolerance_);
+      }
+
+      case ComparisonMode::ABSOLUTE: {
+        return Comparison<ComparisonMode::ABSOLUTE>::IsGreater(a, b,
+                                                               tolerance_);
+      }
+
+      default: {
+        return Comparison<ComparisonMode::RELATIVE>::IsGreater(a, b,
+                                                               tolerance_);
+      }
+    }
+  }
+
+  template <typename T, typename U>
+  [[nodiscard]] __forceinline static bool IsGreaterOrEqual(T a, U b) noexcept {
+    if constexpr (!kRuntimeMode) {
+      return Comparison<ComparisonMode::RELATIVE>::IsGreaterOrEqual(a, b, 0);
+    }
+
+    switch (mode_) {
+      case ComparisonMode::EXACT: {
+        return Comparison<ComparisonMode::EXACT>::IsGreaterOrEqual(a, b,
+                                                                   tolerance_);
+      }
+
+      case ComparisonMode::ABSOLUTE: {
+        return Comparison<ComparisonMode::ABSOLUTE>::IsGreaterOrEqual(
+            a, b, tolerance_);
+      }
+
+      default: {
+        return Comparison<ComparisonMode::RELATIVE>::IsGreaterOrEqual(
+            a, b, tolerance_);
+      }
+    }
+  }
+
+  template <typename T, typename U>
+  [[nodiscard]] __forceinline static bool IsLess(T a, U b) noexcept {
+    if constexpr (!kRuntimeMode) {
+      return Comparison<ComparisonMode::RELATIVE>::IsLess(a, b, 0);
+    }
+
+    return IsGreater(b, a);
+  }
+
+  template <typename T, typename U>
+  [[nodiscard]] __forceinline static bool IsLessOrEqual(T a, U b) noexcept {
+    if constexpr (!kRuntimeMode) {
+      return Comparison<ComparisonMode::RELATIVE>::IsLessOrEqual(a, b, 0);
+    }
+
+    return IsGreaterOrEqual(b, a);
+  }
+
+ private:
+  static ComparisonMode mode_;
+  static double tolerance_;
+};
+
 /// 부동소숫점 오류를 방지하기 위한 연산자를 지원하는 템플릿 숫자 클래스
 template <typename T>
 class BACKTESTING_API Numeric final {
@@ -44,22 +276,22 @@ class BACKTESTING_API Numeric final {
 
   // Numeric 간 비교 연산자
   bool operator==(const Numeric& other) const {
-    return utils::IsEqual(value_, other.value_);
+    return ComparisonPolicy::IsEqual(value_, other.value_);
   }
   bool operator!=(const Numeric& other) const {
-    return utils::IsDiff(value_, other.value_);
+    return ComparisonPolicy::IsDiff(value_, other.value_);
   }
   bool operator>(const Numeric& other) const {
-    return utils::IsGreater(value_, other.value_);
+    return ComparisonPolicy::IsGreater(value_, other.value_);
   }
   bool operator>=(const Numeric& other) const {
-    return utils::IsGreaterOrEqual(value_, other.value_);
+    return ComparisonPolicy::IsGreaterOrEqual(value_, other.value_);
   }
   bool operator<(const Numeric& other) const {
-    return utils::IsLess(value_, other.value_);
+    return ComparisonPolicy::IsLess(value_, other.value_);
   }
   bool operator<=(const Numeric& other) const {
-    return utils::IsLessOrEqual(value_, other.value_);
+    return ComparisonPolicy::IsLessOrEqual(value_, other.value_);
   }
 
   // Numeric + U (산술 연산자)
@@ -93,27 +325,27 @@ class BACKTESTING_API Numeric final {
   // Numeric + U 비교 연산자
   template <typename U>
   bool operator==(U other) const {
-    return utils::IsEqual(value_, other);
+    return ComparisonPolicy::IsEqual(value_, other);
   }
   template <typename U>
   bool operator!=(U other) const {
-    return utils::IsDiff(value_, other);
+    return ComparisonPolicy::IsDiff(value_, other);
   }
   template <typename U>
   bool operator>(U other) const {
-    return utils::IsGreater(value_, other);
+    return ComparisonPolicy::IsGreater(value_, other);
   }
   template <typename U>
   bool operator>=(U other) const {
-    return utils::IsGreaterOrEqual(value_, other);
+    return ComparisonPolicy::IsGreaterOrEqual(value_, other);
   }
   template <typename U>
   bool operator<(U other) const {
-    return utils::IsLess(value_, other);
+    return ComparisonPolicy::IsLess(value_, other);
   }
   template <typename U>
   bool operator<=(U other) const {
-    return utils::IsLessOrEqual(value_, other);
+    return ComparisonPolicy::IsLessOrEqual(value_, other);
   }
 
   // U + Numeric 산술 연산자 (friend)
@@ -147,27 +379,27 @@ class BACKTESTING_API Numeric final {
   // U + Numeric 비교 연산자 (friend)
   template <typename U>
   friend bool operator==(U lhs, const Numeric& rhs) {
-    return utils::IsEqual(lhs, rhs.value_);
+    return ComparisonPolicy::IsEqual(lhs, rhs.value_);
   }
   template <typename U>
   friend bool operator!=(U lhs, const Numeric& rhs) {
-    return utils::IsDiff(lhs, rhs.value_);
+    return ComparisonPolicy::IsDiff(lhs, rhs.value_);
   }
   template <typename U>
   friend bool operator>(U lhs, const Numeric& rhs) {
-    return utils::IsGreater(lhs, rhs.value_);
+    return ComparisonPolicy::IsGreater(lhs, rhs.value_);
   }
   template <typename U>
   friend bool operator>=(U lhs, const Numeric& rhs) {
-    return utils::IsGreaterOrEqual(lhs, rhs.value_);
+    return ComparisonPolicy::IsGreaterOrEqual(lhs, rhs.value_);
   }
   template <typename U>
   friend bool operator<(U lhs, const Numeric& rhs) {
-    return utils::IsLess(lhs, rhs.value_);
+    return ComparisonPolicy::IsLess(lhs, rhs.value_);
   }
   template <typename U>
   friend bool operator<=(U lhs, const Numeric& rhs) {
-    return utils::IsLessOrEqual(lhs, rhs.value_);
+    return ComparisonPolicy::IsLessOrEqual(lhs, rhs.value_);
   }
 
  private:
@@ -17,6 +17,10 @@ namespace backtesting::engine {
 class Engine;
 }
 
+namespace backtesting::main {
+class BacktestContext;
+}
+
 namespace backtesting::order {
 
 /**
@@ -55,6 +59,9 @@ class BACKTESTING_API OrderHandler final : public BaseOrderHandler {
   // 체결 확인, 주문 실행 용도
   friend class Engine;
 
+  // 컨텍스트 전환 시 인스턴스 교체용
+  friend class main::BacktestContext;
+
  public:
   // 싱글톤 특성 유지
   OrderHandler(const OrderHandler&) = delete;             // 복사 생성자 삭제
@@ -0,0 +1,123 @@
+#pragma once
+
+// 표준 라이브러리
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 내부 헤더
+#include "Engines/Export.hpp"
+
+// 네임 스페이스
+using namespace std;
+
+/// 프로파일링 계측 활성화 여부 (0: 비활성화, 1: 활성화).
+/// 비활성화 시 PROFILE_SCOPE는 아무 코드도 생성하지 않음
+#ifndef BACKTESTING_ENABLE_PROFILING
+#define BACKTESTING_ENABLE_PROFILING 0
+#endif
+
+#define PROFILE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_IMPL(a, b)
+
+/**
+ * 현재 스코프의 실행 시간을 계측하는 매크로.
+ *
+ * 구간 이름은 호출 지점마다 한 번만 등록되며, 스코프를 벗어날 때 경과 시간이
+ * 스레드별 누적기와 트레이스 이벤트 버퍼에 기록됨.
+ * 구간 이름은 문자열 리터럴이어야 함
+ */
+#if BACKTESTING_ENABLE_PROFILING
+#define PROFILE_SCOPE(name)                                                \
+  static const uint32_t PROFILE_CONCAT(profile_site_, __LINE__) =          \
+      backtesting::profiler::Profiler::RegisterSite(name);                 \
+  const backtesting::profiler::ProfileScope PROFILE_CONCAT(profile_scope_, \
+                                                           __LINE__)(      \
+      PROFILE_CONCAT(profile_site_, __LINE__))
+#else
+#define PROFILE_SCOPE(name) \
+  do {                      \
+  } while (false)
+#endif
+
+namespace backtesting::profiler {
+
+/// 모든 스레드에서 합산한 구간 하나의 통계
+struct BACKTESTING_API ProfileSiteStats {
+  string name;      // 구간 이름
+  uint64_t calls;   // 호출 수
+  double total_ms;  // 하위 구간을 포함한 전체 시간
+  double self_ms;   // 하위 구간을 제외한 자체 시간
+  double max_us;    // 한 번 호출의 최대 시간
+};
+
+/**
+ * 구간별 실행 시간을 수집하는 정적 프로파일러 클래스.
+ *
+ * 시간은 x86에서는 rdtsc, 그 외에는 steady_clock 틱으로 측정되며,
+ * 리포트 시점에 Reset 이후의 steady_clock 경과 시간으로 보정하여
+ * 나노초로 환산함.
+ *
+ * 측정값은 스레드별 누적기에 락 없이 기록되고, 리포트 시 모든 스레드의
+ * 누적기를 합산함. Reset과 리포트 함수는 계측 중인 스레드가 없을 때
+ * (실행 사이) 호출해야 함
+ */
+class BACKTESTING_API Profiler final {
+ public:
+  static constexpr uint32_t max_sites = 128;  // 등록 가능한 최대 구간 수
+
+  // 스레드당 저장하는 최대 트레이스 이벤트 수 (약 24MB)
+  static constexpr size_t max_trace_events = 1 << 20;
+
+  /**
+   * 구간 이름을 등록하고 구간 ID를 반환하는 함수.
+   * 같은 이름은 같은 ID를 공유함
+   */
+  static uint32_t RegisterSite(const char* name);
+
+  /// 모든 스레드의 누적기와 트레이스 이벤트를 초기화하고
+  /// 시간 보정 기준점을 다시 잡는 함수. 실행 시작 시 호출
+  static void Reset();
+
+  /// 현재 시각을 틱 단위로 반환하는 함수
+  static uint64_t Now();
+
+  /// Reset 이후의 경과 시간을 ms 단위로 반환하는 함수
+  static double GetElapsedMs();
+
+  /// Reset 이후 모든 스레드에서 합산한 구간별 통계를 전체 시간이 긴
+  /// 순서로 반환하는 함수. 호출되지 않은 구간은 제외됨
+  static vector<ProfileSiteStats> CollectStats();
+
+  /**
+   * Reset 이후 구간별 호출 수와 전체/자체 시간, 평균/최대 시간,
+   * 전체 경과 시간 대비 비율을 정리한 표를 반환하는 함수.
+   * 자체 시간은 하위 구간의 시간을 제외한 시간
+   */
+  static string FormatBreakdown();
+
+  /**
+   * Reset 이후의 트레이스 이벤트를 Chrome Trace Event 형식의 JSON 파일로
+   * 저장하는 함수. chrome://tracing 혹은 Perfetto에서 열 수 있음
+   * @param file_path 저장할 파일 경로
+   */
+  static void SaveTrace(const string& file_path);
+};
+
+/// 생성부터 소멸까지의 시간을 구간에 기록하는 RAII 클래스
+class BACKTESTING_API ProfileScope final {
+ public:
+  explicit ProfileScope(uint32_t site_id);
+  ~ProfileScope();
+
+  ProfileScope(const ProfileScope&) = delete;
+  ProfileScope& operator=(const ProfileScope&) = delete;
+
+ private:
+  uint32_t site_id_;
+  uint64_t start_ticks_;
+  uint64_t child_ticks_;   // 하위 구간들의 누적 틱
+  ProfileScope* parent_;  // 같은 스레드에서 감싸고 있는 구간
+};
+
+}  // namespace backtesting::profiler
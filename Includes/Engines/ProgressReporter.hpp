@@ -0,0 +1,121 @@
+#pragma once
+
+// 표준 라이브러리
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// 내부 헤더
+#include "Engines/Export.hpp"
+
+// 네임 스페이스
+using namespace std;
+
+namespace backtesting::engine {
+
+/**
+ * 백테스팅 진행 상황을 한 줄의 Json(NDJSON) 프레임으로 출력하는 클래스.
+ *
+ * 프레임은 "진행 상황" 접두사 뒤에 Json이 붙은 한 줄이므로 같은 출력의 로그
+ * 줄과 구분됨. Update는 바 루프에서 매번 호출해도 되며, 출력 간격이 지났을
+ * 때만 프레임을 만들어 출력함. 단계가 바뀔 때와 Finish에서는 간격과 관계없이
+ * 출력함.
+ *
+ * 프레임 항목:
+ * - jobId: 진행 중인 서버 작업 아이디 (서버 작업이 아니면 빈 문자열)\n
+ * - phase: 현재 단계, elapsedMs: 시작 후 경과 시간\n
+ * - simulatedTime: 현재 바의 Open Time, progress: 백테스팅 기간 진행률\n
+ * - bars: 처리한 트레이딩 바 수, barsPerSecond: 현재 단계의 초당 처리 바 수\n
+ * - trades: 체결된 거래 수, walletBalance: 지갑 자금\n
+ * - etaMs: 현재 단계의 남은 예상 시간 (진행률을 알 수 없으면 null)\n
+ * - phasesMs: 끝난 단계별 소요 시간, done: 마지막 프레임 여부
+ */
+class BACKTESTING_API ProgressReporter final {
+ public:
+  /**
+   * @param interval 바 루프에서 프레임을 출력하는 최소 간격
+   * @param output 프레임을 출력할 스트림
+   */
+  explicit ProgressReporter(
+      chrono::milliseconds interval = chrono::milliseconds(250),
+      ostream& output = cout);
+
+  /// 진행 보고를 시작하는 함수.
+  /// 시작 전과 Finish 후에는 다른 함수가 아무 것도 출력하지 않음
+  /// @param job_id 프레임에 포함할 서버 작업 아이디
+  void Start(const string& job_id = "");
+
+  /// 새 단계를 시작하는 함수. 이전 단계의 소요 시간을 기록하고 출력
+  void BeginPhase(const string& phase);
+
+  /// 진행률 계산에 사용하는 백테스팅 기간을 설정하는 함수
+  void SetTimeRange(int64_t begin_time, int64_t end_time);
+
+  /**
+   * 바 루프의 진행 상황을 갱신하는 함수. 값은 항상 저장하며 출력 간격이
+   * 지났을 때만 출력
+   * @param simulated_time 현재 바의 Open Time
+   * @param num_bars 지금까지 처리한 트레이딩 바 수
+   * @param num_trades 지금까지 체결된 거래 수
+   * @param wallet_balance 현재 지갑 자금
+   */
+  __forceinline void Update(const int64_t simulated_time,
+                            const size_t num_bars, const size_t num_trades,
+                            const double wallet_balance) {
+    if (!is_started_) {
+      return;
+    }
+
+    // 단계 변경과 Finish의 프레임이 최신 값을 출력하도록 간격과 관계없이 저장
+    simulated_time_ = simulated_time;
+    num_bars_ = num_bars;
+    num_trades_ = num_trades;
+    wallet_balance_ = wallet_balance;
+
+    const auto now = chrono::steady_clock::now();
+    if (now < next_frame_time_) {
+      return;
+    }
+
+    Emit(now, false);
+  }
+
+  /// 마지막 단계를 끝내고 마지막 프레임을 출력한 후 보고를 종료하는 함수
+  void Finish();
+
+  /// 진행 보고 중인지 여부를 반환하는 함수
+  [[nodiscard]] bool IsStarted() const;
+
+ private:
+  chrono::milliseconds interval_;
+  ostream& output_;
+
+  bool is_started_;
+  string job_id_;
+  chrono::steady_clock::time_point start_time_;
+  chrono::steady_clock::time_point phase_start_time_;
+  chrono::steady_clock::time_point next_frame_time_;
+
+  string phase_;
+  vector<pair<string, int64_t>> phases_ms_;  // 끝난 단계별 소요 시간
+  size_t phase_begin_bars_;                  // 현재 단계 시작 시 처리 바 수
+
+  int64_t begin_time_;
+  int64_t end_time_;
+  int64_t simulated_time_;
+  size_t num_bars_;
+  size_t num_trades_;
+  double wallet_balance_;
+
+  /// 현재 상태로 프레임을 만들어 출력하는 함수
+  void Emit(chrono::steady_clock::time_point now, bool done);
+
+  /// 현재 단계를 끝내고 소요 시간을 기록하는 함수
+  void EndPhase(chrono::steady_clock::time_point now);
+};
+
+}  // namespace backtesting::engine
@@ -0,0 +1,117 @@
+#pragma once
+
+// 표준 라이브러리
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// 내부 헤더
+#include "Engines/Export.hpp"
+
+// 네임 스페이스
+using namespace std;
+
+namespace backtesting::main {
+
+/// 서버 작업 종류
+enum class ServerJobType { RUN_SINGLE_BACKTESTING, FETCH_OR_UPDATE_BAR_DATA };
+
+/// 서버 작업 상태
+enum class ServerJobStatus {
+  QUEUED,     // 큐에서 대기 중
+  RUNNING,    // 실행 중
+  COMPLETED,  // 정상 종료
+  FAILED,     // 작업이 예외를 던짐
+  CANCELLED,  // 대기 중 취소되었거나 실행 중 취소 후 종료
+  REJECTED    // 큐가 가득 찼거나 같은 아이디의 작업이 있어 거부됨
+};
+
+/// 서버 작업
+struct ServerJob {
+  string id;
+  ServerJobType type;
+  string payload;  // 작업 명령의 Json 문자열
+
+  /// 작업별 취소 토큰. 실행 중인 작업은 이 값을 확인하여 중지해야 함
+  shared_ptr<atomic<bool>> cancel_requested;
+};
+
+/**
+ * 서버 명령을 아이디가 있는 작업 단위로 받아 도착 순서대로 실행하는 크기
+ * 제한 작업 큐.
+ *
+ * 대기 중인 작업은 취소 시 큐에서 바로 제거되고, 실행 중인 작업은 취소
+ * 토큰이 설정되어 작업이 스스로 중지됨. 작업 상태가 바뀔 때마다 상태
+ * 콜백이 호출됨.
+ *
+ * ※ 주의 사항 ※\n
+ * - 엔진 상태가 프로세스 전역이므로 작업은 하나의 작업 스레드에서 하나씩
+ *   실행됨\n
+ * - 상태 콜백은 상태 순서를 보장하기 위해 내부 잠금을 잡은 채 호출되므로
+ *   콜백에서 큐 함수를 호출하면 안 됨
+ */
+class BACKTESTING_API ServerJobQueue final {
+ public:
+  using Handler = function<void(const ServerJob&)>;
+  using StatusCallback = function<void(const ServerJob&, ServerJobStatus)>;
+
+  /**
+   * @param capacity 대기 가능한 최대 작업 수. 실행 중인 작업은 제외
+   * @param handler 작업을 실행하는 함수. 예외를 던지면 실패로 처리
+   * @param status_callback 작업 상태가 바뀔 때 호출되는 함수
+   */
+  ServerJobQueue(size_t capacity, Handler handler,
+                 StatusCallback status_callback);
+  ~ServerJobQueue();
+
+  ServerJobQueue(const ServerJobQueue&) = delete;
+  ServerJobQueue& operator=(const ServerJobQueue&) = delete;
+
+  /// 작업을 큐에 추가하는 함수. 큐가 가득 찼거나 같은 아이디의 작업이
+  /// 대기 또는 실행 중이면 거부하고 false를 반환
+  bool Submit(const string& id, ServerJobType type, string payload);
+
+  /// 아이디에 해당하는 작업을 취소하는 함수. 작업이 없으면 false를 반환
+  bool Cancel(const string& id);
+
+  /// 대기 및 실행 중인 모든 작업을 취소하는 함수
+  void CancelAll();
+
+  /// 모든 작업을 취소하고 실행 중인 작업이 끝날 때까지 대기하는 함수
+  void Shutdown();
+
+  /// 대기 중인 작업 수를 반환하는 함수
+  [[nodiscard]] size_t GetNumQueued() const;
+
+  /// 실행 중인 작업의 아이디를 반환하는 함수. 없으면 빈 문자열
+  [[nodiscard]] string GetRunningJobId() const;
+
+ private:
+  const size_t capacity_;
+  Handler handler_;
+  StatusCallback status_callback_;
+
+  mutable mutex mutex_;
+  condition_variable cv_;
+  deque<ServerJob> queue_;
+  unique_ptr<ServerJob> running_job_;
+  bool is_stopping_;
+  thread worker_;
+
+  void WorkerLoop();
+};
+
+/// 작업 종류를 서버 명령어 이름으로 변환하는 함수
+[[nodiscard]] BACKTESTING_API string ServerJobTypeToString(ServerJobType type);
+
+/// 작업 상태를 문자열로 변환하는 함수
+[[nodiscard]] BACKTESTING_API string
+ServerJobStatusToString(ServerJobStatus status);
+
+}  // namespace backtesting::main
@@ -31,8 +31,9 @@ class Engine;
 }
 
 namespace backtesting::main {
+class BacktestContext;
 class Backtesting;
-}
+}  // namespace backtesting::main
 
 // 네임 스페이스
 using namespace std;
@@ -105,6 +106,9 @@ class BACKTESTING_API Strategy {
   // ResetStrategy 접근용
   friend class Backtesting;
 
+  // 컨텍스트 전환 시 전략 교체용
+  friend class main::BacktestContext;
+
  public:
   // 전략을 팩토리로 우회하여 생성하고 strategy_에 추가하고 반환하는 함수
   template <typename CustomStrategy, typename... Args>
@@ -391,6 +395,10 @@ class BACKTESTING_API Strategy {
     // AddIndicator 함수를 통할 때만 생성 카운터 증가
     Indicator::IncreaseCreationCounter();
 
+    // 인수가 생성자로 이동되기 전에 의존 지표와 파라미터 서명 수집
+    auto dependencies =
+        Indicator::CollectDependencies<CustomIndicator>(args...);
+
     shared_ptr<CustomIndicator> indicator;
     try {
       indicator = std::make_shared<CustomIndicator>(
@@ -412,6 +420,7 @@ class BACKTESTING_API Strategy {
 
     // 지표의 파일 경로 자동 설정
     indicator->template AutoDetectSourcePaths<CustomIndicator>();
+    indicator->SetDependencies(std::move(dependencies));
 
     // 같은 클래스 이름의 지표가 저장되지 않았을 경우에만 저장된 지표에 추가
     if (const string& class_name = indicator->GetIndicatorClassName();
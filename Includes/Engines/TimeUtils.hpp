@@ -2,6 +2,8 @@
 
 // 표준 라이브러리
 #include <cstdint>
+#include <ctime>
+#include <format>
 #include <string>
 
 // 내부 헤더
@@ -57,6 +59,17 @@ constexpr int64_t kYear = 12 * kMonth;
  */
 [[nodiscard]] BACKTESTING_API size_t FormatCurrentTimeFast(char* buffer);
 
+/**
+ * 최적화된 지정 시간 포맷팅 함수 (지연 포맷팅 로그용)
+ * FormatCurrentTimeFast와 같은 Thread-local 캐시를 공유
+ *
+ * @param buffer 출력 버퍼
+ * @param now_time_t 포맷할 시각
+ * @return 포맷된 시간 문자열의 길이
+ */
+[[nodiscard]] BACKTESTING_API size_t FormatTimeFast(char* buffer,
+                                                    time_t now_time_t);
+
 /**
  * 주어진 타임스탬프(밀리초 기준)를 유닉스 에포크 시간대부터 UTC 날짜-시간
  * 문자열로 변환하여 반환하는 함수
@@ -119,4 +132,20 @@ BACKTESTING_API int64_t ParseTimeframe(const string& timeframe_str);
 [[nodiscard]] BACKTESTING_API int64_t
 CalculateNextMonthBoundary(int64_t timestamp_ms);
 
+/// 포맷 시 UtcTimestampToUtcDatetime으로 변환되는 타임스탬프 래퍼.
+/// LOG_DEFERRED 인자로 전달하면 날짜 문자열 변환이 백그라운드 스레드로 지연됨
+struct UtcDatetime {
+  int64_t timestamp_ms;
+};
+
 }  // namespace backtesting::utils
+
+template <>
+struct std::formatter<backtesting::utils::UtcDatetime> : formatter<string> {
+  auto format(const backtesting::utils::UtcDatetime& datetime,
+              format_context& ctx) const {
+    return formatter<string>::format(
+        backtesting::utils::UtcTimestampToUtcDatetime(datetime.timestamp_ms),
+        ctx);
+  }
+};
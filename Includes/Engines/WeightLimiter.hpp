@@ -0,0 +1,97 @@
+#pragma once
+
+// 표준 라이브러리
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+// 내부 헤더
+#include "Engines/Export.hpp"
+
+// 네임 스페이스
+using namespace std;
+
+namespace backtesting::fetcher {
+
+/**
+ * 거래소의 고정 창 REQUEST_WEIGHT 한도에 맞춰 요청을 허가하는 클래스.
+ *
+ * 창마다 한도 × 사용 비율만큼의 weight를 요청 전에 예약하고, 예산이 모자라면
+ * 다음 창까지 기다림. 응답의 사용 weight 헤더(예: X-MBX-USED-WEIGHT-1M)가
+ * 예약한 양보다 크면 같은 IP의 다른 요청이 있는 것이므로 서버 값을 따름.
+ * 429나 418 응답을 받으면 Retry-After 동안 모든 요청을 멈춤.
+ *
+ * 창 경계는 로컬 시계 기준이므로 서버와의 시간 차이를 흡수하도록 경계 후
+ * window_margin만큼 늦게 새 창을 시작함. 시간을 인자로 받는 함수들은 테스트에서
+ * 시계를 대신하기 위해 사용함
+ */
+class BACKTESTING_API WeightLimiter final {
+ public:
+  /**
+   * @param weight_limit 서버의 창당 weight 한도
+   * @param target_ratio 한도 중 사용할 비율 (0, 1]
+   * @param window 창 길이 (ms)
+   * @param window_margin 창 경계 후 새 창을 시작하기까지 기다리는 시간 (ms)
+   */
+  WeightLimiter(int64_t weight_limit, double target_ratio,
+                int64_t window = 60000, int64_t window_margin = 1000);
+
+  /// weight를 예약할 수 있을 때까지 기다린 후 예약하는 함수.
+  /// 예산보다 큰 weight는 runtime_error를 던짐
+  void Acquire(int64_t weight);
+
+  /**
+   * 주어진 시간에 weight를 예약해보는 함수.
+   *
+   * @return 예약했으면 0, 예약할 수 없으면 다시 시도할 때까지의 시간 (ms)
+   */
+  [[nodiscard]] int64_t TryAcquire(int64_t weight, int64_t now);
+
+  /**
+   * 응답 헤더의 사용 weight와 Rate Limit 응답을 반영하는 함수.
+   *
+   * 이전 창에 보낸 요청의 사용 weight는 현재 창과 관계가 없으므로 무시함.
+   *
+   * @param response_code HTTP 응답 코드
+   * @param response_header 응답 헤더 전체 문자열
+   * @param request_time 요청을 보낸 시간 (Unix ms)
+   * @param now 응답을 받은 시간 (Unix ms)
+   */
+  void OnResponse(long response_code, const string& response_header,
+                  int64_t request_time, int64_t now);
+
+  /// 현재 창에서 사용한 것으로 보는 weight를 반환하는 함수
+  [[nodiscard]] int64_t GetUsedWeight() const;
+
+  /// 창당 사용할 weight 예산을 반환하는 함수
+  [[nodiscard]] int64_t GetBudget() const;
+
+  /// 헤더에서 이름이 X-MBX-USED-WEIGHT-로 시작하는 마지막 값을 반환하는 함수.
+  /// 없으면 -1을 반환
+  [[nodiscard]] static int64_t ParseUsedWeight(const string& response_header);
+
+  /// 헤더의 Retry-After 값을 초 단위로 반환하는 함수. 이름이 Retry-After인
+  /// 헤더만 사용하며, 없으면 -1을 반환
+  [[nodiscard]] static int64_t ParseRetryAfter(const string& response_header);
+
+  /// 현재 시간을 Unix ms로 반환하는 함수
+  [[nodiscard]] static int64_t GetNow();
+
+ private:
+  int64_t budget_;
+  int64_t window_;
+  int64_t window_margin_;
+
+  mutable mutex mutex_;
+  int64_t window_idx_;     // 현재 창 번호
+  int64_t used_weight_;    // 현재 창에서 예약했거나 서버가 알려준 weight
+  int64_t blocked_until_;  // 이 시간 전까지 모든 요청을 멈춤 (Unix ms)
+
+  /// 주어진 시간이 속하는 창 번호를 반환하는 함수
+  [[nodiscard]] int64_t GetWindowIndex(int64_t time) const;
+
+  /// 창이 바뀌었으면 사용 weight를 초기화하는 함수
+  void RollWindow(int64_t now);
+};
+
+}  // namespace backtesting::fetcher
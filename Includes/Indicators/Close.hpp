@@ -14,4 +14,7 @@ class BACKTESTING_API Close final : public Indicator {
 
   void Initialize() override;
   Numeric<double> Calculate() override;
+  bool CalculateBatch(span<double> output) override;
+  bool SaveState(IndicatorState& state) const override;
+  bool LoadState(IndicatorState& state) override;
 };
@@ -14,4 +14,6 @@ class BACKTESTING_API ConstantValue final : public Indicator {
 
   void Initialize() override;
   Numeric<double> Calculate() override;
+  bool SaveState(IndicatorState& state) const override;
+  bool LoadState(IndicatorState& state) override;
 };
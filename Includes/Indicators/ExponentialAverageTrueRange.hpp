@@ -32,4 +32,13 @@ class BACKTESTING_API ExponentialAverageTrueRange final : public Indicator {
 
   void Initialize() override;
   Numeric<double> Calculate() override;
+  bool CalculateBatch(span<double> output) override;
+  bool SaveState(IndicatorState& state) const override;
+  bool LoadState(IndicatorState& state) override;
+
+  /// 바 하나를 반영하여 다음 값을 계산하는 함수
+  double CalculateNext(const Bar& current_bar);
+
+  /// True Range 하나를 반영하여 다음 ATR을 계산하는 함수
+  double SmoothNext(double tr);
 };
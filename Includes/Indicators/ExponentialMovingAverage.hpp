@@ -26,4 +26,10 @@ class BACKTESTING_API ExponentialMovingAverage final : public Indicator {
 
   void Initialize() override;
   Numeric<double> Calculate() override;
+  bool CalculateBatch(span<double> output) override;
+  bool SaveState(IndicatorState& state) const override;
+  bool LoadState(IndicatorState& state) override;
+
+  /// 입력값 하나를 반영하여 다음 값을 계산하는 함수
+  double CalculateNext(double value);
 };
@@ -0,0 +1,40 @@
+#pragma once
+
+// 표준 라이브러리
+#include <vector>
+
+// 내부 헤더
+#include "Engines/Expression.hpp"
+#include "Engines/Indicator.hpp"
+
+/**
+ * 지표 식을 계산하는 지표.
+ *
+ * 식의 모든 단계를 심볼마다 한 번의 바 순회로 계산하므로 중간 단계의 값을
+ * 별도 지표로 저장하지 않음. 식에서 참조하는 지표는 이 지표보다 먼저
+ * 추가되어야 하며 같은 타임프레임이어야 함.
+ *
+ * 사용 예:
+ * AddIndicator<ExpressionIndicator>("ATR 비율", trading_timeframe, Null(),
+ *                                   Sma(BarTrueRange(), 14) / close)
+ */
+class BACKTESTING_API ExpressionIndicator final : public Indicator {
+ public:
+  explicit ExpressionIndicator(const string& name, const string& timeframe,
+                               const Plot& plot, const Expression& expression);
+
+ private:
+  CompiledExpression program_;
+  vector<Indicator*> sources_;
+
+  shared_ptr<BarData> reference_bar_;
+  int symbol_idx_;
+
+  vector<double> source_values_;  // 바마다 계산 시 참조 지표들의 현재 값
+
+  void Initialize() override;
+  Numeric<double> Calculate() override;
+  bool CalculateBatch(span<double> output) override;
+  bool SaveState(IndicatorState& state) const override;
+  bool LoadState(IndicatorState& state) override;
+};
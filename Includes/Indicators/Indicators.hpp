@@ -5,6 +5,7 @@
 #include "Indicators/ConstantValue.hpp"
 #include "Indicators/ExponentialAverageTrueRange.hpp"
 #include "Indicators/ExponentialMovingAverage.hpp"
+#include "Indicators/ExpressionIndicator.hpp"
 #include "Indicators/High.hpp"
 #include "Indicators/Highest.hpp"
 #include "Indicators/Low.hpp"
@@ -29,4 +29,6 @@ class BACKTESTING_API RelativeStrengthIndex final : public Indicator {
 
   void Initialize() override;
   Numeric<double> Calculate() override;
+  bool SaveState(IndicatorState& state) const override;
+  bool LoadState(IndicatorState& state) override;
 };
@@ -30,4 +30,10 @@ class BACKTESTING_API SimpleAverageTrueRange final : public Indicator {
 
   void Initialize() override;
   Numeric<double> Calculate() override;
+  bool CalculateBatch(span<double> output) override;
+  bool SaveState(IndicatorState& state) const override;
+  bool LoadState(IndicatorState& state) override;
+
+  /// 바 하나를 반영하여 다음 값을 계산하는 함수
+  double CalculateNext(const Bar& current_bar);
 };
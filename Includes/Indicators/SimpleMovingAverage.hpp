@@ -8,6 +8,9 @@
 
 /// 단순 이동평균 (SMA)
 class BACKTESTING_API SimpleMovingAverage final : public Indicator {
+  // 단위 테스트에서 바마다 계산하는 경로 접근용
+  friend class backtesting::indicator::IndicatorTestAccess;
+
  public:
   explicit SimpleMovingAverage(const string& name, const string& timeframe,
                                const Plot& plot, Indicator& source,
@@ -27,4 +30,10 @@ class BACKTESTING_API SimpleMovingAverage final : public Indicator {
 
   void Initialize() override;
   Numeric<double> Calculate() override;
+  bool CalculateBatch(span<double> output) override;
+  bool SaveState(IndicatorState& state) const override;
+  bool LoadState(IndicatorState& state) override;
+
+  /// 입력값 하나를 반영하여 다음 값을 계산하는 함수
+  double CalculateNext(double value);
 };
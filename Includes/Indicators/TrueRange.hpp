@@ -5,6 +5,9 @@
 
 /// True Range
 class BACKTESTING_API TrueRange final : public Indicator {
+  // 단위 테스트에서 바마다 계산하는 경로 접근용
+  friend class backtesting::indicator::IndicatorTestAccess;
+
  public:
   explicit TrueRange(const string& name, const string& timeframe,
                      const Plot& plot);
@@ -17,4 +20,10 @@ class BACKTESTING_API TrueRange final : public Indicator {
 
   void Initialize() override;
   Numeric<double> Calculate() override;
+  bool CalculateBatch(span<double> output) override;
+  bool SaveState(IndicatorState& state) const override;
+  bool LoadState(IndicatorState& state) override;
+
+  /// 바 하나를 반영하여 다음 값을 계산하는 함수
+  double CalculateNext(const Bar& current_bar);
 };
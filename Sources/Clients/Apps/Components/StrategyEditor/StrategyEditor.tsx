@@ -612,6 +612,8 @@ function StrategyEditorContent({isActive, onFullyLoaded}: { isActive: boolean, o
         // 전송 대상에서 다음 항목들은 제외
         // - 타임프레임의 값 또는 단위가 비어있는 항목
         // - BarDataType.MAGNIFIER 이고 engineConfig.useBarMagnifier === false
+        // - 앞의 항목과 같은 파일에 저장되는 항목 (마크 가격 외에는 같은 연속 선물 캔들스틱)
+        const barDataTargets = new Set<string>();
         const payloadBarDataConfigs = barDataConfigs
             .filter(config => {
                 const timeframe = config.timeframe;
@@ -625,7 +627,18 @@ function StrategyEditorContent({isActive, onFullyLoaded}: { isActive: boolean, o
                 timeframe: timeframeToString(config.timeframe),
                 klinesDirectory: (config.klinesDirectory || '').replace(/\\/g, '/'),
                 barDataType: config.barDataType,
-            }));
+            }))
+            .filter(config => {
+                const isMarkPrice = config.barDataType === BarDataType.MARK_PRICE;
+                const target = JSON.stringify([isMarkPrice, config.timeframe, config.klinesDirectory.replace(/\/+$/, '')]);
+
+                if (barDataTargets.has(target)) {
+                    return false;
+                }
+
+                barDataTargets.add(target);
+                return true;
+            });
 
         // 전송할 바 데이터 설정이 없으면 중단
         if (payloadBarDataConfigs.length === 0) {
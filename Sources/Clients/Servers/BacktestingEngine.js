@@ -19,7 +19,23 @@ let backtestingEngine = null;
 let backtestingEngineReady = false;
 
 let _projectDirForEngine = null;
-const _pendingBacktestRequesters = [];
+// 백테스팅 작업 아이디별 요청자(ws)
+const _pendingBacktestRequesters = new Map();
+
+// 엔진에서 실행 중인 백테스팅 작업 아이디 (엔진은 한 번에 하나의 작업만 실행)
+let _runningBacktestJobId = null;
+
+// 작업 아이디의 요청자를 대기열에서 꺼냄
+function takeBacktestRequester(jobId) {
+    if (jobId === null || jobId === undefined) {
+        return null;
+    }
+
+    const requester = _pendingBacktestRequesters.get(jobId) || null;
+    _pendingBacktestRequesters.delete(jobId);
+
+    return requester;
+}
 
 function startBacktestingEngine(activeClients, broadcastLog, projectDir, staticDir) {
     if (backtestingEngine) {
@@ -52,7 +68,7 @@ function startBacktestingEngine(activeClients, broadcastLog, projectDir, staticD
         }
 
         try {
-            const requester = _pendingBacktestRequesters.shift();
+            const requester = takeBacktestRequester(_runningBacktestJobId);
             if (requester && requester.readyState === 1) {
                 requester.send(JSON.stringify({action: 'backtestingFailed'}));
             }
@@ -95,6 +111,9 @@ function startBacktestingEngine(activeClients, broadcastLog, projectDir, staticD
 
                 // 백테스팅이 정상적으로 완료되었을 때, 해당 작업을 요청한 클라이언트에게만 성공 알림을 보냄
                 if (cleaned.includes('백테스팅이 완료되었습니다.')) {
+                    // 결과 폴더를 찾는 동안 다음 작업이 시작될 수 있으므로 요청자를 먼저 꺼냄
+                    const requester = takeBacktestRequester(_runningBacktestJobId);
+
                     const parsed = cleaned.match(/^\[([^\]]+)]\s*\[([^\]]+?)]\s*(?:\[([^\]]+)]\s*)?\|\s*(.*)$/);
                     if (parsed) {
                         const [, timestamp, level, fileInfo, message] = parsed;
@@ -155,7 +174,6 @@ function startBacktestingEngine(activeClients, broadcastLog, projectDir, staticD
                             return false;
                         }
 
-                        const requester = _pendingBacktestRequesters.shift();
                         if (requester && requester.readyState === 1) {
                             const payload = {action: 'backtestingSuccess'};
 
@@ -318,6 +336,69 @@ function startBacktestingEngine(activeClients, broadcastLog, projectDir, staticD
                     return;
                 }
 
+                // 작업 큐의 상태 변경은 로그로 표시하지 않고 요청자 대기열만 정리
+                if (cleaned.startsWith('진행 상황')) {
+                    // 진행 상황 프레임은 로그로 남기지 않고 그대로 전달
+                    try {
+                        const progress = JSON.parse(cleaned.substring('진행 상황'.length).trim());
+
+                        if (activeClients && activeClients.size) {
+                            const message = JSON.stringify({action: 'backtestingProgress', progress});
+
+                            activeClients.forEach((c) => {
+                                try {
+                                    if (c && c.readyState === 1) {
+                                        c.send(message);
+                                    }
+                                } catch (e) {
+                                    // 무시
+                                }
+                            });
+                        }
+                    } catch (e) {
+                        // 무시
+                    }
+
+                    return;
+                }
+
+                if (cleaned.startsWith('작업 상태')) {
+                    try {
+                        const job = JSON.parse(cleaned.substring('작업 상태'.length).trim());
+                        if (job.type !== 'runSingleBacktesting') {
+                            return;
+                        }
+
+                        if (job.status === 'running') {
+                            _runningBacktestJobId = job.jobId;
+                        } else if (job.status === 'rejected') {
+                            broadcastLog('WARN', `백테스팅 작업 [${job.jobId}]이 거부되었습니다. 대기 중인 작업이 너무 많습니다.`, null, null);
+
+                            const requester = takeBacktestRequester(job.jobId);
+                            if (requester && requester.readyState === 1) {
+                                requester.send(JSON.stringify({action: 'backtestingFailed'}));
+                            }
+                        } else if (job.status === 'failed') {
+                            // 오류 로그로 이미 알리지 못한 요청자에게 실패를 알림
+                            const requester = takeBacktestRequester(job.jobId);
+                            if (requester && requester.readyState === 1) {
+                                requester.send(JSON.stringify({action: 'backtestingFailed'}));
+                            }
+                        } else {
+                            // 완료 알림이 없는 취소나 완료된 작업의 요청자를 제거
+                            takeBacktestRequester(job.jobId);
+                        }
+
+                        if (job.status !== 'running' && job.status !== 'queued' && job.jobId === _runningBacktestJobId) {
+                            _runningBacktestJobId = null;
+                        }
+                    } catch (e) {
+                        // 무시
+                    }
+
+                    return;
+                }
+
                 if (NO_PARSE) {
                     const level = cleaned.includes('[ERROR]') ? 'ERROR' : 'INFO';
                     broadcastLog(level, cleaned, null, null);
@@ -366,6 +447,10 @@ function startBacktestingEngine(activeClients, broadcastLog, projectDir, staticD
                 notifyAllClientsBacktestingFailed();
             }
 
+            // 종료된 엔진의 작업은 더 이상 상태가 오지 않으므로 대기열을 비움
+            _pendingBacktestRequesters.clear();
+            _runningBacktestJobId = null;
+
             backtestingEngine = null;
             backtestingEngineReady = false;
         });
@@ -380,7 +465,12 @@ function runSingleBacktesting(ws, backtestingStartTime, editorConfig, symbolConf
         return;
     }
 
+    // 작업 상태와 요청자를 연결하는 작업 아이디
+    const jobId = `backtest-${crypto.randomUUID()}`;
+
     const config = {
+        jobId: jobId,
+
         backtestingStartTime: backtestingStartTime,
 
         apiKeyEnvVar: (editorConfig && editorConfig.apiKeyEnvVar) ? editorConfig.apiKeyEnvVar : "",
@@ -433,10 +523,10 @@ function runSingleBacktesting(ws, backtestingStartTime, editorConfig, symbolConf
         strategyConfig: strategyConfig || null
     };
 
-    // 요청자(ws)를 대기열에 추가
+    // 요청자(ws)를 작업 아이디로 대기열에 추가
     try {
         if (ws && ws.send && typeof ws.send === 'function') {
-            _pendingBacktestRequesters.push(ws);
+            _pendingBacktestRequesters.set(jobId, ws);
         }
     } catch (e) {
         // 무시
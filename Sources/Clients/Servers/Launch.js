@@ -758,6 +758,198 @@ app.get('/api/log', async (req, res) => {
     }
 });
 
+// 백테스팅 로그 인덱스(.idx, .sym)를 이용한 범위 조회
+// from/to는 로그가 기록된 시각이 아닌 백테스팅 바 시각(UTC) 기준
+// 예: /api/log/query?result=...&level=ERROR&symbol=BTCUSDT&from=2024-03-01&to=2024-04-01&limit=1000
+const LOG_INDEX_MAGIC = 'BTLOGIDX';
+const LOG_INDEX_VERSION = 2;
+const LOG_INDEX_HEADER_SIZE = 16;
+const LOG_INDEX_NO_SYMBOL = 0xFFFF;
+const LOG_INDEX_NO_BAR_TIME = -(2n ** 63n);
+const LOG_INDEX_CACHE_SIZE = 8;
+const LOG_LEVELS = ['DEBUG', 'INFO', 'WARN', 'ERROR', 'BALANCE'];
+
+const parseLogQueryTime = (value) => {
+    if (value === undefined || value === '') {
+        return null;
+    }
+
+    // 숫자는 Unix Timestamp ms, 그 외는 로그의 바 시각과 같은 UTC 시각 문자열로 해석
+    if (/^\d+$/.test(value)) {
+        return Number(value);
+    }
+
+    const text = String(value).trim().replace(' ', 'T');
+    const time = new Date(/Z$|[+-]\d{2}:?\d{2}$/.test(text) ? text : text + (text.includes('T') ? 'Z' : 'T00:00:00Z')).getTime();
+    return isNaN(time) ? NaN : time;
+};
+
+// 로그 인덱스 캐시 (인덱스 경로 -> {ino, size, buffer, symbols, symbolSize})
+// 로그 세그먼트처럼 인덱스도 한 번 읽은 부분은 메모리에 유지하고, 조회 시에는 이어서 기록된 엔트리만 읽음
+const logIndexCache = new Map();
+
+const loadLogIndex = async (indexPath, symbolPath) => {
+    const stat = await fsPromises.stat(indexPath);
+    let cached = logIndexCache.get(indexPath);
+
+    // 다른 파일로 교체됐거나 잘렸으면 처음부터 다시 읽음
+    if (!cached || cached.ino !== stat.ino || stat.size < cached.size) {
+        cached = {ino: stat.ino, size: 0, buffer: Buffer.alloc(0), symbols: [], symbolSize: -1};
+    }
+
+    if (stat.size > cached.size) {
+        const appended = Buffer.alloc(stat.size - cached.size);
+        const handle = await fsPromises.open(indexPath, 'r');
+
+        try {
+            const {bytesRead} = await handle.read(appended, 0, appended.length, cached.size);
+            cached.buffer = Buffer.concat([cached.buffer, appended.subarray(0, bytesRead)]);
+            cached.size += bytesRead;
+        } finally {
+            await handle.close();
+        }
+    }
+
+    // 심볼 테이블은 크기가 바뀌었을 때만 다시 읽음
+    try {
+        const symbolStat = await fsPromises.stat(symbolPath);
+
+        if (symbolStat.size !== cached.symbolSize) {
+            cached.symbols = (await fsPromises.readFile(symbolPath, 'utf8')).split('\n');
+            cached.symbolSize = symbolStat.size;
+        }
+    } catch (e) {
+        // 심볼 테이블이 없으면 일치하는 심볼 없음
+        cached.symbols = [];
+        cached.symbolSize = -1;
+    }
+
+    // 최근 사용 순서 유지
+    logIndexCache.delete(indexPath);
+    logIndexCache.set(indexPath, cached);
+
+    if (logIndexCache.size > LOG_INDEX_CACHE_SIZE) {
+        logIndexCache.delete(logIndexCache.keys().next().value);
+    }
+
+    return cached;
+};
+
+app.get('/api/log/query', async (req, res) => {
+    try {
+        const {result, level, symbol, from, to, limit} = req.query || {};
+
+        if (!result || typeof result !== 'string') {
+            return res.status(400).send('result query parameter is required for /api/log/query');
+        }
+
+        // 결과 이름은 Results 아래의 폴더 이름만 허용
+        if (path.basename(result) !== result || result === '.' || result === '..') {
+            return res.status(400).send(`invalid result name: ${result}`);
+        }
+
+        const levelIdx = level ? LOG_LEVELS.indexOf(String(level).toUpperCase()) : -1;
+        if (level && levelIdx === -1) {
+            return res.status(400).send(`invalid level: ${level}`);
+        }
+
+        const fromTime = parseLogQueryTime(from);
+        const toTime = parseLogQueryTime(to);
+        if (Number.isNaN(fromTime) || Number.isNaN(toTime)) {
+            return res.status(400).send('invalid from/to');
+        }
+
+        const maxLines = Math.max(1, Math.min(parseInt(limit, 10) || 1000, 100000));
+
+        // 결과 폴더나 로그 파일이 없으면 경로를 만들 수 없음
+        let logPath;
+        try {
+            logPath = await resolveResultBackboardPath(result, 'backtesting.log');
+        } catch (e) {
+            return res.status(404).send('log not found');
+        }
+
+        const indexPath = logPath + '.idx';
+        const symbolPath = logPath + '.sym';
+
+        let logIndex;
+        try {
+            logIndex = await loadLogIndex(indexPath, symbolPath);
+        } catch (e) {
+            return res.status(404).send('log index not found');
+        }
+
+        const index = logIndex.buffer;
+        if (index.length < LOG_INDEX_HEADER_SIZE || index.toString('latin1', 0, 8) !== LOG_INDEX_MAGIC) {
+            return res.status(422).send('invalid log index');
+        }
+
+        // 이전 버전 인덱스는 바 시각 대신 로그 기록 시각을 담고 있으므로 조회 불가
+        if (index.readUInt32LE(8) !== LOG_INDEX_VERSION) {
+            return res.status(422).send('outdated log index. run the backtest again to rebuild it');
+        }
+
+        const entrySize = index.readUInt32LE(12);
+
+        // 심볼 이름을 심볼 테이블 인덱스로 변환
+        let symbolId = -1;
+        if (symbol) {
+            symbolId = logIndex.symbols.indexOf(String(symbol).toUpperCase());
+            if (symbolId === -1) {
+                return res.json({lines: [], total: 0, truncated: false});
+            }
+        }
+
+        // 인덱스 필터링
+        const matches = [];
+        let total = 0;
+
+        for (let pos = LOG_INDEX_HEADER_SIZE; pos + entrySize <= index.length; pos += entrySize) {
+            const entrySymbolId = index.readUInt16LE(pos + 20);
+            const entryLevel = index.readUInt8(pos + 22);
+
+            if ((levelIdx !== -1 && entryLevel !== levelIdx) ||
+                (symbolId !== -1 && entrySymbolId !== symbolId)) {
+                continue;
+            }
+
+            // 기간 조건이 있으면 바 시각이 없는 로그(초기화, 저장 등)는 제외
+            if (fromTime !== null || toTime !== null) {
+                const barTime = index.readBigInt64LE(pos);
+
+                if (barTime === LOG_INDEX_NO_BAR_TIME ||
+                    (fromTime !== null && Number(barTime) < fromTime) ||
+                    (toTime !== null && Number(barTime) >= toTime)) {
+                    continue;
+                }
+            }
+
+            if (++total <= maxLines) {
+                matches.push({offset: Number(index.readBigUInt64LE(pos + 8)), length: index.readUInt32LE(pos + 16)});
+            }
+        }
+
+        // 일치하는 라인만 오프셋으로 읽음
+        const lines = [];
+        const handle = await fsPromises.open(logPath, 'r');
+
+        try {
+            for (const {offset, length} of matches) {
+                const buffer = Buffer.alloc(length);
+                const {bytesRead} = await handle.read(buffer, 0, length, offset);
+                lines.push(buffer.toString('utf8', 0, bytesRead).replace(/\r?\n$/, ''));
+            }
+        } finally {
+            await handle.close();
+        }
+
+        res.set('Cache-Control', 'no-cache');
+        return res.json({lines, total, truncated: total > lines.length});
+    } catch (err) {
+        return res.status(500).send('internal error');
+    }
+});
+
 // =====================================================================================================================
 // API: 전략 목록 가져오기
 // =====================================================================================================================
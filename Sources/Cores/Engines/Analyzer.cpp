@@ -32,6 +32,8 @@
 #include "Engines/DataUtils.hpp"
 #include "Engines/Engine.hpp"
 #include "Engines/Logger.hpp"
+#include "Engines/MappedLogFile.hpp"
+#include "Engines/Profiler.hpp"
 #include "Engines/Slippage.hpp"
 #include "Engines/Strategy.hpp"
 #include "Engines/SymbolInfo.hpp"
@@ -44,6 +46,7 @@ namespace backtesting {
 using namespace analyzer;
 using namespace engine;
 using namespace logger;
+using namespace profiler;
 using namespace utils;
 }  // namespace backtesting
 
@@ -132,6 +135,8 @@ void Analyzer::AddTrade(Trade& new_trade, const int exit_count) {
 
 Trade Analyzer::GetLastTrade() const { return trade_list_.back(); }
 
+size_t Analyzer::GetNumTrades() const { return trade_list_.size(); }
+
 string Analyzer::GetMainDirectory() const { return main_directory_; }
 
 // =============================================================================
@@ -170,6 +175,8 @@ void Analyzer::CreateDirectories() {
 }
 
 void Analyzer::SaveIndicatorData() {
+  PROFILE_SCOPE("Analyzer::SaveIndicatorData");
+
   try {
     const auto& strategy = engine_->strategy_;
     const auto& indicators = strategy->GetIndicators();
@@ -290,7 +297,10 @@ void Analyzer::SaveIndicatorData() {
         }
       }
 
-      const auto& indicator_output = indicator->output_;
+      // 지연 계산 지표는 전략에서 참조되지 않은 심볼을 모두 계산
+      indicator->EvaluateRemainingSymbols();
+
+      const auto& indicator_output = *indicator->output_;
       const auto num_indicator_symbols = indicator_output.size();
 
       // 심볼별 처리를 병렬화
@@ -306,7 +316,8 @@ void Analyzer::SaveIndicatorData() {
 
             if (is_indicator_timeframe_larger) {
               // 지표의 타임프레임이 트레이딩 바보다 큰 경우 특별 처리
-              const auto& output = indicator_output[symbol_idx];
+              const size_t output_num_bars =
+                  indicator_output.GetNumBars(symbol_idx);
               const auto& reference_close_times =
                   reference_close_times_cache[symbol_idx];
               const size_t reference_num_bars = reference_close_times.size();
@@ -370,7 +381,7 @@ void Analyzer::SaveIndicatorData() {
 
                 // 아직 첫 번째 지표 바가 완성되지 않은 경우 또는
                 // 지표 바를 찾지 못한 경우
-                if (!found || reference_bar_idx >= output.size()) {
+                if (!found || reference_bar_idx >= output_num_bars) {
                   value_vector[row_idx] = NAN;
                   continue;
                 }
@@ -384,13 +395,13 @@ void Analyzer::SaveIndicatorData() {
                 }
 
                 // 현재 트레이딩 바에 대응하는 지표 값 할당
-                value_vector[row_idx] = output[reference_bar_idx];
+                value_vector[row_idx] =
+                    indicator_output.Get(symbol_idx, reference_bar_idx);
               }
             } else {
               // 타임프레임이 같은 경우
               // 시간 벡터는 모든 심볼의 최대 시간 범위이므로,
               // output의 시간 범위는 시간 벡터 범위와 다름
-              const auto& output = indicator_output[symbol_idx];
               size_t bar_idx = 0;
 
               for (size_t row_idx = 0; row_idx < total_rows; row_idx++) {
@@ -399,7 +410,8 @@ void Analyzer::SaveIndicatorData() {
                       current_time ==
                       reference_bar_data->GetBar(symbol_idx, bar_idx)
                           .open_time) {
-                    value_vector[row_idx] = output[bar_idx];
+                    value_vector[row_idx] =
+                        indicator_output.Get(symbol_idx, bar_idx);
                     bar_idx++;
                   } else {
                     value_vector[row_idx] = NAN;
@@ -457,6 +469,8 @@ void Analyzer::SaveIndicatorData() {
 }
 
 void Analyzer::SaveTradeList() const {
+  PROFILE_SCOPE("Analyzer::SaveTradeList");
+
   const auto& file_path = Backtesting::IsServerMode()
                               ? main_directory_ + "/trade_list.json"
                               : main_directory_ + "/BackBoard/trade_list.json";
@@ -528,6 +542,8 @@ void Analyzer::SaveTradeList() const {
 }
 
 void Analyzer::SaveConfig() {
+  PROFILE_SCOPE("Analyzer::SaveConfig");
+
   ordered_json config;
 
   // 미리 계산된 데이터
@@ -865,6 +881,8 @@ void Analyzer::SaveConfig() {
 }
 
 void Analyzer::SaveSourcesAndHeaders() {
+  PROFILE_SCOPE("Analyzer::SaveSourcesAndHeaders");
+
   try {
     const auto& strategy = engine_->strategy_;
     const auto& strategy_class_name = strategy->GetStrategyClassName();
@@ -987,6 +1005,8 @@ void Analyzer::SaveSourcesAndHeaders() {
 }
 
 void Analyzer::SaveBackBoard() const {
+  PROFILE_SCOPE("Analyzer::SaveBackBoard");
+
   try {
     // BackBoard Package 경로 설정
     const string backboard_package_path =
@@ -1020,15 +1040,35 @@ void Analyzer::SaveBackBoard() const {
   }
 }
 
+void Analyzer::SaveProfile() const {
+  try {
+    // 구간별 시간 분석 표는 콘솔과 로그에 출력
+    logger_->Log(INFO_L, Profiler::FormatBreakdown(), __FILE__, __LINE__,
+                 true);
+
+    Profiler::SaveTrace(main_directory_ + "/profile_trace.json");
+
+    logger_->Log(INFO_L, "프로파일링 트레이스가 저장되었습니다.", __FILE__,
+                 __LINE__, true);
+  } catch (const exception& e) {
+    logger_->Log(ERROR_L,
+                 "프로파일링 결과를 저장하는 중 오류가 발생했습니다.",
+                 __FILE__, __LINE__, true);
+
+    throw runtime_error(e.what());
+  }
+}
+
 void Analyzer::SaveBacktestingLog() const {
   try {
     logger_->FlushAllBuffers();
     logger_->backtesting_log_.close();
 
-    fs::rename(logger_->backtesting_log_temp_path_,
-               Backtesting::IsServerMode()
-                   ? main_directory_ + "/backtesting.log"
-                   : main_directory_ + "/BackBoard/backtesting.log");
+    // 인덱스 파일(.idx, .sym)도 함께 이동
+    MappedLogFile::Rename(logger_->backtesting_log_temp_path_,
+                          Backtesting::IsServerMode()
+                              ? main_directory_ + "/backtesting.log"
+                              : main_directory_ + "/BackBoard/backtesting.log");
   } catch (const exception& e) {
     logger_->Log(ERROR_L,
                  "백테스팅 로그 파일을 저장하는 데 오류가 발생했습니다.",
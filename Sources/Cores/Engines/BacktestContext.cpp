@@ -0,0 +1,179 @@
+// 표준 라이브러리
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 외부 라이브러리
+#include "nlohmann/json.hpp"
+
+// 파일 헤더
+#include "Engines/BacktestContext.hpp"
+
+// 내부 헤더
+#include "Engines/Analyzer.hpp"
+#include "Engines/BarHandler.hpp"
+#include "Engines/BaseEngine.hpp"
+#include "Engines/Config.hpp"
+#include "Engines/Engine.hpp"
+#include "Engines/JsonFileCache.hpp"
+#include "Engines/Logger.hpp"
+#include "Engines/OrderHandler.hpp"
+#include "Engines/Strategy.hpp"
+
+namespace backtesting::main {
+
+// 한 번에 하나의 컨텍스트만 싱글톤을 사용하도록 활성화 동안 잠그는 뮤텍스
+static mutex activation_mutex;
+
+// 활성화된 컨텍스트와 활성화한 스레드
+static atomic<BacktestContext*> active_context = nullptr;
+static atomic<thread::id> active_thread_id;
+
+struct BacktestContext::State {
+  // 싱글톤 인스턴스
+  shared_ptr<Engine> engine;
+  shared_ptr<BarHandler> bar_handler;
+  shared_ptr<OrderHandler> order_handler;
+  shared_ptr<Analyzer> analyzer;
+  shared_ptr<Config> config;
+  shared_ptr<Strategy> strategy;
+
+  // 거래소 정보, 레버리지 구간, 펀딩 비율
+  shared_ptr<const CachedJsonFile> exchange_info;
+  string exchange_info_path;
+  shared_ptr<const CachedJsonFile> leverage_bracket;
+  string leverage_bracket_path;
+  vector<shared_ptr<const CachedJsonFile>> funding_rates;
+  vector<string> funding_rates_paths;
+
+  // 프로젝트 및 전략, 지표 경로
+  string project_directory;
+  vector<string> strategy_header_dirs;
+  vector<string> strategy_source_dirs;
+  vector<string> indicator_header_dirs;
+  vector<string> indicator_source_dirs;
+  string strategy_header_path;
+  string strategy_source_path;
+};
+
+BacktestContext::Scope::Scope(BacktestContext& context) : context_(context) {
+  // 같은 스레드에서 중첩 활성화 시 뮤텍스를 기다리며 교착되므로 오류 발생
+  if (active_thread_id.load() == this_thread::get_id()) {
+    Logger::GetLogger()->Log(
+        ERROR_L,
+        "현재 스레드에서 이미 백테스팅 컨텍스트가 활성화되어 있습니다.",
+        __FILE__, __LINE__, true);
+
+    throw runtime_error("백테스팅 컨텍스트 중첩 활성화");
+  }
+
+  activation_mutex.lock();
+
+  context_.SwapState();
+  context_.is_active_ = true;
+
+  active_context = &context_;
+  active_thread_id = this_thread::get_id();
+}
+
+BacktestContext::Scope::~Scope() {
+  active_thread_id = thread::id();
+  active_context = nullptr;
+
+  context_.is_active_ = false;
+  context_.SwapState();
+
+  activation_mutex.unlock();
+}
+
+BacktestContext::BacktestContext()
+    : state_(make_unique<State>()), is_active_(false) {
+  // 비어있는 슬롯으로 활성화한 후 각 싱글톤을 새로 생성
+  const Scope scope(*this);
+
+  Engine::GetEngine();
+  BarHandler::GetBarHandler();
+  OrderHandler::GetOrderHandler();
+  Analyzer::GetAnalyzer();
+}
+
+BacktestContext::~BacktestContext() = default;
+
+BacktestContext::Scope BacktestContext::Activate() { return Scope(*this); }
+
+bool BacktestContext::IsActive() const { return is_active_; }
+
+BacktestContext* BacktestContext::GetActiveContext() { return active_context; }
+
+shared_ptr<Engine> BacktestContext::GetEngine() const {
+  return is_active_ ? Engine::instance_ : state_->engine;
+}
+
+shared_ptr<BarHandler> BacktestContext::GetBarHandler() const {
+  return is_active_ ? BarHandler::instance_ : state_->bar_handler;
+}
+
+shared_ptr<OrderHandler> BacktestContext::GetOrderHandler() const {
+  return is_active_ ? OrderHandler::instance_ : state_->order_handler;
+}
+
+shared_ptr<Analyzer> BacktestContext::GetAnalyzer() const {
+  return is_active_ ? Analyzer::instance_ : state_->analyzer;
+}
+
+shared_ptr<Config> BacktestContext::GetConfig() const {
+  return is_active_ ? BaseEngine::config_ : state_->config;
+}
+
+shared_ptr<Strategy> BacktestContext::GetStrategy() const {
+  return is_active_ ? Strategy::strategy_ : state_->strategy;
+}
+
+void BacktestContext::SwapState() const {
+  auto& state = *state_;
+
+  // 싱글톤 인스턴스는 슬롯의 내용만 바꾸므로 각 클래스가 보관한 싱글톤 참조가
+  // 그대로 새 인스턴스를 가리키게 됨
+  {
+    lock_guard lock(Engine::mutex_);
+    swap(state.engine, Engine::instance_);
+  }
+
+  {
+    lock_guard lock(BarHandler::mutex_);
+    swap(state.bar_handler, BarHandler::instance_);
+  }
+
+  {
+    lock_guard lock(OrderHandler::mutex_);
+    swap(state.order_handler, OrderHandler::instance_);
+  }
+
+  {
+    lock_guard lock(Analyzer::mutex_);
+    swap(state.analyzer, Analyzer::instance_);
+  }
+
+  swap(state.config, BaseEngine::config_);
+  swap(state.strategy, Strategy::strategy_);
+
+  swap(state.exchange_info, BaseEngine::exchange_info_);
+  swap(state.exchange_info_path, BaseEngine::exchange_info_path_);
+  swap(state.leverage_bracket, BaseEngine::leverage_bracket_);
+  swap(state.leverage_bracket_path, BaseEngine::leverage_bracket_path_);
+  swap(state.funding_rates, BaseEngine::funding_rates_);
+  swap(state.funding_rates_paths, BaseEngine::funding_rates_paths_);
+
+  swap(state.project_directory, Config::project_directory_);
+  swap(state.strategy_header_dirs, Config::strategy_header_dirs_);
+  swap(state.strategy_source_dirs, Config::strategy_source_dirs_);
+  swap(state.indicator_header_dirs, Config::indicator_header_dirs_);
+  swap(state.indicator_source_dirs, Config::indicator_source_dirs_);
+  swap(state.strategy_header_path, Config::strategy_header_path_);
+  swap(state.strategy_source_path, Config::strategy_source_path_);
+}
+
+}  // namespace backtesting::main
@@ -54,6 +54,7 @@
 // =============================================================================
 
 // 표준 라이브러리
+#include <atomic>
 #include <chrono>
 #include <format>
 #include <iostream>
@@ -70,6 +71,8 @@
 
 // 내부 헤더
 #include "Engines/Exception.hpp"
+#include "Engines/FetchScheduler.hpp"
+#include "Engines/ServerJobQueue.hpp"
 #include "Engines/StrategyLoader.hpp"
 #include "Engines/TimeUtils.hpp"
 
@@ -83,7 +86,9 @@ BACKTESTING_API shared_ptr<BarHandler>& Backtesting::bar_ =
 BACKTESTING_API shared_ptr<Logger>& Backtesting::logger_ = Logger::GetLogger();
 
 BACKTESTING_API bool Backtesting::server_mode_ = false;
-BACKTESTING_API atomic<bool> Backtesting::stop_requested_ = false;
+BACKTESTING_API atomic<const atomic<bool>*>
+    Backtesting::running_job_cancel_token_ = nullptr;
+BACKTESTING_API string Backtesting::running_job_id_;
 BACKTESTING_API vector<shared_ptr<StrategyLoader>> Backtesting::dll_loaders_;
 BACKTESTING_API string Backtesting::market_data_directory_;
 BACKTESTING_API string Backtesting::api_key_env_var_;
@@ -95,9 +100,19 @@ void Backtesting::SetServerMode(const bool server_mode) {
 
 bool Backtesting::IsServerMode() { return server_mode_; }
 
-bool Backtesting::IsStopRequested() { return stop_requested_.load(); }
+bool Backtesting::IsStopRequested() {
+  const auto* cancel_token = running_job_cancel_token_.load();
+  return cancel_token != nullptr && cancel_token->load();
+}
+
+string Backtesting::GetRunningJobId() { return running_job_id_; }
 
 void Backtesting::RunBacktesting() {
+  // 로컬 모드는 데이터 요청 후 백테스팅하므로 여기서 HTTP 작업 스레드를 종료
+  if (!server_mode_) {
+    BaseFetcher::ShutdownHttpClients();
+  }
+
   try {
     Engine::GetEngine()->Backtesting();
   } catch (const std::exception& e) {
@@ -112,94 +127,102 @@ void Backtesting::RunServer() {
   // 서버 모드로 진입했음을 알리는 로그를 출력하여 Js가 준비 상태를 감지
   cout << "백테스팅 엔진 준비 완료" << endl;
 
-  atomic should_exit(false);
-  string pending_command;
-  mutex command_mutex;
-  condition_variable command_cv;
-
-  // stdin 읽기 전용 스레드
-  thread stdin_thread([&] {
-    string line;
-    while (getline(cin, line)) {
-      if (line.empty()) {
-        continue;
-      }
-
-      istringstream iss(line);
-      string cmd;
-      iss >> cmd;
-
-      if (cmd == "stopSingleBacktesting") {
-        // 중지 플래그 설정
-        stop_requested_.store(true);
-      } else if (cmd == "shutdown") {
-        should_exit.store(true);
+  // 대기 가능한 최대 작업 수
+  constexpr size_t max_queued_jobs = 32;
 
-        command_cv.notify_one();
-        break;
-      } else {
-        // 다른 명령은 큐에 추가
-        {
-          lock_guard lock(command_mutex);
-          pending_command = line;
-        }
+  // 작업 상태를 "작업 상태<Json>" 형식으로 출력하여 Js가 작업별로 구분
+  const auto print_status = [](const ServerJob& job,
+                               const ServerJobStatus status) {
+    const json& payload = {{"jobId", job.id},
+                           {"type", ServerJobTypeToString(job.type)},
+                           {"status", ServerJobStatusToString(status)}};
 
-        command_cv.notify_one();
-      }
-    }
-  });
+    // 작업 스레드와 메인 스레드의 출력이 섞이지 않도록 한 번에 출력
+    cout << "작업 상태" + payload.dump() + "\n" << flush;
+  };
 
-  // 메인 루프: 명령 처리
-  while (!should_exit.load()) {
-    string line;
+  ServerJobQueue job_queue(max_queued_jobs, RunServerJob, print_status);
 
-    {
-      unique_lock lock(command_mutex);
-      command_cv.wait(
-          lock, [&] { return !pending_command.empty() || should_exit.load(); });
+  size_t job_counter = 0;
 
-      if (should_exit.load()) {
-        break;
-      }
-
-      line = pending_command;
-      pending_command.clear();
+  // 메인 루프: stdin 명령을 작업 큐에 추가하거나 작업을 취소
+  string line;
+  while (getline(cin, line)) {
+    if (line.empty()) {
+      continue;
     }
 
     istringstream iss(line);
     string cmd;
     iss >> cmd;
 
-    try {
-      if (cmd == "runSingleBacktesting") {
-        // 나머지 라인을 JSON으로 파싱
-        string json_str;
-        getline(iss, json_str);
-
-        RunSingleBacktesting(json_str);
-      } else if (cmd == "fetchOrUpdateBarData") {
-        string json_str;
-        getline(iss, json_str);
-
-        FetchOrUpdateBarData(json_str);
+    if (cmd == "stopSingleBacktesting") {
+      // 작업 아이디가 없으면 기존 클라이언트와 같이 모든 작업을 중지
+      if (string job_id; iss >> job_id) {
+        if (!job_queue.Cancel(job_id)) {
+          cout << "존재하지 않는 작업: " + job_id + "\n" << flush;
+        }
       } else {
-        cout << "알 수 없는 명령어: " << cmd << endl;
+        job_queue.CancelAll();
       }
-    } catch (...) {
-      // 무시하고 다음 루프 진행
+    } else if (cmd == "shutdown") {
+      break;
+    } else if (cmd == "runSingleBacktesting" ||
+               cmd == "fetchOrUpdateBarData") {
+      // 나머지 라인을 JSON으로 전달
+      string json_str;
+      getline(iss, json_str);
+
+      // 작업 아이디는 Json의 jobId를 사용하며, 없으면 순번으로 생성
+      string job_id = format("job-{}", ++job_counter);
+      if (const json& json_config = json::parse(json_str, nullptr, false);
+          json_config.is_object() && json_config.contains("jobId") &&
+          json_config["jobId"].is_string()) {
+        job_id = json_config["jobId"].get<string>();
+      }
+
+      job_queue.Submit(job_id,
+                       cmd == "runSingleBacktesting"
+                           ? ServerJobType::RUN_SINGLE_BACKTESTING
+                           : ServerJobType::FETCH_OR_UPDATE_BAR_DATA,
+                       json_str);
+    } else {
+      cout << "알 수 없는 명령어: " + cmd + "\n" << flush;
     }
   }
 
-  if (stdin_thread.joinable()) {
-    stdin_thread.join();
+  // 남은 작업을 취소하고 실행 중인 작업이 중지될 때까지 대기
+  job_queue.Shutdown();
+
+  // 정적 소멸자가 아닌 여기서 HTTP 작업 스레드를 종료
+  BaseFetcher::ShutdownHttpClients();
+}
+
+void Backtesting::RunServerJob(const ServerJob& job) {
+  // 실행 중인 작업의 취소 토큰을 중지 요청으로 사용
+  running_job_cancel_token_.store(job.cancel_requested.get());
+  running_job_id_ = job.id;
+
+  try {
+    if (job.type == ServerJobType::RUN_SINGLE_BACKTESTING) {
+      RunSingleBacktesting(job.payload);
+    } else {
+      FetchOrUpdateBarData(job.payload);
+    }
+  } catch (...) {
+    running_job_cancel_token_.store(nullptr);
+    running_job_id_.clear();
+
+    // 작업 큐가 FAILED 상태를 출력하도록 예외를 전파
+    throw;
   }
+
+  running_job_cancel_token_.store(nullptr);
+  running_job_id_.clear();
 }
 
 void Backtesting::RunSingleBacktesting(const string& json_str) {
   try {
-    // 중지 플래그 초기화
-    stop_requested_.store(false);
-
     if (!server_mode_) {
       throw runtime_error(
           "RunSingleBacktesting 함수는 서버 모드에서만 실행 가능합니다.");
@@ -354,7 +377,7 @@ void Backtesting::RunSingleBacktesting(const string& json_str) {
     if (updated) {
       const json& payload = UtcTimestampToLocalDatetime(now);
 
-      cout << "업데이트 완료" << payload.dump() << endl;
+      cout << "업데이트 완료" + payload.dump() + "\n" << flush;
     }
 
     RET_IF_STOP_REQUESTED("백테스팅이 중지되었습니다.")
@@ -654,9 +677,6 @@ void Backtesting::RunSingleBacktesting(const string& json_str) {
 
 void Backtesting::FetchOrUpdateBarData(const string& json_str) {
   try {
-    // 중지 플래그 초기화
-    stop_requested_.store(false);
-
     if (!server_mode_) {
       throw runtime_error(
           "FetchOrUpdateBarData 함수는 서버 모드에서만 실행 가능합니다.");
@@ -703,98 +723,134 @@ void Backtesting::FetchOrUpdateBarData(const string& json_str) {
     const string& funding_rates_directory =
         json_config.at("fundingRatesDirectory").get<string>();
 
-    // 각 심볼 별로 요청 수행
+    // 모든 요청 작업을 먼저 계획. 심볼별로 바 데이터 후 펀딩 비율 순서
+    vector<FetchJob> jobs;
     for (const auto& symbol_name : symbol_names) {
-      // 바 데이터 처리
-      for (const auto& bar_data_config : bar_data_configs) {
-        if (IsStopRequested()) {
-          const string& msg = operation == "download"
-                                  ? "바 데이터 다운로드가 중지되었습니다."
-                                  : "바 데이터 업데이트가 중지되었습니다.";
-          cout << msg << endl;
-          ResetCores();
-          return;
-        }
-
-        const auto& timeframe = get<0>(bar_data_config);
-        const auto& klines_directory = get<1>(bar_data_config);
-        const auto& bar_data_type = get<2>(bar_data_config);
-
-        try {
-          if (bar_data_type == "마크 가격") {
-            if (operation == "download") {
-              FetchMarkPriceKlines(symbol_name, timeframe, klines_directory);
-            } else {
-              UpdateMarkPriceKlines(symbol_name, timeframe, klines_directory);
-            }
-          } else {
-            // 트레이딩/참조/돋보기 바 데이터는 전부 연속 선물 klines
-            if (operation == "download") {
-              FetchContinuousKlines(symbol_name, timeframe, klines_directory);
-            } else {
-              UpdateContinuousKlines(symbol_name, timeframe, klines_directory);
-            }
-          }
-        } catch (...) {
-          if (bar_data_type == "마크 가격") {
-            if (operation == "download") {
-              logger_->Log(
-                  ERROR_L,
-                  format("[{}] 마크 가격 캔들스틱 파일 생성이 실패했습니다.",
-                         symbol_name),
-                  __FILE__, __LINE__, true);
-            } else {
-              logger_->Log(
-                  ERROR_L,
-                  format(
-                      "[{}] 마크 가격 캔들스틱 파일 업데이트가 실패했습니다.",
-                      symbol_name),
-                  __FILE__, __LINE__, true);
-            }
-          } else {
-            if (operation == "download") {
-              logger_->Log(
-                  ERROR_L,
-                  format("[{} {}] 연속 선물 캔들스틱 파일 생성이 실패했습니다.",
-                         symbol_name, timeframe),
-                  __FILE__, __LINE__, true);
-            } else {
-              logger_->Log(ERROR_L,
-                           format("[{} {}] 연속 선물 캔들스틱 파일 "
-                                  "업데이트가 실패했습니다.",
-                                  symbol_name, timeframe),
-                           __FILE__, __LINE__, true);
-            }
-          }
-        }
+      for (const auto& [timeframe, klines_directory, bar_data_type] :
+           bar_data_configs) {
+        // 트레이딩/참조/돋보기 바 데이터는 전부 연속 선물 klines
+        jobs.push_back({bar_data_type == "마크 가격"
+                            ? FetchJobKind::MARK_PRICE_KLINES
+                            : FetchJobKind::CONTINUOUS_KLINES,
+                        symbol_name, timeframe, klines_directory});
       }
 
-      // 펀딩 비율 처리
-      try {
-        if (operation == "download") {
-          FetchFundingRates(symbol_name, funding_rates_directory);
-        } else {
-          UpdateFundingRates(symbol_name, funding_rates_directory);
-        }
-      } catch (...) {
-        if (operation == "download") {
-          logger_->Log(
-              ERROR_L,
-              format("[{}] 펀딩 비율 파일 생성이 실패했습니다.", symbol_name),
-              __FILE__, __LINE__, true);
-        } else {
-          logger_->Log(ERROR_L,
-                       format("[{}] 펀딩 비율 파일 업데이트가 실패했습니다.",
-                              symbol_name),
-                       __FILE__, __LINE__, true);
-        }
+      jobs.push_back({FetchJobKind::FUNDING_RATES, symbol_name, "",
+                      funding_rates_directory});
+    }
+
+    // 같은 파일을 쓰는 작업이 동시에 실행되지 않도록 중복 작업을 제거
+    jobs = FetchScheduler::RemoveDuplicateJobs(jobs);
+
+    const bool is_download = operation == "download";
+
+    // 요청 Weight는 토큰 버킷이 제한하므로 작업 스레드는 응답 대기만 겹침
+    size_t num_fetch_workers = 4;
+    if (json_config.contains("fetchWorkers")) {
+      const auto& fetch_workers = json_config["fetchWorkers"];
+      if (!fetch_workers.is_number_unsigned() ||
+          fetch_workers.get<size_t>() < 1 ||
+          fetch_workers.get<size_t>() > FetchScheduler::max_workers) {
+        throw runtime_error(
+            format("서버 오류: C++ 서버로 전달된 요청 작업 스레드 수 [{}]는 "
+                   "1 이상 {} 이하의 정수여야 합니다.",
+                   fetch_workers.dump(), FetchScheduler::max_workers));
       }
+
+      num_fetch_workers = fetch_workers.get<size_t>();
+    }
+
+    atomic<size_t> num_failed_jobs = 0;
+    FetchScheduler(num_fetch_workers)
+        .Run(
+            jobs,
+            [is_download](const FetchJob& job) {
+              switch (job.kind) {
+                case FetchJobKind::CONTINUOUS_KLINES: {
+                  if (is_download) {
+                    FetchContinuousKlines(job.symbol, job.timeframe,
+                                          job.directory);
+                  } else {
+                    UpdateContinuousKlines(job.symbol, job.timeframe,
+                                           job.directory);
+                  }
+
+                  break;
+                }
+
+                case FetchJobKind::MARK_PRICE_KLINES: {
+                  if (is_download) {
+                    FetchMarkPriceKlines(job.symbol, job.timeframe,
+                                         job.directory);
+                  } else {
+                    UpdateMarkPriceKlines(job.symbol, job.timeframe,
+                                          job.directory);
+                  }
+
+                  break;
+                }
+
+                case FetchJobKind::FUNDING_RATES: {
+                  if (is_download) {
+                    FetchFundingRates(job.symbol, job.directory);
+                  } else {
+                    UpdateFundingRates(job.symbol, job.directory);
+                  }
+
+                  break;
+                }
+              }
+            },
+            [is_download, &num_failed_jobs](const FetchJob& job,
+                                            const exception_ptr&) {
+              ++num_failed_jobs;
+
+              const string action = is_download ? "생성이" : "업데이트가";
+
+              string msg;
+              switch (job.kind) {
+                case FetchJobKind::CONTINUOUS_KLINES: {
+                  msg = format("[{} {}] 연속 선물 캔들스틱 파일 {} "
+                               "실패했습니다.",
+                               job.symbol, job.timeframe, action);
+                  break;
+                }
+
+                case FetchJobKind::MARK_PRICE_KLINES: {
+                  msg = format("[{}] 마크 가격 캔들스틱 파일 {} 실패했습니다.",
+                               job.symbol, action);
+                  break;
+                }
+
+                case FetchJobKind::FUNDING_RATES: {
+                  msg = format("[{}] 펀딩 비율 파일 {} 실패했습니다.",
+                               job.symbol, action);
+                  break;
+                }
+              }
+
+              logger_->Log(ERROR_L, msg, __FILE__, __LINE__, true);
+            },
+            [] { return IsStopRequested(); });
+
+    if (IsStopRequested()) {
+      cout << (is_download ? "바 데이터 다운로드가 중지되었습니다."
+                           : "바 데이터 업데이트가 중지되었습니다.")
+           << endl;
+      ResetCores();
+      return;
+    }
+
+    // 실패한 작업이 있으면 작업 큐가 FAILED 상태를 출력하도록 예외를 던짐
+    if (num_failed_jobs > 0) {
+      throw runtime_error(format("요청 작업 {}개 중 {}개가 실패했습니다.",
+                                 jobs.size(), num_failed_jobs.load()));
     }
 
     // 엔진 코어 초기화
     ResetCores();
 
-    if (operation == "download") {
+    if (is_download) {
       cout << "바 데이터 다운로드가 완료되었습니다." << endl;
     } else {
       cout << "바 데이터 업데이트가 완료되었습니다." << endl;
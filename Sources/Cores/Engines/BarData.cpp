@@ -102,6 +102,10 @@ Bar& BarData::GetBar(const int symbol_idx, const size_t bar_idx) {
   return bar_data_[symbol_idx][bar_idx];
 }
 
+const vector<Bar>& BarData::GetBars(const int symbol_idx) const {
+  return bar_data_[symbol_idx];
+}
+
 string BarData::GetBarDataPath(const int symbol_idx) const {
   return bar_data_path_[symbol_idx];
 }
@@ -17,6 +17,7 @@
 #include "Engines/BarData.hpp"
 #include "Engines/DataUtils.hpp"
 #include "Engines/Exception.hpp"
+#include "Engines/KlineDataset.hpp"
 #include "Engines/Logger.hpp"
 #include "Engines/TimeUtils.hpp"
 
@@ -37,6 +38,14 @@ void BarHandler::Deleter::operator()(const BarHandler* p) const { delete p; }
 BACKTESTING_API mutex BarHandler::mutex_;
 BACKTESTING_API shared_ptr<BarHandler> BarHandler::instance_;
 
+// 현재 스레드의 평가 상태. DLL 경계로 내보낼 수 없으므로 파일 내부에 둠
+static thread_local BarHandler::EvaluationContext* evaluation_context =
+    nullptr;
+
+void BarHandler::SetEvaluationContext(EvaluationContext* context) {
+  evaluation_context = context;
+}
+
 shared_ptr<BarHandler>& BarHandler::GetBarHandler() {
   lock_guard lock(mutex_);  // 스레드에서 안전하게 접근하기 위해 mutex 사용
 
@@ -95,9 +104,9 @@ void BarHandler::AddBarData(const vector<string>& symbol_names,
       open_time_column, open_column,   high_column,      low_column,
       close_column,     volume_column, close_time_column};
 
-  // 배치로 모든 Parquet 파일을 병렬 읽기
+  // 배치로 모든 Parquet 파일과 업데이트 조각을 병렬 읽기
   const vector<shared_ptr<arrow::Table>>& bar_data_tables =
-      ReadParquetBatch(file_paths, original_columns);
+      KlineDataset::ReadBatch(file_paths, original_columns);
 
   // 타임프레임 계산 및 검증을 병렬로 수행
   const size_t num_symbols = symbol_names.size();
@@ -274,6 +283,17 @@ void BarHandler::ProcessBarIndices(const BarDataType bar_data_type,
 
 void BarHandler::SetCurrentBarDataType(const BarDataType bar_data_type,
                                        const string& timeframe) {
+  if (evaluation_context != nullptr) {
+    if (bar_data_type == REFERENCE) {
+      IsValidReferenceBarTimeframe(timeframe);
+
+      evaluation_context->reference_timeframe = timeframe;
+    }
+
+    evaluation_context->bar_data_type = bar_data_type;
+    return;
+  }
+
   current_bar_data_type_ = bar_data_type;
 
   if (bar_data_type == REFERENCE) {
@@ -284,10 +304,21 @@ void BarHandler::SetCurrentBarDataType(const BarDataType bar_data_type,
 }
 
 void BarHandler::SetCurrentSymbolIndex(const int symbol_index) {
+  if (evaluation_context != nullptr) {
+    evaluation_context->symbol_index = symbol_index;
+    return;
+  }
+
   current_symbol_index_ = symbol_index;
 }
 
 void BarHandler::SetCurrentBarIndex(const size_t bar_index) {
+  // 평가 상태에서는 계산 중인 바 데이터 하나의 인덱스만 사용
+  if (evaluation_context != nullptr) {
+    evaluation_context->bar_index = bar_index;
+    return;
+  }
+
   switch (current_bar_data_type_) {
     case TRADING: {
       trading_index_[current_symbol_index_] = bar_index;
@@ -336,16 +367,34 @@ size_t BarHandler::IncreaseBarIndex(const BarDataType bar_data_type,
 }
 
 BarDataType BarHandler::GetCurrentBarDataType() const {
+  if (evaluation_context != nullptr) {
+    return evaluation_context->bar_data_type;
+  }
+
   return current_bar_data_type_;
 }
 
 string BarHandler::GetCurrentReferenceTimeframe() const {
+  if (evaluation_context != nullptr) {
+    return evaluation_context->reference_timeframe;
+  }
+
   return current_reference_timeframe_;
 }
 
-int BarHandler::GetCurrentSymbolIndex() const { return current_symbol_index_; }
+int BarHandler::GetCurrentSymbolIndex() const {
+  if (evaluation_context != nullptr) {
+    return evaluation_context->symbol_index;
+  }
+
+  return current_symbol_index_;
+}
 
 size_t BarHandler::GetCurrentBarIndex() {
+  if (evaluation_context != nullptr) {
+    return evaluation_context->bar_index;
+  }
+
   switch (current_bar_data_type_) {
     case TRADING: {
       return trading_index_[current_symbol_index_];
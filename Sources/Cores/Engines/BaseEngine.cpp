@@ -13,6 +13,7 @@
 #include "Engines/Config.hpp"
 #include "Engines/DataUtils.hpp"
 #include "Engines/Exception.hpp"
+#include "Engines/JsonFileCache.hpp"
 #include "Engines/Logger.hpp"
 #include "Engines/SymbolInfo.hpp"
 
@@ -45,88 +46,64 @@ BACKTESTING_API shared_ptr<BarHandler>& BaseEngine::bar_ =
     BarHandler::GetBarHandler();
 BACKTESTING_API shared_ptr<Config> BaseEngine::config_;
 BACKTESTING_API shared_ptr<Logger>& BaseEngine::logger_ = Logger::GetLogger();
-BACKTESTING_API vector<json> BaseEngine::funding_rates_;
+BACKTESTING_API vector<shared_ptr<const CachedJsonFile>>
+    BaseEngine::funding_rates_;
 BACKTESTING_API vector<string> BaseEngine::funding_rates_paths_;
-BACKTESTING_API json BaseEngine::exchange_info_;
+BACKTESTING_API shared_ptr<const CachedJsonFile> BaseEngine::exchange_info_;
 BACKTESTING_API string BaseEngine::exchange_info_path_;
-BACKTESTING_API json BaseEngine::leverage_bracket_;
+BACKTESTING_API shared_ptr<const CachedJsonFile> BaseEngine::leverage_bracket_;
 BACKTESTING_API string BaseEngine::leverage_bracket_path_;
 
 void BaseEngine::AddExchangeInfo(const string& exchange_info_path) {
-  ifstream file(exchange_info_path);
-
-  if (!filesystem::exists(exchange_info_path)) {
-    throw runtime_error(format("거래소 정보 파일 [{}]이(가) 존재하지 않습니다.",
-                               exchange_info_path));
-  }
-
-  if (!file.is_open()) {
-    throw runtime_error(format("거래소 정보 파일 [{}]을(를) 열 수 없습니다.",
-                               exchange_info_path));
-  }
-
-  if (file.peek() == ifstream::traits_type::eof()) {
-    throw runtime_error(format("거래소 정보 파일 [{}]이(가) 비어있습니다.",
-                               exchange_info_path));
-  }
+  // PERPETUAL 계약 심볼의 symbols 배열 인덱스를 파싱할 때 한 번만 생성
+  const auto& index_symbols = [](const json& exchange_info) {
+    unordered_map<string, size_t> symbol_indices;
+
+    const auto& symbols = exchange_info.at("symbols");
+    for (size_t idx = 0; idx < symbols.size(); idx++) {
+      if (const auto& symbol = symbols[idx];
+          symbol.at("contractType") == "PERPETUAL") {
+        symbol_indices.emplace(symbol.at("symbol").get<string>(), idx);
+      }
+    }
 
-  try {
-    exchange_info_ = json::parse(file);
-    exchange_info_path_ = exchange_info_path;
-  } catch (const json::parse_error& e) {
-    // JSON 파싱 오류 처리
-    logger_->Log(
-        ERROR_L,
-        format("거래소 정보 파일 [{}]의 Json 형식이 유효하지 않습니다.",
-               exchange_info_path),
-        __FILE__, __LINE__, true);
-
-    throw runtime_error(e.what());
-  }
+    return symbol_indices;
+  };
 
-  file.close();
+  bool reused = false;
+  exchange_info_ = JsonFileCache::Load(exchange_info_path, "거래소 정보",
+                                       index_symbols, &reused);
+  exchange_info_path_ = exchange_info_path;
 
-  logger_->Log(INFO_L, "거래소 정보가 엔진에 추가되었습니다.", __FILE__,
-               __LINE__, true);
+  logger_->Log(INFO_L,
+               reused ? "변경되지 않은 거래소 정보가 엔진에 재사용되었습니다."
+                      : "거래소 정보가 엔진에 추가되었습니다.",
+               __FILE__, __LINE__, true);
 }
 
 void BaseEngine::AddLeverageBracket(const string& leverage_bracket_path) {
-  ifstream file(leverage_bracket_path);
-
-  if (!filesystem::exists(leverage_bracket_path)) {
-    throw runtime_error(
-        format("레버리지 구간 파일 [{}]이(가) 존재하지 않습니다.",
-               leverage_bracket_path));
-  }
-
-  if (!file.is_open()) {
-    throw runtime_error(format("레버리지 구간 파일 [{}]을(를) 열 수 없습니다.",
-                               leverage_bracket_path));
-  }
+  // 심볼별 구간의 배열 인덱스를 파싱할 때 한 번만 생성
+  const auto& index_symbols = [](const json& leverage_bracket) {
+    unordered_map<string, size_t> symbol_indices;
 
-  if (file.peek() == ifstream::traits_type::eof()) {
-    throw runtime_error(format("레버리지 구간 파일 [{}]이(가) 비어있습니다.",
-                               leverage_bracket_path));
-  }
+    for (size_t idx = 0; idx < leverage_bracket.size(); idx++) {
+      symbol_indices.emplace(
+          leverage_bracket[idx].at("symbol").get<string>(), idx);
+    }
 
-  try {
-    leverage_bracket_ = json::parse(file);
-    leverage_bracket_path_ = leverage_bracket_path;
-  } catch (const json::parse_error& e) {
-    // JSON 파싱 오류 처리
-    logger_->Log(
-        ERROR_L,
-        format("레버리지 구간 파일 [{}]의 Json 형식이 유효하지 않습니다.",
-               leverage_bracket_path),
-        __FILE__, __LINE__, true);
-
-    throw runtime_error(e.what());
-  }
+    return symbol_indices;
+  };
 
-  file.close();
+  bool reused = false;
+  leverage_bracket_ = JsonFileCache::Load(leverage_bracket_path,
+                                          "레버리지 구간", index_symbols,
+                                          &reused);
+  leverage_bracket_path_ = leverage_bracket_path;
 
-  logger_->Log(INFO_L, "레버리지 구간이 엔진에 추가되었습니다.", __FILE__,
-               __LINE__, true);
+  logger_->Log(INFO_L,
+               reused ? "변경되지 않은 레버리지 구간이 엔진에 재사용되었습니다."
+                      : "레버리지 구간이 엔진에 추가되었습니다.",
+               __FILE__, __LINE__, true);
 }
 
 void BaseEngine::AddFundingRates(const vector<string>& symbol_names,
@@ -136,46 +113,23 @@ void BaseEngine::AddFundingRates(const vector<string>& symbol_names,
                                funding_rates_directory));
   }
 
+  size_t num_reused = 0;
   for (const auto& symbol_name : symbol_names) {
     const auto& funding_rate_path =
         format("{}/{}.json", funding_rates_directory, symbol_name);
 
-    ifstream file(funding_rate_path);
-
-    if (!filesystem::exists(funding_rate_path)) {
-      throw runtime_error(format("펀딩 비율 파일 [{}]이(가) 존재하지 않습니다.",
-                                 funding_rate_path));
-    }
-
-    if (!file.is_open()) {
-      throw runtime_error(format("펀딩 비율 파일 [{}]을(를) 열 수 없습니다.",
-                                 funding_rate_path));
-    }
-
-    if (file.peek() == ifstream::traits_type::eof()) {
-      throw runtime_error(
-          format("펀딩 비율 파일 [{}]이(가) 비어있습니다.", funding_rate_path));
-    }
-
-    try {
-      funding_rates_.push_back(json::parse(file));
-      funding_rates_paths_.push_back(funding_rate_path);
-    } catch (const json::parse_error& e) {
-      // JSON 파싱 오류 처리
-      logger_->Log(
-          ERROR_L,
-          format("펀딩 비율 파일 [{}]의 Json 형식이 유효하지 않습니다.",
-                 funding_rate_path),
-          __FILE__, __LINE__, true);
-
-      throw runtime_error(e.what());
-    }
+    bool reused = false;
+    funding_rates_.push_back(
+        JsonFileCache::Load(funding_rate_path, "펀딩 비율", nullptr, &reused));
+    funding_rates_paths_.push_back(funding_rate_path);
 
-    file.close();
+    num_reused += reused;
   }
 
-  logger_->Log(INFO_L, "펀딩 비율이 엔진에 추가되었습니다.", __FILE__, __LINE__,
-               true);
+  logger_->Log(INFO_L,
+               format("펀딩 비율이 엔진에 추가되었습니다. (재사용 {}개 / {}개)",
+                      num_reused, symbol_names.size()),
+               __FILE__, __LINE__, true);
 }
 
 bool BaseEngine::IsEngineInitialized() const { return engine_initialized_; }
@@ -308,9 +262,10 @@ void BaseEngine::ResetBaseEngine() {
   magnifier_bar_time_diff_ = 0;
   reference_bar_time_diff_.clear();
 
-  exchange_info_.clear();
+  // 파싱된 파일은 JsonFileCache에 남아 다음 추가 시 재사용됨
+  exchange_info_.reset();
   exchange_info_path_.clear();
-  leverage_bracket_.clear();
+  leverage_bracket_.reset();
   leverage_bracket_path_.clear();
   funding_rates_.clear();
   funding_rates_paths_.clear();
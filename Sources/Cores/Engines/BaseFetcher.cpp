@@ -1,9 +1,19 @@
 // 표준 라이브러리
+#include <array>
 #include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <format>
+#include <functional>
 #include <iomanip>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 // 외부 라이브러리
 #include "curl/curl.h"
@@ -24,105 +34,338 @@ using namespace backtesting::utils;
 
 namespace backtesting::fetcher {
 
+namespace {
+
+// 요청을 처리하는 최대 HTTP 작업 스레드 수.
+// FetchScheduler 기본 작업 수 4개가 캔들스틱 요청을 각각 최대 4개 구간으로
+// 나눠 동시에 요청하는 수
+constexpr size_t max_http_threads = 16;
+
+// 등록된 응답 관찰 함수. 요청 중에 교체될 수 있으므로 복사하여 호출함
+mutex response_observer_mutex;
+shared_ptr<const function<void(long, const string&, int64_t)>>
+    response_observer;
+
+// HTTP 작업 스레드가 재사용하는 CURL 핸들. 작업 스레드가 아니면 nullptr
+thread_local CURL* pooled_curl = nullptr;
+
+/**
+ * 고정된 수의 작업 스레드에서 HTTP 요청을 실행하는 풀.
+ *
+ * 작업 스레드마다 CURL 핸들을 하나씩 유지하여 keep-alive 연결을 재사용하고,
+ * 모든 핸들은 DNS와 TLS 세션 캐시를 공유하므로 새 연결도 전체 핸드셰이크
+ * 없이 세션을 재개함.
+ *
+ * 연결 캐시는 동시에 여러 스레드가 공유할 수 없으므로 핸들마다 유지함.
+ *
+ * 작업 스레드는 쉬는 스레드가 없을 때만 최대 수까지 추가되므로 동시에 진행
+ * 중인 요청 수만큼만 생성됨
+ */
+class HttpClientPool final {
+ public:
+  HttpClientPool(const HttpClientPool&) = delete;
+  HttpClientPool& operator=(const HttpClientPool&) = delete;
+
+  static HttpClientPool& GetPool() {
+    // 정적 소멸자는 DLL 언로드 중 로더 락을 잡은 채 실행되어 스레드를 join할
+    // 수 없으므로 풀은 소멸시키지 않고 Shutdown에서 작업 스레드를 정리
+    static auto* pool = new HttpClientPool(max_http_threads);
+    return *pool;
+  }
+
+  /// 요청 함수를 작업 큐에 넣고 결과 future를 반환하는 함수
+  template <typename Request>
+  future<invoke_result_t<Request>> Submit(Request&& request) {
+    using Result = invoke_result_t<Request>;
+
+    auto task =
+        make_shared<packaged_task<Result()>>(std::forward<Request>(request));
+    auto result = task->get_future();
+
+    {
+      lock_guard lock(tasks_mutex_);
+      tasks_.emplace_back([task] { (*task)(); });
+
+      // 쉬는 작업 스레드보다 대기 중인 요청이 많으면 작업 스레드를 추가
+      if (tasks_.size() > num_idle_threads_ &&
+          threads_.size() < max_threads_) {
+        threads_.emplace_back([this] { Work(); });
+      }
+    }
+
+    tasks_cv_.notify_one();
+
+    return result;
+  }
+
+  /// 대기 중인 요청을 모두 처리한 후 작업 스레드들을 종료하는 함수.
+  /// 이후 요청이 들어오면 작업 스레드를 다시 생성함
+  void Shutdown() {
+    vector<thread> threads;
+
+    {
+      lock_guard lock(tasks_mutex_);
+      stop_requested_ = true;
+      threads = move(threads_);
+      threads_.clear();
+    }
+
+    tasks_cv_.notify_all();
+
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    lock_guard lock(tasks_mutex_);
+    stop_requested_ = false;
+  }
+
+  /// 요청 핸들이 공유할 캐시를 반환하는 함수
+  [[nodiscard]] CURLSH* GetShare() const { return share_; }
+
+ private:
+  CURLSH* share_;
+  array<mutex, CURL_LOCK_DATA_LAST> share_mutexes_;
+
+  mutex tasks_mutex_;
+  condition_variable tasks_cv_;
+  deque<function<void()>> tasks_;
+  bool stop_requested_;
+  size_t max_threads_;
+  size_t num_idle_threads_;
+  vector<thread> threads_;
+
+  explicit HttpClientPool(const size_t max_threads)
+      : stop_requested_(false),
+        max_threads_(max_threads),
+        num_idle_threads_(0) {
+    curl_global_init(CURL_GLOBAL_DEFAULT);
+
+    share_ = curl_share_init();
+    curl_share_setopt(share_, CURLSHOPT_LOCKFUNC, LockShare);
+    curl_share_setopt(share_, CURLSHOPT_UNLOCKFUNC, UnlockShare);
+    curl_share_setopt(share_, CURLSHOPT_USERDATA, this);
+    curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+
+    threads_.reserve(max_threads);
+  }
+
+  void Work() {
+    pooled_curl = curl_easy_init();
+
+    while (true) {
+      function<void()> task;
+
+      {
+        unique_lock lock(tasks_mutex_);
+
+        ++num_idle_threads_;
+        tasks_cv_.wait(lock,
+                       [this] { return stop_requested_ || !tasks_.empty(); });
+        --num_idle_threads_;
+
+        if (tasks_.empty()) {
+          break;
+        }
+
+        task = move(tasks_.front());
+        tasks_.pop_front();
+      }
+
+      // 예외는 packaged_task가 future로 전달함
+      task();
+    }
+
+    if (pooled_curl != nullptr) {
+      curl_easy_cleanup(pooled_curl);
+      pooled_curl = nullptr;
+    }
+  }
+
+  static void LockShare(CURL*, const curl_lock_data data, curl_lock_access,
+                        void* user_data) {
+    static_cast<HttpClientPool*>(user_data)->share_mutexes_[data].lock();
+  }
+
+  static void UnlockShare(CURL*, const curl_lock_data data, void* user_data) {
+    static_cast<HttpClientPool*>(user_data)->share_mutexes_[data].unlock();
+  }
+};
+
+}  // namespace
+
 BaseFetcher::BaseFetcher() = default;
 BaseFetcher::~BaseFetcher() = default;
 
+void BaseFetcher::ShutdownHttpClients() {
+  HttpClientPool::GetPool().Shutdown();
+}
+
 BACKTESTING_API shared_ptr<Logger>& BaseFetcher::logger_ = Logger::GetLogger();
 
+void BaseFetcher::SetResponseObserver(ResponseObserver observer) {
+  auto new_observer =
+      observer ? make_shared<const ResponseObserver>(move(observer)) : nullptr;
+
+  lock_guard lock(response_observer_mutex);
+  response_observer = move(new_observer);
+}
+
 future<json> BaseFetcher::Fetch(
     const string& url, const unordered_map<string, string>& params,
     const bool need_signature, const bool sort_params, const string& header_msg,
     const string& api_key_env_var, const string& api_secret_env_var) {
-  return async(launch::async, [url, params, need_signature, sort_params,
-                               header_msg, api_key_env_var,
-                               api_secret_env_var] {
-    CURL* curl = curl_easy_init();
-    if (!curl) {
-      throw runtime_error("CURL 초기화가 실패했습니다.");
-    }
+  return HttpClientPool::GetPool().Submit(
+      [url, params, need_signature, sort_params, header_msg, api_key_env_var,
+       api_secret_env_var] {
+        return json::parse(Request(url, params, need_signature, sort_params,
+                                   header_msg, api_key_env_var,
+                                   api_secret_env_var));
+      });
+}
 
-    string response_string;
-    const string& full_url = BuildFullUrl(url, params, need_signature,
-                                          sort_params, api_secret_env_var);
+future<string> BaseFetcher::FetchText(
+    const string& url, const unordered_map<string, string>& params,
+    const bool need_signature, const bool sort_params, const string& header_msg,
+    const string& api_key_env_var, const string& api_secret_env_var) {
+  return HttpClientPool::GetPool().Submit(
+      [url, params, need_signature, sort_params, header_msg, api_key_env_var,
+       api_secret_env_var] {
+        return Request(url, params, need_signature, sort_params, header_msg,
+                       api_key_env_var, api_secret_env_var);
+      });
+}
 
-    curl_slist* headers = nullptr;
-    string response_header;
-    if (need_signature) {
-      // API KEY 헤더 추가
-      headers = curl_slist_append(
-          headers, (header_msg + GetEnvVariable(api_key_env_var)).c_str());
-      curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
-    }
+string BaseFetcher::Request(const string& url,
+                            const unordered_map<string, string>& params,
+                            const bool need_signature, const bool sort_params,
+                            const string& header_msg,
+                            const string& api_key_env_var,
+                            const string& api_secret_env_var) {
+  const string& full_url = BuildFullUrl(url, params, need_signature,
+                                        sort_params, api_secret_env_var);
+
+  // HTTP 작업 스레드에서는 연결이 살아있는 핸들을 설정만 초기화하여 재사용
+  CURL* curl = pooled_curl;
+  const bool is_pooled = curl != nullptr;
+
+  if (is_pooled) {
+    curl_easy_reset(curl);
+  } else if (curl = curl_easy_init(); !curl) {
+    throw runtime_error("CURL 초기화가 실패했습니다.");
+  }
 
-    curl_easy_setopt(curl, CURLOPT_URL, full_url.c_str());
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response_string);
-    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, HeaderCallback);
-    curl_easy_setopt(curl, CURLOPT_HEADERDATA, &response_header);
-    curl_easy_setopt(curl, CURLOPT_TIMEOUT, 10L);
+  string response_string;
 
-    const CURLcode& response = curl_easy_perform(curl);
+  curl_slist* headers = nullptr;
+  string response_header;
+  if (need_signature) {
+    // API KEY 헤더 추가
+    headers = curl_slist_append(
+        headers, (header_msg + GetEnvVariable(api_key_env_var)).c_str());
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+  }
 
-    long response_code = 0;
-    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response_code);
+  curl_easy_setopt(curl, CURLOPT_URL, full_url.c_str());
+  curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
+  curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response_string);
+  curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, HeaderCallback);
+  curl_easy_setopt(curl, CURLOPT_HEADERDATA, &response_header);
+  curl_easy_setopt(curl, CURLOPT_TIMEOUT, 10L);
+
+  // 연결 재사용 설정. HTTP/2는 서버와 libcurl이 지원할 때만 사용됨
+  curl_easy_setopt(curl, CURLOPT_SHARE, HttpClientPool::GetPool().GetShare());
+  curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+  curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+  curl_easy_setopt(curl, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+  curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, "");
+
+  const int64_t request_time =
+      chrono::duration_cast<chrono::milliseconds>(
+          chrono::system_clock::now().time_since_epoch())
+          .count();
+  const CURLcode& response = curl_easy_perform(curl);
+
+  long response_code = 0;
+  curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response_code);
+  curl_slist_free_all(headers);  // 헤더 메모리 해제
+
+  if (!is_pooled) {
     curl_easy_cleanup(curl);
-    curl_slist_free_all(headers);  // 헤더 메모리 해제
-
-    if (response != CURLE_OK || response_code != 200) {
-      if (response_code == 429 || response_code == 418) {
-        string detail_msg;
-        if (response_code == 429) {
-          // Retry-After 헤더가 있으면 추출하여 메시지에 포함
-          string retry_after;
-          const string& key = "Retry-After:";
-
-          if (const auto pos = response_header.find(key); pos != string::npos) {
-            const auto start = pos + key.size();
-            auto end = response_header.find_first_of("\r\n", start);
-
-            if (end == string::npos) {
-              end = response_header.size();
-            }
-
-            retry_after = response_header.substr(start, end - start);
-
-            // 앞뒤 공백 제거
-            while (!retry_after.empty() &&
-                   isspace(static_cast<unsigned char>(retry_after.front()))) {
-              retry_after.erase(retry_after.begin());
-            }
-
-            while (!retry_after.empty() &&
-                   isspace(static_cast<unsigned char>(retry_after.back()))) {
-              retry_after.pop_back();
-            }
+  }
+
+  // Rate Limit 헤더 등을 반영할 수 있도록 실패한 응답도 전달
+  if (response_code != 0) {
+    shared_ptr<const ResponseObserver> observer;
+    {
+      lock_guard lock(response_observer_mutex);
+      observer = response_observer;
+    }
+
+    if (observer) {
+      (*observer)(response_code, response_header, request_time);
+    }
+  }
+
+  if (response != CURLE_OK || response_code != 200) {
+    if (response_code == 429 || response_code == 418) {
+      string detail_msg;
+      if (response_code == 429) {
+        // Retry-After 헤더가 있으면 추출하여 메시지에 포함
+        string retry_after;
+        const string& key = "Retry-After:";
+
+        if (const auto pos = response_header.find(key); pos != string::npos) {
+          const auto start = pos + key.size();
+          auto end = response_header.find_first_of("\r\n", start);
+
+          if (end == string::npos) {
+            end = response_header.size();
+          }
+
+          retry_after = response_header.substr(start, end - start);
+
+          // 앞뒤 공백 제거
+          while (!retry_after.empty() &&
+                 isspace(static_cast<unsigned char>(retry_after.front()))) {
+            retry_after.erase(retry_after.begin());
           }
 
-          detail_msg = format(
-              "HTTP [{}] 응답 코드 429. 요청이 너무 많아 rate limit에 "
-              "걸렸습니다. {}",
-              full_url,
-              retry_after.empty() ? string("")
-                                  : format(" Retry-After: {}", retry_after));
-        } else {
-          detail_msg = format(
-              "HTTP [{}] 응답 코드 418. 요청이 차단되었거나 비정상 응답입니다.",
-              full_url);
+          while (!retry_after.empty() &&
+                 isspace(static_cast<unsigned char>(retry_after.back()))) {
+            retry_after.pop_back();
+          }
         }
 
-        logger_->Log(ERROR_L, detail_msg, __FILE__, __LINE__, true);
+        detail_msg = format(
+            "HTTP [{}] 응답 코드 429. 요청이 너무 많아 rate limit에 "
+            "걸렸습니다. {}",
+            full_url,
+            retry_after.empty() ? string("")
+                                : format(" Retry-After: {}", retry_after));
       } else {
-        logger_->Log(ERROR_L,
-                     format("HTTP [{}] 응답이 실패했습니다.", full_url),
-                     __FILE__, __LINE__, true);
+        detail_msg = format(
+            "HTTP [{}] 응답 코드 418. 요청이 차단되었거나 비정상 응답입니다.",
+            full_url);
       }
 
-      throw runtime_error(format("[{}] | [{}] | {}", response_header,
-                                 response_code, response_string));
+      logger_->Log(ERROR_L, detail_msg, __FILE__, __LINE__, true);
+
+      throw RateLimitExceeded(format("[{}] | [{}] | {}", response_header,
+                                     response_code, response_string),
+                              response_code);
+    } else {
+      logger_->Log(ERROR_L,
+                   format("HTTP [{}] 응답이 실패했습니다.", full_url),
+                   __FILE__, __LINE__, true);
     }
 
-    return json::parse(response_string);
-  });
+    throw runtime_error(format("[{}] | [{}] | {}", response_header,
+                               response_code, response_string));
+  }
+
+  return response_string;
 }
 
 string BaseFetcher::BuildFullUrl(const string& base_url,
@@ -4,11 +4,11 @@
 #include <filesystem>
 #include <format>
 #include <future>
+#include <mutex>
 #include <string>
 #include <utility>
 
 // 외부 라이브러리
-#include "arrow/array/builder_primitive.h"
 #include "arrow/table.h"
 #include "nlohmann/json.hpp"
 
@@ -19,8 +19,12 @@
 #include "Engines/Backtesting.hpp"
 #include "Engines/DataUtils.hpp"
 #include "Engines/Engine.hpp"
+#include "Engines/FetchScheduler.hpp"
+#include "Engines/KlineDataset.hpp"
+#include "Engines/KlineParser.hpp"
 #include "Engines/Logger.hpp"
 #include "Engines/TimeUtils.hpp"
+#include "Engines/WeightLimiter.hpp"
 
 // 네임 스페이스
 namespace backtesting {
@@ -29,6 +33,21 @@ using namespace utils;
 
 namespace backtesting::fetcher {
 
+// 한 캔들스틱 요청 기간을 동시에 요청할 최대 구간 수
+static constexpr size_t max_kline_slices = 4;
+
+// 구간 하나가 가져야 하는 최소 페이지 수
+static constexpr int64_t min_pages_per_slice = 8;
+
+// 바이낸스 선물의 1분당 REQUEST_WEIGHT 한도
+static constexpr int64_t request_weight_limit = 2400;
+
+// 한도 중 사용할 비율. 나머지는 창 경계의 시간 차이와 응답 전 요청을 위한 여유
+static constexpr double request_weight_ratio = 0.9;
+
+// 429 응답 후 Retry-After만큼 기다렸다가 같은 요청을 다시 보내는 최대 횟수
+static constexpr int max_rate_limit_retries = 3;
+
 BinanceFetcher::BinanceFetcher(string api_key_env_var,
                                string api_secret_env_var) {
   api_key_env_var_ = move(api_key_env_var);
@@ -103,76 +122,62 @@ BACKTESTING_API string BinanceFetcher::exchange_info_url_ =
     futures_endpoint_ + "/fapi/v1/exchangeInfo";
 BACKTESTING_API string BinanceFetcher::leverage_bracket_url_ =
     futures_endpoint_ + "/fapi/v1/leverageBracket";
-BACKTESTING_API BinanceFetcher::TokenBucket*
-    BinanceFetcher::TokenBucket::limiter_ = nullptr;
-
-BinanceFetcher::TokenBucket::TokenBucket(const double capacity,
-                                         const double refill_per_sec)
-    : capacity_(capacity),
-      tokens_(capacity),
-      refill_rate_(refill_per_sec),
-      last_refill_(chrono::steady_clock::now()) {}
-
-BinanceFetcher::TokenBucket& BinanceFetcher::TokenBucket::GetBinanceLimiter() {
-  if (!limiter_) {
-    constexpr double capacity = 2400.0 * 0.5;  // 보수적으로 50%만 사용
-    constexpr double refill_per_sec = capacity / 60.0;
-
-    limiter_ = new TokenBucket(capacity, refill_per_sec);
-  }
 
-  return *limiter_;
-}
-
-void BinanceFetcher::TokenBucket::Acquire(double weight) {
-  if (weight <= 0.0) {
-    return;
-  }
+void BinanceFetcher::SetFuturesEndpoint(const string& futures_endpoint) {
+  futures_endpoint_ = futures_endpoint;
 
-  if (weight > capacity_) {
-    throw runtime_error(format("요청 Weight({})가 버킷 용량({})을 초과합니다.",
-                               weight, capacity_));
-  }
+  server_time_url_ = futures_endpoint_ + "/fapi/v1/time";
+  continuous_klines_url_ = futures_endpoint_ + "/fapi/v1/continuousKlines";
+  mark_price_klines_url_ = futures_endpoint_ + "/fapi/v1/markPriceKlines";
+  funding_rates_url_ = futures_endpoint_ + "/fapi/v1/fundingRate";
+  exchange_info_url_ = futures_endpoint_ + "/fapi/v1/exchangeInfo";
+  leverage_bracket_url_ = futures_endpoint_ + "/fapi/v1/leverageBracket";
+}
 
-  unique_lock lock(mutex_);
+WeightLimiter& BinanceFetcher::GetWeightLimiter() {
+  // 여러 요청 스레드가 동시에 처음 호출할 수 있으므로 한 번만 등록
+  static WeightLimiter limiter(request_weight_limit, request_weight_ratio);
+  static once_flag observer_flag;
+
+  call_once(observer_flag, [] {
+    SetResponseObserver([](const long response_code,
+                           const string& response_header,
+                           const int64_t request_time) {
+      limiter.OnResponse(response_code, response_header, request_time,
+                         WeightLimiter::GetNow());
+    });
+  });
 
-  // 초기 리필 한 번 수행
-  refill();
+  return limiter;
+}
 
-  while (true) {
-    // refill() 후 토큰이 충분하면 즉시 종료
-    if (tokens_ + 1e-12 >= weight) {
-      break;
-    }
+void BinanceFetcher::AcquireBinanceWeight(const int64_t weight) {
+  GetWeightLimiter().Acquire(weight);
+}
 
-    const double deficit = weight - tokens_;
-    double wait_seconds = deficit / max(refill_rate_, 1e-12);
+void BinanceFetcher::LogRateLimitRetry(const int num_retries) {
+  logger_->Log(WARN_L,
+               format("요청 한도를 초과하여 대기 후 같은 요청을 다시 "
+                      "보냅니다. ({}/{})",
+                      num_retries, max_rate_limit_retries),
+               __FILE__, __LINE__, true);
+}
 
-    if (wait_seconds < 0.001) {
-      wait_seconds = 0.001;
-    }
+int64_t BinanceFetcher::GetKlinesWeight(
+    const unordered_map<string, string>& params) {
+  const auto limit_it = params.find("limit");
+  const int64_t limit =
+      limit_it == params.end() ? 500 : stoll(limit_it->second);
 
-    cv_.wait_for(lock, chrono::duration_cast<chrono::milliseconds>(
-                           chrono::duration<double>(wait_seconds)));
-    refill();
+  if (limit < 100) {
+    return 1;
   }
 
-  tokens_ -= weight;
-}
-
-void BinanceFetcher::TokenBucket::refill() {
-  const auto now = chrono::steady_clock::now();
-  const chrono::duration<double> elapsed = now - last_refill_;
-
-  if (const double add = elapsed.count() * refill_rate_; add > 0.0) {
-    tokens_ = min(capacity_, tokens_ + add);
-    last_refill_ = now;
-    cv_.notify_all();
+  if (limit < 500) {
+    return 2;
   }
-}
 
-void BinanceFetcher::AcquireBinanceWeight(const double weight) {
-  TokenBucket::GetBinanceLimiter().Acquire(weight);
+  return limit <= 1000 ? 5 : 10;
 }
 
 void BinanceFetcher::FetchContinuousKlines(
@@ -218,17 +223,17 @@ void BinanceFetcher::FetchContinuousKlines(
                                                  {"startTime", "0"},
                                                  {"limit", "1000"}};
 
-  const auto& klines = FetchKlines(continuous_klines_url_, params, true).get();
+  auto klines = FetchKlines(continuous_klines_url_, params, true).get();
 
   RET_IF_STOP_REQUESTED()
 
-  // 캔들스틱 데이터 변환
-  const auto& transformed_klines = TransformKlines(klines, true);
+  // 최신 캔들은 아직 완성되지 않았으므로 제거
+  klines.PopBack();
 
   RET_IF_STOP_REQUESTED()
 
   // 선물 데이터가 비어있으면 처리 중단
-  if (transformed_klines.empty()) {
+  if (klines.Empty()) {
     logger_->Log(ERROR_L, "선물 데이터가 비어있습니다. 처리를 중단합니다.",
                  __FILE__, __LINE__, true);
 
@@ -239,15 +244,15 @@ void BinanceFetcher::FetchContinuousKlines(
   RET_IF_STOP_REQUESTED()
 
   // 저장
-  SaveKlines(transformed_klines, save_directory,
-             timeframe_filename + ".parquet", true, true);
+  SaveKlines(klines, save_directory, timeframe_filename + ".parquet", true,
+             true);
 
   logger_->Log(
       INFO_L,
       format("[{} - {}] 기간의 [{} {}] 연속 선물 캔들스틱 파일이 [{}] 경로에 "
              "저장되었습니다.",
-             UtcTimestampToUtcDatetime(transformed_klines.front().at(0)),
-             UtcTimestampToUtcDatetime(transformed_klines.back().at(6)), symbol,
+             UtcTimestampToUtcDatetime(klines.open_time.front()),
+             UtcTimestampToUtcDatetime(klines.close_time.back()), symbol,
              timeframe_filename, ConvertBackslashToSlash(file_path)),
       __FILE__, __LINE__, true);
 
@@ -291,24 +296,21 @@ void BinanceFetcher::UpdateContinuousKlines(
     return;
   }
 
-  // Parquet 파일 읽기
-  const shared_ptr<arrow::Table> klines_file = ReadParquet(file_path);
+  // 기존 캔들은 읽지 않고 매니페스트에서 시간 범위만 확인
+  const auto& manifest = KlineDataset::LoadManifest(file_path);
+  const auto& last_part = manifest.GetLastPart();
 
   logger_->Log(
       INFO_L,
       format("[{} - {}] 기간의 [{} {}] 연속 선물 캔들스틱 파일이 존재합니다. "
              "최신 연속 선물 캔들스틱 데이터 업데이트를 시작합니다.",
-             UtcTimestampToUtcDatetime(
-                 any_cast<int64_t>(GetCellValue(klines_file, "Open Time", 0))),
-             UtcTimestampToUtcDatetime(any_cast<int64_t>(GetCellValue(
-                 klines_file, "Close Time", klines_file->num_rows() - 1))),
-             symbol, filename_timeframe),
+             UtcTimestampToUtcDatetime(manifest.base.first_open_time),
+             UtcTimestampToUtcDatetime(last_part.last_close_time), symbol,
+             filename_timeframe),
       __FILE__, __LINE__, true);
 
   // 새로운 Open Time의 시작은 Klines file의 마지막 Open Time의 다음 값
-  const auto end_open_time = any_cast<int64_t>(
-      GetCellValue(klines_file, "Open Time", klines_file->num_rows() - 1));
-  const string& start_time = to_string(end_open_time + 1);
+  const string& start_time = to_string(last_part.last_open_time + 1);
 
   const unordered_map<string, string>& params = {{"pair", symbol},
                                                  {"contractType", "PERPETUAL"},
@@ -318,38 +320,26 @@ void BinanceFetcher::UpdateContinuousKlines(
 
   RET_IF_STOP_REQUESTED()
 
-  const auto& futures_klines =
-      FetchKlines(continuous_klines_url_, params, true).get();
+  auto futures_klines = FetchKlines(continuous_klines_url_, params, true).get();
 
   RET_IF_STOP_REQUESTED()
 
-  if (const auto& transformed_klines = TransformKlines(futures_klines, true);
-      !transformed_klines.empty()) {
-    RET_IF_STOP_REQUESTED()
-
-    // 업데이트된 데이터가 있다면 Array에 저장
-    const auto& arrays = GetArraysAddedKlines(transformed_klines);
-
-    // 새로운 Array로 새로운 Table 생성
-    const auto& schema = klines_file->schema();
-    const auto& new_table = arrow::Table::Make(schema, arrays);
+  // 최신 캔들은 아직 완성되지 않았으므로 제거
+  futures_klines.PopBack();
 
-    // 기존 Table과 새로운 Table을 수직으로 결합
-    const vector<shared_ptr<arrow::Table>>& tables_to_concatenate = {
-        klines_file, new_table};
-    const auto& concatenated_tables_result =
-        ConcatenateTables(tables_to_concatenate);
+  if (!futures_klines.Empty()) {
+    RET_IF_STOP_REQUESTED()
 
-    // 저장
-    TableToParquet(concatenated_tables_result.ValueOrDie(), directory_path,
-                   filename_timeframe + ".parquet", true, true);
+    // 업데이트된 캔들만 조각 파일로 추가
+    KlineDataset::Append(MakeKlinesTable(futures_klines), file_path, true,
+                         true);
 
     logger_->Log(
         INFO_L,
         format("[{} - {}] 기간의 [{} {}] 연속 선물 캔들스틱 파일이 "
                "업데이트되었습니다.",
-               UtcTimestampToUtcDatetime(transformed_klines.front().at(0)),
-               UtcTimestampToUtcDatetime(transformed_klines.back().at(6)),
+               UtcTimestampToUtcDatetime(futures_klines.open_time.front()),
+               UtcTimestampToUtcDatetime(futures_klines.close_time.back()),
                symbol, filename_timeframe),
         __FILE__, __LINE__, true);
   } else {
@@ -418,25 +408,34 @@ void BinanceFetcher::FetchMarkPriceKlines(
   logger_->Log(INFO_L, "마크 가격 캔들스틱 데이터 요청을 시작합니다.", __FILE__,
                __LINE__, true);
 
-  const auto& klines = FetchKlines(mark_price_klines_url_, params, true).get();
+  auto klines = FetchKlines(mark_price_klines_url_, params, true).get();
 
   RET_IF_STOP_REQUESTED()
 
-  // 캔들스틱 데이터 변환
-  const auto& transformed_klines = TransformKlines(klines, true);
+  // 최신 캔들은 아직 완성되지 않았으므로 제거
+  klines.PopBack();
 
   RET_IF_STOP_REQUESTED()
 
+  // 마크 가격 데이터가 비어있으면 처리 중단
+  if (klines.Empty()) {
+    logger_->Log(ERROR_L, "마크 가격 데이터가 비어있습니다. 처리를 중단합니다.",
+                 __FILE__, __LINE__, true);
+
+    Engine::LogSeparator(true);
+    return;
+  }
+
   // 저장
-  SaveKlines(transformed_klines, save_directory,
-             timeframe_filename + ".parquet", false, false);
+  SaveKlines(klines, save_directory, timeframe_filename + ".parquet", false,
+             false);
 
   logger_->Log(
       INFO_L,
       format("[{} - {}] 기간의 [{} {}] 마크 가격 캔들스틱 파일이 [{}] 경로에 "
              "저장되었습니다.",
-             UtcTimestampToUtcDatetime(transformed_klines.front().at(0)),
-             UtcTimestampToUtcDatetime(transformed_klines.back().at(6)), symbol,
+             UtcTimestampToUtcDatetime(klines.open_time.front()),
+             UtcTimestampToUtcDatetime(klines.close_time.back()), symbol,
              timeframe_filename, ConvertBackslashToSlash(file_path)),
       __FILE__, __LINE__, true);
 
@@ -480,24 +479,21 @@ void BinanceFetcher::UpdateMarkPriceKlines(
     return;
   }
 
-  // Parquet 파일 읽기
-  const shared_ptr<arrow::Table> klines_file = ReadParquet(file_path);
+  // 기존 캔들은 읽지 않고 매니페스트에서 시간 범위만 확인
+  const auto& manifest = KlineDataset::LoadManifest(file_path);
+  const auto& last_part = manifest.GetLastPart();
 
   logger_->Log(
       INFO_L,
       format("[{} - {}] 기간의 [{} {}] 마크 가격 캔들스틱 파일이 존재합니다. "
              "최신 마크 가격 캔들스틱 데이터 업데이트를 시작합니다.",
-             UtcTimestampToUtcDatetime(
-                 any_cast<int64_t>(GetCellValue(klines_file, "Open Time", 0))),
-             UtcTimestampToUtcDatetime(any_cast<int64_t>(GetCellValue(
-                 klines_file, "Close Time", klines_file->num_rows() - 1))),
-             symbol, filename_timeframe),
+             UtcTimestampToUtcDatetime(manifest.base.first_open_time),
+             UtcTimestampToUtcDatetime(last_part.last_close_time), symbol,
+             filename_timeframe),
       __FILE__, __LINE__, true);
 
   // 새로운 Open Time의 시작은 Klines file의 마지막 Open Time의 다음 값
-  const auto end_open_time = any_cast<int64_t>(
-      GetCellValue(klines_file, "Open Time", klines_file->num_rows() - 1));
-  const string& start_time = to_string(end_open_time + 1);
+  const string& start_time = to_string(last_part.last_open_time + 1);
 
   const unordered_map<string, string>& params = {{"symbol", symbol},
                                                  {"interval", timeframe},
@@ -506,38 +502,27 @@ void BinanceFetcher::UpdateMarkPriceKlines(
 
   RET_IF_STOP_REQUESTED()
 
-  const auto& mark_price_klines =
+  auto mark_price_klines =
       FetchKlines(mark_price_klines_url_, params, true).get();
 
   RET_IF_STOP_REQUESTED()
 
-  if (const auto& transformed_klines = TransformKlines(mark_price_klines, true);
-      !transformed_klines.empty()) {
-    RET_IF_STOP_REQUESTED()
-
-    // 업데이트된 데이터가 있다면 Array에 저장
-    const auto& arrays = GetArraysAddedKlines(transformed_klines);
-
-    // 새로운 Array로 새로운 Table 생성
-    const auto& schema = klines_file->schema();
-    const auto& new_table = arrow::Table::Make(schema, arrays);
+  // 최신 캔들은 아직 완성되지 않았으므로 제거
+  mark_price_klines.PopBack();
 
-    // 기존 Table과 새로운 Table을 수직으로 결합
-    const vector<shared_ptr<arrow::Table>>& tables_to_concatenate = {
-        klines_file, new_table};
-    const auto& concatenated_tables_result =
-        ConcatenateTables(tables_to_concatenate);
+  if (!mark_price_klines.Empty()) {
+    RET_IF_STOP_REQUESTED()
 
-    // 저장
-    TableToParquet(concatenated_tables_result.ValueOrDie(), directory_path,
-                   filename_timeframe + ".parquet", false, false);
+    // 업데이트된 캔들만 조각 파일로 추가
+    KlineDataset::Append(MakeKlinesTable(mark_price_klines), file_path, false,
+                         false);
 
     logger_->Log(
         INFO_L,
         format("[{} - {}] 기간의 [{} {}] 마크 가격 캔들스틱 파일이 "
                "업데이트되었습니다.",
-               UtcTimestampToUtcDatetime(transformed_klines.front().at(0)),
-               UtcTimestampToUtcDatetime(transformed_klines.back().at(6)),
+               UtcTimestampToUtcDatetime(mark_price_klines.open_time.front()),
+               UtcTimestampToUtcDatetime(mark_price_klines.close_time.back()),
                symbol, filename_timeframe),
         __FILE__, __LINE__, true);
   } else {
@@ -769,7 +754,7 @@ void BinanceFetcher::UpdateFundingRates(
 
 void BinanceFetcher::FetchExchangeInfo(const string& exchange_info_path) {
   try {
-    AcquireBinanceWeight(1.0);
+    AcquireBinanceWeight(1);
 
     JsonToFile(Fetch(exchange_info_url_), exchange_info_path);
   } catch (const exception& e) {
@@ -791,7 +776,7 @@ void BinanceFetcher::FetchExchangeInfo(const string& exchange_info_path) {
 void BinanceFetcher::FetchLeverageBracket(
     const string& leverage_bracket_path) const {
   try {
-    AcquireBinanceWeight(1.0);
+    AcquireBinanceWeight(1);
 
     JsonToFile(Fetch(leverage_bracket_url_,
                      {{"timestamp", to_string(GetServerTime())}}, true, false,
@@ -814,87 +799,202 @@ void BinanceFetcher::FetchLeverageBracket(
       __FILE__, __LINE__, true);
 }
 
-future<vector<json>> BinanceFetcher::FetchKlines(
+future<KlineColumns> BinanceFetcher::FetchKlines(
     const string& url, const unordered_map<string, string>& params,
     const bool forward) {
   return async(launch::async, [=] {
-    deque<json> result;
-    auto param = params;
+    KlineColumns result;
+
+    // 앞으로 가져올 때는 기간을 구간으로 나눠 동시에 요청한 후 구간 순서대로
+    // 이어 붙임. 마지막 구간은 끝 시간 없이 최신 데이터까지 요청
+    if (const auto& slices = forward ? PlanKlineSlices(url, params)
+                                     : vector<pair<int64_t, int64_t>>{};
+        slices.size() > 1) {
+      vector<future<KlineColumns>> slice_futures;
+      slice_futures.reserve(slices.size());
+
+      for (size_t slice_idx = 0; slice_idx < slices.size(); slice_idx++) {
+        auto slice_params = params;
+        slice_params["startTime"] = to_string(slices[slice_idx].first);
+
+        if (slice_idx + 1 < slices.size()) {
+          slice_params["endTime"] = to_string(slices[slice_idx].second);
+        }
+
+        slice_futures.push_back(async(launch::async, [=] {
+          return FetchKlinePages(url, slice_params, true);
+        }));
+      }
+
+      for (auto& slice_future : slice_futures) {
+        result.Append(slice_future.get());
+      }
+    } else {
+      result = FetchKlinePages(url, params, forward);
+    }
+
+    if (!result.Empty()) {
+      logger_->Log(
+          INFO_L,
+          format("[{} - {}] 기간의 데이터가 요청 완료 되었습니다.",
+                 UtcTimestampToUtcDatetime(result.open_time.front()),
+                 UtcTimestampToUtcDatetime(result.close_time.back())),
+          __FILE__, __LINE__, true);
+    } else {
+      logger_->Log(INFO_L, "요청한 데이터가 비어있습니다.", __FILE__, __LINE__,
+                   true);
+    }
+
+    return result;
+  });
+}
+
+KlineColumns BinanceFetcher::FetchKlinePages(
+    const string& url, const unordered_map<string, string>& params,
+    const bool forward) {
+  // 뒤로 가져올 때는 페이지를 앞에 붙여야 하므로 페이지별로 모은 후 마지막에
+  // 한 번에 이어 붙임
+  KlineColumns result;
+  deque<KlineColumns> backward_pages;
+  auto param = params;
+  int num_retries = 0;
+
+  while (true) {
+    // 중지 요청 확인
+    if (Backtesting::IsStopRequested()) {
+      break;
+    }
+
+    try {
+      AcquireBinanceWeight(GetKlinesWeight(param));
+
+      // fetched_future를 미리 받아둠
+      auto fetched_future = FetchText(url, param);
+
+      // Fetch 대기
+      const string& body = fetched_future.get();
 
-    while (true) {
       // 중지 요청 확인
       if (Backtesting::IsStopRequested()) {
         break;
       }
 
-      try {
-        AcquireBinanceWeight(5.0);
+      // 응답 본문을 Json 트리 없이 열별 버퍼로 바로 파싱
+      KlineColumns page;
+      if (!ParseKlines(body, page)) {
+        // 캔들스틱 배열이 아니면 오류 응답이므로 잘못된 심볼 등의 응답이면
+        // 종료하고 그 외에는 에러
+        if (const auto& error = json::parse(body);
+            error.contains("code") && error["code"] == -1121) {
+          break;
+        }
 
-        // fetched_future를 미리 받아둠
-        auto fetched_future = Fetch(url, param);
+        throw runtime_error(body);
+      }
 
-        // Fetch 대기
-        const auto& fetched_data = fetched_future.get();
+      // fetch 해온 데이터가 비어있으면 종료
+      if (page.Empty()) {
+        break;
+      }
 
-        // 중지 요청 확인
-        if (Backtesting::IsStopRequested()) {
-          break;
-        }
+      logger_->Log(INFO_L,
+                   format("[{} - {}] 요청 완료",
+                          UtcTimestampToUtcDatetime(page.open_time.front()),
+                          UtcTimestampToUtcDatetime(page.close_time.back())),
+                   __FILE__, __LINE__, true);
 
-        // fetch 해온 데이터가 비어있거나 잘못된 데이터면 종료
-        if (fetched_data.empty() ||
-            (fetched_data.contains("code") && fetched_data["code"] == -1121)) {
-          break;
-        }
+      if (forward) {
+        // 다음 startTime은 마지막 startTime의 뒤 시간
+        param["startTime"] = to_string(page.open_time.back() + 1);
 
-        logger_->Log(INFO_L,
-                     format("[{} - {}] 요청 완료",
-                            UtcTimestampToUtcDatetime(
-                                fetched_data.front().at(0).get<int64_t>()),
-                            UtcTimestampToUtcDatetime(
-                                fetched_data.back().at(6).get<int64_t>())),
-                     __FILE__, __LINE__, true);
+        result.Append(page);
+      } else {
+        // 다음 endTime은 첫 startTime의 앞 시간
+        param["endTime"] = to_string(page.open_time.front() - 1);
 
-        if (forward) {
-          // 앞부터 순회하여 뒤에 붙임
-          for (const auto& data : fetched_data) {
-            result.push_back(data);
-          }
-
-          // 다음 startTime은 마지막 startTime의 뒤 시간
-          param["startTime"] =
-              to_string(result.back().at(0).get<int64_t>() + 1);
-        } else {
-          // 뒤부터 순회하여 앞에 붙임
-          for (auto kline = fetched_data.rbegin(); kline != fetched_data.rend();
-               ++kline)
-            result.push_front(*kline);
-
-          // 다음 endTime은 첫 startTime의 앞 시간
-          param["endTime"] = to_string(result.front().at(0).get<int64_t>() - 1);
-        }
-      } catch (const exception& e) {
-        logger_->Log(ERROR_L, "데이터를 요청하는 중 에러가 발생했습니다.",
-                     __FILE__, __LINE__, true);
+        backward_pages.push_front(move(page));
+      }
 
-        throw runtime_error(e.what());
+      num_retries = 0;
+    } catch (const RateLimitExceeded& e) {
+      // 제한기가 Retry-After 동안 요청을 멈추므로 같은 페이지를 다시 요청
+      if (e.GetResponseCode() == 429 &&
+          num_retries++ < max_rate_limit_retries) {
+        LogRateLimitRetry(num_retries);
+        continue;
       }
+
+      logger_->Log(ERROR_L, "데이터를 요청하는 중 에러가 발생했습니다.",
+                   __FILE__, __LINE__, true);
+
+      throw runtime_error(e.what());
+    } catch (const exception& e) {
+      logger_->Log(ERROR_L, "데이터를 요청하는 중 에러가 발생했습니다.",
+                   __FILE__, __LINE__, true);
+
+      throw runtime_error(e.what());
     }
+  }
 
-    if (!result.empty()) {
-      logger_->Log(
-          INFO_L,
-          format("[{} - {}] 기간의 데이터가 요청 완료 되었습니다.",
-                 UtcTimestampToUtcDatetime(result.front().at(0).get<int64_t>()),
-                 UtcTimestampToUtcDatetime(result.back().at(6).get<int64_t>())),
-          __FILE__, __LINE__, true);
-    } else {
-      logger_->Log(INFO_L, "요청한 데이터가 비어있습니다.", __FILE__, __LINE__,
-                   true);
+  for (const auto& page : backward_pages) {
+    result.Append(page);
+  }
+
+  return result;
+}
+
+vector<pair<int64_t, int64_t>> BinanceFetcher::PlanKlineSlices(
+    const string& url, const unordered_map<string, string>& params) {
+  const auto interval_it = params.find("interval");
+  const auto start_time_it = params.find("startTime");
+  if (interval_it == params.end() || start_time_it == params.end() ||
+      params.contains("endTime")) {
+    return {};
+  }
+
+  const auto interval = ParseTimeframe(interval_it->second);
+  const auto page_size =
+      params.contains("limit") ? stoll(params.at("limit")) : 500;
+
+  // 업데이트처럼 시작 시간이 최근이면 나눌 만큼 길지 않으므로 추가 요청 없이
+  // 순서대로 요청
+  if (const auto start_time = stoll(start_time_it->second); start_time > 0) {
+    const auto now = chrono::duration_cast<chrono::milliseconds>(
+                         chrono::system_clock::now().time_since_epoch())
+                         .count();
+
+    if ((now - start_time) / (interval * page_size) <
+        2 * min_pages_per_slice) {
+      return {};
     }
+  }
 
-    return vector(result.begin(), result.end());
-  });
+  try {
+    // 시작 시간이 상장 전일 수 있으므로 첫 캔들을 한 개만 요청하여 실제 시작
+    // 시간을 구함
+    auto probe_params = params;
+    probe_params["limit"] = "1";
+
+    AcquireBinanceWeight(GetKlinesWeight(probe_params));
+    const auto& probe = Fetch(url, probe_params).get();
+
+    if (!probe.is_array() || probe.empty()) {
+      return {};
+    }
+
+    return FetchScheduler::PlanTimeSlices(
+        probe.front().at(0).get<int64_t>(), GetServerTime(), interval,
+        page_size, max_kline_slices, min_pages_per_slice);
+  } catch (const exception& e) {
+    // 구간을 나누지 못하면 기존처럼 처음부터 순서대로 요청
+    logger_->Log(WARN_L,
+                 format("요청 기간을 구간으로 나누지 못해 순서대로 요청합니다: "
+                        "{}",
+                        e.what()),
+                 __FILE__, __LINE__, true);
+
+    return {};
+  }
 }
 
 future<vector<json>> BinanceFetcher::FetchContinuousFundingRates(
@@ -902,13 +1002,14 @@ future<vector<json>> BinanceFetcher::FetchContinuousFundingRates(
   return async(launch::async, [=] {
     vector<json> result;
     auto param = params;
+    int num_retries = 0;
 
     while (true) {
       // 중지 요청 확인
       BRK_IF_STOP_REQUESTED()
 
       try {
-        AcquireBinanceWeight(1.0);
+        AcquireBinanceWeight(1);
 
         // fetched_future를 미리 받아둠
         auto fetched_future = Fetch(url, param);
@@ -942,6 +1043,20 @@ future<vector<json>> BinanceFetcher::FetchContinuousFundingRates(
         // 다음 startTime은 마지막 startTime의 뒤 시간
         param["startTime"] =
             to_string(result.back()["fundingTime"].get<int64_t>() + 1);
+
+        num_retries = 0;
+      } catch (const RateLimitExceeded& e) {
+        // 제한기가 Retry-After 동안 요청을 멈추므로 같은 구간을 다시 요청
+        if (e.GetResponseCode() == 429 &&
+            num_retries++ < max_rate_limit_retries) {
+          LogRateLimitRetry(num_retries);
+          continue;
+        }
+
+        logger_->Log(ERROR_L, "데이터를 요청하는 중 에러가 발생했습니다.",
+                     __FILE__, __LINE__, true);
+
+        throw runtime_error(e.what());
       } catch (const exception& e) {
         logger_->Log(ERROR_L, "데이터를 요청하는 중 에러가 발생했습니다.",
                      __FILE__, __LINE__, true);
@@ -976,81 +1091,39 @@ string BinanceFetcher::GetFilenameWithTimeframe(const string& timeframe) {
   return timeframe;
 }
 
-vector<json> BinanceFetcher::TransformKlines(const vector<json>& klines,
-                                             const bool drop_latest) {
-  logger_->Log(INFO_L, "데이터 변환을 시작합니다.", __FILE__, __LINE__, true);
-
-  const size_t size = drop_latest ? klines.size() - 1 : klines.size();
-  vector<json> transformed_klines(size);
-
-#pragma omp parallel for
-  for (int i = 0; i < size; i++) {
-    // 중지 요청 확인
-    BRK_IF_STOP_REQUESTED()
-
-    const auto& kline = klines[i];
-
-    try {
-      json bar;
-
-      // Open Time 추가
-      bar.push_back(static_cast<int64_t>(kline[0]));
-
-      // OHLCV 추가
-      // 가격 데이터는 String 타입으로 들어오기 때문에 String을 Double로 변환
-      for (int j = 1; j <= 5; j++) {
-        bar.push_back(stod(kline[j].get<string>()));
-      }
-
-      // Close Time 추가
-      bar.push_back(static_cast<int64_t>(kline[6]));
-
-      // 미리 할당한 위치에 저장
-      transformed_klines[i] = bar;
-    } catch (const exception& e) {
-#pragma omp critical
-      {
-        const string& err =
-            format("데이터 변환 중 에러가 발생했습니다: {}", e.what());
-        logger_->Log(WARN_L, err, __FILE__, __LINE__, true);
-      }
-
-      // 에러 발생 시 빈 JSON 객체 저장
-      transformed_klines[i] = json();
-    }
-  }
-
-  return transformed_klines;
-}
-
-vector<json> BinanceFetcher::ConcatKlines(const vector<json>& spot_klines,
-                                          const vector<json>& futures_klines) {
+KlineColumns BinanceFetcher::ConcatKlines(
+    const KlineColumns& spot_klines, const KlineColumns& futures_klines) {
   // 연결 시점의 시간 정보 로깅
   logger_->Log(
       INFO_L,
-      format(
-          "현물-선물 연결 시점: 현물 마지막 바({}) - 선물 첫 바({})",
-          UtcTimestampToUtcDatetime(spot_klines.back()[0].get<int64_t>()),
-          UtcTimestampToUtcDatetime(futures_klines.front()[0].get<int64_t>())),
+      format("현물-선물 연결 시점: 현물 마지막 바({}) - 선물 첫 바({})",
+             UtcTimestampToUtcDatetime(spot_klines.open_time.back()),
+             UtcTimestampToUtcDatetime(futures_klines.open_time.front())),
       __FILE__, __LINE__, true);
 
   // 현물 데이터를 그대로 복사
-  vector<json> combined_klines = spot_klines;
+  KlineColumns combined_klines = spot_klines;
 
   // futures 데이터를 한 번에 추가
-  combined_klines.insert(combined_klines.end(), futures_klines.begin(),
-                         futures_klines.end());
+  combined_klines.Append(futures_klines);
 
   return combined_klines;
 }
 
-void BinanceFetcher::SaveKlines(const vector<json>& klines,
+void BinanceFetcher::SaveKlines(const KlineColumns& klines,
                                 const string& directory_path,
                                 const string& file_name,
                                 const bool save_split_files,
                                 const bool reset_directory) {
   logger_->Log(INFO_L, "데이터 저장을 시작합니다.", __FILE__, __LINE__, true);
 
+  KlineDataset::WriteBase(MakeKlinesTable(klines),
+                          directory_path + "/" + file_name, save_split_files,
+                          reset_directory);
+}
+
+shared_ptr<arrow::Table> BinanceFetcher::MakeKlinesTable(
+    const KlineColumns& klines) {
   // column 추가
   const vector<string>& column_names{"Open Time", "Open",   "High",      "Low",
                                      "Close",     "Volume", "Close Time"};
@@ -1067,77 +1140,8 @@ void BinanceFetcher::SaveKlines(const vector<json>& klines,
   // 스키마 생성
   const auto& schema = arrow::schema(arrow_fields);
 
-  // Klines를 Array에 추가
-  const auto& arrays = GetArraysAddedKlines(klines);
-
-  // Table 생성
-  const auto& table = arrow::Table::Make(schema, arrays);
-
-  // 저장
-  TableToParquet(table, directory_path, file_name, save_split_files,
-                 reset_directory);
-}
-
-vector<shared_ptr<arrow::Array>> BinanceFetcher::GetArraysAddedKlines(
-    const vector<json>& klines) {
-  const size_t num_rows = klines.size();
-
-  // 임시 데이터 저장소
-  vector<int64_t> open_time(num_rows);
-  vector<double> open(num_rows);
-  vector<double> high(num_rows);
-  vector<double> low(num_rows);
-  vector<double> close(num_rows);
-  vector<double> volume(num_rows);
-  vector<int64_t> close_time(num_rows);
-
-#pragma omp parallel for
-  for (int row = 0; row < num_rows; ++row) {
-    const auto& json = klines[row];
-    open_time[row] = json[0].get<int64_t>();
-    open[row] = json[1].get<double>();
-    high[row] = json[2].get<double>();
-    low[row] = json[3].get<double>();
-    close[row] = json[4].get<double>();
-    volume[row] = json[5].get<double>();
-    close_time[row] = json[6].get<int64_t>();
-  }
-
-  // 빌더 생성
-  vector<shared_ptr<arrow::ArrayBuilder>> builders(7);
-  builders[0] = make_shared<arrow::Int64Builder>();  // Open Time
-  for (int i = 1; i <= 5; i++) {
-    builders[i] = make_shared<arrow::DoubleBuilder>();  // OHLCV
-  }
-  builders[6] = make_shared<arrow::Int64Builder>();  // Close Time
-
-  // 데이터를 Builder에 추가 후 Array에 추가
-  vector<shared_ptr<arrow::Array>> arrays(7);
-  const vector<vector<double>*>& price_data = {nullptr, &open,   &high,  &low,
-                                               &close,  &volume, nullptr};
-  const vector<vector<int64_t>*>& time_data = {
-      &open_time, nullptr, nullptr, nullptr, nullptr, nullptr, &close_time};
-
-  for (int column_idx = 0; column_idx < 7; ++column_idx) {
-    if (column_idx == 0 || column_idx == 6) {  // 시간 데이터
-      auto builder = make_shared<arrow::Int64Builder>();
-      if (auto* int64_builder = builder.get();
-          !int64_builder->AppendValues(*time_data[column_idx]).ok() ||
-          !int64_builder->Finish(&arrays[column_idx]).ok()) {
-        throw runtime_error(format("{} time 데이터를 처리하는 데 실패했습니다.",
-                                   column_idx == 0 ? "Open" : "Close"));
-      }
-    } else {  // 가격 데이터
-      auto builder = make_shared<arrow::DoubleBuilder>();
-      if (auto* double_builder = builder.get();
-          !double_builder->AppendValues(*price_data[column_idx]).ok() ||
-          !double_builder->Finish(&arrays[column_idx]).ok()) {
-        throw runtime_error("가격 데이터를 처리하는 데 실패했습니다.");
-      }
-    }
-  }
-
-  return arrays;
+  // Klines를 Array로 변환하여 Table 생성
+  return arrow::Table::Make(schema, klines.ToArrays());
 }
 
 string BinanceFetcher::ConvertBackslashToSlash(const string& path_string) {
@@ -1150,7 +1154,7 @@ string BinanceFetcher::ConvertBackslashToSlash(const string& path_string) {
 
 int64_t BinanceFetcher::GetServerTime() {
   try {
-    AcquireBinanceWeight(1.0);
+    AcquireBinanceWeight(1);
 
     return Fetch(server_time_url_).get()["serverTime"];
   } catch (const exception& e) {
@@ -3,12 +3,18 @@
 
 // 내부 헤더
 #include "Engines/Logger.hpp"
+#include "Engines/Numeric.hpp"
 #include "Engines/Slippage.hpp"
 
 namespace backtesting::engine {
 
 Config::Config()
-    : initial_balance_(NAN),
+    : use_indicator_cache_(true),
+      use_lazy_indicator_(false),
+      indicator_threads_(1),
+      comparison_mode_(ComparisonMode::RELATIVE),
+      comparison_tolerance_(0),
+      initial_balance_(NAN),
       taker_fee_percentage_(NAN),
       maker_fee_percentage_(NAN),
       check_same_bar_data_with_target_(true),
@@ -94,6 +100,28 @@ Config& Config::SetUseBarMagnifier(const bool use_bar_magnifier) {
   return *this;
 }
 
+Config& Config::SetUseIndicatorCache(const bool use_indicator_cache) {
+  use_indicator_cache_ = use_indicator_cache;
+  return *this;
+}
+
+Config& Config::SetUseLazyIndicator(const bool use_lazy_indicator) {
+  use_lazy_indicator_ = use_lazy_indicator;
+  return *this;
+}
+
+Config& Config::SetIndicatorThreads(const int indicator_threads) {
+  indicator_threads_ = indicator_threads;
+  return *this;
+}
+
+Config& Config::SetComparisonMode(const ComparisonMode comparison_mode,
+                                  const double tolerance) {
+  comparison_mode_ = comparison_mode;
+  comparison_tolerance_ = tolerance;
+  return *this;
+}
+
 Config& Config::SetInitialBalance(const double initial_balance) {
   initial_balance_ = initial_balance;
   return *this;
@@ -157,6 +185,12 @@ string Config::GetStrategyHeaderPath() { return strategy_header_path_; }
 string Config::GetStrategySourcePath() { return strategy_source_path_; }
 optional<Period> Config::GetBacktestPeriod() const { return backtest_period_; }
 optional<bool> Config::GetUseBarMagnifier() const { return use_bar_magnifier_; }
+bool Config::GetUseIndicatorCache() const { return use_indicator_cache_; }
+
+bool Config::GetUseLazyIndicator() const { return use_lazy_indicator_; }
+int Config::GetIndicatorThreads() const { return indicator_threads_; }
+ComparisonMode Config::GetComparisonMode() const { return comparison_mode_; }
+double Config::GetComparisonTolerance() const { return comparison_tolerance_; }
 double Config::GetInitialBalance() const { return initial_balance_; }
 double Config::GetTakerFeePercentage() const { return taker_fee_percentage_; }
 double Config::GetMakerFeePercentage() const { return maker_fee_percentage_; }
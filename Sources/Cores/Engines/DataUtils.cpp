@@ -338,12 +338,13 @@ void TableToParquet(const shared_ptr<arrow::Table>& table,
                                file_path, close_status.ToString()));
   }
 
-  if (!save_split_files) {
-    return;
+  if (save_split_files) {
+    TableToSplitParquet(table, directory_path);
   }
+}
 
-  // ===========================================================================
-  // ※ 분할 저장
+void TableToSplitParquet(const shared_ptr<arrow::Table>& table,
+                         const string& directory_path) {
   // 전체 행 수와 청크 크기 설정
   int64_t total_rows = table->num_rows();
   int64_t chunk_size = 10000;
@@ -6,6 +6,8 @@
 #include <format>
 #include <ranges>
 #include <set>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 
 // 외부 라이브러리
@@ -24,7 +26,12 @@
 #include "Engines/Config.hpp"
 #include "Engines/DataUtils.hpp"
 #include "Engines/Exception.hpp"
+#include "Engines/IndicatorCache.hpp"
+#include "Engines/IndicatorScheduler.hpp"
+#include "Engines/JsonFileCache.hpp"
+#include "Engines/Numeric.hpp"
 #include "Engines/OrderHandler.hpp"
+#include "Engines/Profiler.hpp"
 #include "Engines/Strategy.hpp"
 #include "Engines/SymbolInfo.hpp"
 #include "Engines/TimeUtils.hpp"
@@ -32,6 +39,7 @@
 // 네임 스페이스
 namespace backtesting {
 using namespace exception;
+using namespace profiler;
 using namespace utils;
 }  // namespace backtesting
 
@@ -48,7 +56,8 @@ Engine::Engine()
       current_open_time_(0),
       current_close_time_(0),
       next_month_boundary_(0),
-      all_trading_ended_(false) {}
+      all_trading_ended_(false),
+      num_processed_bars_(0) {}
 
 void Engine::Deleter::operator()(const Engine* p) const { delete p; }
 
@@ -70,6 +79,24 @@ shared_ptr<Engine>& Engine::GetEngine() {
 }
 
 void Engine::Backtesting() {
+#if BACKTESTING_ENABLE_PROFILING
+  // 이번 실행의 프로파일링 구간 초기화
+  Profiler::Reset();
+#endif
+
+  // 서버 모드에서는 진행 상황을 로그 대신 프레임으로 전달
+  if (Backtesting::IsServerMode()) {
+    progress_.Start(Backtesting::GetRunningJobId());
+  }
+
+  // 중지나 예외로 일찍 반환해도 마지막 프레임을 출력하여 보고를 종료
+  struct ProgressFinisher {
+    ProgressReporter& progress;
+    ~ProgressFinisher() { progress.Finish(); }
+  } const progress_finisher{progress_};
+
+  progress_.BeginPhase("initialize");
+
   LogSeparator(true);
   Initialize();
   RET_IF_STOP_REQUESTED()
@@ -78,6 +105,9 @@ void Engine::Backtesting() {
   logger_->Log(INFO_L, std::format("백테스팅을 시작합니다."), __FILE__,
                __LINE__, true);
 
+  progress_.SetTimeRange(begin_open_time_, end_close_time_);
+  progress_.BeginPhase("backtesting");
+
   try {
     BacktestingMain();
   } catch ([[maybe_unused]] const Bankruptcy& e) {
@@ -89,6 +119,8 @@ void Engine::Backtesting() {
 
   RET_IF_STOP_REQUESTED()
 
+  progress_.BeginPhase("save");
+
   LogSeparator(true);
   logger_->Log(INFO_L, "백테스팅 결과 저장을 시작합니다.", __FILE__, __LINE__,
                true);
@@ -119,6 +151,13 @@ void Engine::Backtesting() {
   }
   RET_IF_STOP_REQUESTED()
 
+#if BACKTESTING_ENABLE_PROFILING
+  // 구간별 시간 분석 표와 Chrome 트레이스 저장
+  analyzer_->SaveProfile();
+#endif
+
+  progress_.Finish();
+
   LogSeparator(true);
   logger_->Log(INFO_L, "백테스팅이 완료되었습니다.", __FILE__, __LINE__, true);
 
@@ -352,6 +391,27 @@ void Engine::IsValidConfig() {
           "주세요.");
     }
 
+    if (!ComparisonPolicy::kRuntimeMode &&
+        config_->GetComparisonMode() != ComparisonMode::RELATIVE) {
+      throw runtime_error(
+          "RELATIVE 이외의 비교 방식은 BACKTESTING_RUNTIME_COMPARISON 옵션으로 "
+          "빌드해야 사용할 수 있습니다.");
+    }
+
+    if (const auto comparison_tolerance = config_->GetComparisonTolerance();
+        !isfinite(comparison_tolerance) || comparison_tolerance < 0) {
+      throw runtime_error(
+          format("지정된 비교 오차 [{}]는 0 이상의 유한한 값이어야 합니다.",
+                 comparison_tolerance));
+    }
+
+    if (const auto indicator_threads = config_->GetIndicatorThreads();
+        indicator_threads < 0) {
+      throw runtime_error(
+          format("지정된 지표 계산 스레드 개수 [{}]는 0 이상이어야 합니다.",
+                 indicator_threads));
+    }
+
     logger_->Log(INFO_L, "엔진 설정 유효성 검증이 완료되었습니다.", __FILE__,
                  __LINE__, true);
   } catch (const std::exception& e) {
@@ -759,13 +819,13 @@ void Engine::IsValidSymbolInfo() {
   const auto trading_num_symbols = trading_bar_data->GetNumSymbols();
 
   try {
-    if (exchange_info_.empty()) {
+    if (exchange_info_ == nullptr) {
       throw runtime_error(
           "엔진에 거래소 정보가 추가되지 않았습니다. "
           "Backtesting::AddExchangeInfo 함수를 호출해 주세요.");
     }
 
-    if (leverage_bracket_.empty()) {
+    if (leverage_bracket_ == nullptr) {
       throw runtime_error(
           "엔진에 레버리지 구간이 추가되지 않았습니다. "
           "Backtesting::AddLeverageBracket 함수를 호출해 주세요.");
@@ -789,7 +849,7 @@ void Engine::IsValidSymbolInfo() {
       if (const auto& symbol_name =
               trading_bar_data->GetSafeSymbolName(symbol_idx);
           symbol_name !=
-          funding_rates_[symbol_idx][0]["symbol"].get<string>()) {
+          funding_rates_[symbol_idx]->data[0]["symbol"].get<string>()) {
         throw runtime_error(
             format("펀딩 비율에 [{}]이(가) 존재하지 않거나 "
                    "트레이딩 바 데이터에 추가된 심볼 순서와 일치하지 않습니다.",
@@ -879,6 +939,15 @@ void Engine::IsValidIndicators() {
         }
       }
 
+      // 계산 값을 버리는 지표는 플롯할 수 없음
+      if (indicator->GetOutputStorage() == OutputStorage::DISCARD &&
+          indicator->plot_type_ != "Null") {
+        throw runtime_error(
+            format("[{}] 전략에서 사용하는 [{}] 지표는 계산 값을 버리도록 "
+                   "설정되었으므로 플롯할 수 없습니다.",
+                   strategy_name, indicator_name));
+      }
+
       // 지표 플롯 타입 검사
       if (const auto& plot_type = indicator->plot_type_;
           plot_type != "Area" && plot_type != "Baseline" &&
@@ -912,6 +981,10 @@ void Engine::InitializeEngine() {
   // 돋보기 기능 사용 여부 결정
   use_bar_magnifier_ = *config_->GetUseBarMagnifier();
 
+  // 전략의 Numeric 비교 방식 설정
+  ComparisonPolicy::Set(config_->GetComparisonMode(),
+                        config_->GetComparisonTolerance());
+
   // 바 데이터 초기화
   trading_bar_data_ = bar_->GetBarData(TRADING, "");
   if (use_bar_magnifier_) {
@@ -1001,73 +1074,68 @@ void Engine::InitializeSymbolInfo() {
 
     // 거래소 정보 초기화
     try {
-      bool symbol_found = false;
-
       // 데이터 경로 설정
       symbol_info.SetExchangeInfoPath(exchange_info_path_);
 
-      // 거래소 정보의 symbols 배열 내 모든 심볼들을 순회
-      for (const auto& symbol : exchange_info_.at("symbols")) {
-        if (symbol.at("symbol") == symbol_name &&
-            symbol.at("contractType") == "PERPETUAL") {
-          // 해당 심볼이 존재한다면 필요한 정보들로 초기화
-          int filter_count = 0;  // filter 배열에서 값을 찾은 횟수
-          for (const auto& filters = symbol.at("filters");
-               const auto& filter : filters) {
-            if (filter.at("filterType") == "PRICE_FILTER") {
-              const auto price_step = GetDoubleFromJson(filter, "tickSize");
-
-              symbol_info.SetPriceStep(price_step);
-              symbol_info.SetPricePrecision(CountDecimalPlaces(price_step));
-              filter_count += 1;
-              continue;
-            }
+      // 파싱할 때 만든 인덱스로 symbols 배열에서 심볼을 찾음
+      const auto& symbol_indices = exchange_info_->symbol_indices;
+      const auto symbol_it = symbol_indices.find(symbol_name);
+      if (symbol_it == symbol_indices.end()) {
+        throw invalid_argument(
+            format("거래소 정보에 [symbol: {}] && [contractType: PERPETUAL]인 "
+                   "객체가 존재하지 않습니다.",
+                   symbol_name));
+      }
 
-            if (filter.at("filterType") == "LOT_SIZE") {
-              symbol_info.SetLimitMaxQty(GetDoubleFromJson(filter, "maxQty"))
-                  .SetLimitMinQty(GetDoubleFromJson(filter, "minQty"));
-              filter_count += 2;
-              continue;
-            }
+      const auto& symbol =
+          exchange_info_->data.at("symbols")[symbol_it->second];
 
-            if (filter.at("filterType") == "MARKET_LOT_SIZE") {
-              const auto qty_step = GetDoubleFromJson(filter, "stepSize");
+      // 해당 심볼이 존재한다면 필요한 정보들로 초기화
+      int filter_count = 0;  // filter 배열에서 값을 찾은 횟수
+      for (const auto& filters = symbol.at("filters");
+           const auto& filter : filters) {
+        if (filter.at("filterType") == "PRICE_FILTER") {
+          const auto price_step = GetDoubleFromJson(filter, "tickSize");
 
-              symbol_info.SetMarketMaxQty(GetDoubleFromJson(filter, "maxQty"))
-                  .SetMarketMinQty(GetDoubleFromJson(filter, "minQty"))
-                  .SetQtyStep(qty_step)
-                  .SetQtyPrecision(CountDecimalPlaces(qty_step));
-              filter_count += 3;
-              continue;
-            }
+          symbol_info.SetPriceStep(price_step);
+          symbol_info.SetPricePrecision(CountDecimalPlaces(price_step));
+          filter_count += 1;
+          continue;
+        }
 
-            if (filter.at("filterType") == "MIN_NOTIONAL") {
-              symbol_info.SetMinNotionalValue(
-                  GetDoubleFromJson(filter, "notional"));
-              filter_count += 1;
-            }
-          }
+        if (filter.at("filterType") == "LOT_SIZE") {
+          symbol_info.SetLimitMaxQty(GetDoubleFromJson(filter, "maxQty"))
+              .SetLimitMinQty(GetDoubleFromJson(filter, "minQty"));
+          filter_count += 2;
+          continue;
+        }
 
-          if (filter_count != 7) {
-            throw invalid_argument(
-                format("[{}] filters의 심볼 정보 중 일부가 존재하지 않습니다.",
-                       symbol_name));
-          }
+        if (filter.at("filterType") == "MARKET_LOT_SIZE") {
+          const auto qty_step = GetDoubleFromJson(filter, "stepSize");
 
-          symbol_info.SetLiquidationFeeRate(
-              GetDoubleFromJson(symbol, "liquidationFee"));
+          symbol_info.SetMarketMaxQty(GetDoubleFromJson(filter, "maxQty"))
+              .SetMarketMinQty(GetDoubleFromJson(filter, "minQty"))
+              .SetQtyStep(qty_step)
+              .SetQtyPrecision(CountDecimalPlaces(qty_step));
+          filter_count += 3;
+          continue;
+        }
 
-          symbol_found = true;
-          break;
+        if (filter.at("filterType") == "MIN_NOTIONAL") {
+          symbol_info.SetMinNotionalValue(
+              GetDoubleFromJson(filter, "notional"));
+          filter_count += 1;
         }
       }
 
-      if (!symbol_found) {
+      if (filter_count != 7) {
         throw invalid_argument(
-            format("거래소 정보에 [symbol: {}] && [contractType: PERPETUAL]인 "
-                   "객체가 존재하지 않습니다.",
+            format("[{}] filters의 심볼 정보 중 일부가 존재하지 않습니다.",
                    symbol_name));
       }
+
+      symbol_info.SetLiquidationFeeRate(
+          GetDoubleFromJson(symbol, "liquidationFee"));
     } catch (const std::exception& e) {
       logger_->Log(
           ERROR_L,
@@ -1080,45 +1148,41 @@ void Engine::InitializeSymbolInfo() {
 
     // 레버리지 구간 초기화
     try {
-      bool symbol_found = false;
-
       // 데이터 경로 설정
       symbol_info.SetLeverageBracketPath(leverage_bracket_path_);
 
-      // 레버리지 구간의 symbols 배열 내 모든 심볼들을 순회
-      for (const auto& symbol : leverage_bracket_) {
-        if (symbol.at("symbol") == symbol_name) {
-          vector<LeverageBracket> leverage_brackets;
-
-          // 해당 심볼이 존재한다면 구간을 순회하며 추가
-          for (const auto& bracket : symbol.at("brackets")) {
-            LeverageBracket leverage_bracket{};
-            leverage_bracket.min_notional_value =
-                bracket.at("notionalFloor").get<double>();
-            leverage_bracket.max_notional_value =
-                bracket.at("notionalCap").get<double>();
-            leverage_bracket.max_leverage =
-                bracket.at("initialLeverage").get<int>();
-            leverage_bracket.maintenance_margin_rate =
-                bracket.at("maintMarginRatio").get<double>();
-            leverage_bracket.maintenance_amount =
-                bracket.at("cum").get<double>();
-
-            leverage_brackets.push_back(leverage_bracket);
-          }
-
-          symbol_info.SetLeverageBracket(leverage_brackets);
-
-          symbol_found = true;
-          break;
-        }
-      }
-
-      if (!symbol_found) {
+      // 파싱할 때 만든 인덱스로 레버리지 구간 배열에서 심볼을 찾음
+      const auto& symbol_indices = leverage_bracket_->symbol_indices;
+      const auto symbol_it = symbol_indices.find(symbol_name);
+      if (symbol_it == symbol_indices.end()) {
         throw invalid_argument(
             format("레버리지 구간에 [symbol: {}]인 객체가 존재하지 않습니다.",
                    symbol_name));
       }
+
+      const auto& brackets =
+          leverage_bracket_->data[symbol_it->second].at("brackets");
+
+      // 구간을 순회하며 추가
+      vector<LeverageBracket> leverage_brackets;
+      leverage_brackets.reserve(brackets.size());
+
+      for (const auto& bracket : brackets) {
+        LeverageBracket leverage_bracket{};
+        leverage_bracket.min_notional_value =
+            bracket.at("notionalFloor").get<double>();
+        leverage_bracket.max_notional_value =
+            bracket.at("notionalCap").get<double>();
+        leverage_bracket.max_leverage =
+            bracket.at("initialLeverage").get<int>();
+        leverage_bracket.maintenance_margin_rate =
+            bracket.at("maintMarginRatio").get<double>();
+        leverage_bracket.maintenance_amount = bracket.at("cum").get<double>();
+
+        leverage_brackets.push_back(leverage_bracket);
+      }
+
+      symbol_info.SetLeverageBracket(leverage_brackets);
     } catch (const std::exception& e) {
       logger_->Log(
           ERROR_L,
@@ -1140,7 +1204,7 @@ void Engine::InitializeSymbolInfo() {
       // 데이터 경로 설정
       symbol_info.SetFundingRatesPath(funding_rates_paths_[symbol_idx]);
 
-      const auto& funding_rates = funding_rates_[symbol_idx];
+      const auto& funding_rates = funding_rates_[symbol_idx]->data;
       const auto funding_rates_size = funding_rates.size();
       vector<FundingInfo> funding_rates_vector(funding_rates_size);
 
@@ -1226,12 +1290,56 @@ void Engine::InitializeStrategy() {
 }
 
 void Engine::InitializeIndicators() const {
-  // 전략에서 trading_timeframe을 사용하여 타임프레임이 공란이면
-  // 트레이딩 바의 타임프레임을 사용
-  for (const auto& indicator : indicators_) {
-    // 백테스팅 중지 요청 시 중지
-    RET_IF_STOP_REQUESTED()
+  const size_t num_indicators = indicators_.size();
 
+  // ===========================================================================
+  // 1. 정규화: 계산 없이 서명만으로 같은 계산을 하는 지표들을 묶음
+  // ===========================================================================
+  // 정규화 키별 계산 값을 가진 지표의 인덱스
+  unordered_map<string, size_t> canonical_keys;
+
+  // 각 지표가 계산 값을 공유하는 지표의 인덱스
+  vector<size_t> canonical_of(num_indicators);
+  unordered_map<const Indicator*, size_t> indicator_indices;
+
+  // 지표별 디스크 캐시 키와 스냅샷 키. 비어있으면 캐시하지 않음
+  const bool use_indicator_cache = config_->GetUseIndicatorCache();
+  vector<string> cache_keys(num_indicators);
+  vector<string> snapshot_keys(num_indicators);
+
+  // 같은 파일과 타임프레임을 여러 번 해시하지 않도록 결과 저장
+  unordered_map<string, string> file_hashes;
+  unordered_map<string, string> bar_fingerprints;
+
+  const auto hash_file = [&](const string& path) -> const string& {
+    auto it = file_hashes.find(path);
+    if (it == file_hashes.end()) {
+      it = file_hashes.emplace(path, IndicatorCache::HashFile(path)).first;
+    }
+
+    return it->second;
+  };
+
+  const auto fingerprint_bar_data =
+      [&](const string& timeframe) -> const string& {
+    auto it = bar_fingerprints.find(timeframe);
+    if (it == bar_fingerprints.end()) {
+      it = bar_fingerprints
+               .emplace(timeframe, IndicatorCache::GetBarDataFingerprint(
+                                       bar_->GetBarData(REFERENCE, timeframe)))
+               .first;
+    }
+
+    return it->second;
+  };
+
+  for (size_t indicator_idx = 0; indicator_idx < num_indicators;
+       ++indicator_idx) {
+    const auto& indicator = indicators_[indicator_idx];
+    indicator_indices[indicator.get()] = indicator_idx;
+
+    // 전략에서 trading_timeframe을 사용하여 타임프레임이 공란이면
+    // 트레이딩 바의 타임프레임을 사용
     if (indicator->GetTimeframe() == "TRADING_TIMEFRAME") {
       indicator->SetTimeframe(trading_bar_timeframe_);
     }
@@ -1241,38 +1349,422 @@ void Engine::InitializeIndicators() const {
       indicator->SetHigherTimeframeIndicator();
     }
 
-    // 지표 계산
-    indicator->CalculateIndicator();
+    // 정규화 키: 클래스와 파라미터 서명, 타임프레임, 의존 지표의 정규화 인덱스
+    // 의존 지표는 먼저 정의되어야 하므로 이미 정규화되어 있음
+    string key = indicator->signature_;
+    if (!key.empty()) {
+      key += format("|{}", indicator->GetTimeframe());
+
+      for (const auto* source : indicator->GetSourceIndicators()) {
+        if (const auto it = indicator_indices.find(source);
+            it != indicator_indices.end()) {
+          key += format("|#{}", canonical_of[it->second]);
+        } else {
+          // 전략에 추가되지 않은 지표를 참조하면 공유하지 않음
+          key.clear();
+          break;
+        }
+      }
+    }
+
+    // 같은 계산을 하는 지표가 이미 있으면 해당 지표의 계산 값을 공유
+    if (const auto it = canonical_keys.find(key);
+        !key.empty() && it != canonical_keys.end()) {
+      canonical_of[indicator_idx] = it->second;
+      continue;
+    }
+
+    canonical_of[indicator_idx] = indicator_idx;
+
+    if (!key.empty()) {
+      canonical_keys.emplace(std::move(key), indicator_idx);
+
+      // 스냅샷 키: 정규화 키와 헤더 및 소스 파일 내용, 의존 지표들의
+      // 스냅샷 키. 파일을 읽을 수 없거나 의존 지표가 캐시되지 않으면
+      // 캐시하지 않음
+      // 디스크 캐시 키: 스냅샷 키와 바 데이터 지문
+      if (!use_indicator_cache) {
+        continue;
+      }
+
+      const auto& header_hash = hash_file(indicator->GetHeaderPath());
+      const auto& source_hash = hash_file(indicator->GetSourcePath());
+      if (header_hash.empty() || source_hash.empty()) {
+        continue;
+      }
+
+      auto snapshot_key =
+          format("{}|{}|{}|{}", indicator->signature_,
+                 indicator->GetTimeframe(), header_hash, source_hash);
+
+      for (const auto* source : indicator->GetSourceIndicators()) {
+        const auto& source_key =
+            snapshot_keys[canonical_of[indicator_indices[source]]];
+        if (source_key.empty()) {
+          snapshot_key.clear();
+          break;
+        }
+
+        snapshot_key += format(
+            "|{:016x}",
+            IndicatorCache::Hash(source_key.data(), source_key.size()));
+      }
+
+      if (!snapshot_key.empty()) {
+        cache_keys[indicator_idx] =
+            format("{}|{}", snapshot_key,
+                   fingerprint_bar_data(indicator->GetTimeframe()));
+        snapshot_keys[indicator_idx] = std::move(snapshot_key);
+      }
+    }
+  }
+
+  // ===========================================================================
+  // 2. 저장 방식: 계산 값을 공유하는 지표들 중 가장 정밀한 저장 방식을 사용하고,
+  //    계산 값을 마지막으로 사용하는 지표의 계산이 끝나면 압축
+  // ===========================================================================
+  vector<OutputStorage> output_storages(num_indicators,
+                                        OutputStorage::DISCARD);
+  vector<size_t> last_uses(num_indicators, 0);
+
+  for (size_t indicator_idx = 0; indicator_idx < num_indicators;
+       ++indicator_idx) {
+    const auto& indicator = indicators_[indicator_idx];
+    const size_t canonical_idx = canonical_of[indicator_idx];
+
+    output_storages[canonical_idx] = min(output_storages[canonical_idx],
+                                         indicator->GetOutputStorage());
+    last_uses[canonical_idx] = indicator_idx;
+
+    for (const auto* source : indicator->GetSourceIndicators()) {
+      if (const auto it = indicator_indices.find(source);
+          it != indicator_indices.end()) {
+        last_uses[canonical_of[it->second]] = indicator_idx;
+      }
+    }
   }
 
-  logger_->Log(INFO_L, "지표 초기화가 완료되었습니다.", __FILE__, __LINE__,
-               true);
+  // ===========================================================================
+  // 3. 계산: 캐시 로딩 또는 계산 후, 사용이 끝난 계산 값 압축
+  //    지연 계산 시 캐시되지 않은 지표는 심볼별로 처음 참조될 때 계산
+  // ===========================================================================
+  const bool use_lazy_indicator = config_->GetUseLazyIndicator();
+
+  // 여러 스레드로 계산 시 캐시 로딩과 계산을 미리 하고 아래에서 결과만 반영.
+  // 지연 계산 지표는 전략 실행 중 계산되므로 순차 계산
+  size_t num_threads = config_->GetIndicatorThreads();
+  if (num_threads == 0) {
+    num_threads = max(1U, thread::hardware_concurrency());
+  }
+
+  vector preparations(num_indicators, IndicatorPreparation::NONE);
+  if (num_threads > 1 && !use_lazy_indicator &&
+      !PrepareIndicatorsInParallel(canonical_of, indicator_indices,
+                                   cache_keys, snapshot_keys, num_threads,
+                                   preparations)) {
+    return;
+  }
+
+  // 지연 계산 지표가 전략 실행 중 참조할 수 있으므로 압축하지 않을 계산 값
+  vector<uint8_t> is_pinned(num_indicators, 0);
+
+  size_t num_shared = 0;
+  size_t num_cached = 0;
+  size_t num_resumed = 0;
+  size_t num_lazy = 0;
+  size_t full_memory_usage = 0;
+
+  for (size_t indicator_idx = 0; indicator_idx < num_indicators;
+       ++indicator_idx) {
+    // 백테스팅 중지 요청 시 중지
+    RET_IF_STOP_REQUESTED()
+
+    const auto& indicator = indicators_[indicator_idx];
+    const size_t canonical_idx = canonical_of[indicator_idx];
+
+    if (canonical_idx != indicator_idx) {
+      // 같은 계산을 하는 지표의 계산 값 공유
+      indicator->ShareOutput(*indicators_[canonical_idx]);
+      num_shared++;
+    } else {
+      // 캐시된 계산 값이 있으면 매핑하여 사용하고, 없으면 계산 후 캐시에 저장
+      // 바가 추가되어 캐시가 없어도 스냅샷이 있으면 추가된 바만 계산
+      const auto& cache_key = cache_keys[indicator_idx];
+      const auto preparation = preparations[indicator_idx];
+
+      if (preparation == IndicatorPreparation::CACHED ||
+          (preparation == IndicatorPreparation::NONE && !cache_key.empty() &&
+           indicator->LoadCachedOutput(cache_key))) {
+        num_cached++;
+      } else if (use_lazy_indicator) {
+        indicator->PrepareLazyOutput();
+        num_lazy++;
+      } else {
+        const auto& snapshot_key = snapshot_keys[indicator_idx];
+
+        if (preparation == IndicatorPreparation::RESUMED) {
+          num_resumed++;
+        } else if (preparation == IndicatorPreparation::CALCULATED) {
+          // 심볼별로 계산한 지표는 모든 심볼의 계산이 끝났으므로 완료 처리
+          if (indicator->is_scheduled_) {
+            indicator->FinishScheduledCalculation();
+          }
+        } else {
+          indicator->capture_states_ = !cache_key.empty();
+
+          if (!cache_key.empty() &&
+              indicator->ResumeFromSnapshot(snapshot_key)) {
+            num_resumed++;
+          } else {
+            indicator->CalculateIndicator();
+          }
+        }
+
+        if (!cache_key.empty()) {
+          indicator->SaveCachedOutput(cache_key);
+          indicator->SaveSnapshot(snapshot_key, cache_key);
+        }
+      }
+
+      full_memory_usage += indicator->output_->GetMemoryUsage();
+    }
+
+    if (indicator->is_lazy_) {
+      for (const auto* source : indicator->GetSourceIndicators()) {
+        if (const auto it = indicator_indices.find(source);
+            it != indicator_indices.end()) {
+          is_pinned[canonical_of[it->second]] = 1;
+        }
+      }
+    }
+
+    // 이 지표의 계산으로 사용이 끝난 계산 값들을 저장 방식에 맞게 압축
+    for (size_t used_idx = 0; used_idx <= indicator_idx; ++used_idx) {
+      if (canonical_of[used_idx] != used_idx ||
+          last_uses[used_idx] != indicator_idx ||
+          output_storages[used_idx] == OutputStorage::DOUBLE ||
+          indicators_[used_idx]->is_lazy_ || is_pinned[used_idx]) {
+        continue;
+      }
+
+      const auto& compacted =
+          output_storages[used_idx] == OutputStorage::FLOAT
+              ? indicators_[used_idx]->output_->ToFloat()
+              : nullptr;
+
+      for (size_t member_idx = used_idx; member_idx <= indicator_idx;
+           ++member_idx) {
+        if (canonical_of[member_idx] != used_idx) {
+          continue;
+        }
+
+        if (compacted != nullptr) {
+          indicators_[member_idx]->ReplaceOutput(compacted);
+        } else {
+          indicators_[member_idx]->DiscardOutput();
+        }
+      }
+    }
+  }
+
+  // 공유되는 버퍼는 한 번만 집계
+  size_t memory_usage = 0;
+  for (size_t indicator_idx = 0; indicator_idx < num_indicators;
+       ++indicator_idx) {
+    if (canonical_of[indicator_idx] == indicator_idx) {
+      memory_usage += indicators_[indicator_idx]->output_->GetMemoryUsage();
+    }
+  }
+
+  logger_->Log(
+      INFO_L,
+      format("지표 초기화가 완료되었습니다. (계산 [{}]개, 캐시 [{}]개, 이어서 "
+             "계산 [{}]개, 지연 [{}]개, 공유 [{}]개, 계산 값 메모리 "
+             "[{:.1f}MB / {:.1f}MB])",
+             num_indicators - num_shared - num_cached - num_resumed - num_lazy,
+             num_cached, num_resumed, num_lazy, num_shared,
+             static_cast<double>(memory_usage) / (1024 * 1024),
+             static_cast<double>(full_memory_usage) / (1024 * 1024)),
+      __FILE__, __LINE__, true);
+}
+
+bool Engine::PrepareIndicatorsInParallel(
+    const vector<size_t>& canonical_of,
+    const unordered_map<const Indicator*, size_t>& indicator_indices,
+    const vector<string>& cache_keys, const vector<string>& snapshot_keys,
+    const size_t num_threads,
+    vector<IndicatorPreparation>& preparations) const {
+  const size_t num_indicators = indicators_.size();
+  const auto num_symbols = static_cast<size_t>(trading_bar_num_symbols_);
+
+  // 작업 스레드에서는 스레드마다 따로 가진 바 데이터 환경에서 계산
+  const auto run_in_context = [](const auto& calculate) {
+    BarHandler::EvaluationContext context;
+    BarHandler::SetEvaluationContext(&context);
+
+    try {
+      calculate();
+    } catch (...) {
+      BarHandler::SetEvaluationContext(nullptr);
+      throw;
+    }
+
+    BarHandler::SetEvaluationContext(nullptr);
+  };
+
+  // 계산 값을 공유하는 지표들이 계산 중에도 같은 계산 값을 참조하도록 설정
+  const auto attach_members = [&](const size_t canonical_idx) {
+    for (size_t member_idx = canonical_idx + 1; member_idx < num_indicators;
+         ++member_idx) {
+      if (canonical_of[member_idx] == canonical_idx) {
+        indicators_[member_idx]->AttachOutput(*indicators_[canonical_idx]);
+      }
+    }
+  };
+
+  IndicatorScheduler scheduler;
+
+  // 지표별 심볼 계산 작업의 인덱스. 지표 전체를 하나의 작업으로 계산하는
+  // 지표는 모든 심볼이 같은 작업이며, 계산하지 않는 지표는 비어있음
+  vector<vector<size_t>> symbol_tasks(num_indicators);
+
+  for (size_t indicator_idx = 0; indicator_idx < num_indicators;
+       ++indicator_idx) {
+    if (canonical_of[indicator_idx] != indicator_idx) {
+      continue;
+    }
+
+    const auto& indicator = indicators_[indicator_idx];
+    const auto& cache_key = cache_keys[indicator_idx];
+
+    if (!cache_key.empty() && indicator->LoadCachedOutput(cache_key)) {
+      preparations[indicator_idx] = IndicatorPreparation::CACHED;
+      continue;
+    }
+
+    // 계산 중인 의존 지표들의 심볼 계산 작업
+    vector<const vector<size_t>*> source_tasks;
+    for (const auto* source : indicator->GetSourceIndicators()) {
+      if (const auto it = indicator_indices.find(source);
+          it != indicator_indices.end()) {
+        if (const auto& tasks = symbol_tasks[canonical_of[it->second]];
+            !tasks.empty()) {
+          source_tasks.push_back(&tasks);
+        }
+      }
+    }
+
+    indicator->capture_states_ = !cache_key.empty();
+
+    if (!cache_key.empty()) {
+      // 스냅샷에서 이어서 계산할 수 있는 지표는 의존 지표의 모든 심볼
+      // 계산이 끝난 후 지표 전체를 계산.
+      // 같은 지표의 심볼 작업은 순서대로 실행되므로 마지막 작업에만 의존
+      vector<size_t> dependencies;
+      for (const auto* tasks : source_tasks) {
+        dependencies.push_back(tasks->back());
+      }
+
+      const size_t task_idx = scheduler.AddTask(
+          [&, indicator_idx] {
+            run_in_context([&] {
+              const auto& target = indicators_[indicator_idx];
+
+              if (target->ResumeFromSnapshot(snapshot_keys[indicator_idx])) {
+                preparations[indicator_idx] = IndicatorPreparation::RESUMED;
+              } else {
+                target->CalculateIndicator();
+                preparations[indicator_idx] = IndicatorPreparation::CALCULATED;
+              }
+
+              attach_members(indicator_idx);
+            });
+          },
+          dependencies);
+
+      symbol_tasks[indicator_idx].assign(num_symbols, task_idx);
+      continue;
+    }
+
+    indicator->BeginScheduledCalculation();
+    attach_members(indicator_idx);
+    preparations[indicator_idx] = IndicatorPreparation::CALCULATED;
+
+    // 같은 지표의 심볼들은 지표의 멤버 변수를 공유하므로 순서대로 계산하고,
+    // 의존 지표의 같은 심볼 계산이 끝나면 계산
+    auto& tasks = symbol_tasks[indicator_idx];
+    tasks.reserve(num_symbols);
+
+    for (size_t symbol_idx = 0; symbol_idx < num_symbols; ++symbol_idx) {
+      vector<size_t> dependencies;
+      if (symbol_idx > 0) {
+        dependencies.push_back(tasks.back());
+      }
+
+      for (const auto* source : source_tasks) {
+        dependencies.push_back((*source)[symbol_idx]);
+      }
+
+      tasks.push_back(scheduler.AddTask(
+          [&, indicator_idx, symbol_idx] {
+            run_in_context([&] {
+              indicators_[indicator_idx]->CalculateScheduledSymbol(
+                  static_cast<int>(symbol_idx));
+            });
+          },
+          dependencies));
+    }
+  }
+
+  if (scheduler.GetNumTasks() == 0) {
+    return true;
+  }
+
+  logger_->Log(INFO_L,
+               format("지표 계산 작업 [{}]개를 [{}]개 스레드로 실행합니다.",
+                      scheduler.GetNumTasks(), num_threads),
+               __FILE__, __LINE__, true);
+
+  scheduler.Start(num_threads);
+
+  // 중지 요청 시 남은 작업은 스케줄러 소멸 시 취소됨
+  while (!scheduler.WaitFor(chrono::milliseconds(100))) {
+    if (Backtesting::IsStopRequested()) {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 void Engine::BacktestingMain() {
+  // 백테스팅 진행 중의 로그 라인에 바 시각을 붙이고, 종료 시 원상 복구
+  const LogBarTimeScope bar_time_scope;
+
   while (true) {
     // =========================================================================
     // [백테스팅 중지 요청 확인]
     // =========================================================================
     RET_IF_STOP_REQUESTED()
 
+    Logger::SetThreadBarTime(current_open_time_);
+
     // =========================================================================
     // [진행 시간 로그]
     // =========================================================================
     LogSeparator(false);
 
-    // 월이 바뀌는지 체크
-    bool log_to_console = false;
+    // 월이 바뀔 때만 콘솔에 로그 출력.
+    // 날짜 문자열 변환은 로거 백그라운드 스레드에서 진행
     if (current_open_time_ >= next_month_boundary_) {
-      log_to_console = true;
       next_month_boundary_ = CalculateNextMonthBoundary(current_open_time_);
-    }
 
-    // 월이 바뀔 때만 콘솔에 로그 출력
-    logger_->Log(
-        INFO_L,
-        format("진행 시간: {}", UtcTimestampToUtcDatetime(current_open_time_)),
-        __FILE__, __LINE__, log_to_console);
+      LOG_DEFERRED_CONSOLE(logger_, INFO_L, "진행 시간: {}",
+                           UtcDatetime{current_open_time_});
+    } else {
+      LOG_DEFERRED(logger_, INFO_L, "진행 시간: {}",
+                   UtcDatetime{current_open_time_});
+    }
 
     // =========================================================================
     // [심볼별 트레이딩 진행 여부 및 진행 방법 결정]
@@ -1304,6 +1796,8 @@ void Engine::BacktestingMain() {
     // =========================================================================
     // 돋보기 바 기능 사용 시 돋보기 바 시간 진행
     if (use_bar_magnifier_) {
+      PROFILE_SCOPE("Engine::MagnifierLoop");
+
       const auto original_open_time = current_open_time_;
       const auto original_close_time = current_close_time_;
       bar_->SetCurrentBarDataType(MAGNIFIER, "");
@@ -1322,6 +1816,7 @@ void Engine::BacktestingMain() {
         // Close Time은 마크 가격 바 인덱스를 일치시키기 위함
         current_open_time_ += magnifier_bar_time_diff_;
         current_close_time_ += magnifier_bar_time_diff_;
+        Logger::SetThreadBarTime(current_open_time_);
 
         for (const auto symbol_idx : activated_symbol_indices_) {
           bar_->SetCurrentSymbolIndex(symbol_idx);
@@ -1338,19 +1833,15 @@ void Engine::BacktestingMain() {
             if (moved_bar_idx < magnifier_bar_data_->GetNumBars(symbol_idx) - 1)
                 [[likely]] {
               // 현재 바가 마지막 바가 아닌 경우 직접 Open Time 가져오기
-              const string& magnifier_next_open_time =
-                  UtcTimestampToUtcDatetime(
+              // 날짜 문자열 변환은 로거 백그라운드 스레드에서 진행
+              LOG_DEFERRED(
+                  logger_, WARN_L,
+                  "[{}] 심볼의 [{}] 돋보기 바가 누락되어 체결 확인을 "
+                  "건너뜁니다. (돋보기 바 다음 시간: [{}])",
+                  symbol_names_[symbol_idx], UtcDatetime{current_open_time_},
+                  UtcDatetime{
                       magnifier_bar_data_->GetBar(symbol_idx, moved_bar_idx + 1)
-                          .open_time);
-
-              logger_->Log(
-                  WARN_L,
-                  format("[{}] 심볼의 [{}] 돋보기 바가 누락되어 체결 확인을 "
-                         "건너뜁니다. (돋보기 바 다음 시간: [{}])",
-                         symbol_names_[symbol_idx],
-                         UtcTimestampToUtcDatetime(current_open_time_),
-                         magnifier_next_open_time),
-                  __FILE__, __LINE__, false);
+                          .open_time});
 
               // 마크 가격 바 인덱스를 현재 돋보기 바 Close Time으로 일치.
               // 펀딩비 데이터에 마크 가격이 누락되었을 경우 시장 마크 가격을
@@ -1395,6 +1886,7 @@ void Engine::BacktestingMain() {
       // 돋보기 바 진행이 끝났다면 시간을 원상 복구
       current_open_time_ = original_open_time;
       current_close_time_ = original_close_time;
+      Logger::SetThreadBarTime(current_open_time_);
     } else {
       // 돋보기 기능 미사용 시 트레이딩 바를 이용하여 체결 확인
       bar_->SetCurrentBarDataType(TRADING, "");
@@ -1431,6 +1923,11 @@ void Engine::BacktestingMain() {
       bar_->IncreaseBarIndex(TRADING, "", symbol_idx);
     }
 
+    // 출력 간격이 지났을 때만 진행 상황 프레임 출력
+    num_processed_bars_ += activated_symbol_indices_.size();
+    progress_.Update(current_open_time_, num_processed_bars_,
+                     analyzer_->GetNumTrades(), wallet_balance_);
+
     // current_open_time_ -> UpdateTradingStatus에서 트레이딩 시작 검증 시 사용
     // current_close_time_
     // -> 1. UpdateTradingStatus에서 현재 트레이딩 바 Close Time까지
@@ -1442,6 +1939,8 @@ void Engine::BacktestingMain() {
 }
 
 void Engine::UpdateTradingStatus() {
+  PROFILE_SCOPE("Engine::UpdateTradingStatus");
+
   // 활성화된 심볼 벡터 초기화
   activated_symbol_indices_.clear();
 
@@ -1474,14 +1973,12 @@ void Engine::UpdateTradingStatus() {
       if (const auto trading_bar_open_time =
               trading_bar_data_->GetBar(symbol_idx, bar_idx).open_time;
           trading_bar_open_time != current_open_time_) {
-        logger_->Log(
-            WARN_L,
-            format("[{}] 심볼의 [{}] 트레이딩 바가 누락되어 이번 시간의 "
-                   "트레이딩을 건너뜁니다. (트레이딩 바 다음 시간: [{}])",
-                   symbol_names_[symbol_idx],
-                   UtcTimestampToUtcDatetime(current_open_time_),
-                   UtcTimestampToUtcDatetime(trading_bar_open_time)),
-            __FILE__, __LINE__, true);
+        LOG_DEFERRED_CONSOLE(
+            logger_, WARN_L,
+            "[{}] 심볼의 [{}] 트레이딩 바가 누락되어 이번 시간의 "
+            "트레이딩을 건너뜁니다. (트레이딩 바 다음 시간: [{}])",
+            symbol_names_[symbol_idx], UtcDatetime{current_open_time_},
+            UtcDatetime{trading_bar_open_time});
 
         // 결손 시 현재 시간보다 큰 시간을 가리키므로 인덱스는 증가시키지 않음
         continue;
@@ -1539,14 +2036,12 @@ void Engine::UpdateTradingStatus() {
              트레이딩 바 인덱스는 맞추어 흘러가야 Open Time, Close Time이 동기화
              되므로 인덱스 증가
              ※ 원래 트레이딩 바 인덱스는 활성화된 심볼에서만 증가함 */
-          logger_->Log(
-              WARN_L,
-              format("[{} {}] 참조 바 데이터가 아직 시작되지 않아 해당 심볼의 "
-                     "트레이딩을 진행할 수 없습니다. (참조 바가 시작되는 기준 "
-                     "Close Time: [{}])",
-                     symbol_names_[symbol_idx], timeframe,
-                     UtcTimestampToUtcDatetime(moved_close_time)),
-              __FILE__, __LINE__, false);
+          LOG_DEFERRED(logger_, WARN_L,
+                       "[{} {}] 참조 바 데이터가 아직 시작되지 않아 해당 "
+                       "심볼의 트레이딩을 진행할 수 없습니다. (참조 바가 "
+                       "시작되는 기준 Close Time: [{}])",
+                       symbol_names_[symbol_idx], timeframe,
+                       UtcDatetime{moved_close_time});
 
           bar_->IncreaseBarIndex(TRADING, "", symbol_idx);
           can_use_reference = false;
@@ -1598,15 +2093,14 @@ void Engine::UpdateTradingStatus() {
            트레이딩 바 인덱스는 맞추어 흘러가야 Open Time, Close Time이 동기화
            되므로 인덱스 증가
            ※ 원래 트레이딩 바 인덱스는 활성화된 심볼에서만 증가함 */
-        logger_->Log(
-            WARN_L,
-            format("[{}] 돋보기 바 데이터가 아직 시작되지 않아 해당 심볼의 "
-                   "트레이딩을 진행할 수 없습니다. (돋보기 바 시작 시각: [{}])",
-                   symbol_names_[symbol_idx],
-                   UtcTimestampToUtcDatetime(
-                       magnifier_bar_data_->GetBar(symbol_idx, moved_bar_idx)
-                           .open_time)),
-            __FILE__, __LINE__, true);
+        LOG_DEFERRED_CONSOLE(
+            logger_, WARN_L,
+            "[{}] 돋보기 바 데이터가 아직 시작되지 않아 해당 심볼의 "
+            "트레이딩을 진행할 수 없습니다. (돋보기 바 시작 시각: [{}])",
+            symbol_names_[symbol_idx],
+            UtcDatetime{
+                magnifier_bar_data_->GetBar(symbol_idx, moved_bar_idx)
+                    .open_time});
 
         bar_->IncreaseBarIndex(TRADING, "", symbol_idx);
         continue;
@@ -1692,6 +2186,8 @@ void Engine::ExecuteAllTradingEnd() {
 }
 
 void Engine::CheckFundingTime() {
+  PROFILE_SCOPE("Engine::CheckFundingTime");
+
   auto update_next_funding_info = [&](const int symbol_idx) {
     const auto& funding_rates = symbol_info_[symbol_idx].GetFundingRates();
 
@@ -1776,6 +2272,8 @@ void Engine::CheckFundingTime() {
 
 void Engine::ProcessOhlc(const BarDataType bar_data_type,
                          const vector<int>& symbol_indices) {
+  PROFILE_SCOPE("Engine::ProcessOhlc");
+
   auto& should_fill_orders = order_handler_->should_fill_orders_;
 
   // 매커니즘에 따라 확인할 순서대로 가격을 정렬한 벡터 얻기
@@ -2077,6 +2575,8 @@ void Engine::SortOrders(vector<FillInfo>& should_fill_orders,
 
 void Engine::ExecuteStrategy(const StrategyType strategy_type,
                              const int symbol_idx) {
+  PROFILE_SCOPE("Engine::ExecuteStrategy");
+
   // 종가 전략 실행인 경우 원본 바 데이터 유형은 트레이딩 바
   //
   // ProcessOhlc에서 전략 실행인 경우 원본 바 데이터 유형은
@@ -0,0 +1,590 @@
+// 표준 라이브러리
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <stdexcept>
+#include <unordered_map>
+
+// 파일 헤더
+#include "Engines/Expression.hpp"
+
+namespace backtesting::expression {
+
+namespace {
+
+/// 노드를 만드는 함수
+Expression MakeNode(const ExpressionOp op,
+                    vector<shared_ptr<const ExpressionNode>> inputs,
+                    const double constant = 0, const size_t period = 0,
+                    Indicator* source = nullptr) {
+  return Expression(make_shared<const ExpressionNode>(
+      ExpressionNode{op, std::move(inputs), constant, period, source}));
+}
+
+/// 기간이 필요한 노드를 만드는 함수
+Expression MakeWindowNode(const ExpressionOp op, const string& name,
+                          const Expression& expression, const size_t period,
+                          const size_t min_period) {
+  if (period < min_period) {
+    throw runtime_error(format("{}의 기간 [{}]은(는) {} 이상이어야 합니다.",
+                               name, period, min_period));
+  }
+
+  return MakeNode(op, {expression.GetNode()}, 0, period);
+}
+
+/// 연산의 서명 이름을 반환하는 함수
+string OpName(const ExpressionOp op) {
+  switch (op) {
+    case ExpressionOp::OPEN:
+      return "open";
+    case ExpressionOp::HIGH:
+      return "high";
+    case ExpressionOp::LOW:
+      return "low";
+    case ExpressionOp::CLOSE:
+      return "close";
+    case ExpressionOp::VOLUME:
+      return "volume";
+    case ExpressionOp::CONSTANT:
+      return "const";
+    case ExpressionOp::SOURCE:
+      return "source";
+    case ExpressionOp::ADD:
+      return "add";
+    case ExpressionOp::SUBTRACT:
+      return "sub";
+    case ExpressionOp::MULTIPLY:
+      return "mul";
+    case ExpressionOp::DIVIDE:
+      return "div";
+    case ExpressionOp::NEGATE:
+      return "neg";
+    case ExpressionOp::ABS:
+      return "abs";
+    case ExpressionOp::MAX:
+      return "max";
+    case ExpressionOp::MIN:
+      return "min";
+    case ExpressionOp::SHIFT:
+      return "shift";
+    case ExpressionOp::SMA:
+      return "sma";
+    case ExpressionOp::EMA:
+      return "ema";
+    case ExpressionOp::STDDEV:
+      return "stddev";
+    case ExpressionOp::HIGHEST:
+      return "highest";
+    case ExpressionOp::LOWEST:
+      return "lowest";
+  }
+
+  return "unknown";
+}
+
+/// 상태를 가지는 연산인지 여부를 반환하는 함수
+bool IsStateful(const ExpressionOp op) {
+  return op >= ExpressionOp::SHIFT;
+}
+
+/**
+ * 식 DAG를 후위 순회하며 노드별 서명과 참조 지표 목록을 만드는 클래스.
+ * 같은 노드를 여러 번 참조해도 한 번만 방문함
+ */
+class SignatureBuilder {
+ public:
+  /// 노드의 서명을 반환하는 함수
+  const string& Visit(const ExpressionNode* node) {
+    if (const auto it = signatures_.find(node); it != signatures_.end()) {
+      return it->second;
+    }
+
+    string signature;
+    if (node->op == ExpressionOp::SOURCE) {
+      // 참조 지표는 처음 참조된 순서의 위치로 기록
+      const auto it = ranges::find(sources_, node->source);
+      signature = format("@{}", it - sources_.begin());
+
+      if (it == sources_.end()) {
+        sources_.push_back(node->source);
+      }
+    } else if (node->op == ExpressionOp::CONSTANT) {
+      signature = format("{}", node->constant);
+    } else {
+      signature = OpName(node->op) + "(";
+      for (size_t i = 0; i < node->inputs.size(); ++i) {
+        signature += (i == 0 ? "" : ",") + Visit(node->inputs[i].get());
+      }
+
+      if (IsStateful(node->op)) {
+        signature += format(",{}", node->period);
+      }
+
+      signature += ")";
+    }
+
+    return signatures_.emplace(node, std::move(signature)).first->second;
+  }
+
+  /// 처음 참조된 순서의 참조 지표 목록을 반환하는 함수
+  [[nodiscard]] const vector<Indicator*>& GetSources() const {
+    return sources_;
+  }
+
+ private:
+  unordered_map<const ExpressionNode*, string> signatures_;
+  vector<Indicator*> sources_;
+};
+
+}  // namespace
+
+Expression::Expression(const double constant)
+    : node_(MakeNode(ExpressionOp::CONSTANT, {}, constant).node_) {}
+
+Expression::Expression(Indicator& source)
+    : node_(MakeNode(ExpressionOp::SOURCE, {}, 0, 0, &source).node_) {}
+
+Expression::Expression(shared_ptr<const ExpressionNode> node)
+    : node_(std::move(node)) {}
+
+const shared_ptr<const ExpressionNode>& Expression::GetNode() const {
+  return node_;
+}
+
+string Expression::GetSignature() const {
+  SignatureBuilder builder;
+  return builder.Visit(node_.get());
+}
+
+vector<Indicator*> Expression::GetSourceIndicators() const {
+  SignatureBuilder builder;
+  builder.Visit(node_.get());
+
+  return builder.GetSources();
+}
+
+Expression BarOpen() { return MakeNode(ExpressionOp::OPEN, {}); }
+
+Expression BarHigh() { return MakeNode(ExpressionOp::HIGH, {}); }
+
+Expression BarLow() { return MakeNode(ExpressionOp::LOW, {}); }
+
+Expression BarClose() { return MakeNode(ExpressionOp::CLOSE, {}); }
+
+Expression BarVolume() { return MakeNode(ExpressionOp::VOLUME, {}); }
+
+Expression BarTrueRange() {
+  // TR = max(high - low, |high - prev_close|, |low - prev_close|)
+  // 첫 바는 이전 종가가 NaN이므로 NaN
+  const auto& high = BarHigh();
+  const auto& low = BarLow();
+  const auto& prev_close = Shift(BarClose(), 1);
+
+  return Max(Max(high - low, Abs(high - prev_close)), Abs(low - prev_close));
+}
+
+Expression Shift(const Expression& expression, const size_t period) {
+  return MakeWindowNode(ExpressionOp::SHIFT, "Shift", expression, period, 0);
+}
+
+Expression Abs(const Expression& expression) {
+  return MakeNode(ExpressionOp::ABS, {expression.GetNode()});
+}
+
+Expression Max(const Expression& lhs, const Expression& rhs) {
+  return MakeNode(ExpressionOp::MAX, {lhs.GetNode(), rhs.GetNode()});
+}
+
+Expression Min(const Expression& lhs, const Expression& rhs) {
+  return MakeNode(ExpressionOp::MIN, {lhs.GetNode(), rhs.GetNode()});
+}
+
+Expression Sma(const Expression& expression, const size_t period) {
+  return MakeWindowNode(ExpressionOp::SMA, "Sma", expression, period, 1);
+}
+
+Expression Ema(const Expression& expression, const size_t period) {
+  return MakeWindowNode(ExpressionOp::EMA, "Ema", expression, period, 1);
+}
+
+Expression StdDev(const Expression& expression, const size_t period) {
+  return MakeWindowNode(ExpressionOp::STDDEV, "StdDev", expression, period, 1);
+}
+
+Expression RollingMax(const Expression& expression, const size_t period) {
+  return MakeWindowNode(ExpressionOp::HIGHEST, "RollingMax", expression,
+                        period, 1);
+}
+
+Expression RollingMin(const Expression& expression, const size_t period) {
+  return MakeWindowNode(ExpressionOp::LOWEST, "RollingMin", expression, period,
+                        1);
+}
+
+Expression operator+(const Expression& lhs, const Expression& rhs) {
+  return MakeNode(ExpressionOp::ADD, {lhs.GetNode(), rhs.GetNode()});
+}
+
+Expression operator-(const Expression& lhs, const Expression& rhs) {
+  return MakeNode(ExpressionOp::SUBTRACT, {lhs.GetNode(), rhs.GetNode()});
+}
+
+Expression operator*(const Expression& lhs, const Expression& rhs) {
+  return MakeNode(ExpressionOp::MULTIPLY, {lhs.GetNode(), rhs.GetNode()});
+}
+
+Expression operator/(const Expression& lhs, const Expression& rhs) {
+  return MakeNode(ExpressionOp::DIVIDE, {lhs.GetNode(), rhs.GetNode()});
+}
+
+Expression operator-(const Expression& expression) {
+  return MakeNode(ExpressionOp::NEGATE, {expression.GetNode()});
+}
+
+CompiledExpression::CompiledExpression(const Expression& expression) {
+  SignatureBuilder builder;
+  unordered_map<string, size_t> instruction_indices;
+  unordered_map<const ExpressionNode*, size_t> node_indices;
+
+  // 입력이 먼저 배치되도록 후위 순회하며 같은 서명의 부분식은 하나로 합침
+  const auto compile = [&](const auto& self,
+                           const ExpressionNode* node) -> size_t {
+    if (const auto it = node_indices.find(node); it != node_indices.end()) {
+      return it->second;
+    }
+
+    Instruction instruction{node->op, 0, 0, node->period, node->constant};
+    if (node->op == ExpressionOp::SOURCE) {
+      builder.Visit(node);
+      instruction.lhs =
+          ranges::find(builder.GetSources(), node->source) -
+          builder.GetSources().begin();
+    }
+
+    if (!node->inputs.empty()) {
+      instruction.lhs = self(self, node->inputs[0].get());
+    }
+
+    if (node->inputs.size() > 1) {
+      instruction.rhs = self(self, node->inputs[1].get());
+    }
+
+    const auto& signature = builder.Visit(node);
+    auto [it, inserted] =
+        instruction_indices.try_emplace(signature, instructions_.size());
+    if (inserted) {
+      instructions_.push_back(instruction);
+    }
+
+    node_indices.emplace(node, it->second);
+    return it->second;
+  };
+
+  // 루트의 서명은 모든 부분식의 서명을 포함하므로 루트는 항상 마지막 명령
+  compile(compile, expression.GetNode().get());
+  num_sources_ = builder.GetSources().size();
+
+  states_.resize(instructions_.size());
+  values_.resize(instructions_.size());
+  source_values_.resize(num_sources_);
+
+  Reset();
+}
+
+void CompiledExpression::Reset() {
+  for (size_t i = 0; i < instructions_.size(); ++i) {
+    const auto& instruction = instructions_[i];
+    if (!IsStateful(instruction.op)) {
+      continue;
+    }
+
+    auto& state = states_[i];
+    state = WindowState();
+
+    if (instruction.op == ExpressionOp::SHIFT) {
+      state.buffer.assign(instruction.period + 1, NAN);
+    } else if (instruction.op == ExpressionOp::SMA ||
+               instruction.op == ExpressionOp::STDDEV) {
+      state.buffer.assign(instruction.period, 0.0);
+    }
+  }
+}
+
+double CompiledExpression::Step(const bar::Bar& bar,
+                                const span<const double> source_values) {
+  for (size_t i = 0; i < instructions_.size(); ++i) {
+    const auto& instruction = instructions_[i];
+    double value;
+
+    switch (instruction.op) {
+      case ExpressionOp::OPEN:
+        value = bar.open;
+        break;
+      case ExpressionOp::HIGH:
+        value = bar.high;
+        break;
+      case ExpressionOp::LOW:
+        value = bar.low;
+        break;
+      case ExpressionOp::CLOSE:
+        value = bar.close;
+        break;
+      case ExpressionOp::VOLUME:
+        value = bar.volume;
+        break;
+      case ExpressionOp::CONSTANT:
+        value = instruction.constant;
+        break;
+      case ExpressionOp::SOURCE:
+        value = source_values[instruction.lhs];
+        break;
+      case ExpressionOp::ADD:
+        value = values_[instruction.lhs] + values_[instruction.rhs];
+        break;
+      case ExpressionOp::SUBTRACT:
+        value = values_[instruction.lhs] - values_[instruction.rhs];
+        break;
+      case ExpressionOp::MULTIPLY:
+        value = values_[instruction.lhs] * values_[instruction.rhs];
+        break;
+      case ExpressionOp::DIVIDE:
+        value = values_[instruction.lhs] / values_[instruction.rhs];
+        break;
+      case ExpressionOp::NEGATE:
+        value = -values_[instruction.lhs];
+        break;
+      case ExpressionOp::ABS:
+        value = abs(values_[instruction.lhs]);
+        break;
+      case ExpressionOp::MAX:
+      case ExpressionOp::MIN: {
+        const double lhs = values_[instruction.lhs];
+        const double rhs = values_[instruction.rhs];
+
+        if (isnan(lhs) || isnan(rhs)) {
+          value = NAN;
+        } else {
+          value = instruction.op == ExpressionOp::MAX ? max(lhs, rhs)
+                                                      : min(lhs, rhs);
+        }
+
+        break;
+      }
+      default:
+        value = StepWindow(instruction, states_[i], values_[instruction.lhs]);
+        break;
+    }
+
+    values_[i] = value;
+  }
+
+  return values_.back();
+}
+
+void CompiledExpression::Evaluate(const span<const bar::Bar> bars,
+                                  const span<const span<const double>> sources,
+                                  const span<double> output) {
+  for (size_t bar_idx = 0; bar_idx < bars.size(); ++bar_idx) {
+    for (size_t source_idx = 0; source_idx < num_sources_; ++source_idx) {
+      source_values_[source_idx] = sources[source_idx][bar_idx];
+    }
+
+    output[bar_idx] = Step(bars[bar_idx], source_values_);
+  }
+}
+
+double CompiledExpression::StepWindow(const Instruction& instruction,
+                                      WindowState& state,
+                                      const double value) const {
+  const size_t period = instruction.period;
+
+  // SHIFT는 유효하지 않은 값도 그대로 지연
+  if (instruction.op == ExpressionOp::SHIFT) {
+    const size_t size = state.buffer.size();
+    state.buffer[state.position] = value;
+    state.position = (state.position + 1) % size;
+
+    if (state.count < size) {
+      state.count++;
+    }
+
+    // 다음 기록 위치가 가장 오래된 값
+    return state.count < size ? NAN : state.buffer[state.position];
+  }
+
+  // 유효하지 않은 입력은 누적하지 않음
+  if (!isfinite(value)) {
+    return state.ready ? state.previous : NAN;
+  }
+
+  switch (instruction.op) {
+    case ExpressionOp::SMA:
+    case ExpressionOp::STDDEV: {
+      const double old = state.buffer[state.position];
+      state.buffer[state.position] = value;
+      state.position = (state.position + 1) % period;
+
+      state.sum += value;
+      state.sum_sq += value * value;
+
+      if (!state.ready) {
+        if (state.count++ < period - 1) {
+          return NAN;
+        }
+
+        state.ready = true;
+      } else {
+        state.sum -= old;
+        state.sum_sq -= old * old;
+      }
+
+      const double double_period = static_cast<double>(period);
+      const double mean = state.sum / double_period;
+
+      if (instruction.op == ExpressionOp::SMA) {
+        state.previous = mean;
+      } else {
+        double var = state.sum_sq / double_period - mean * mean;
+        if (var < 0 && var > -1e-12) {
+          var = 0;
+        }
+
+        state.previous = sqrt(var);
+      }
+
+      return state.previous;
+    }
+
+    case ExpressionOp::EMA: {
+      // period 개의 값을 모아 SMA를 계산하여 EMA의 초기값으로 사용
+      const double double_period = static_cast<double>(period);
+
+      if (!state.ready) {
+        state.sum += value;
+        if (state.count++ < period - 1) {
+          return NAN;
+        }
+
+        state.ready = true;
+        state.previous = state.sum / double_period;
+        return state.previous;
+      }
+
+      const double alpha = 2.0 / (double_period + 1.0);
+      state.previous = alpha * value + (1.0 - alpha) * state.previous;
+      return state.previous;
+    }
+
+    case ExpressionOp::HIGHEST:
+    case ExpressionOp::LOWEST: {
+      // 데크는 최댓값이면 감소, 최솟값이면 증가하는 순서로 유지
+      const bool is_highest = instruction.op == ExpressionOp::HIGHEST;
+      while (!state.extremes.empty() &&
+             (is_highest ? state.extremes.back().first <= value
+                         : state.extremes.back().first >= value)) {
+        state.extremes.pop_back();
+      }
+
+      state.extremes.emplace_back(value, state.index);
+
+      if (!state.ready) {
+        if (state.count++ < period - 1) {
+          state.index++;
+          return NAN;
+        }
+
+        state.ready = true;
+      }
+
+      // 윈도우에서 벗어난 요소 제거
+      const size_t window_start_idx = state.index + 1 - period;
+      while (state.extremes.front().second < window_start_idx) {
+        state.extremes.pop_front();
+      }
+
+      state.index++;
+      state.previous = state.extremes.front().first;
+      return state.previous;
+    }
+
+    default:
+      return NAN;
+  }
+}
+
+void CompiledExpression::SaveState(IndicatorState& state) const {
+  for (size_t i = 0; i < instructions_.size(); ++i) {
+    if (!IsStateful(instructions_[i].op)) {
+      continue;
+    }
+
+    const auto& window_state = states_[i];
+
+    // 데크는 값과 인덱스를 나눠 기록
+    vector<double> extreme_values;
+    vector<size_t> extreme_indices;
+    for (const auto& [value, idx] : window_state.extremes) {
+      extreme_values.push_back(value);
+      extreme_indices.push_back(idx);
+    }
+
+    state.Write(window_state.buffer);
+    state.Write(window_state.position);
+    state.Write(window_state.count);
+    state.Write(window_state.index);
+    state.Write(window_state.sum);
+    state.Write(window_state.sum_sq);
+    state.Write(window_state.previous);
+    state.Write(window_state.ready);
+    state.Write(extreme_values);
+    state.Write(extreme_indices);
+  }
+}
+
+bool CompiledExpression::LoadState(IndicatorState& state) {
+  for (size_t i = 0; i < instructions_.size(); ++i) {
+    if (!IsStateful(instructions_[i].op)) {
+      continue;
+    }
+
+    auto& window_state = states_[i];
+    const size_t buffer_size = window_state.buffer.size();
+
+    vector<double> extreme_values;
+    vector<size_t> extreme_indices;
+
+    state.Read(window_state.buffer);
+    state.Read(window_state.position);
+    state.Read(window_state.count);
+    state.Read(window_state.index);
+    state.Read(window_state.sum);
+    state.Read(window_state.sum_sq);
+    state.Read(window_state.previous);
+    state.Read(window_state.ready);
+    state.Read(extreme_values);
+    state.Read(extreme_indices);
+
+    if (window_state.buffer.size() != buffer_size ||
+        (buffer_size != 0 && window_state.position >= buffer_size) ||
+        extreme_values.size() != extreme_indices.size()) {
+      return false;
+    }
+
+    window_state.extremes.clear();
+    for (size_t j = 0; j < extreme_values.size(); ++j) {
+      window_state.extremes.emplace_back(extreme_values[j],
+                                         extreme_indices[j]);
+    }
+  }
+
+  return true;
+}
+
+size_t CompiledExpression::GetNumInstructions() const {
+  return instructions_.size();
+}
+
+size_t CompiledExpression::GetNumSources() const { return num_sources_; }
+
+}  // namespace backtesting::expression
@@ -0,0 +1,124 @@
+// 표준 라이브러리
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <set>
+#include <thread>
+#include <tuple>
+
+// 파일 헤더
+#include "Engines/FetchScheduler.hpp"
+
+namespace backtesting::fetcher {
+
+FetchScheduler::FetchScheduler(const size_t num_workers)
+    : num_workers_(clamp<size_t>(num_workers, 1, max_workers)) {}
+
+size_t FetchScheduler::Run(const vector<FetchJob>& jobs, const Handler& handler,
+                           const ErrorCallback& error_callback,
+                           const StopPredicate& stop_requested) const {
+  atomic<size_t> next_job_idx = 0;
+  atomic<size_t> num_started = 0;
+
+  const auto& worker = [&] {
+    while (true) {
+      if (stop_requested && stop_requested()) {
+        return;
+      }
+
+      const size_t job_idx = next_job_idx.fetch_add(1);
+      if (job_idx >= jobs.size()) {
+        return;
+      }
+
+      ++num_started;
+
+      const auto& job = jobs[job_idx];
+      try {
+        handler(job);
+      } catch (...) {
+        error_callback(job, current_exception());
+      }
+    }
+  };
+
+  // 작업 수가 적으면 그만큼만 스레드 생성
+  const size_t num_threads = min(num_workers_, jobs.size());
+  if (num_threads <= 1) {
+    worker();
+    return num_started;
+  }
+
+  vector<thread> threads;
+  threads.reserve(num_threads);
+
+  for (size_t i = 0; i < num_threads; ++i) {
+    threads.emplace_back(worker);
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  return num_started;
+}
+
+vector<FetchJob> FetchScheduler::RemoveDuplicateJobs(
+    const vector<FetchJob>& jobs) {
+  set<tuple<FetchJobKind, string, string, string>> targets;
+
+  vector<FetchJob> unique_jobs;
+  for (const auto& job : jobs) {
+    // 끝의 경로 구분자 유무와 관계없이 같은 폴더로 비교
+    auto directory = filesystem::path(job.directory).lexically_normal();
+    if (!directory.has_filename() && directory.has_relative_path()) {
+      directory = directory.parent_path();
+    }
+
+    const auto& [target, is_new] = targets.emplace(
+        job.kind, job.symbol, job.timeframe, directory.generic_string());
+
+    if (is_new) {
+      unique_jobs.push_back(job);
+    }
+  }
+
+  return unique_jobs;
+}
+
+vector<pair<int64_t, int64_t>> FetchScheduler::PlanTimeSlices(
+    const int64_t begin_time, const int64_t end_time, const int64_t interval,
+    const int64_t page_size, const size_t max_slices,
+    const int64_t min_pages_per_slice) {
+  if (end_time < begin_time) {
+    return {};
+  }
+
+  if (interval <= 0 || page_size <= 0 || max_slices <= 1) {
+    return {{begin_time, end_time}};
+  }
+
+  // 요청 기간에 필요한 페이지 수로 구간 수 결정
+  const int64_t page_span = interval * page_size;
+  const int64_t num_pages = (end_time - begin_time) / page_span + 1;
+  const auto num_slices = static_cast<int64_t>(
+      clamp<int64_t>(num_pages / max<int64_t>(min_pages_per_slice, 1), 1,
+                     static_cast<int64_t>(max_slices)));
+
+  // 구간 경계를 페이지 단위로 맞춰 구간마다 마지막 페이지만 덜 채워지도록 함
+  const int64_t slice_span =
+      (num_pages + num_slices - 1) / num_slices * page_span;
+
+  vector<pair<int64_t, int64_t>> slices;
+  for (int64_t slice_begin = begin_time; slice_begin <= end_time;
+       slice_begin += slice_span) {
+    slices.emplace_back(slice_begin,
+                        min(slice_begin + slice_span - 1, end_time));
+  }
+
+  return slices;
+}
+
+size_t FetchScheduler::GetNumWorkers() const { return num_workers_; }
+
+}  // namespace backtesting::fetcher
@@ -13,6 +13,8 @@
 #include "Engines/BaseBarHandler.hpp"
 #include "Engines/DataUtils.hpp"
 #include "Engines/Engine.hpp"
+#include "Engines/IndicatorCache.hpp"
+#include "Engines/Profiler.hpp"
 
 // 네임 스페이스
 using namespace backtesting::utils;
@@ -21,7 +23,13 @@ namespace backtesting::indicator {
 
 Indicator::Indicator(const string& name, const string& timeframe,
                      const Plot& plot)
-    : is_calculated_(false),
+    : output_(make_shared<IndicatorOutput>(vector<size_t>())),
+      is_calculated_(false),
+      output_storage_(OutputStorage::DOUBLE),
+      is_output_discarded_(false),
+      is_lazy_(false),
+      capture_states_(false),
+      is_scheduled_(false),
       is_higher_timeframe_indicator_(false),
       cached_symbol_idx_(SIZE_MAX),
       cached_trading_bar_idx_(SIZE_MAX),
@@ -75,11 +83,18 @@ BACKTESTING_API shared_ptr<Engine>& Indicator::engine_ = Engine::GetEngine();
 BACKTESTING_API shared_ptr<Logger>& Indicator::logger_ = Logger::GetLogger();
 BACKTESTING_API size_t Indicator::creation_counter_ = 0;
 BACKTESTING_API size_t Indicator::pre_creation_counter_ = 0;
-BACKTESTING_API bool Indicator::is_calculating_ = false;
-BACKTESTING_API string Indicator::calculating_name_;
-BACKTESTING_API string Indicator::calculating_timeframe_;
 BACKTESTING_API vector<string> Indicator::saved_indicator_classes_;
 
+// 지표가 현재 계산 중인지 확인하는 플래그.
+// 지표 계산 시 사용하는 다른 지표가 계산하는 지표와 다른 타임프레임을 가질 수
+// 없게 검사할 때 사용하며, 지표를 여러 스레드에서 계산할 수 있으므로
+// 스레드마다 따로 가짐
+static thread_local bool is_calculating = false;  // 현재 지표 계산 중인지 여부
+static thread_local string calculating_name;  // 계산 중인 지표의 이름
+static thread_local string calculating_timeframe;  // 계산 중인 지표의 타임프레임
+static thread_local const Indicator* calculating_indicator =
+    nullptr;  // 계산 중인 지표
+
 Numeric<double> Indicator::operator[](const size_t index) {
   // =========================================================================
   // 사전 검증
@@ -87,27 +102,46 @@ Numeric<double> Indicator::operator[](const size_t index) {
 
   // 지표 계산 전 참조 호출 시 에러 발생
   // 특정 지표 계산 중 다른 지표 참조하는데 참조 지표의 정의 순서가 더 늦는 경우
-  if (!is_calculated_) [[unlikely]] {
-    throw runtime_error(
-        format("[{} {}] 지표가 계산되지 않았으므로 참조할 수 없습니다.", name_,
-               timeframe_));
+  if (!is_calculated_ && !IsScheduledSourceOfCalculating()) [[unlikely]] {
+    if (is_output_discarded_) {
+      throw runtime_error(
+          format("[{} {}] 지표는 계산 값을 버리도록 설정되었으므로 참조할 수 "
+                 "없습니다.",
+                 name_, timeframe_));
+    }
+
+    if (is_scheduled_) {
+      throw runtime_error(
+          format("[{} {}] 지표 계산에 사용하는 [{} {}] 지표는 여러 스레드로 "
+                 "계산 시 생성자 인수로 전달해야 참조할 수 있습니다.",
+                 calculating_name, calculating_timeframe, name_, timeframe_));
+    }
+
+    if (!is_lazy_) {
+      throw runtime_error(
+          format("[{} {}] 지표가 계산되지 않았으므로 참조할 수 없습니다.",
+                 name_, timeframe_));
+    }
+
+    // 지연 계산 지표는 현재 심볼이 처음 참조될 때 계산
+    EvaluateLazySymbol(bar_->GetCurrentSymbolIndex());
   }
 
   // 다른 지표 계산 중 해당 지표와 다른 타임프레임의 이 지표를 사용 시 에러 발생
-  if (is_calculating_ && timeframe_ != calculating_timeframe_) [[unlikely]] {
+  if (is_calculating && timeframe_ != calculating_timeframe) [[unlikely]] {
     throw runtime_error(
         format("[{} {}] 지표 계산에 사용하는 [{} {}] 지표의 타임프레임은 "
                "[{} {}] 지표의 타임프레임과 동일해야 합니다.",
-               calculating_name_, calculating_timeframe_, name_, timeframe_,
-               calculating_name_, calculating_timeframe_));
+               calculating_name, calculating_timeframe, name_, timeframe_,
+               calculating_name, calculating_timeframe));
   }
 
   // AFTER 전략에서 현재 인덱스 값 참조 시 에러 발생
   // 봉 완성은 CLOSE에서 되는데, 해당 전략들은 봉 중간에 실행되므로 현재 인덱스
   // 값 참조 시 미래의 값을 참조하게 되는 것이므로 논리에 맞지 않음
-  // (current_strategy_type의 초기값은 ON_CLOSE이므로 계산 중에는 관계 없음)
-  if (index == 0 && engine_->GetCurrentStrategyType() != ON_CLOSE)
-      [[unlikely]] {
+  // (지표 계산 중에는 지연 계산 지표가 AFTER 전략에서 계산될 수 있으므로 제외)
+  if (index == 0 && !is_calculating &&
+      engine_->GetCurrentStrategyType() != ON_CLOSE) [[unlikely]] {
     throw runtime_error(
         format("AfterEntry/AfterExit 전략에서는 [0]을 이용하여 [{} {}] 지표의 "
                "현재 인덱스의 값을 참조할 수 없습니다.",
@@ -124,7 +158,7 @@ Numeric<double> Indicator::operator[](const size_t index) {
   // - 계산 중인 지표와 같은 타임프레임의 지표인 케이스만 존재
   //   (다른 타임프레임은 사전 검증에서 에러 발생)
   // =========================================================================
-  if (is_calculating_) {
+  if (is_calculating) {
     const auto bar_idx = bar_->GetCurrentBarIndex();
 
     // 범위 검사
@@ -134,7 +168,7 @@ Numeric<double> Indicator::operator[](const size_t index) {
 
     const auto target_bar_idx = bar_idx - index;
 
-    return output_[bar_->GetCurrentSymbolIndex()][target_bar_idx];
+    return output_->Get(bar_->GetCurrentSymbolIndex(), target_bar_idx);
   }
 
   // =========================================================================
@@ -153,7 +187,7 @@ Numeric<double> Indicator::operator[](const size_t index) {
 
     const auto target_bar_idx = bar_idx - index;
 
-    return output_[bar_->GetCurrentSymbolIndex()][target_bar_idx];
+    return output_->Get(bar_->GetCurrentSymbolIndex(), target_bar_idx);
   }
 
   // =========================================================================
@@ -189,7 +223,7 @@ Numeric<double> Indicator::operator[](const size_t index) {
       return NAN;
     }
 
-    return output_[symbol_idx][cached_ref_bar_idx_];
+    return output_->Get(symbol_idx, cached_ref_bar_idx_);
   }
 
   // 캐시 미스 - 새로 계산
@@ -277,10 +311,12 @@ Numeric<double> Indicator::operator[](const size_t index) {
   bar_->SetCurrentBarDataType(original_bar_data_type,
                               original_reference_timeframe);
 
-  return output_[symbol_idx][ref_bar_idx];
+  return output_->Get(symbol_idx, ref_bar_idx);
 }
 
 void Indicator::CalculateIndicator() {
+  PROFILE_SCOPE("Indicator::CalculateIndicator");
+
   try {
     // 엔진이 초기화되기 전 지표를 계산하면 모든 심볼의 계산이 어려우므로 에러
     if (!engine_->IsEngineInitialized()) [[unlikely]] {
@@ -289,84 +325,408 @@ void Indicator::CalculateIndicator() {
                  timeframe_));
     }
 
-    // 바 데이터 설정
-    if (trading_bar_data_ == nullptr) {
-      trading_bar_data_ = bar_->GetBarData(TRADING, "");
-    }
-
-    if (reference_bar_data_ == nullptr) {
-      reference_bar_data_ = bar_->GetBarData(REFERENCE, timeframe_);
-    }
-
-    // 캐시 무효화 - 새로운 계산 시작 (메모리 효율적으로 초기화)
-    cached_symbol_idx_ = SIZE_MAX;
-    cached_trading_bar_idx_ = SIZE_MAX;
-    cached_target_bar_idx_ = SIZE_MAX;
-    cached_ref_bar_idx_ = SIZE_MAX;
+    // 바 데이터 및 심볼별 바 개수 설정
+    PrepareBarData();
 
     // ===========================================================================
     // 사전 설정 - 공통 변수들 미리 캐시
     const int num_symbols = reference_bar_data_->GetNumSymbols();
 
     // 계산 상태 설정
-    is_calculating_ = true;
-    calculating_name_ = name_;
-    calculating_timeframe_ = timeframe_;
+    is_calculating = true;
+    calculating_name = name_;
+    calculating_timeframe = timeframe_;
+    calculating_indicator = this;
 
-    // 메모리 미리 할당으로 리얼로케이션 방지 - 효율적인 메모리 관리
-    output_.clear();
-    output_.reserve(num_symbols);
-    output_.resize(num_symbols);
-
-    reference_num_bars_.clear();
-    reference_num_bars_.reserve(num_symbols);
-    reference_num_bars_.resize(num_symbols);
+    // 모든 심볼의 메모리를 한 번에 미리 할당
+    // 계산 값을 공유하는 지표가 있을 수 있으므로 새 버퍼에 계산
+    output_ = make_shared<IndicatorOutput>(reference_num_bars_);
 
     // 지표 설정에 맞게 바 데이터 유형 및 타임프레임 설정
     bar_->SetCurrentBarDataType(REFERENCE, timeframe_);
 
     // 전체 트레이딩 심볼들을 순회하며 지표 계산
     for (int symbol_idx = 0; symbol_idx < num_symbols; ++symbol_idx) {
-      // 심볼 인덱스 설정
+      CalculateSymbol(symbol_idx);
+    }
+
+    // 상태 정리
+    is_calculated_ = true;
+    is_calculating = false;
+    calculating_indicator = nullptr;
+
+    logger_->Log(
+        INFO_L,
+        format("[{} {}] 지표 계산이 완료되었습니다.", name_, timeframe_),
+        __FILE__, __LINE__, true);
+  } catch (const exception& e) {
+    is_calculating = false;
+    calculating_indicator = nullptr;
+
+    logger_->Log(
+        ERROR_L,
+        format("[{} {}] 지표 계산 중 오류가 발생했습니다.", name_, timeframe_),
+        __FILE__, __LINE__, true);
+
+    throw runtime_error(e.what());
+  }
+}
+
+void Indicator::CalculateSymbol(const int symbol_idx) {
+  // 심볼 인덱스 설정
+  bar_->SetCurrentSymbolIndex(symbol_idx);
+
+  // 해당 심볼의 바 개수와 출력 버퍼
+  const auto num_bars = reference_num_bars_[symbol_idx];
+  const auto symbol_output = (*output_)[symbol_idx];
+
+  // 초기화 - 심볼별로 한 번만 호출
+  this->Initialize();
+
+  // 일괄 계산을 지원하는 지표는 심볼의 모든 바를 한 번에 계산하고,
+  // 지원하지 않는 지표는 바마다 Calculate를 호출하여 계산
+  if (!this->CalculateBatch(symbol_output)) {
+    // 해당 심볼의 모든 바를 순회
+    // 컴파일러 최적화를 위한 지역 변수 사용
+    for (int bar_idx = 0; bar_idx < num_bars; ++bar_idx) {
+      // 현재 심볼의 바 인덱스를 증가시키며 지표 계산
+      bar_->SetCurrentBarIndex(bar_idx);
+
+      // 지표 계산
+      symbol_output[bar_idx] = this->Calculate();
+    }
+  }
+
+  // 바 인덱스 초기화
+  bar_->SetCurrentBarIndex(0);
+
+  if (capture_states_) {
+    CaptureState(symbol_idx);
+  }
+}
+
+void Indicator::CaptureState(const int symbol_idx) {
+  IndicatorState state;
+  if (!this->SaveState(state)) {
+    // 상태 저장을 지원하지 않는 지표는 스냅샷을 저장하지 않음
+    capture_states_ = false;
+    symbol_states_.clear();
+
+    return;
+  }
+
+  symbol_states_.resize(reference_num_bars_.size());
+  symbol_states_[symbol_idx] = state.Release();
+}
+
+void Indicator::PrepareLazyOutput() {
+  // 바 데이터 및 심볼별 바 개수 설정
+  PrepareBarData();
+
+  output_ = make_shared<IndicatorOutput>(reference_num_bars_);
+  output_->MarkAllPending();
+  is_lazy_ = true;
+}
+
+void Indicator::EvaluateLazySymbol(const int symbol_idx) {
+  if (output_->IsPending(symbol_idx)) {
+    PROFILE_SCOPE("Indicator::EvaluateLazySymbol");
+
+    // 전략 실행 또는 다른 지표 계산 중에 호출되므로
+    // 호출 시점의 데이터 환경과 계산 상태 저장
+    const auto original_bar_data_type = bar_->GetCurrentBarDataType();
+    const auto original_reference_timeframe =
+        bar_->GetCurrentReferenceTimeframe();
+    const auto original_symbol_idx = bar_->GetCurrentSymbolIndex();
+    const bool original_is_calculating = is_calculating;
+    const string original_calculating_name = calculating_name;
+    const string original_calculating_timeframe = calculating_timeframe;
+    const auto* original_calculating_indicator = calculating_indicator;
+
+    // 지표 설정에 맞게 바 데이터 유형 및 타임프레임 설정
+    // 전략 실행 중 사용하는 참조 바 인덱스는 계산 후 복구
+    bar_->SetCurrentBarDataType(REFERENCE, timeframe_);
+    bar_->SetCurrentSymbolIndex(symbol_idx);
+    const auto original_bar_idx = bar_->GetCurrentBarIndex();
+
+    is_calculating = true;
+    calculating_name = name_;
+    calculating_timeframe = timeframe_;
+    calculating_indicator = this;
+
+    const auto restore = [&] {
+      bar_->SetCurrentBarDataType(REFERENCE, timeframe_);
       bar_->SetCurrentSymbolIndex(symbol_idx);
+      bar_->SetCurrentBarIndex(original_bar_idx);
+
+      bar_->SetCurrentBarDataType(original_bar_data_type,
+                                  original_reference_timeframe);
+      bar_->SetCurrentSymbolIndex(original_symbol_idx);
+
+      is_calculating = original_is_calculating;
+      calculating_name = original_calculating_name;
+      calculating_timeframe = original_calculating_timeframe;
+      calculating_indicator = original_calculating_indicator;
+    };
+
+    try {
+      CalculateSymbol(symbol_idx);
+    } catch (const exception& e) {
+      restore();
+
+      logger_->Log(ERROR_L,
+                   format("[{} {}] 지표의 [{}] 심볼 지연 계산 중 오류가 "
+                          "발생했습니다.",
+                          name_, timeframe_,
+                          reference_bar_data_->GetSafeSymbolName(symbol_idx)),
+                   __FILE__, __LINE__, true);
+
+      throw runtime_error(e.what());
+    }
+
+    restore();
+    output_->MarkCalculated(symbol_idx);
+  }
+
+  // 계산 값을 공유하는 다른 지표가 남은 심볼을 계산했을 수 있으므로
+  // 버퍼의 계산 상태로 완료 여부 확인
+  if (output_->IsComplete()) {
+    is_calculated_ = true;
+    is_lazy_ = false;
+  }
+}
+
+void Indicator::EvaluateRemainingSymbols() {
+  if (!is_lazy_) {
+    return;
+  }
+
+  for (int symbol_idx = 0; symbol_idx < static_cast<int>(output_->size());
+       ++symbol_idx) {
+    EvaluateLazySymbol(symbol_idx);
+  }
+}
+
+void Indicator::BeginScheduledCalculation() {
+  // 바 데이터 및 심볼별 바 개수 설정
+  PrepareBarData();
+
+  // 계산 값을 공유하는 지표가 있을 수 있으므로 새 버퍼에 계산
+  output_ = make_shared<IndicatorOutput>(reference_num_bars_);
+  is_scheduled_ = true;
+}
+
+void Indicator::CalculateScheduledSymbol(const int symbol_idx) {
+  PROFILE_SCOPE("Indicator::CalculateScheduledSymbol");
+
+  try {
+    // 계산 상태 설정
+    is_calculating = true;
+    calculating_name = name_;
+    calculating_timeframe = timeframe_;
+    calculating_indicator = this;
+
+    // 지표 설정에 맞게 바 데이터 유형 및 타임프레임 설정
+    bar_->SetCurrentBarDataType(REFERENCE, timeframe_);
+
+    CalculateSymbol(symbol_idx);
+
+    is_calculating = false;
+    calculating_indicator = nullptr;
+  } catch (const exception& e) {
+    is_calculating = false;
+    calculating_indicator = nullptr;
+
+    logger_->Log(ERROR_L,
+                 format("[{} {}] 지표의 [{}] 심볼 계산 중 오류가 "
+                        "발생했습니다.",
+                        name_, timeframe_,
+                        reference_bar_data_->GetSafeSymbolName(symbol_idx)),
+                 __FILE__, __LINE__, true);
+
+    throw runtime_error(e.what());
+  }
+}
+
+void Indicator::FinishScheduledCalculation() {
+  is_scheduled_ = false;
+  is_calculated_ = true;
+
+  logger_->Log(
+      INFO_L, format("[{} {}] 지표 계산이 완료되었습니다.", name_, timeframe_),
+      __FILE__, __LINE__, true);
+}
+
+bool Indicator::IsScheduledSourceOfCalculating() const {
+  return is_scheduled_ && calculating_indicator != nullptr &&
+         ranges::find(calculating_indicator->source_indicators_, this) !=
+             calculating_indicator->source_indicators_.end();
+}
+
+bool Indicator::CalculateBatch(span<double> /*output*/) { return false; }
+
+bool Indicator::SaveState(IndicatorState& /*state*/) const { return false; }
+
+bool Indicator::LoadState(IndicatorState& /*state*/) { return false; }
+
+span<const double> Indicator::GetSeries(const Indicator& source) {
+  // 일괄 계산은 심볼의 바 인덱스가 타임프레임별로 다르므로
+  // 같은 타임프레임의 지표 계산 중에만 참조 가능
+  if (!is_calculating || source.timeframe_ != calculating_timeframe)
+      [[unlikely]] {
+    throw runtime_error(
+        format("[{} {}] 지표의 전체 계산 값은 같은 타임프레임의 지표 계산 "
+               "중에만 참조할 수 있습니다.",
+               source.name_, source.timeframe_));
+  }
+
+  const auto symbol_idx = bar_->GetCurrentSymbolIndex();
+
+  // 지연 계산 지표는 현재 심볼을 먼저 계산.
+  // 참조 지표는 전략이 소유한 지표이므로 상수성을 제거해도 안전함
+  if (source.is_lazy_) {
+    const_cast<Indicator&>(source).EvaluateLazySymbol(symbol_idx);
+  }
+
+  // 참조 지표의 정의 순서가 더 늦어 아직 계산되지 않았거나
+  // 계산 값이 압축되어 전체 값을 참조할 수 없는 경우
+  if ((!source.is_calculated_ && !source.is_lazy_ &&
+       !source.IsScheduledSourceOfCalculating()) ||
+      source.output_->IsCompacted()) [[unlikely]] {
+    throw runtime_error(
+        format("[{} {}] 지표가 계산되지 않았으므로 참조할 수 없습니다.",
+               source.name_, source.timeframe_));
+  }
+
+  return (*source.output_)[symbol_idx];
+}
+
+bool Indicator::LoadCachedOutput(const string& key) {
+  PrepareBarData();
+
+  auto output =
+      IndicatorOutput::Map(IndicatorCache::GetCachePath(key), key,
+                           reference_num_bars_);
+  if (output == nullptr) {
+    return false;
+  }
+
+  output_ = std::move(output);
+  is_calculated_ = true;
+
+  logger_->Log(INFO_L,
+               format("[{} {}] 지표의 계산 값을 캐시에서 불러왔습니다.", name_,
+                      timeframe_),
+               __FILE__, __LINE__, true);
+
+  return true;
+}
+
+void Indicator::SaveCachedOutput(const string& key) const {
+  if (!output_->Save(IndicatorCache::GetCachePath(key), key)) {
+    logger_->Log(WARN_L,
+                 format("[{} {}] 지표의 계산 값을 캐시에 저장하지 못했습니다.",
+                        name_, timeframe_),
+                 __FILE__, __LINE__, true);
+  }
+}
+
+bool Indicator::ResumeFromSnapshot(const string& key) {
+  PROFILE_SCOPE("Indicator::ResumeFromSnapshot");
+
+  PrepareBarData();
+
+  const auto& snapshot =
+      IndicatorSnapshot::Load(IndicatorCache::GetSnapshotPath(key), key);
+  const int num_symbols = reference_bar_data_->GetNumSymbols();
+  if (snapshot == nullptr ||
+      snapshot->symbols.size() != static_cast<size_t>(num_symbols)) {
+    return false;
+  }
+
+  // 스냅샷 저장 시점의 바들이 현재 바 데이터의 앞부분과 같은지 확인
+  vector<size_t> previous_num_bars(num_symbols);
+  for (int symbol_idx = 0; symbol_idx < num_symbols; ++symbol_idx) {
+    const auto& symbol = snapshot->symbols[symbol_idx];
+    if (symbol.num_bars > reference_num_bars_[symbol_idx] ||
+        IndicatorCache::HashBars(*reference_bar_data_, symbol_idx,
+                                 symbol.num_bars) != symbol.bars_hash) {
+      return false;
+    }
+
+    previous_num_bars[symbol_idx] = symbol.num_bars;
+  }
+
+  const auto& previous_output = IndicatorOutput::Map(
+      IndicatorCache::GetCachePath(snapshot->output_key), snapshot->output_key,
+      previous_num_bars);
+  if (previous_output == nullptr) {
+    return false;
+  }
+
+  size_t num_appended_bars = 0;
+
+  try {
+    // 계산 상태 설정
+    is_calculating = true;
+    calculating_name = name_;
+    calculating_timeframe = timeframe_;
+    calculating_indicator = this;
+
+    output_ = make_shared<IndicatorOutput>(reference_num_bars_);
+
+    // 지표 설정에 맞게 바 데이터 유형 및 타임프레임 설정
+    bar_->SetCurrentBarDataType(REFERENCE, timeframe_);
 
-      // 해당 심볼의 바 개수 미리 계산 및 캐시
-      const auto num_bars = reference_bar_data_->GetNumBars(symbol_idx);
-      reference_num_bars_[symbol_idx] = num_bars;
+    for (int symbol_idx = 0; symbol_idx < num_symbols; ++symbol_idx) {
+      bar_->SetCurrentSymbolIndex(symbol_idx);
 
-      // 메모리 미리 할당 (리얼로케이션 방지) - cache-friendly 패턴
-      auto& symbol_output = output_[symbol_idx];
-      symbol_output.clear();
-      symbol_output.reserve(num_bars);
-      symbol_output.resize(num_bars);
+      // 저장 시점까지의 계산 값 복사
+      const auto previous_values = (*previous_output)[symbol_idx];
+      const auto symbol_output = (*output_)[symbol_idx];
+      ranges::copy(previous_values, symbol_output.begin());
 
-      // 초기화 - 심볼별로 한 번만 호출
+      // 저장된 상태를 복구할 수 없으면 해당 심볼만 처음부터 계산
       this->Initialize();
 
-      // 해당 심볼의 모든 바를 순회
-      // 컴파일러 최적화를 위한 지역 변수 사용
-      for (int bar_idx = 0; bar_idx < num_bars; ++bar_idx) {
-        // 현재 심볼의 바 인덱스를 증가시키며 지표 계산
-        bar_->SetCurrentBarIndex(bar_idx);
+      bool is_loaded;
+      try {
+        IndicatorState state(std::move(snapshot->symbols[symbol_idx].state));
+        is_loaded = this->LoadState(state);
+      } catch (const exception&) {
+        is_loaded = false;
+      }
 
-        // 지표 계산
+      if (!is_loaded) {
+        CalculateSymbol(symbol_idx);
+        continue;
+      }
+
+      // 추가된 바만 계산
+      const auto num_bars = reference_num_bars_[symbol_idx];
+      for (size_t bar_idx = previous_values.size(); bar_idx < num_bars;
+           ++bar_idx) {
+        bar_->SetCurrentBarIndex(bar_idx);
         symbol_output[bar_idx] = this->Calculate();
       }
 
+      num_appended_bars += num_bars - previous_values.size();
+
       // 바 인덱스 초기화
       bar_->SetCurrentBarIndex(0);
+
+      if (capture_states_) {
+        CaptureState(symbol_idx);
+      }
     }
 
     // 상태 정리
     is_calculated_ = true;
-    is_calculating_ = false;
-
-    logger_->Log(
-        INFO_L,
-        format("[{} {}] 지표 계산이 완료되었습니다.", name_, timeframe_),
-        __FILE__, __LINE__, true);
+    is_calculating = false;
+    calculating_indicator = nullptr;
   } catch (const exception& e) {
-    is_calculating_ = false;
+    is_calculating = false;
+    calculating_indicator = nullptr;
 
     logger_->Log(
         ERROR_L,
@@ -375,6 +735,137 @@ void Indicator::CalculateIndicator() {
 
     throw runtime_error(e.what());
   }
+
+  resumed_output_key_ = snapshot->output_key;
+
+  logger_->Log(INFO_L,
+               format("[{} {}] 지표를 스냅샷에서 이어서 계산했습니다. (추가된 "
+                      "바 [{}]개)",
+                      name_, timeframe_, num_appended_bars),
+               __FILE__, __LINE__, true);
+
+  return true;
+}
+
+void Indicator::SaveSnapshot(const string& key, const string& output_key) {
+  if (!capture_states_ || symbol_states_.size() != reference_num_bars_.size()) {
+    return;
+  }
+
+  IndicatorSnapshot snapshot;
+  snapshot.output_key = output_key;
+  snapshot.symbols.reserve(symbol_states_.size());
+
+  for (int symbol_idx = 0; symbol_idx < static_cast<int>(symbol_states_.size());
+       ++symbol_idx) {
+    const auto num_bars = reference_num_bars_[symbol_idx];
+
+    snapshot.symbols.push_back(
+        {num_bars,
+         IndicatorCache::HashBars(*reference_bar_data_, symbol_idx, num_bars),
+         std::move(symbol_states_[symbol_idx])});
+  }
+
+  symbol_states_.clear();
+
+  if (!snapshot.Save(IndicatorCache::GetSnapshotPath(key), key)) {
+    logger_->Log(WARN_L,
+                 format("[{} {}] 지표의 계산 상태를 스냅샷에 저장하지 "
+                        "못했습니다.",
+                        name_, timeframe_),
+                 __FILE__, __LINE__, true);
+
+    return;
+  }
+
+  // 이어서 계산한 이전 계산 값은 더 이상 스냅샷에서 참조하지 않으므로 삭제
+  if (!resumed_output_key_.empty() && resumed_output_key_ != output_key) {
+    error_code ec;
+    fs::remove(IndicatorCache::GetCachePath(resumed_output_key_), ec);
+  }
+
+  resumed_output_key_.clear();
+}
+
+void Indicator::PrepareBarData() {
+  if (trading_bar_data_ == nullptr) {
+    trading_bar_data_ = bar_->GetBarData(TRADING, "");
+  }
+
+  if (reference_bar_data_ == nullptr) {
+    reference_bar_data_ = bar_->GetBarData(REFERENCE, timeframe_);
+  }
+
+  // 캐시 무효화 - 새로운 계산 시작 (메모리 효율적으로 초기화)
+  cached_symbol_idx_ = SIZE_MAX;
+  cached_trading_bar_idx_ = SIZE_MAX;
+  cached_target_bar_idx_ = SIZE_MAX;
+  cached_ref_bar_idx_ = SIZE_MAX;
+
+  // 해당 타임프레임의 심볼별 바 개수 미리 계산 및 캐시
+  const int num_symbols = reference_bar_data_->GetNumSymbols();
+
+  reference_num_bars_.resize(num_symbols);
+  for (int symbol_idx = 0; symbol_idx < num_symbols; ++symbol_idx) {
+    reference_num_bars_[symbol_idx] =
+        reference_bar_data_->GetNumBars(symbol_idx);
+  }
+}
+
+void Indicator::ShareOutput(const Indicator& canonical) {
+  if ((!canonical.is_calculated_ && !canonical.is_lazy_ &&
+       !canonical.is_scheduled_) ||
+      canonical.timeframe_ != timeframe_) [[unlikely]] {
+    const string& msg =
+        format("[{} {}] 지표는 계산되지 않았거나 타임프레임이 다른 [{} {}] "
+               "지표의 계산 값을 공유할 수 없습니다.",
+               name_, timeframe_, canonical.name_, canonical.timeframe_);
+
+    logger_->Log(ERROR_L, msg, __FILE__, __LINE__, true);
+    throw runtime_error(msg);
+  }
+
+  AttachOutput(canonical);
+
+  logger_->Log(INFO_L,
+               format("[{} {}] 지표는 [{} {}] 지표와 계산이 같으므로 계산 "
+                      "값을 공유합니다.",
+                      name_, timeframe_, canonical.name_, canonical.timeframe_),
+               __FILE__, __LINE__, true);
+}
+
+void Indicator::AttachOutput(const Indicator& canonical) {
+  // 계산 시 설정되는 바 데이터와 참조 캐시를 같은 상태로 설정
+  trading_bar_data_ = canonical.trading_bar_data_;
+  reference_bar_data_ = canonical.reference_bar_data_;
+
+  cached_symbol_idx_ = SIZE_MAX;
+  cached_trading_bar_idx_ = SIZE_MAX;
+  cached_target_bar_idx_ = SIZE_MAX;
+  cached_ref_bar_idx_ = SIZE_MAX;
+
+  // 지연 계산 지표의 계산 값을 공유하면 계산 상태도 공유하므로
+  // 어느 지표에서 계산하든 같은 버퍼에 한 번만 계산됨
+  output_ = canonical.output_;
+  reference_num_bars_ = canonical.reference_num_bars_;
+  is_calculated_ = canonical.is_calculated_;
+  is_lazy_ = canonical.is_lazy_;
+  is_scheduled_ = canonical.is_scheduled_;
+}
+
+void Indicator::ReplaceOutput(shared_ptr<IndicatorOutput> output) {
+  output_ = std::move(output);
+}
+
+void Indicator::DiscardOutput() {
+  output_ = make_shared<IndicatorOutput>(vector<size_t>());
+  is_calculated_ = false;
+  is_output_discarded_ = true;
+}
+
+void Indicator::SetDependencies(Dependencies&& dependencies) {
+  source_indicators_ = std::move(dependencies.source_indicators);
+  signature_ = std::move(dependencies.signature);
 }
 
 void Indicator::SetTimeframe(const string& timeframe) {
@@ -386,6 +877,15 @@ void Indicator::SetTimeframe(const string& timeframe) {
   }
 }
 
+void Indicator::SetOutputStorage(const OutputStorage output_storage) {
+  if (!is_calculated_) {
+    output_storage_ = output_storage;
+  } else {
+    throw runtime_error(format(
+        "[{}] 지표가 계산되었으므로 저장 방식 변경을 할 수 없습니다.", name_));
+  }
+}
+
 void Indicator::SetHigherTimeframeIndicator() {
   is_higher_timeframe_indicator_ = true;
 }
@@ -396,8 +896,14 @@ string Indicator::GetIndicatorClassName() const { return class_name_; }
 
 string Indicator::GetTimeframe() const { return timeframe_; }
 
+OutputStorage Indicator::GetOutputStorage() const { return output_storage_; }
+
 string Indicator::GetSourcePath() { return source_path_; }
 
+const vector<Indicator*>& Indicator::GetSourceIndicators() const {
+  return source_indicators_;
+}
+
 string Indicator::GetHeaderPath() { return header_path_; }
 
 bool Indicator::IsIndicatorClassSaved(const string& class_name) {
@@ -417,9 +923,10 @@ void Indicator::ResetIndicator() {
 
   saved_indicator_classes_.clear();
 
-  is_calculating_ = false;
-  calculating_name_.clear();
-  calculating_timeframe_.clear();
+  is_calculating = false;
+  calculating_name.clear();
+  calculating_timeframe.clear();
+  calculating_indicator = nullptr;
 }
 
 void Indicator::IncreaseCreationCounter() { creation_counter_++; }
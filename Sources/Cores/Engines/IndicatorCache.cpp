@@ -0,0 +1,188 @@
+// 표준 라이브러리
+#include <bit>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <mutex>
+#include <unordered_map>
+
+// 파일 헤더
+#include "Engines/IndicatorCache.hpp"
+
+// 내부 헤더
+#include "Engines/BarData.hpp"
+#include "Engines/Config.hpp"
+
+// 네임 스페이스
+using namespace backtesting::bar;
+using namespace backtesting::engine;
+
+namespace backtesting::indicator {
+
+namespace {
+
+// 바 데이터 객체별로 계산해 둔 지문과 계산 당시의 심볼 개수
+struct BarDataFingerprint {
+  weak_ptr<BarData> bar_data;
+  int num_symbols;
+  string fingerprint;
+};
+
+mutex fingerprints_mutex;
+unordered_map<const BarData*, BarDataFingerprint> bar_data_fingerprints;
+
+// XXH64 상수
+constexpr uint64_t prime1 = 0x9e3779b185ebca87ULL;
+constexpr uint64_t prime2 = 0xc2b2ae3d27d4eb4fULL;
+constexpr uint64_t prime3 = 0x165667b19e3779f9ULL;
+constexpr uint64_t prime4 = 0x85ebca77c2b2ae63ULL;
+constexpr uint64_t prime5 = 0x27d4eb2f165667c5ULL;
+
+/// 바이트 열에서 리틀 엔디안 정수를 읽는 함수
+template <typename T>
+T ReadWord(const unsigned char* bytes) {
+  T word;
+  memcpy(&word, bytes, sizeof(word));
+
+  return word;
+}
+
+/// 레인 하나에 8바이트를 누적하는 함수
+uint64_t Round(const uint64_t acc, const uint64_t word) {
+  return rotl(acc + word * prime2, 31) * prime1;
+}
+
+/// 레인을 최종 해시에 합치는 함수
+uint64_t MergeRound(const uint64_t hash, const uint64_t lane) {
+  return (hash ^ Round(0, lane)) * prime1 + prime4;
+}
+
+}  // namespace
+
+uint64_t IndicatorCache::Hash(const void* data, const size_t size,
+                              const uint64_t seed) {
+  const auto* bytes = static_cast<const unsigned char*>(data);
+  const unsigned char* const end = bytes + size;
+
+  // XXH64: 4개의 레인에서 8바이트씩 곱셈과 회전으로 누적한 뒤 합치고,
+  // 마지막에 모든 입력 비트가 모든 출력 비트에 영향을 주도록 섞음
+  uint64_t hash;
+  if (size >= 32) {
+    uint64_t lanes[4] = {seed + prime1 + prime2, seed + prime2, seed,
+                         seed - prime1};
+
+    for (; bytes + 32 <= end; bytes += 32) {
+      for (size_t lane = 0; lane < 4; ++lane) {
+        lanes[lane] = Round(lanes[lane], ReadWord<uint64_t>(bytes + lane * 8));
+      }
+    }
+
+    hash = rotl(lanes[0], 1) + rotl(lanes[1], 7) + rotl(lanes[2], 12) +
+           rotl(lanes[3], 18);
+
+    for (const auto lane : lanes) {
+      hash = MergeRound(hash, lane);
+    }
+  } else {
+    hash = seed + prime5;
+  }
+
+  hash += size;
+
+  // 남은 바이트 처리
+  for (; bytes + 8 <= end; bytes += 8) {
+    hash ^= Round(0, ReadWord<uint64_t>(bytes));
+    hash = rotl(hash, 27) * prime1 + prime4;
+  }
+
+  if (bytes + 4 <= end) {
+    hash ^= ReadWord<uint32_t>(bytes) * prime1;
+    hash = rotl(hash, 23) * prime2 + prime3;
+    bytes += 4;
+  }
+
+  for (; bytes < end; ++bytes) {
+    hash ^= *bytes * prime5;
+    hash = rotl(hash, 11) * prime1;
+  }
+
+  // 최종 혼합
+  hash ^= hash >> 33;
+  hash *= prime2;
+  hash ^= hash >> 29;
+  hash *= prime3;
+  hash ^= hash >> 32;
+
+  return hash;
+}
+
+string IndicatorCache::HashFile(const string& path) {
+  ifstream file(path, ios::binary);
+  if (!file.is_open()) {
+    return "";
+  }
+
+  const string content((istreambuf_iterator(file)),
+                       istreambuf_iterator<char>());
+
+  return format("{:016x}", Hash(content.data(), content.size()));
+}
+
+string IndicatorCache::FingerprintBarData(BarData& bar_data) {
+  const int num_symbols = bar_data.GetNumSymbols();
+  uint64_t hash = Hash(&num_symbols, sizeof(num_symbols));
+
+  for (int symbol_idx = 0; symbol_idx < num_symbols; ++symbol_idx) {
+    const auto& symbol_name = bar_data.GetSafeSymbolName(symbol_idx);
+    hash = Hash(symbol_name.data(), symbol_name.size(), hash);
+
+    const auto& bars = bar_data.GetBars(symbol_idx);
+    hash = Hash(bars.data(), bars.size() * sizeof(Bar), hash);
+  }
+
+  return format("{:016x}", hash);
+}
+
+string IndicatorCache::GetBarDataFingerprint(
+    const shared_ptr<BarData>& bar_data) {
+  lock_guard lock(fingerprints_mutex);
+
+  // 해제된 바 데이터의 지문은 제거하여 같은 주소의 새 객체와 혼동하지 않음
+  erase_if(bar_data_fingerprints,
+           [](const auto& entry) { return entry.second.bar_data.expired(); });
+
+  // 바 데이터는 SetBarData로 심볼이 추가될 때만 바뀌므로 심볼 개수가 같으면
+  // 지문을 재사용
+  const int num_symbols = bar_data->GetNumSymbols();
+  if (const auto it = bar_data_fingerprints.find(bar_data.get());
+      it != bar_data_fingerprints.end() &&
+      it->second.num_symbols == num_symbols) {
+    return it->second.fingerprint;
+  }
+
+  auto fingerprint = FingerprintBarData(*bar_data);
+  bar_data_fingerprints[bar_data.get()] = {bar_data, num_symbols, fingerprint};
+
+  return fingerprint;
+}
+
+uint64_t IndicatorCache::HashBars(BarData& bar_data, const int symbol_idx,
+                                  const size_t num_bars) {
+  const auto& symbol_name = bar_data.GetSafeSymbolName(symbol_idx);
+  const uint64_t hash = Hash(symbol_name.data(), symbol_name.size());
+
+  return Hash(bar_data.GetBars(symbol_idx).data(), num_bars * sizeof(Bar),
+              hash);
+}
+
+string IndicatorCache::GetCachePath(const string& key) {
+  return format("{}/Caches/Indicators/{:016x}.bin",
+                Config::GetProjectDirectory(), Hash(key.data(), key.size()));
+}
+
+string IndicatorCache::GetSnapshotPath(const string& key) {
+  return format("{}/Caches/Indicators/{:016x}.state",
+                Config::GetProjectDirectory(), Hash(key.data(), key.size()));
+}
+
+}  // namespace backtesting::indicator
@@ -0,0 +1,892 @@
+// 표준 라이브러리
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#include <immintrin.h>
+#define KERNEL_USE_X86_SIMD 1
+#else
+#define KERNEL_USE_X86_SIMD 0
+#endif
+
+// MSVC는 /arch 설정과 관계없이 모든 내장 함수를 사용할 수 있으므로
+// 구현별 타겟 속성은 GCC/Clang에서만 지정
+#if KERNEL_USE_X86_SIMD && defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define KERNEL_TARGET_AVX2
+#define KERNEL_TARGET_AVX512
+#elif KERNEL_USE_X86_SIMD
+#define KERNEL_TARGET_AVX2 __attribute__((target("avx2")))
+#define KERNEL_TARGET_AVX512 __attribute__((target("avx512f")))
+#endif
+
+// 파일 헤더
+#include "Engines/IndicatorKernels.hpp"
+
+// 내부 헤더
+#include "Engines/Logger.hpp"
+#include "Engines/Numeric.hpp"
+
+// 네임 스페이스
+using namespace backtesting::bar;
+using namespace backtesting::logger;
+using namespace backtesting::numeric;
+
+namespace backtesting::kernel {
+
+namespace {
+
+// 바 구조체의 필드를 double 단위 간격으로 모아 읽기 위한 간격
+static_assert(sizeof(Bar) % sizeof(double) == 0);
+constexpr long long bar_stride = sizeof(Bar) / sizeof(double);
+
+// RELATIVE 비교 방식의 절대 오차 및 상대 오차. utils::IsGreater 등과 같은 값
+constexpr double relative_abs_tolerance =
+    numeric_limits<double>::epsilon() * 100;
+constexpr double relative_rel_tolerance = 1e-12;
+
+atomic<SimdLevel>& GetSimdLevelRef() {
+  static atomic<SimdLevel> simd_level(DetectSimdLevel());
+  return simd_level;
+}
+
+/**
+ * 앞쪽 NaN 구간의 길이를 반환하는 함수.
+ * NaN 구간 이후에 유한하지 않은 값이 있으면 nullopt를 반환
+ */
+optional<size_t> FindFirstValue(const span<const double> input) {
+  size_t start = 0;
+  while (start < input.size() && isnan(input[start])) {
+    ++start;
+  }
+
+  for (size_t i = start; i < input.size(); ++i) {
+    if (!isfinite(input[i])) {
+      return nullopt;
+    }
+  }
+
+  return start;
+}
+
+// =============================================================================
+// 구간별 누적/역누적
+// 윈도우 [b - period + 1, b]는 최대 두 구간에 걸치므로, 앞 구간의 역누적값과
+// 뒤 구간의 누적값을 결합하면 윈도우 값이 됨
+// =============================================================================
+/**
+ * 구간별 누적합과 역누적합을 계산하는 함수.
+ * 구간 시작 위치의 역누적합은 0으로 두어, 구간과 정확히 겹치는 윈도우는
+ * 누적합만으로 계산되게 함
+ */
+template <typename Transform>
+void ScanSum(const double* input, const size_t count, const size_t period,
+             double* prefix, double* suffix, Transform transform) {
+  for (size_t seg_start = 0; seg_start < count; seg_start += period) {
+    const size_t seg_end = min(seg_start + period, count);
+
+    double sum = 0;
+    for (size_t i = seg_start; i < seg_end; ++i) {
+      sum += transform(input[i]);
+      prefix[i] = sum;
+    }
+
+    sum = 0;
+    for (size_t i = seg_end - 1; i > seg_start; --i) {
+      sum += transform(input[i]);
+      suffix[i] = sum;
+    }
+
+    suffix[seg_start] = 0;
+  }
+}
+
+/**
+ * 구간별 누적 최댓값(최솟값)과 역누적 최댓값(최솟값)을 계산하는 함수.
+ * 같은 값은 나중 값을 선택하여 스칼라 지표의 데크와 같은 값을 반환하게 함
+ */
+template <bool IsMax>
+void ScanExtreme(const double* input, const size_t count, const size_t period,
+                 double* prefix, double* suffix) {
+  const auto is_better_or_equal = [](const double lhs, const double rhs) {
+    return IsMax ? lhs >= rhs : lhs <= rhs;
+  };
+
+  const auto is_better = [](const double lhs, const double rhs) {
+    return IsMax ? lhs > rhs : lhs < rhs;
+  };
+
+  for (size_t seg_start = 0; seg_start < count; seg_start += period) {
+    const size_t seg_end = min(seg_start + period, count);
+
+    double extreme = input[seg_start];
+    prefix[seg_start] = extreme;
+    for (size_t i = seg_start + 1; i < seg_end; ++i) {
+      if (is_better_or_equal(input[i], extreme)) {
+        extreme = input[i];
+      }
+
+      prefix[i] = extreme;
+    }
+
+    extreme = input[seg_end - 1];
+    suffix[seg_end - 1] = extreme;
+    for (size_t i = seg_end - 1; i-- > seg_start;) {
+      if (is_better(input[i], extreme)) {
+        extreme = input[i];
+      }
+
+      suffix[i] = extreme;
+    }
+  }
+}
+
+// =============================================================================
+// 스칼라 구현
+// =============================================================================
+double StandardDeviationFromSums(const double sum, const double sum_sq,
+                                 const double divisor) {
+  const double mean = sum / divisor;
+  double var = sum_sq / divisor - mean * mean;
+
+  // 경미한 음수 보정
+  if (var < 0 && var > -1e-12) {
+    var = 0;
+  }
+
+  return sqrt(var);
+}
+
+void CombineMeanScalar(const double* suffix, const double* prefix,
+                       double* output, const size_t count,
+                       const double divisor) {
+  for (size_t i = 0; i < count; ++i) {
+    output[i] = (suffix[i] + prefix[i]) / divisor;
+  }
+}
+
+void CombineStandardDeviationScalar(const double* sum_suffix,
+                                    const double* sum_prefix,
+                                    const double* sq_suffix,
+                                    const double* sq_prefix, double* output,
+                                    const size_t count, const double divisor) {
+  for (size_t i = 0; i < count; ++i) {
+    output[i] = StandardDeviationFromSums(sum_suffix[i] + sum_prefix[i],
+                                          sq_suffix[i] + sq_prefix[i], divisor);
+  }
+}
+
+void CombineMaxScalar(const double* suffix, const double* prefix,
+                      double* output, const size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    output[i] = suffix[i] > prefix[i] ? suffix[i] : prefix[i];
+  }
+}
+
+void CombineMinScalar(const double* suffix, const double* prefix,
+                      double* output, const size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    output[i] = suffix[i] < prefix[i] ? suffix[i] : prefix[i];
+  }
+}
+
+void TrueRangeScalar(const Bar* bars, double* output, const size_t begin,
+                     const size_t end) {
+  for (size_t i = begin; i < end; ++i) {
+    const double prev_close = bars[i - 1].close;
+
+    const double hl = bars[i].high - bars[i].low;
+    const double hc = abs(bars[i].high - prev_close);
+    const double lc = abs(bars[i].low - prev_close);
+
+    output[i] = max({hl, hc, lc});
+  }
+}
+
+/// 현재 바에서 lhs > rhs이고 이전 바에서 lhs <= rhs인지 Numeric 비교와 같은
+/// 방식으로 판정하는 함수
+template <ComparisonMode Mode>
+void CrossOverScalar(const double* lhs, const double* rhs, uint8_t* output,
+                     const size_t begin, const size_t end,
+                     const double tolerance) {
+  for (size_t i = begin; i < end; ++i) {
+    output[i] =
+        Comparison<Mode>::IsGreater(lhs[i], rhs[i], tolerance) &
+        Comparison<Mode>::IsLessOrEqual(lhs[i - 1], rhs[i - 1], tolerance);
+  }
+}
+
+#if KERNEL_USE_X86_SIMD
+// =============================================================================
+// AVX2 구현
+// max_pd(a, b)는 (a > b) ? a : b와 같으므로 NaN과 부호 있는 0을 포함하여
+// 스칼라 비교와 같은 결과를 반환함
+// =============================================================================
+KERNEL_TARGET_AVX2 void CombineMeanAvx2(const double* suffix,
+                                        const double* prefix, double* output,
+                                        const size_t count,
+                                        const double divisor) {
+  const __m256d divisor_vec = _mm256_set1_pd(divisor);
+
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    const __m256d sum =
+        _mm256_add_pd(_mm256_loadu_pd(suffix + i), _mm256_loadu_pd(prefix + i));
+    _mm256_storeu_pd(output + i, _mm256_div_pd(sum, divisor_vec));
+  }
+
+  CombineMeanScalar(suffix + i, prefix + i, output + i, count - i, divisor);
+}
+
+KERNEL_TARGET_AVX2 void CombineStandardDeviationAvx2(
+    const double* sum_suffix, const double* sum_prefix,
+    const double* sq_suffix, const double* sq_prefix, double* output,
+    const size_t count, const double divisor) {
+  const __m256d divisor_vec = _mm256_set1_pd(divisor);
+  const __m256d zero = _mm256_setzero_pd();
+  const __m256d epsilon = _mm256_set1_pd(-1e-12);
+
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    const __m256d sum = _mm256_add_pd(_mm256_loadu_pd(sum_suffix + i),
+                                      _mm256_loadu_pd(sum_prefix + i));
+    const __m256d sum_sq = _mm256_add_pd(_mm256_loadu_pd(sq_suffix + i),
+                                         _mm256_loadu_pd(sq_prefix + i));
+
+    const __m256d mean = _mm256_div_pd(sum, divisor_vec);
+    __m256d var = _mm256_sub_pd(_mm256_div_pd(sum_sq, divisor_vec),
+                                _mm256_mul_pd(mean, mean));
+
+    // 경미한 음수 보정
+    const __m256d tiny_negative =
+        _mm256_and_pd(_mm256_cmp_pd(var, zero, _CMP_LT_OQ),
+                      _mm256_cmp_pd(var, epsilon, _CMP_GT_OQ));
+    var = _mm256_blendv_pd(var, zero, tiny_negative);
+
+    _mm256_storeu_pd(output + i, _mm256_sqrt_pd(var));
+  }
+
+  CombineStandardDeviationScalar(sum_suffix + i, sum_prefix + i,
+                                 sq_suffix + i, sq_prefix + i, output + i,
+                                 count - i, divisor);
+}
+
+KERNEL_TARGET_AVX2 void CombineMaxAvx2(const double* suffix,
+                                       const double* prefix, double* output,
+                                       const size_t count) {
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    _mm256_storeu_pd(output + i, _mm256_max_pd(_mm256_loadu_pd(suffix + i),
+                                               _mm256_loadu_pd(prefix + i)));
+  }
+
+  CombineMaxScalar(suffix + i, prefix + i, output + i, count - i);
+}
+
+KERNEL_TARGET_AVX2 void CombineMinAvx2(const double* suffix,
+                                       const double* prefix, double* output,
+                                       const size_t count) {
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    _mm256_storeu_pd(output + i, _mm256_min_pd(_mm256_loadu_pd(suffix + i),
+                                               _mm256_loadu_pd(prefix + i)));
+  }
+
+  CombineMinScalar(suffix + i, prefix + i, output + i, count - i);
+}
+
+KERNEL_TARGET_AVX2 void TrueRangeAvx2(const Bar* bars, double* output,
+                                      const size_t count) {
+  const __m256i index =
+      _mm256_setr_epi64x(0, bar_stride, 2 * bar_stride, 3 * bar_stride);
+  const __m256d sign_mask = _mm256_set1_pd(-0.0);
+
+  size_t i = 1;
+  for (; i + 4 <= count; i += 4) {
+    const __m256d high = _mm256_i64gather_pd(&bars[i].high, index, 8);
+    const __m256d low = _mm256_i64gather_pd(&bars[i].low, index, 8);
+    const __m256d prev_close =
+        _mm256_i64gather_pd(&bars[i - 1].close, index, 8);
+
+    const __m256d hl = _mm256_sub_pd(high, low);
+    const __m256d hc =
+        _mm256_andnot_pd(sign_mask, _mm256_sub_pd(high, prev_close));
+    const __m256d lc =
+        _mm256_andnot_pd(sign_mask, _mm256_sub_pd(low, prev_close));
+
+    // max({hl, hc, lc})와 같은 순서로 비교
+    _mm256_storeu_pd(output + i,
+                     _mm256_max_pd(lc, _mm256_max_pd(hc, hl)));
+  }
+
+  TrueRangeScalar(bars, output, i, count);
+}
+
+/**
+ * 두 값의 차이가 이 값을 넘으면 다른 값으로 판정하는 경계값을 계산하는 함수.
+ * RELATIVE는 max(절대 오차, 상대 오차 × max(|lhs|, |rhs|))이며,
+ * diff > 경계값은 utils::IsGreater의 두 오차 검사와 같은 판정임
+ */
+template <ComparisonMode Mode>
+KERNEL_TARGET_AVX2 __m256d CrossThresholdAvx2(const __m256d lhs,
+                                              const __m256d rhs,
+                                              const __m256d tolerance) {
+  if constexpr (Mode == ComparisonMode::ABSOLUTE) {
+    return tolerance;
+  } else {
+    const __m256d sign_mask = _mm256_set1_pd(-0.0);
+    const __m256d scale = _mm256_max_pd(_mm256_andnot_pd(sign_mask, lhs),
+                                        _mm256_andnot_pd(sign_mask, rhs));
+
+    return _mm256_max_pd(
+        tolerance,
+        _mm256_mul_pd(_mm256_set1_pd(relative_rel_tolerance), scale));
+  }
+}
+
+template <ComparisonMode Mode>
+KERNEL_TARGET_AVX2 void CrossOverAvx2(const double* lhs, const double* rhs,
+                                      uint8_t* output, const size_t count,
+                                      const double tolerance) {
+  const __m256d tolerance_vec = _mm256_set1_pd(
+      Mode == ComparisonMode::ABSOLUTE ? tolerance : relative_abs_tolerance);
+
+  size_t i = 1;
+  for (; i + 4 <= count; i += 4) {
+    const __m256d current_lhs = _mm256_loadu_pd(lhs + i);
+    const __m256d current_rhs = _mm256_loadu_pd(rhs + i);
+    const __m256d prev_lhs = _mm256_loadu_pd(lhs + i - 1);
+    const __m256d prev_rhs = _mm256_loadu_pd(rhs + i - 1);
+
+    // 순서 있는 비교(_OQ)이므로 NaN이 포함되면 false
+    __m256d is_above;
+    __m256d was_below;
+    if constexpr (Mode == ComparisonMode::EXACT) {
+      is_above = _mm256_cmp_pd(current_lhs, current_rhs, _CMP_GT_OQ);
+      was_below = _mm256_cmp_pd(prev_lhs, prev_rhs, _CMP_LE_OQ);
+    } else {
+      is_above = _mm256_cmp_pd(
+          _mm256_sub_pd(current_lhs, current_rhs),
+          CrossThresholdAvx2<Mode>(current_lhs, current_rhs, tolerance_vec),
+          _CMP_GT_OQ);
+      was_below = _mm256_cmp_pd(
+          _mm256_sub_pd(prev_lhs, prev_rhs),
+          CrossThresholdAvx2<Mode>(prev_lhs, prev_rhs, tolerance_vec),
+          _CMP_LE_OQ);
+    }
+
+    const int mask = _mm256_movemask_pd(_mm256_and_pd(is_above, was_below));
+    for (int lane = 0; lane < 4; ++lane) {
+      output[i + lane] = static_cast<uint8_t>(mask >> lane & 1);
+    }
+  }
+
+  CrossOverScalar<Mode>(lhs, rhs, output, i, count, tolerance);
+}
+
+// =============================================================================
+// AVX-512 구현
+// =============================================================================
+KERNEL_TARGET_AVX512 void CombineMeanAvx512(const double* suffix,
+                                            const double* prefix,
+                                            double* output, const size_t count,
+                                            const double divisor) {
+  const __m512d divisor_vec = _mm512_set1_pd(divisor);
+
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    const __m512d sum =
+        _mm512_add_pd(_mm512_loadu_pd(suffix + i), _mm512_loadu_pd(prefix + i));
+    _mm512_storeu_pd(output + i, _mm512_div_pd(sum, divisor_vec));
+  }
+
+  CombineMeanScalar(suffix + i, prefix + i, output + i, count - i, divisor);
+}
+
+KERNEL_TARGET_AVX512 void CombineStandardDeviationAvx512(
+    const double* sum_suffix, const double* sum_prefix,
+    const double* sq_suffix, const double* sq_prefix, double* output,
+    const size_t count, const double divisor) {
+  const __m512d divisor_vec = _mm512_set1_pd(divisor);
+  const __m512d zero = _mm512_setzero_pd();
+  const __m512d epsilon = _mm512_set1_pd(-1e-12);
+
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    const __m512d sum = _mm512_add_pd(_mm512_loadu_pd(sum_suffix + i),
+                                      _mm512_loadu_pd(sum_prefix + i));
+    const __m512d sum_sq = _mm512_add_pd(_mm512_loadu_pd(sq_suffix + i),
+                                         _mm512_loadu_pd(sq_prefix + i));
+
+    const __m512d mean = _mm512_div_pd(sum, divisor_vec);
+    __m512d var = _mm512_sub_pd(_mm512_div_pd(sum_sq, divisor_vec),
+                                _mm512_mul_pd(mean, mean));
+
+    // 경미한 음수 보정
+    const __mmask8 tiny_negative =
+        _mm512_cmp_pd_mask(var, zero, _CMP_LT_OQ) &
+        _mm512_cmp_pd_mask(var, epsilon, _CMP_GT_OQ);
+    var = _mm512_mask_blend_pd(tiny_negative, var, zero);
+
+    _mm512_storeu_pd(output + i, _mm512_sqrt_pd(var));
+  }
+
+  CombineStandardDeviationScalar(sum_suffix + i, sum_prefix + i,
+                                 sq_suffix + i, sq_prefix + i, output + i,
+                                 count - i, divisor);
+}
+
+KERNEL_TARGET_AVX512 void CombineMaxAvx512(const double* suffix,
+                                           const double* prefix,
+                                           double* output, const size_t count) {
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    _mm512_storeu_pd(output + i, _mm512_max_pd(_mm512_loadu_pd(suffix + i),
+                                               _mm512_loadu_pd(prefix + i)));
+  }
+
+  CombineMaxScalar(suffix + i, prefix + i, output + i, count - i);
+}
+
+KERNEL_TARGET_AVX512 void CombineMinAvx512(const double* suffix,
+                                           const double* prefix,
+                                           double* output, const size_t count) {
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    _mm512_storeu_pd(output + i, _mm512_min_pd(_mm512_loadu_pd(suffix + i),
+                                               _mm512_loadu_pd(prefix + i)));
+  }
+
+  CombineMinScalar(suffix + i, prefix + i, output + i, count - i);
+}
+
+KERNEL_TARGET_AVX512 void TrueRangeAvx512(const Bar* bars, double* output,
+                                          const size_t count) {
+  const __m512i index = _mm512_set_epi64(
+      7 * bar_stride, 6 * bar_stride, 5 * bar_stride, 4 * bar_stride,
+      3 * bar_stride, 2 * bar_stride, bar_stride, 0);
+
+  size_t i = 1;
+  for (; i + 8 <= count; i += 8) {
+    const __m512d high = _mm512_i64gather_pd(index, &bars[i].high, 8);
+    const __m512d low = _mm512_i64gather_pd(index, &bars[i].low, 8);
+    const __m512d prev_close =
+        _mm512_i64gather_pd(index, &bars[i - 1].close, 8);
+
+    const __m512d hl = _mm512_sub_pd(high, low);
+    const __m512d hc = _mm512_abs_pd(_mm512_sub_pd(high, prev_close));
+    const __m512d lc = _mm512_abs_pd(_mm512_sub_pd(low, prev_close));
+
+    // max({hl, hc, lc})와 같은 순서로 비교
+    _mm512_storeu_pd(output + i,
+                     _mm512_max_pd(lc, _mm512_max_pd(hc, hl)));
+  }
+
+  TrueRangeScalar(bars, output, i, count);
+}
+
+template <ComparisonMode Mode>
+KERNEL_TARGET_AVX512 __m512d CrossThresholdAvx512(const __m512d lhs,
+                                                  const __m512d rhs,
+                                                  const __m512d tolerance) {
+  if constexpr (Mode == ComparisonMode::ABSOLUTE) {
+    return tolerance;
+  } else {
+    const __m512d scale =
+        _mm512_max_pd(_mm512_abs_pd(lhs), _mm512_abs_pd(rhs));
+
+    return _mm512_max_pd(
+        tolerance,
+        _mm512_mul_pd(_mm512_set1_pd(relative_rel_tolerance), scale));
+  }
+}
+
+template <ComparisonMode Mode>
+KERNEL_TARGET_AVX512 void CrossOverAvx512(const double* lhs, const double* rhs,
+                                          uint8_t* output, const size_t count,
+                                          const double tolerance) {
+  const __m512d tolerance_vec = _mm512_set1_pd(
+      Mode == ComparisonMode::ABSOLUTE ? tolerance : relative_abs_tolerance);
+
+  size_t i = 1;
+  for (; i + 8 <= count; i += 8) {
+    const __m512d current_lhs = _mm512_loadu_pd(lhs + i);
+    const __m512d current_rhs = _mm512_loadu_pd(rhs + i);
+    const __m512d prev_lhs = _mm512_loadu_pd(lhs + i - 1);
+    const __m512d prev_rhs = _mm512_loadu_pd(rhs + i - 1);
+
+    __mmask8 is_above;
+    __mmask8 was_below;
+    if constexpr (Mode == ComparisonMode::EXACT) {
+      is_above = _mm512_cmp_pd_mask(current_lhs, current_rhs, _CMP_GT_OQ);
+      was_below = _mm512_cmp_pd_mask(prev_lhs, prev_rhs, _CMP_LE_OQ);
+    } else {
+      is_above = _mm512_cmp_pd_mask(
+          _mm512_sub_pd(current_lhs, current_rhs),
+          CrossThresholdAvx512<Mode>(current_lhs, current_rhs, tolerance_vec),
+          _CMP_GT_OQ);
+      was_below = _mm512_cmp_pd_mask(
+          _mm512_sub_pd(prev_lhs, prev_rhs),
+          CrossThresholdAvx512<Mode>(prev_lhs, prev_rhs, tolerance_vec),
+          _CMP_LE_OQ);
+    }
+
+    const unsigned mask = is_above & was_below;
+    for (int lane = 0; lane < 8; ++lane) {
+      output[i + lane] = static_cast<uint8_t>(mask >> lane & 1);
+    }
+  }
+
+  CrossOverScalar<Mode>(lhs, rhs, output, i, count, tolerance);
+}
+#endif
+
+// =============================================================================
+// SIMD 수준별 분기
+// =============================================================================
+void CombineMean(const double* suffix, const double* prefix, double* output,
+                 const size_t count, const double divisor) {
+  switch (GetSimdLevel()) {
+#if KERNEL_USE_X86_SIMD
+    case SimdLevel::AVX512: {
+      return CombineMeanAvx512(suffix, prefix, output, count, divisor);
+    }
+
+    case SimdLevel::AVX2: {
+      return CombineMeanAvx2(suffix, prefix, output, count, divisor);
+    }
+#endif
+
+    default: {
+      return CombineMeanScalar(suffix, prefix, output, count, divisor);
+    }
+  }
+}
+
+void CombineStandardDeviation(const double* sum_suffix,
+                              const double* sum_prefix,
+                              const double* sq_suffix, const double* sq_prefix,
+                              double* output, const size_t count,
+                              const double divisor) {
+  switch (GetSimdLevel()) {
+#if KERNEL_USE_X86_SIMD
+    case SimdLevel::AVX512: {
+      return CombineStandardDeviationAvx512(sum_suffix, sum_prefix, sq_suffix,
+                                            sq_prefix, output, count, divisor);
+    }
+
+    case SimdLevel::AVX2: {
+      return CombineStandardDeviationAvx2(sum_suffix, sum_prefix, sq_suffix,
+                                          sq_prefix, output, count, divisor);
+    }
+#endif
+
+    default: {
+      return CombineStandardDeviationScalar(sum_suffix, sum_prefix, sq_suffix,
+                                            sq_prefix, output, count, divisor);
+    }
+  }
+}
+
+template <bool IsMax>
+void CombineExtreme(const double* suffix, const double* prefix, double* output,
+                    const size_t count) {
+  switch (GetSimdLevel()) {
+#if KERNEL_USE_X86_SIMD
+    case SimdLevel::AVX512: {
+      return IsMax ? CombineMaxAvx512(suffix, prefix, output, count)
+                   : CombineMinAvx512(suffix, prefix, output, count);
+    }
+
+    case SimdLevel::AVX2: {
+      return IsMax ? CombineMaxAvx2(suffix, prefix, output, count)
+                   : CombineMinAvx2(suffix, prefix, output, count);
+    }
+#endif
+
+    default: {
+      return IsMax ? CombineMaxScalar(suffix, prefix, output, count)
+                   : CombineMinScalar(suffix, prefix, output, count);
+    }
+  }
+}
+
+template <ComparisonMode Mode>
+void CrossOverDispatch(const double* lhs, const double* rhs, uint8_t* output,
+                       const size_t count, const double tolerance) {
+  switch (GetSimdLevel()) {
+#if KERNEL_USE_X86_SIMD
+    case SimdLevel::AVX512: {
+      return CrossOverAvx512<Mode>(lhs, rhs, output, count, tolerance);
+    }
+
+    case SimdLevel::AVX2: {
+      return CrossOverAvx2<Mode>(lhs, rhs, output, count, tolerance);
+    }
+#endif
+
+    default: {
+      return CrossOverScalar<Mode>(lhs, rhs, output, 1, count, tolerance);
+    }
+  }
+}
+
+/// 이동 최댓값/최솟값 커널의 공통 구현
+template <bool IsMax>
+bool RollingExtreme(const span<const double> input, const size_t period,
+                    const span<double> output) {
+  const auto start = FindFirstValue(input);
+  if (period == 0 || !start) {
+    return false;
+  }
+
+  // 첫 윈도우가 완성되기 전까지는 NaN
+  const size_t first_output = min(*start + period - 1, input.size());
+  fill(output.begin(), output.begin() + first_output, NAN);
+
+  if (first_output == input.size()) {
+    return true;
+  }
+
+  const size_t count = input.size() - *start;
+  vector<double> prefix(count);
+  vector<double> suffix(count);
+
+  ScanExtreme<IsMax>(input.data() + *start, count, period, prefix.data(),
+                     suffix.data());
+
+  CombineExtreme<IsMax>(suffix.data(), prefix.data() + period - 1,
+                        output.data() + first_output, count - period + 1);
+
+  return true;
+}
+
+}  // namespace
+
+SimdLevel DetectSimdLevel() {
+#if KERNEL_USE_X86_SIMD && defined(_MSC_VER) && !defined(__clang__)
+  int cpu_info[4];
+  __cpuid(cpu_info, 0);
+  if (cpu_info[0] < 7) {
+    return SimdLevel::SCALAR;
+  }
+
+  // OS가 AVX 레지스터 상태를 저장하는지 확인 (OSXSAVE, AVX)
+  __cpuidex(cpu_info, 1, 0);
+  if ((cpu_info[2] & (1 << 27)) == 0 || (cpu_info[2] & (1 << 28)) == 0) {
+    return SimdLevel::SCALAR;
+  }
+
+  const auto xcr0 = _xgetbv(0);
+  if ((xcr0 & 0x6) != 0x6) {
+    return SimdLevel::SCALAR;
+  }
+
+  __cpuidex(cpu_info, 7, 0);
+  const bool has_avx2 = (cpu_info[1] & (1 << 5)) != 0;
+  const bool has_avx512f = (cpu_info[1] & (1 << 16)) != 0;
+
+  // AVX-512는 opmask와 상위 ZMM 레지스터 상태도 저장되어야 함
+  if (has_avx512f && (xcr0 & 0xE6) == 0xE6) {
+    return SimdLevel::AVX512;
+  }
+
+  return has_avx2 ? SimdLevel::AVX2 : SimdLevel::SCALAR;
+#elif KERNEL_USE_X86_SIMD
+  __builtin_cpu_init();
+
+  if (__builtin_cpu_supports("avx512f")) {
+    return SimdLevel::AVX512;
+  }
+
+  return __builtin_cpu_supports("avx2") ? SimdLevel::AVX2 : SimdLevel::SCALAR;
+#else
+  return SimdLevel::SCALAR;
+#endif
+}
+
+SimdLevel GetSimdLevel() {
+  return GetSimdLevelRef().load(memory_order_relaxed);
+}
+
+void SetSimdLevel(const SimdLevel simd_level) {
+  if (simd_level > DetectSimdLevel()) {
+    const string& msg = format(
+        "현재 CPU는 [{}] 커널을 지원하지 않습니다. (지원 수준: [{}])",
+        SimdLevelToString(simd_level), SimdLevelToString(DetectSimdLevel()));
+    Logger::GetLogger()->Log(ERROR_L, msg, __FILE__, __LINE__, true);
+    throw runtime_error(msg);
+  }
+
+  GetSimdLevelRef().store(simd_level, memory_order_relaxed);
+}
+
+string SimdLevelToString(const SimdLevel simd_level) {
+  switch (simd_level) {
+    case SimdLevel::AVX512: {
+      return "AVX-512";
+    }
+
+    case SimdLevel::AVX2: {
+      return "AVX2";
+    }
+
+    default: {
+      return "SCALAR";
+    }
+  }
+}
+
+bool RollingMean(const span<const double> input, const size_t period,
+                 const span<double> output) {
+  const auto start = FindFirstValue(input);
+  if (period == 0 || !start) {
+    return false;
+  }
+
+  // 첫 윈도우가 완성되기 전까지는 NaN
+  const size_t first_output = min(*start + period - 1, input.size());
+  fill(output.begin(), output.begin() + first_output, NAN);
+
+  if (first_output == input.size()) {
+    return true;
+  }
+
+  const size_t count = input.size() - *start;
+  vector<double> prefix(count);
+  vector<double> suffix(count);
+
+  ScanSum(input.data() + *start, count, period, prefix.data(), suffix.data(),
+          [](const double value) { return value; });
+
+  CombineMean(suffix.data(), prefix.data() + period - 1,
+              output.data() + first_output, count - period + 1,
+              static_cast<double>(period));
+
+  return true;
+}
+
+bool RollingStandardDeviation(const span<const double> input,
+                              const size_t period, const span<double> output) {
+  const auto start = FindFirstValue(input);
+  if (period == 0 || !start) {
+    return false;
+  }
+
+  // 첫 윈도우가 완성되기 전까지는 NaN
+  const size_t first_output = min(*start + period - 1, input.size());
+  fill(output.begin(), output.begin() + first_output, NAN);
+
+  if (first_output == input.size()) {
+    return true;
+  }
+
+  const size_t count = input.size() - *start;
+  vector<double> sum_prefix(count);
+  vector<double> sum_suffix(count);
+  vector<double> sq_prefix(count);
+  vector<double> sq_suffix(count);
+
+  ScanSum(input.data() + *start, count, period, sum_prefix.data(),
+          sum_suffix.data(), [](const double value) { return value; });
+  ScanSum(input.data() + *start, count, period, sq_prefix.data(),
+          sq_suffix.data(), [](const double value) { return value * value; });
+
+  CombineStandardDeviation(sum_suffix.data(), sum_prefix.data() + period - 1,
+                           sq_suffix.data(), sq_prefix.data() + period - 1,
+                           output.data() + first_output, count - period + 1,
+                           static_cast<double>(period));
+
+  return true;
+}
+
+bool RollingMax(const span<const double> input, const size_t period,
+                const span<double> output) {
+  return RollingExtreme<true>(input, period, output);
+}
+
+bool RollingMin(const span<const double> input, const size_t period,
+                const span<double> output) {
+  return RollingExtreme<false>(input, period, output);
+}
+
+void TrueRange(const span<const Bar> bars, const span<double> output) {
+  if (bars.empty()) {
+    return;
+  }
+
+  // 첫 바는 이전 종가가 없으므로 NaN
+  output[0] = NAN;
+
+  switch (GetSimdLevel()) {
+#if KERNEL_USE_X86_SIMD
+    case SimdLevel::AVX512: {
+      return TrueRangeAvx512(bars.data(), output.data(), bars.size());
+    }
+
+    case SimdLevel::AVX2: {
+      return TrueRangeAvx2(bars.data(), output.data(), bars.size());
+    }
+#endif
+
+    default: {
+      return TrueRangeScalar(bars.data(), output.data(), 1, bars.size());
+    }
+  }
+}
+
+void CrossOver(const span<const double> lhs, const span<const double> rhs,
+               const span<uint8_t> output) {
+  CrossOver(lhs, rhs, output, ComparisonPolicy::GetMode(),
+            ComparisonPolicy::GetTolerance());
+}
+
+void CrossUnder(const span<const double> lhs, const span<const double> rhs,
+                const span<uint8_t> output) {
+  CrossUnder(lhs, rhs, output, ComparisonPolicy::GetMode(),
+             ComparisonPolicy::GetTolerance());
+}
+
+void CrossOver(const span<const double> lhs, const span<const double> rhs,
+               const span<uint8_t> output, const ComparisonMode mode,
+               const double tolerance) {
+  if (lhs.empty()) {
+    return;
+  }
+
+  // 첫 바는 이전 값이 없으므로 교차하지 않음
+  output[0] = 0;
+
+  switch (mode) {
+    case ComparisonMode::EXACT: {
+      return CrossOverDispatch<ComparisonMode::EXACT>(
+          lhs.data(), rhs.data(), output.data(), lhs.size(), tolerance);
+    }
+
+    case ComparisonMode::ABSOLUTE: {
+      return CrossOverDispatch<ComparisonMode::ABSOLUTE>(
+          lhs.data(), rhs.data(), output.data(), lhs.size(), tolerance);
+    }
+
+    default: {
+      return CrossOverDispatch<ComparisonMode::RELATIVE>(
+          lhs.data(), rhs.data(), output.data(), lhs.size(), tolerance);
+    }
+  }
+}
+
+void CrossUnder(const span<const double> lhs, const span<const double> rhs,
+                const span<uint8_t> output, const ComparisonMode mode,
+                const double tolerance) {
+  // lhs < rhs는 rhs > lhs, lhs >= rhs는 rhs <= lhs와 같은 판정
+  CrossOver(rhs, lhs, output, mode, tolerance);
+}
+
+}  // namespace backtesting::kernel
@@ -0,0 +1,326 @@
+// Windows API 충돌 방지
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#undef byte  // Windows에서 정의된 byte 매크로 제거
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// 표준 라이브러리
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+// 파일 헤더
+#include "Engines/IndicatorOutput.hpp"
+
+// 네임 스페이스
+namespace fs = filesystem;
+
+namespace backtesting::indicator {
+
+// 캐시 파일 식별자 및 버전
+static constexpr char cache_magic[8] = {'B', 'T', 'I', 'N', 'D', 'C', 'A', 'C'};
+static constexpr uint32_t cache_version = 1;
+
+/// 캐시 키를 기록한 영역의 8바이트 정렬 크기를 반환하는 함수
+static size_t AlignedKeySize(const size_t key_size) {
+  return (key_size + 7) & ~static_cast<size_t>(7);
+}
+
+IndicatorOutput::IndicatorOutput(const vector<size_t>& num_bars) {
+  size_t total_bars = 0;
+  for (const auto symbol_num_bars : num_bars) {
+    total_bars += symbol_num_bars;
+  }
+
+  storage_.resize(total_bars);
+  symbols_.reserve(num_bars.size());
+
+  double* data = storage_.data();
+  for (const auto symbol_num_bars : num_bars) {
+    symbols_.push_back({data, nullptr, 0, symbol_num_bars});
+    data += symbol_num_bars;
+  }
+}
+
+IndicatorOutput::~IndicatorOutput() { Unmap(); }
+
+shared_ptr<IndicatorOutput> IndicatorOutput::Map(
+    const string& path, const string& key, const vector<size_t>& num_bars) {
+  // make_shared는 private 생성자에 접근할 수 없으므로 직접 생성
+  shared_ptr<IndicatorOutput> output(new IndicatorOutput());
+
+  // 쓰기 시 복사로 매핑하여 매핑된 값을 수정해도 파일에는 반영되지 않게 함
+#ifdef _WIN32
+  const HANDLE file_handle =
+      CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+  if (file_handle == INVALID_HANDLE_VALUE) {
+    return nullptr;
+  }
+
+  output->file_handle_ = file_handle;
+
+  LARGE_INTEGER file_size;
+  if (!GetFileSizeEx(file_handle, &file_size) || file_size.QuadPart == 0) {
+    return nullptr;
+  }
+
+  output->mapping_handle_ = CreateFileMappingA(file_handle, nullptr,
+                                               PAGE_WRITECOPY, 0, 0, nullptr);
+
+  if (output->mapping_handle_ == nullptr) {
+    return nullptr;
+  }
+
+  output->mapped_data_ =
+      MapViewOfFile(static_cast<HANDLE>(output->mapping_handle_),
+                    FILE_MAP_COPY, 0, 0, 0);
+
+  if (output->mapped_data_ == nullptr) {
+    return nullptr;
+  }
+
+  output->mapped_size_ = static_cast<size_t>(file_size.QuadPart);
+#else
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+
+  struct stat file_stat{};
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+    ::close(fd);
+    return nullptr;
+  }
+
+  void* mapped_data =
+      mmap(nullptr, static_cast<size_t>(file_stat.st_size),
+           PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+  // 매핑은 파일 디스크립터를 닫아도 유지됨
+  ::close(fd);
+
+  if (mapped_data == MAP_FAILED) {
+    return nullptr;
+  }
+
+  output->mapped_data_ = mapped_data;
+  output->mapped_size_ = static_cast<size_t>(file_stat.st_size);
+#endif
+
+  // 헤더와 캐시 키 검사
+  const auto* data = static_cast<char*>(output->mapped_data_);
+  const size_t mapped_size = output->mapped_size_;
+
+  if (mapped_size < sizeof(IndicatorCacheHeader)) {
+    return nullptr;
+  }
+
+  IndicatorCacheHeader header{};
+  memcpy(&header, data, sizeof(header));
+
+  if (memcmp(header.magic, cache_magic, sizeof(cache_magic)) != 0 ||
+      header.version != cache_version || header.key_size != key.size() ||
+      header.num_symbols != num_bars.size()) {
+    return nullptr;
+  }
+
+  size_t offset = sizeof(header);
+  if (mapped_size < offset + AlignedKeySize(key.size()) ||
+      memcmp(data + offset, key.data(), key.size()) != 0) {
+    return nullptr;
+  }
+
+  offset += AlignedKeySize(key.size());
+
+  // 심볼별 바 개수 검사
+  const size_t num_symbols = num_bars.size();
+  if (mapped_size < offset + num_symbols * sizeof(uint64_t)) {
+    return nullptr;
+  }
+
+  size_t total_bars = 0;
+  for (size_t symbol_idx = 0; symbol_idx < num_symbols; ++symbol_idx) {
+    uint64_t symbol_num_bars;
+    memcpy(&symbol_num_bars, data + offset + symbol_idx * sizeof(uint64_t),
+           sizeof(uint64_t));
+
+    if (symbol_num_bars != num_bars[symbol_idx]) {
+      return nullptr;
+    }
+
+    total_bars += symbol_num_bars;
+  }
+
+  offset += num_symbols * sizeof(uint64_t);
+  if (mapped_size != offset + total_bars * sizeof(double)) {
+    return nullptr;
+  }
+
+  // 값 영역은 8바이트 정렬된 오프셋에서 시작하므로 double로 직접 참조 가능
+  auto* values = reinterpret_cast<double*>(
+      static_cast<char*>(output->mapped_data_) + offset);
+
+  output->symbols_.reserve(num_symbols);
+  for (const auto symbol_num_bars : num_bars) {
+    output->symbols_.push_back({values, nullptr, 0, symbol_num_bars});
+    values += symbol_num_bars;
+  }
+
+  return output;
+}
+
+bool IndicatorOutput::Save(const string& path, const string& key) const {
+  if (IsCompacted() || !IsComplete()) {
+    return false;
+  }
+
+  const string& temp_path = path + ".tmp";
+
+  try {
+    fs::create_directories(fs::path(path).parent_path());
+
+    ofstream file(temp_path, ios::binary | ios::trunc);
+    if (!file.is_open()) {
+      return false;
+    }
+
+    IndicatorCacheHeader header{};
+    memcpy(header.magic, cache_magic, sizeof(cache_magic));
+    header.version = cache_version;
+    header.key_size = static_cast<uint32_t>(key.size());
+    header.num_symbols = symbols_.size();
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    // 캐시 키와 8바이트 정렬용 패딩
+    string padded_key = key;
+    padded_key.resize(AlignedKeySize(key.size()), '\0');
+    file.write(padded_key.data(), static_cast<streamsize>(padded_key.size()));
+
+    for (const auto& symbol : symbols_) {
+      const uint64_t symbol_num_bars = symbol.num_bars;
+      file.write(reinterpret_cast<const char*>(&symbol_num_bars),
+                 sizeof(symbol_num_bars));
+    }
+
+    for (const auto& symbol : symbols_) {
+      file.write(reinterpret_cast<const char*>(symbol.values),
+                 static_cast<streamsize>(symbol.num_bars * sizeof(double)));
+    }
+
+    file.close();
+    if (file.fail()) {
+      fs::remove(temp_path);
+      return false;
+    }
+
+    fs::rename(temp_path, path);
+    return true;
+  } catch (...) {
+    // 다른 실행이 같은 캐시 파일을 사용 중인 경우 등은 저장하지 않음
+    error_code ec;
+    fs::remove(temp_path, ec);
+
+    return false;
+  }
+}
+
+shared_ptr<IndicatorOutput> IndicatorOutput::ToFloat() const {
+  shared_ptr<IndicatorOutput> output(new IndicatorOutput());
+  output->symbols_.reserve(symbols_.size());
+
+  // 심볼별 앞쪽 NaN 구간을 찾아 저장할 값의 개수 계산
+  size_t total_values = 0;
+  for (size_t symbol_idx = 0; symbol_idx < symbols_.size(); ++symbol_idx) {
+    const auto& symbol = symbols_[symbol_idx];
+
+    size_t leading_nans = symbol.leading_nans;
+    while (leading_nans < symbol.num_bars &&
+           isnan(Get(symbol_idx, leading_nans))) {
+      leading_nans++;
+    }
+
+    output->symbols_.push_back(
+        {nullptr, nullptr, leading_nans, symbol.num_bars});
+    total_values += symbol.num_bars - leading_nans;
+  }
+
+  output->float_storage_.resize(total_values);
+
+  float* data = output->float_storage_.data();
+  for (size_t symbol_idx = 0; symbol_idx < symbols_.size(); ++symbol_idx) {
+    auto& symbol = output->symbols_[symbol_idx];
+    symbol.float_values = data;
+
+    for (size_t bar_idx = symbol.leading_nans; bar_idx < symbol.num_bars;
+         ++bar_idx) {
+      *data++ = static_cast<float>(Get(symbol_idx, bar_idx));
+    }
+  }
+
+  return output;
+}
+
+void IndicatorOutput::MarkAllPending() {
+  pending_symbols_.assign(symbols_.size(), 1);
+  num_pending_symbols_ = symbols_.size();
+}
+
+void IndicatorOutput::MarkCalculated(const size_t symbol_idx) {
+  if (IsPending(symbol_idx)) {
+    pending_symbols_[symbol_idx] = 0;
+    num_pending_symbols_--;
+  }
+}
+
+bool IndicatorOutput::IsCompacted() const {
+  return !symbols_.empty() && symbols_.front().values == nullptr;
+}
+
+bool IndicatorOutput::IsMapped() const { return mapped_data_ != nullptr; }
+
+size_t IndicatorOutput::GetMemoryUsage() const {
+  return IsMapped() ? mapped_size_
+                    : storage_.size() * sizeof(double) +
+                          float_storage_.size() * sizeof(float);
+}
+
+void IndicatorOutput::Unmap() {
+#ifdef _WIN32
+  if (mapped_data_ != nullptr) {
+    UnmapViewOfFile(mapped_data_);
+  }
+
+  if (mapping_handle_ != nullptr) {
+    CloseHandle(static_cast<HANDLE>(mapping_handle_));
+    mapping_handle_ = nullptr;
+  }
+
+  if (file_handle_ != nullptr) {
+    CloseHandle(static_cast<HANDLE>(file_handle_));
+    file_handle_ = nullptr;
+  }
+#else
+  if (mapped_data_ != nullptr) {
+    munmap(mapped_data_, mapped_size_);
+  }
+#endif
+
+  mapped_data_ = nullptr;
+  mapped_size_ = 0;
+}
+
+}  // namespace backtesting::indicator
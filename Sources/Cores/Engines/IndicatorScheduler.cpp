@@ -0,0 +1,159 @@
+// 표준 라이브러리
+#include <algorithm>
+#include <format>
+#include <stdexcept>
+
+// 파일 헤더
+#include "Engines/IndicatorScheduler.hpp"
+
+namespace backtesting::indicator {
+
+IndicatorScheduler::~IndicatorScheduler() { Cancel(); }
+
+size_t IndicatorScheduler::AddTask(function<void()> task,
+                                   const vector<size_t>& dependencies) {
+  if (!workers_.empty()) [[unlikely]] {
+    throw runtime_error("지표 계산 작업은 실행 시작 전에만 추가할 수 있습니다.");
+  }
+
+  const size_t task_idx = tasks_.size();
+
+  for (const auto dependency : dependencies) {
+    if (dependency >= task_idx) [[unlikely]] {
+      throw runtime_error(
+          format("지표 계산 작업 [{}]은(는) 먼저 추가된 작업에만 의존할 수 "
+                 "있습니다. (의존 작업 [{}])",
+                 task_idx, dependency));
+    }
+
+    tasks_[dependency].dependents.push_back(task_idx);
+  }
+
+  tasks_.push_back({std::move(task), {}, dependencies.size()});
+
+  return task_idx;
+}
+
+void IndicatorScheduler::Start(const size_t num_threads) {
+  {
+    lock_guard lock(mutex_);
+
+    for (size_t task_idx = 0; task_idx < tasks_.size(); ++task_idx) {
+      if (tasks_[task_idx].num_dependencies == 0) {
+        ready_tasks_.push(task_idx);
+      }
+    }
+  }
+
+  // 작업보다 많은 스레드는 만들지 않음
+  const size_t num_workers = max<size_t>(1, min(num_threads, tasks_.size()));
+
+  workers_.reserve(num_workers);
+  for (size_t worker_idx = 0; worker_idx < num_workers; ++worker_idx) {
+    workers_.emplace_back(&IndicatorScheduler::RunWorker, this);
+  }
+}
+
+bool IndicatorScheduler::WaitFor(const chrono::milliseconds timeout) {
+  bool is_done;
+  {
+    unique_lock lock(mutex_);
+
+    // 실패 시에는 실행 중인 작업까지 끝나야 정리된 것으로 봄
+    is_done = finished_cv_.wait_for(lock, timeout, [this] {
+      return num_finished_ == tasks_.size() ||
+             (error_ != nullptr && num_running_ == 0);
+    });
+  }
+
+  if (!is_done) {
+    return false;
+  }
+
+  JoinWorkers();
+
+  if (error_ != nullptr) {
+    rethrow_exception(error_);
+  }
+
+  return true;
+}
+
+void IndicatorScheduler::Cancel() {
+  {
+    lock_guard lock(mutex_);
+    is_stopping_ = true;
+  }
+
+  ready_cv_.notify_all();
+  JoinWorkers();
+}
+
+size_t IndicatorScheduler::GetNumTasks() const { return tasks_.size(); }
+
+void IndicatorScheduler::RunWorker() {
+  unique_lock lock(mutex_);
+
+  while (true) {
+    ready_cv_.wait(lock, [this] {
+      return is_stopping_ || error_ != nullptr || !ready_tasks_.empty() ||
+             num_finished_ == tasks_.size();
+    });
+
+    if (is_stopping_ || error_ != nullptr || ready_tasks_.empty()) {
+      return;
+    }
+
+    const size_t task_idx = ready_tasks_.top();
+    ready_tasks_.pop();
+    num_running_++;
+
+    lock.unlock();
+
+    exception_ptr error;
+    try {
+      tasks_[task_idx].run();
+    } catch (...) {
+      error = current_exception();
+    }
+
+    lock.lock();
+    num_running_--;
+
+    if (error != nullptr) {
+      if (error_ == nullptr) {
+        error_ = error;
+      }
+
+      ready_cv_.notify_all();
+      finished_cv_.notify_all();
+
+      continue;
+    }
+
+    num_finished_++;
+
+    for (const auto dependent : tasks_[task_idx].dependents) {
+      if (--tasks_[dependent].num_dependencies == 0) {
+        ready_tasks_.push(dependent);
+      }
+    }
+
+    // 새로 실행 가능해진 작업 또는 모든 작업 완료를 알림
+    ready_cv_.notify_all();
+
+    if (num_finished_ == tasks_.size()) {
+      finished_cv_.notify_all();
+    }
+  }
+}
+
+void IndicatorScheduler::JoinWorkers() {
+  for (auto& worker : workers_) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+}
+
+}  // namespace backtesting::indicator
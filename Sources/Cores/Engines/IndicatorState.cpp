@@ -0,0 +1,157 @@
+// 표준 라이브러리
+#include <filesystem>
+#include <fstream>
+
+// 파일 헤더
+#include "Engines/IndicatorState.hpp"
+
+// 네임 스페이스
+namespace fs = filesystem;
+
+namespace backtesting::indicator {
+
+// 스냅샷 파일 식별자 및 버전
+static constexpr char snapshot_magic[8] = {'B', 'T', 'I', 'N',
+                                           'D', 'S', 'T', 'A'};
+static constexpr uint32_t snapshot_version = 1;
+
+IndicatorState::IndicatorState(vector<uint8_t> data) : data_(std::move(data)) {}
+
+const vector<uint8_t>& IndicatorState::GetData() const { return data_; }
+
+vector<uint8_t> IndicatorState::Release() {
+  read_offset_ = 0;
+  return std::move(data_);
+}
+
+void IndicatorState::ReadBytes(void* destination, const size_t size) {
+  if (size > data_.size() - read_offset_) {
+    throw runtime_error(
+        format("지표 상태에서 [{}]바이트를 읽을 수 없습니다. (남은 크기 "
+               "[{}]바이트)",
+               size, data_.size() - read_offset_));
+  }
+
+  memcpy(destination, data_.data() + read_offset_, size);
+  read_offset_ += size;
+}
+
+shared_ptr<IndicatorSnapshot> IndicatorSnapshot::Load(const string& path,
+                                                      const string& key) {
+  ifstream file(path, ios::binary);
+  if (!file.is_open()) {
+    return nullptr;
+  }
+
+  const auto read = [&file](void* destination, const size_t size) {
+    file.read(static_cast<char*>(destination), static_cast<streamsize>(size));
+    return file.good();
+  };
+
+  // 헤더 및 키 검증
+  char magic[8];
+  uint32_t version;
+  uint32_t key_size;
+  uint64_t num_symbols;
+  if (!read(magic, sizeof(magic)) || !read(&version, sizeof(version)) ||
+      !read(&key_size, sizeof(key_size)) ||
+      !read(&num_symbols, sizeof(num_symbols)) ||
+      memcmp(magic, snapshot_magic, sizeof(snapshot_magic)) != 0 ||
+      version != snapshot_version || key_size != key.size()) {
+    return nullptr;
+  }
+
+  string stored_key(key_size, '\0');
+  if (!read(stored_key.data(), key_size) || stored_key != key) {
+    return nullptr;
+  }
+
+  // 파일 크기를 넘는 길이는 손상된 파일이므로 할당 전에 검증
+  error_code ec;
+  const auto file_size = fs::file_size(path, ec);
+  if (ec) {
+    return nullptr;
+  }
+
+  const auto read_bytes = [&](auto& bytes) {
+    uint64_t size;
+    if (!read(&size, sizeof(size)) || size > file_size) {
+      return false;
+    }
+
+    bytes.resize(size);
+    return size == 0 || read(bytes.data(), size);
+  };
+
+  auto snapshot = make_shared<IndicatorSnapshot>();
+  if (!read_bytes(snapshot->output_key) || num_symbols > file_size) {
+    return nullptr;
+  }
+
+  snapshot->symbols.resize(num_symbols);
+  for (auto& symbol : snapshot->symbols) {
+    if (!read(&symbol.num_bars, sizeof(symbol.num_bars)) ||
+        !read(&symbol.bars_hash, sizeof(symbol.bars_hash)) ||
+        !read_bytes(symbol.state)) {
+      return nullptr;
+    }
+  }
+
+  return snapshot;
+}
+
+bool IndicatorSnapshot::Save(const string& path, const string& key) const {
+  const string& temp_path = path + ".tmp";
+
+  try {
+    fs::create_directories(fs::path(path).parent_path());
+
+    ofstream file(temp_path, ios::binary | ios::trunc);
+    if (!file.is_open()) {
+      return false;
+    }
+
+    const auto write = [&file](const void* source, const size_t size) {
+      file.write(static_cast<const char*>(source),
+                 static_cast<streamsize>(size));
+    };
+
+    const auto key_size = static_cast<uint32_t>(key.size());
+    const uint64_t num_symbols = symbols.size();
+    const uint64_t output_key_size = output_key.size();
+
+    write(snapshot_magic, sizeof(snapshot_magic));
+    write(&snapshot_version, sizeof(snapshot_version));
+    write(&key_size, sizeof(key_size));
+    write(&num_symbols, sizeof(num_symbols));
+    write(key.data(), key.size());
+    write(&output_key_size, sizeof(output_key_size));
+    write(output_key.data(), output_key.size());
+
+    for (const auto& symbol : symbols) {
+      const uint64_t state_size = symbol.state.size();
+
+      write(&symbol.num_bars, sizeof(symbol.num_bars));
+      write(&symbol.bars_hash, sizeof(symbol.bars_hash));
+      write(&state_size, sizeof(state_size));
+      write(symbol.state.data(), symbol.state.size());
+    }
+
+    file.close();
+    if (file.fail()) {
+      fs::remove(temp_path);
+      return false;
+    }
+
+    fs::rename(temp_path, path);
+    return true;
+  } catch (...) {
+    // 다른 실행이 같은 스냅샷 파일을 사용 중인 경우 등은 저장하지 않음
+    error_code ec;
+    fs::remove(temp_path, ec);
+
+    return false;
+  }
+}
+
+}  // namespace backtesting::indicator
@@ -0,0 +1,110 @@
+// 표준 라이브러리
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+
+// 파일 헤더
+#include "Engines/JsonFileCache.hpp"
+
+// 내부 헤더
+#include "Engines/Logger.hpp"
+
+// 네임 스페이스
+using namespace backtesting::logger;
+
+namespace backtesting::engine {
+
+namespace {
+
+// 캐시된 Json과 파싱 당시 파일의 수정 시각 및 크기
+struct Entry {
+  filesystem::file_time_type write_time;
+  uintmax_t size;
+  shared_ptr<const CachedJsonFile> file;
+};
+
+mutex cache_mutex;
+unordered_map<string, Entry> cache_entries;
+
+}  // namespace
+
+shared_ptr<const CachedJsonFile> JsonFileCache::Load(const string& path,
+                                                     const string& description,
+                                                     const Indexer& indexer,
+                                                     bool* reused) {
+  if (!filesystem::exists(path)) {
+    throw runtime_error(
+        format("{} 파일 [{}]이(가) 존재하지 않습니다.", description, path));
+  }
+
+  const auto write_time = filesystem::last_write_time(path);
+  const auto size = filesystem::file_size(path);
+
+  {
+    lock_guard lock(cache_mutex);
+
+    if (const auto it = cache_entries.find(path);
+        it != cache_entries.end() && it->second.write_time == write_time &&
+        it->second.size == size) {
+      if (reused != nullptr) {
+        *reused = true;
+      }
+
+      return it->second.file;
+    }
+  }
+
+  ifstream file(path);
+
+  if (!file.is_open()) {
+    throw runtime_error(
+        format("{} 파일 [{}]을(를) 열 수 없습니다.", description, path));
+  }
+
+  if (file.peek() == ifstream::traits_type::eof()) {
+    throw runtime_error(
+        format("{} 파일 [{}]이(가) 비어있습니다.", description, path));
+  }
+
+  auto cached_file = make_shared<CachedJsonFile>();
+
+  try {
+    cached_file->data = json::parse(file);
+  } catch (const json::parse_error& e) {
+    // JSON 파싱 오류 처리
+    Logger::GetLogger()->Log(
+        ERROR_L,
+        format("{} 파일 [{}]의 Json 형식이 유효하지 않습니다.", description,
+               path),
+        __FILE__, __LINE__, true);
+
+    throw runtime_error(e.what());
+  }
+
+  file.close();
+
+  if (indexer) {
+    cached_file->symbol_indices = indexer(cached_file->data);
+  }
+
+  // 파싱 중 파일이 바뀌었을 수 있으므로 파싱 전에 읽은 수정 시각으로 저장하여
+  // 다음 호출에서 다시 파싱되도록 함
+  lock_guard lock(cache_mutex);
+  cache_entries[path] = {write_time, size, cached_file};
+
+  if (reused != nullptr) {
+    *reused = false;
+  }
+
+  return cached_file;
+}
+
+void JsonFileCache::Clear() {
+  lock_guard lock(cache_mutex);
+  cache_entries.clear();
+}
+
+}  // namespace backtesting::engine
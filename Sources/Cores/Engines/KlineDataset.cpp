@@ -0,0 +1,313 @@
+// 표준 라이브러리
+#include <any>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+
+// 외부 라이브러리
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "nlohmann/json.hpp"
+
+// 파일 헤더
+#include "Engines/KlineDataset.hpp"
+
+// 내부 헤더
+#include "Engines/DataUtils.hpp"
+#include "Engines/Logger.hpp"
+
+// 네임 스페이스
+using namespace nlohmann;
+using namespace backtesting::logger;
+
+namespace backtesting::utils {
+
+namespace {
+
+// 매니페스트 형식이 바뀌면 올림
+constexpr int manifest_version = 1;
+
+// 테이블의 주어진 열과 행에 있는 시간 값을 반환하는 함수
+int64_t GetTime(const shared_ptr<arrow::Table>& table, const int column,
+                const int64_t row) {
+  return any_cast<int64_t>(
+      GetScalarValue(table->column(column)->GetScalar(row).ValueOrDie()));
+}
+
+// 테이블의 캔들 수와 시간 범위로 파일 정보를 만드는 함수
+KlinePart MakePart(const shared_ptr<arrow::Table>& table,
+                   const string& file_name, const int open_time_column,
+                   const int close_time_column) {
+  const int64_t num_rows = table->num_rows();
+  if (num_rows == 0) {
+    throw runtime_error(
+        format("캔들스틱 파일 [{}]에 저장할 캔들이 없습니다.", file_name));
+  }
+
+  return {file_name, num_rows, GetTime(table, open_time_column, 0),
+          GetTime(table, open_time_column, num_rows - 1),
+          GetTime(table, close_time_column, num_rows - 1)};
+}
+
+json PartToJson(const KlinePart& part) {
+  return {{"file", part.file_name},
+          {"rows", part.num_rows},
+          {"firstOpenTime", part.first_open_time},
+          {"lastOpenTime", part.last_open_time},
+          {"lastCloseTime", part.last_close_time}};
+}
+
+KlinePart JsonToPart(const json& part) {
+  return {part.at("file").get<string>(), part.at("rows").get<int64_t>(),
+          part.at("firstOpenTime").get<int64_t>(),
+          part.at("lastOpenTime").get<int64_t>(),
+          part.at("lastCloseTime").get<int64_t>()};
+}
+
+// 매니페스트가 있으면 읽어서 반환하는 함수
+optional<KlineManifest> ReadManifest(const string& base_path) {
+  const string& manifest_path = KlineDataset::GetManifestPath(base_path);
+  if (!filesystem::exists(manifest_path)) {
+    return nullopt;
+  }
+
+  try {
+    ifstream file(manifest_path);
+    const auto& manifest_json = json::parse(file);
+
+    if (const int version = manifest_json.at("version").get<int>();
+        version != manifest_version) {
+      throw runtime_error(
+          format("지원하지 않는 매니페스트 버전 [{}]입니다.", version));
+    }
+
+    KlineManifest manifest{JsonToPart(manifest_json.at("base")), {}};
+    for (const auto& fragment : manifest_json.at("fragments")) {
+      manifest.fragments.push_back(JsonToPart(fragment));
+    }
+
+    return manifest;
+  } catch (const std::exception& e) {
+    throw runtime_error(format("캔들스틱 매니페스트 [{}]을(를) 읽을 수 "
+                               "없습니다: {}",
+                               manifest_path, e.what()));
+  }
+}
+
+// 매니페스트를 임시 파일에 쓴 후 교체하여 중간에 중단되어도 이전 매니페스트나
+// 새 매니페스트 중 하나만 남도록 하는 함수
+void SaveManifest(const string& base_path, const KlineManifest& manifest) {
+  json fragments = json::array();
+  for (const auto& fragment : manifest.fragments) {
+    fragments.push_back(PartToJson(fragment));
+  }
+
+  const json& manifest_json = {{"version", manifest_version},
+                               {"base", PartToJson(manifest.base)},
+                               {"fragments", fragments}};
+
+  const string& manifest_path = KlineDataset::GetManifestPath(base_path);
+  const string& temp_path = manifest_path + ".tmp";
+
+  if (ofstream file(temp_path); file.is_open()) {
+    file << manifest_json.dump(4);
+  } else {
+    throw runtime_error(format("[{}] 파일을 열 수 없습니다.", temp_path));
+  }
+
+  filesystem::rename(temp_path, manifest_path);
+}
+
+// 여러 테이블을 수직으로 결합하고 하나의 청크로 합치는 함수
+shared_ptr<arrow::Table> CombineTables(
+    const vector<shared_ptr<arrow::Table>>& tables) {
+  const auto& concatenated_result = arrow::ConcatenateTables(tables);
+  if (!concatenated_result.ok()) {
+    throw runtime_error(format("캔들스틱 테이블을 결합하는 데 실패했습니다. {}",
+                               concatenated_result.status().ToString()));
+  }
+
+  // BarData는 첫 번째 청크만 사용하므로 청크를 하나로 합침
+  const auto& combined_result =
+      concatenated_result.ValueOrDie()->CombineChunks();
+  if (!combined_result.ok()) {
+    throw runtime_error(format("캔들스틱 테이블을 합치는 데 실패했습니다. {}",
+                               combined_result.status().ToString()));
+  }
+
+  return combined_result.ValueOrDie();
+}
+
+}  // namespace
+
+int64_t KlineManifest::GetNumRows() const {
+  int64_t num_rows = base.num_rows;
+  for (const auto& fragment : fragments) {
+    num_rows += fragment.num_rows;
+  }
+
+  return num_rows;
+}
+
+const KlinePart& KlineManifest::GetLastPart() const {
+  return fragments.empty() ? base : fragments.back();
+}
+
+void KlineDataset::WriteBase(const shared_ptr<arrow::Table>& table,
+                             const string& base_path,
+                             const bool save_split_files,
+                             const bool reset_directory) {
+  const filesystem::path path(base_path);
+  const auto& base = MakePart(table, path.filename().string(), 0, 6);
+
+  // 매니페스트를 먼저 삭제하여 저장 중 중단되어도 이전 조각이 새 기본 파일에
+  // 중복으로 붙지 않도록 함
+  filesystem::remove(GetManifestPath(base_path));
+
+  TableToParquet(table, path.parent_path().string(), base.file_name,
+                 save_split_files, reset_directory);
+
+  filesystem::remove_all(GetFragmentDirectory(base_path));
+  SaveManifest(base_path, {base, {}});
+}
+
+void KlineDataset::Append(const shared_ptr<arrow::Table>& table,
+                          const string& base_path, const bool save_split_files,
+                          const bool reset_directory) {
+  if (table->num_rows() == 0) {
+    return;
+  }
+
+  auto manifest = LoadManifest(base_path);
+
+  auto fragment = MakePart(table, "", 0, 6);
+  if (fragment.first_open_time <= manifest.GetLastPart().last_open_time) {
+    throw runtime_error(
+        format("추가할 캔들의 Open Time [{}]이(가) 캔들스틱 파일 [{}]의 "
+               "마지막 Open Time [{}]보다 앞섭니다.",
+               fragment.first_open_time, base_path,
+               manifest.GetLastPart().last_open_time));
+  }
+
+  // 조각 파일을 먼저 저장한 후 매니페스트에 추가하므로 중간에 중단되면 조각은
+  // 읽히지 않고 다음 업데이트에서 다시 받음
+  fragment.file_name = format("{}_{}.parquet", fragment.first_open_time,
+                              fragment.last_open_time);
+
+  TableToParquet(table, GetFragmentDirectory(base_path), fragment.file_name,
+                 false, false);
+
+  if (save_split_files) {
+    TableToSplitParquet(table,
+                        filesystem::path(base_path).parent_path().string());
+  }
+
+  manifest.fragments.push_back(fragment);
+  SaveManifest(base_path, manifest);
+
+  // 조각이 많아지면 읽을 파일 수가 늘어나므로 기본 파일로 합침
+  if (manifest.fragments.size() >= max_fragments) {
+    Logger::GetLogger()->Log(
+        INFO_L,
+        format("캔들스틱 파일 [{}]의 조각 {}개를 기본 파일로 합칩니다.",
+               base_path, manifest.fragments.size()),
+        __FILE__, __LINE__, true);
+
+    WriteBase(ReadBatch({base_path}, {}).front(), base_path, save_split_files,
+              reset_directory);
+  }
+}
+
+KlineManifest KlineDataset::LoadManifest(const string& base_path) {
+  if (auto manifest = ReadManifest(base_path)) {
+    return *manifest;
+  }
+
+  // 매니페스트 없이 저장된 기존 파일은 시간 열만 읽어 기본 파일 정보를 만듦
+  const auto& time_columns = ReadParquet(base_path, {0, 6});
+  const KlineManifest manifest{
+      MakePart(time_columns,
+               filesystem::path(base_path).filename().string(), 0, 1),
+      {}};
+
+  SaveManifest(base_path, manifest);
+
+  return manifest;
+}
+
+vector<shared_ptr<arrow::Table>> KlineDataset::ReadBatch(
+    const vector<string>& base_paths, const vector<int>& column_indices) {
+  // 모든 데이터셋의 파일을 한 목록으로 모아 한 번에 병렬로 읽음
+  vector<optional<KlineManifest>> manifests;
+  vector<string> file_paths;
+  vector<size_t> first_file_indices;
+
+  manifests.reserve(base_paths.size());
+  first_file_indices.reserve(base_paths.size());
+
+  for (const auto& base_path : base_paths) {
+    first_file_indices.push_back(file_paths.size());
+    file_paths.push_back(base_path);
+
+    auto& manifest = manifests.emplace_back(ReadManifest(base_path));
+    if (!manifest) {
+      continue;
+    }
+
+    const string& fragment_directory = GetFragmentDirectory(base_path);
+    for (const auto& fragment : manifest->fragments) {
+      file_paths.push_back(fragment_directory + "/" + fragment.file_name);
+    }
+  }
+
+  const auto& tables = ReadParquetBatch(file_paths, column_indices);
+
+  vector<shared_ptr<arrow::Table>> results;
+  results.reserve(base_paths.size());
+
+  for (size_t dataset_idx = 0; dataset_idx < base_paths.size();
+       dataset_idx++) {
+    const auto& manifest = manifests[dataset_idx];
+    const size_t first_file_idx = first_file_indices[dataset_idx];
+    const auto& base_table = tables[first_file_idx];
+
+    if (!manifest || manifest->fragments.empty()) {
+      results.push_back(base_table);
+      continue;
+    }
+
+    // 매니페스트 없이 기본 파일이 교체되었으면 조각이 이어지지 않으므로
+    // 기본 파일만 사용
+    if (base_table->num_rows() != manifest->base.num_rows) {
+      Logger::GetLogger()->Log(
+          WARN_L,
+          format("캔들스틱 파일 [{}]의 캔들 수가 매니페스트와 달라 조각을 "
+                 "무시합니다.",
+                 base_paths[dataset_idx]),
+          __FILE__, __LINE__, true);
+
+      results.push_back(base_table);
+      continue;
+    }
+
+    const auto first_file = tables.begin() + first_file_idx;
+    results.push_back(CombineTables(
+        {first_file, first_file + 1 + manifest->fragments.size()}));
+  }
+
+  return results;
+}
+
+string KlineDataset::GetManifestPath(const string& base_path) {
+  filesystem::path manifest_path(base_path);
+  return manifest_path.replace_extension(".manifest.json").string();
+}
+
+string KlineDataset::GetFragmentDirectory(const string& base_path) {
+  filesystem::path fragment_directory(base_path);
+  return fragment_directory.replace_extension(".fragments").string();
+}
+
+}  // namespace backtesting::utils
@@ -0,0 +1,241 @@
+// 표준 라이브러리
+#include <charconv>
+#include <format>
+#include <stdexcept>
+#include <string>
+
+// 외부 라이브러리
+#include "arrow/array/builder_primitive.h"
+#include "nlohmann/json.hpp"
+
+// 파일 헤더
+#include "Engines/KlineParser.hpp"
+
+// 네임 스페이스
+using namespace nlohmann;
+
+namespace backtesting::fetcher {
+
+size_t KlineColumns::Size() const { return open_time.size(); }
+
+bool KlineColumns::Empty() const { return open_time.empty(); }
+
+void KlineColumns::Append(const KlineColumns& other) {
+  open_time.insert(open_time.end(), other.open_time.begin(),
+                   other.open_time.end());
+  open.insert(open.end(), other.open.begin(), other.open.end());
+  high.insert(high.end(), other.high.begin(), other.high.end());
+  low.insert(low.end(), other.low.begin(), other.low.end());
+  close.insert(close.end(), other.close.begin(), other.close.end());
+  volume.insert(volume.end(), other.volume.begin(), other.volume.end());
+  close_time.insert(close_time.end(), other.close_time.begin(),
+                    other.close_time.end());
+}
+
+void KlineColumns::PopBack() {
+  if (Empty()) {
+    return;
+  }
+
+  open_time.pop_back();
+  open.pop_back();
+  high.pop_back();
+  low.pop_back();
+  close.pop_back();
+  volume.pop_back();
+  close_time.pop_back();
+}
+
+vector<shared_ptr<arrow::Array>> KlineColumns::ToArrays() const {
+  vector<shared_ptr<arrow::Array>> arrays(7);
+
+  // 시간 데이터
+  const auto& append_times = [&arrays](const int column_idx,
+                                       const vector<int64_t>& values) {
+    if (arrow::Int64Builder builder;
+        !builder.AppendValues(values).ok() ||
+        !builder.Finish(&arrays[column_idx]).ok()) {
+      throw runtime_error(format("{} time 데이터를 처리하는 데 실패했습니다.",
+                                 column_idx == 0 ? "Open" : "Close"));
+    }
+  };
+
+  // 가격 데이터
+  const auto& append_prices = [&arrays](const int column_idx,
+                                        const vector<double>& values) {
+    if (arrow::DoubleBuilder builder;
+        !builder.AppendValues(values).ok() ||
+        !builder.Finish(&arrays[column_idx]).ok()) {
+      throw runtime_error("가격 데이터를 처리하는 데 실패했습니다.");
+    }
+  };
+
+  append_times(0, open_time);
+  append_prices(1, open);
+  append_prices(2, high);
+  append_prices(3, low);
+  append_prices(4, close);
+  append_prices(5, volume);
+  append_times(6, close_time);
+
+  return arrays;
+}
+
+namespace {
+
+/// 캔들스틱 배열을 한 캔들씩 열별 버퍼에 추가하는 SAX 핸들러
+class KlineSaxHandler {
+ public:
+  explicit KlineSaxHandler(KlineColumns& columns)
+      : columns_(columns), depth_(0), field_idx_(0), is_object_(false) {}
+
+  [[nodiscard]] bool IsObject() const { return is_object_; }
+
+  bool null() { return Skip("null"); }
+  bool boolean(bool) { return Skip("boolean"); }
+
+  bool number_integer(const json::number_integer_t value) {
+    return Integer(value);
+  }
+
+  bool number_unsigned(const json::number_unsigned_t value) {
+    return Integer(static_cast<int64_t>(value));
+  }
+
+  bool number_float(const json::number_float_t value, const std::string&) {
+    if (!IsPriceField()) {
+      return Skip("실수");
+    }
+
+    SetPrice(value);
+    field_idx_++;
+
+    return true;
+  }
+
+  bool string(json::string_t& value) {
+    if (!IsPriceField()) {
+      return Skip("문자열");
+    }
+
+    double price;
+    const auto* end = value.data() + value.size();
+    if (const auto [ptr, ec] = from_chars(value.data(), end, price);
+        ec != errc() || ptr != end) {
+      throw runtime_error(
+          format("캔들스틱 가격 [{}]을(를) 숫자로 변환할 수 없습니다.", value));
+    }
+
+    SetPrice(price);
+    field_idx_++;
+
+    return true;
+  }
+
+  bool binary(json::binary_t&) { return Skip("바이너리"); }
+
+  bool start_object(size_t) {
+    // 최상위 객체는 오류 응답이므로 파싱을 멈추고 호출자가 처리
+    if (depth_ == 0) {
+      is_object_ = true;
+      return false;
+    }
+
+    throw runtime_error("캔들스틱 배열에 객체가 포함되어 있습니다.");
+  }
+
+  bool key(json::string_t&) { return true; }
+  bool end_object() { return true; }
+
+  bool start_array(size_t) {
+    if (++depth_ > 2) {
+      throw runtime_error("캔들스틱 배열의 깊이가 올바르지 않습니다.");
+    }
+
+    field_idx_ = 0;
+
+    return true;
+  }
+
+  bool end_array() {
+    // 캔들 하나가 끝나면 필요한 필드가 모두 있을 때만 열에 추가
+    if (depth_-- == 2) {
+      if (field_idx_ < 7) {
+        throw runtime_error(
+            format("캔들스틱의 필드 수 [{}]가 7개보다 적습니다.", field_idx_));
+      }
+
+      columns_.open_time.push_back(open_time_);
+      columns_.open.push_back(prices_[0]);
+      columns_.high.push_back(prices_[1]);
+      columns_.low.push_back(prices_[2]);
+      columns_.close.push_back(prices_[3]);
+      columns_.volume.push_back(prices_[4]);
+      columns_.close_time.push_back(close_time_);
+    }
+
+    return true;
+  }
+
+  bool parse_error(size_t position, const std::string&,
+                   const detail::exception& e) {
+    throw runtime_error(format("캔들스틱 응답의 {}번째 바이트에서 Json 파싱이 "
+                               "실패했습니다: {}",
+                               position, e.what()));
+  }
+
+ private:
+  KlineColumns& columns_;
+  int depth_;
+  size_t field_idx_;
+  bool is_object_;
+
+  int64_t open_time_ = 0;
+  double prices_[5] = {};
+  int64_t close_time_ = 0;
+
+  [[nodiscard]] bool IsPriceField() const {
+    return depth_ == 2 && field_idx_ >= 1 && field_idx_ <= 5;
+  }
+
+  void SetPrice(const double value) { prices_[field_idx_ - 1] = value; }
+
+  bool Integer(const int64_t value) {
+    if (depth_ == 2 && field_idx_ == 0) {
+      open_time_ = value;
+    } else if (depth_ == 2 && field_idx_ == 6) {
+      close_time_ = value;
+    } else if (IsPriceField()) {
+      SetPrice(static_cast<double>(value));
+    } else if (depth_ != 2) {
+      throw runtime_error("캔들스틱 배열에 숫자가 직접 포함되어 있습니다.");
+    }
+
+    field_idx_++;
+
+    return true;
+  }
+
+  bool Skip(const char* type) {
+    // 8번째 이후 필드는 값의 종류와 관계없이 무시
+    if (depth_ == 2 && field_idx_ >= 7) {
+      field_idx_++;
+      return true;
+    }
+
+    throw runtime_error(
+        format("캔들스틱의 {}번째 필드에 예상하지 못한 {} 값이 있습니다.",
+               field_idx_, type));
+  }
+};
+
+}  // namespace
+
+bool ParseKlines(const string_view body, KlineColumns& columns) {
+  KlineSaxHandler handler(columns);
+  json::sax_parse(body, &handler);
+
+  return !handler.IsObject();
+}
+
+}  // namespace backtesting::fetcher
@@ -16,10 +16,12 @@
 #endif
 
 // 표준 라이브러리
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <chrono>
 #include <cstdlib>
+#include <cstring>
 #include <exception>
 #include <filesystem>
 #include <format>
@@ -45,6 +47,10 @@ namespace backtesting::logger {
 thread_local char format_cache[2048];
 thread_local char filename_cache[256];
 
+// 링 버퍼를 소비하며 레코드를 포맷팅하는 캐시.
+// 생산자가 링 버퍼를 직접 소비할 때 format_cache의 라인을 덮어쓰지 않도록 분리
+thread_local char record_cache[2048];
+
 // 파일별 전용 버퍼 - 전역 static 변수
 static FastLogBuffer debug_buffer;
 static FastLogBuffer info_buffer;
@@ -56,10 +62,145 @@ static FastLogBuffer backtesting_buffer;
 // (프로젝트 디렉터리 입력 전 로그가 생성되는 경우를 대비하여 임시 로그 저장)
 static string temp_log_directory;
 
+// 지연 포맷팅 레코드 링 버퍼 레지스트리
+// 링 버퍼는 해제되지 않고 종료된 스레드의 것을 재사용하므로
+// 소비자는 락 없이 개수만 확인하고 순회할 수 있음
+static constexpr size_t max_record_rings = 1024;
+static LogRecordRing* record_rings[max_record_rings];
+static atomic<size_t> num_record_rings{0};
+static mutex record_rings_mutex;
+
+// 포맷 캐시 크기를 넘지 않도록 지연 포맷팅 메시지의 최대 길이를 제한
+static constexpr size_t max_deferred_message_length = 1536;
+
+// 작업이 없을 때 백그라운드 스레드의 최대 대기 시간
+static constexpr auto idle_wait_time = chrono::milliseconds(5);
+
+// 포맷팅을 마친 라인 하나가 차지할 수 있는 최대 슬롯 수
+static constexpr size_t max_line_slots = LogRecordRing::wake_threshold;
+
+// 포맷팅을 마친 라인 레코드의 레벨별 호출 지점
+static constexpr LogSite line_sites[] = {
+    {DEBUG_L, nullptr, nullptr, 0, false},
+    {INFO_L, nullptr, nullptr, 0, false},
+    {WARN_L, nullptr, nullptr, 0, false},
+    {ERROR_L, nullptr, nullptr, 0, false},
+    {BALANCE_L, nullptr, nullptr, 0, false}};
+
+/// 포맷팅을 마친 라인이 차지하는 슬롯 수를 반환하는 함수
+static size_t GetLineSlots(const size_t len) {
+  return max<size_t>(
+      1, (len + LogRecord::args_capacity - 1) / LogRecord::args_capacity);
+}
+
+/// 스레드 종료 시 해당 스레드의 링 버퍼를 재사용 가능하게 반환하는 구조체
+struct RecordRingOwner {
+  LogRecordRing* ring = nullptr;
+
+  ~RecordRingOwner() {
+    if (ring) {
+      ring->in_use.store(false, memory_order_release);
+    }
+  }
+};
+
+thread_local RecordRingOwner record_ring_owner;
+
+// 로그 라인에 붙는 실행 태그의 최대 길이
+static constexpr size_t max_run_tag_length = 64;
+
+/// 등록된 실행의 로그 라우팅 정보를 담는 구조체.
+///
+/// tag는 active를 켜기 전에만 쓰고 등록 해제 후에도 지우지 않으므로,
+/// 등록된 실행의 스레드는 락 없이 읽을 수 있음
+struct LogRunSink {
+  char tag[max_run_tag_length + 1]{};  // 로그 라인에 붙는 실행 태그
+  unique_ptr<FastLogBuffer> buffer;    // 실행 전용 백테스팅 로그 버퍼
+  MappedLogFile file;                  // 실행 전용 백테스팅 로그 파일
+  atomic<bool> active{false};          // 등록 여부
+};
+
+// 실행 ID - 1을 인덱스로 사용하는 실행 라우팅 테이블
+static LogRunSink run_sinks[Logger::max_log_runs];
+static atomic<uint32_t> num_active_runs{0};
+
+// 현재 스레드의 실행 ID (0이면 기본 로그)
+thread_local uint32_t thread_run_id = 0;
+
+// 현재 스레드가 진행 중인 바의 Open Time
+thread_local int64_t thread_bar_time = LogRecord::no_bar_time;
+
+// 여러 스레드의 콘솔 출력이 섞이지 않도록 보호
+static mutex console_mutex;
+
+/// 두 자리 숫자를 기록하는 함수
+static char* WriteTwoDigits(char* p, const int value) {
+  *p++ = static_cast<char>('0' + value / 10);
+  *p++ = static_cast<char>('0' + value % 10);
+  return p;
+}
+
+/// Unix Timestamp ms를 UTC "YYYY-MM-DD HH:MM:SS" 형식으로 기록하는 함수.
+/// 날짜는 그레고리력 일수 변환으로 직접 계산하므로 시간대와 무관함
+static char* FormatBarTimeFast(char* p, const int64_t bar_time) {
+  constexpr int64_t ms_per_day = 86400000;
+
+  int64_t days = bar_time / ms_per_day;
+  int64_t ms_of_day = bar_time % ms_per_day;
+  if (ms_of_day < 0) {
+    ms_of_day += ms_per_day;
+    --days;
+  }
+
+  // 1970-01-01 기준 일수를 연월일로 변환
+  days += 719468;
+  const int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+  const int64_t day_of_era = days - era * 146097;
+  const int64_t year_of_era =
+      (day_of_era - day_of_era / 1460 + day_of_era / 36524 -
+       day_of_era / 146096) /
+      365;
+  const int64_t day_of_year =
+      day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+  const int64_t mp = (5 * day_of_year + 2) / 153;
+  const int day = static_cast<int>(day_of_year - (153 * mp + 2) / 5 + 1);
+  const int month = static_cast<int>(mp < 10 ? mp + 3 : mp - 9);
+  const int year =
+      static_cast<int>(year_of_era + era * 400 + (month <= 2 ? 1 : 0));
+
+  const int seconds = static_cast<int>(ms_of_day / 1000);
+
+  p = WriteTwoDigits(p, year / 100 % 100);
+  p = WriteTwoDigits(p, year % 100);
+  *p++ = '-';
+  p = WriteTwoDigits(p, month);
+  *p++ = '-';
+  p = WriteTwoDigits(p, day);
+  *p++ = ' ';
+  p = WriteTwoDigits(p, seconds / 3600);
+  *p++ = ':';
+  p = WriteTwoDigits(p, seconds / 60 % 60);
+  *p++ = ':';
+  p = WriteTwoDigits(p, seconds % 60);
+
+  return p;
+}
+
+/// 실행 ID에 해당하는 등록된 실행을 반환하는 함수. 미등록이면 nullptr
+static LogRunSink* FindRunSink(const uint32_t run_id) {
+  if (LIKELY(run_id == 0) || UNLIKELY(run_id > Logger::max_log_runs)) {
+    return nullptr;
+  }
+
+  LogRunSink* sink = &run_sinks[run_id - 1];
+  return sink->active.load(memory_order_acquire) ? sink : nullptr;
+}
+
 // 정적 멤버 변수 정의
 BACKTESTING_API mutex Logger::mutex_;
 BACKTESTING_API shared_ptr<Logger> Logger::instance_;
 BACKTESTING_API string Logger::log_directory_;
+BACKTESTING_API atomic<int> Logger::min_log_level_{BACKTESTING_MIN_LOG_LEVEL};
 
 // 빠른 레벨 문자열 반환 - 브랜치 예측 최적화
 const char* Logger::GetLevelString(const LogLevel level) {
@@ -110,18 +251,22 @@ const char* Logger::ExtractFilename(const char* filepath) {
 }
 
 size_t Logger::FormatMessageFast(char* buffer, const LogLevel level,
-                                 const char* file, const int line,
-                                 const char* message) {
+                                 const char* run_tag, const char* file,
+                                 const int line, const char* message,
+                                 const time_t log_time,
+                                 const int64_t bar_time) {
   const char* level_str = GetLevelString(level);
   const char* filename = ExtractFilename(file);
 
   char* p = buffer;
 
-  // "[TIME] [LEVEL] [filename:line] | message" 형식
+  // "[TIME] [LEVEL] [BAR TIME] [RUN TAG] [filename:line] | message" 형식
+  // 바 시각은 백테스팅 진행 중에, 실행 태그는 등록된 실행에서 발생한 로그에만
+  // 붙음
   *p++ = '[';
 
   // 시간 포맷팅 (최적화된 함수 사용)
-  const size_t time_len = FormatCurrentTimeFast(p);
+  const size_t time_len = FormatTimeFast(p, log_time);
   p += time_len;
 
   *p++ = ']';
@@ -138,6 +283,28 @@ size_t Logger::FormatMessageFast(char* buffer, const LogLevel level,
   *p++ = ' ';
   *p++ = '[';
 
+  // 바 시각 기록 (UTC)
+  if (bar_time != LogRecord::no_bar_time) {
+    memcpy(p, "BAR ", 4);
+    p = FormatBarTimeFast(p + 4, bar_time);
+
+    *p++ = ']';
+    *p++ = ' ';
+    *p++ = '[';
+  }
+
+  // 실행 태그 복사
+  if (UNLIKELY(run_tag != nullptr)) {
+    const char* tag = run_tag;
+    while (*tag) {
+      *p++ = *tag++;
+    }
+
+    *p++ = ']';
+    *p++ = ' ';
+    *p++ = '[';
+  }
+
   // 파일명 복사
   const char* fn = filename;
   while (*fn) {
@@ -185,7 +352,7 @@ size_t Logger::FormatMessageFast(char* buffer, const LogLevel level,
 Logger::Logger(const string& debug_log_name, const string& info_log_name,
                const string& warn_log_name, const string& error_log_name,
                const string& backtesting_log_name)
-    : stop_logging_(false) {
+    : stop_logging_(false), logging_thread_sleeping_(false) {
   // 로그 디렉터리가 아직 설정되지 않은 경우에는 임시 디렉터리에 로그를 생성
   // SetLogDirectory가 호출되면 임시 로그 파일들을 프로젝트의 Logs로 이동
   string initial_log_path;
@@ -230,14 +397,11 @@ Logger::Logger(const string& debug_log_name, const string& info_log_name,
   static char info_file_buf[128 * 1024];
   static char warn_file_buf[128 * 1024];
   static char error_file_buf[128 * 1024];
-  static char backtesting_file_buf[128 * 1024];
 
   debug_log_.rdbuf()->pubsetbuf(debug_file_buf, sizeof(debug_file_buf));
   info_log_.rdbuf()->pubsetbuf(info_file_buf, sizeof(info_file_buf));
   warn_log_.rdbuf()->pubsetbuf(warn_file_buf, sizeof(warn_file_buf));
   error_log_.rdbuf()->pubsetbuf(error_file_buf, sizeof(error_file_buf));
-  backtesting_log_.rdbuf()->pubsetbuf(backtesting_file_buf,
-                                      sizeof(backtesting_file_buf));
 
   // 고성능 비동기 스레드 시작
   logging_thread_ = thread(&Logger::ProcessMultiBuffer, this);
@@ -277,6 +441,9 @@ void Logger::SetLogDirectory(const string& log_directory) {
     // 이전에 생성된 로거 인스턴스가 있으면 파일을 닫고
     // 현재 디렉토리의 로그 파일들을 새 디렉토리로 이동
     if (instance_) {
+      // 백그라운드 스레드의 플러시와 겹치지 않도록 파일 스트림 보호
+      lock_guard file_lock(instance_->file_mutex_);
+
       // 파일을 전부 닫음
       if (instance_->debug_log_.is_open()) {
         instance_->debug_log_.close();
@@ -306,8 +473,19 @@ void Logger::SetLogDirectory(const string& log_directory) {
       const string& backtesting_name = "backtesting.log";
 
       // 기존 파일 이동 (현재 디렉토리에 있는 로그 파일을 새 디렉토리로 이동)
-      const vector log_files = {debug_name, info_name, warn_name, error_name,
-                                backtesting_name};
+      // 백테스팅 로그의 인덱스 파일들도 함께 이동
+      const string& backtesting_index_name =
+          MappedLogFile::GetIndexPath(backtesting_name);
+      const string& backtesting_symbol_table_name =
+          MappedLogFile::GetSymbolTablePath(backtesting_name);
+
+      const vector log_files = {debug_name,
+                                info_name,
+                                warn_name,
+                                error_name,
+                                backtesting_name,
+                                backtesting_index_name,
+                                backtesting_symbol_table_name};
 
       for (const auto& file : log_files) {
         // 파일 후보 목록: 임시 로그 디렉터리와 현재 작업 디렉터리의 로그 폴더
@@ -330,6 +508,16 @@ void Logger::SetLogDirectory(const string& log_directory) {
                 break;  // 처리 완료, 다음 파일로
               }
 
+              // 인덱스는 원본 로그 기준 오프셋이므로 합칠 수 없어 삭제
+              // (이어서 기록되는 로그부터 새로 인덱싱됨)
+              if (file == backtesting_index_name ||
+                  file == backtesting_symbol_table_name) {
+                filesystem::remove(src);
+                filesystem::remove(format("{}/{}", log_directory, file));
+
+                break;  // 처리 완료, 다음 파일로
+              }
+
               // 기존 파일이 있다면 현재 파일 내용을 끝에 추가
               if (const string& target_path =
                       format("{}/{}", log_directory, file);
@@ -377,7 +565,6 @@ void Logger::SetLogDirectory(const string& log_directory) {
 
       instance_->backtesting_log_.open(instance_->backtesting_log_temp_path_,
                                        mode);
-      instance_->backtesting_log_.rdbuf()->pubsetbuf(nullptr, 0);
 
       // 이제 현재 세션에서 관리되는 것으로 표시
       instance_->backtesting_log_created_in_current_session_ = true;
@@ -410,6 +597,7 @@ shared_ptr<Logger>& Logger::GetLogger(const string& debug_log_name,
 
 void Logger::Shutdown() {
   stop_logging_ = true;
+  NotifyLoggingThread();
 
   if (logging_thread_.joinable()) {
     logging_thread_.join();
@@ -458,11 +646,234 @@ void Logger::ResetLogger(const string& debug_log_name,
   }
 }
 
-NO_INLINE void Logger::ProcessMultiBuffer() {
-  int consecutive_idle_count = 0;
+void Logger::SetMinLogLevel(const LogLevel log_level) {
+  min_log_level_.store(GetLogLevelRank(log_level), memory_order_relaxed);
+}
+
+uint32_t Logger::RegisterRun(const string& run_tag,
+                             const string& run_log_path) {
+  lock_guard lock(run_sinks_mutex_);
+
+  for (uint32_t run_idx = 0; run_idx < max_log_runs; ++run_idx) {
+    LogRunSink& sink = run_sinks[run_idx];
+
+    if (sink.active.load(memory_order_relaxed)) {
+      continue;
+    }
+
+    if (const auto parent_path = filesystem::path(run_log_path).parent_path();
+        !parent_path.empty() && !filesystem::exists(parent_path)) {
+      filesystem::create_directories(parent_path);
+    }
+
+    sink.file.open(run_log_path, ios::out | ios::trunc);
+
+    if (!sink.file.is_open()) {
+      const string& error_msg =
+          format("실행 로그 파일 [{}]을(를) 열 수 없습니다.", run_log_path);
+
+      Log(ERROR_L, error_msg, __FILE__, __LINE__, true);
+      throw runtime_error(error_msg);
+    }
+
+    // 포맷 캐시를 넘지 않도록 태그 길이 제한.
+    // active를 켜기 전이므로 태그를 읽는 스레드가 없음
+    const size_t tag_length = min(run_tag.size(), max_run_tag_length);
+    run_tag.copy(sink.tag, tag_length);
+    sink.tag[tag_length] = '\0';
+
+    sink.buffer = make_unique<FastLogBuffer>();
+
+    sink.active.store(true, memory_order_release);
+    num_active_runs.fetch_add(1, memory_order_relaxed);
+
+    return run_idx + 1;
+  }
+
+  const string& error_msg = format(
+      "동시에 등록 가능한 실행 수 [{}]개를 초과했습니다.", max_log_runs);
+
+  Log(ERROR_L, error_msg, __FILE__, __LINE__, true);
+  throw runtime_error(error_msg);
+}
+
+void Logger::UnregisterRun(const uint32_t run_id) {
+  if (run_id == 0 || run_id > max_log_runs) {
+    return;
+  }
+
+  // 해당 실행의 지연 레코드를 실행 전용 버퍼로 먼저 옮김
+  DrainRecordRings();
+
+  scoped_lock lock(drain_mutex_, run_sinks_mutex_, write_mutex_, file_mutex_);
+
+  LogRunSink& sink = run_sinks[run_id - 1];
+  if (!sink.active.load(memory_order_relaxed)) {
+    return;
+  }
+
+  sink.active.store(false, memory_order_release);
+  num_active_runs.fetch_sub(1, memory_order_relaxed);
+
+  // 먼저 채워진 버퍼부터 순서대로 기록
+  const size_t current_idx =
+      sink.buffer->current_buffer.load(memory_order_relaxed);
+  for (size_t offset = 1; offset <= FastLogBuffer::max_buffers; ++offset) {
+    FlushBuffer(*sink.buffer,
+                (current_idx + offset) % FastLogBuffer::max_buffers, sink.file);
+  }
+
+  // 태그는 다음 등록 때 덮어쓰므로 지우지 않음
+  sink.file.close();
+  sink.buffer.reset();
+}
+
+void Logger::SetThreadRunId(const uint32_t run_id) { thread_run_id = run_id; }
+
+uint32_t Logger::GetThreadRunId() { return thread_run_id; }
+
+void Logger::SetThreadBarTime(const int64_t bar_time) {
+  thread_bar_time = bar_time;
+}
+
+int64_t Logger::GetThreadBarTime() { return thread_bar_time; }
+
+const char* Logger::GetRunTag(const uint32_t run_id) {
+  const LogRunSink* sink = FindRunSink(run_id);
+  return sink ? sink->tag : nullptr;
+}
+
+LogRecordRing* Logger::GetThreadRecordRing() {
+  if (LIKELY(record_ring_owner.ring != nullptr)) {
+    return record_ring_owner.ring;
+  }
+
+  lock_guard lock(record_rings_mutex);
+
+  // 종료된 스레드의 링 버퍼가 있다면 재사용
+  // 남아있는 레코드는 head/tail이 그대로 이어지므로 유실되지 않음
+  const size_t num_rings = num_record_rings.load(memory_order_relaxed);
+  for (size_t ring_idx = 0; ring_idx < num_rings; ++ring_idx) {
+    bool expected = false;
+
+    if (LogRecordRing* ring = record_rings[ring_idx];
+        ring->in_use.compare_exchange_strong(expected, true,
+                                             memory_order_acq_rel)) {
+      record_ring_owner.ring = ring;
+      return ring;
+    }
+  }
+
+  // 한도에 도달하면 링 버퍼 없이 즉시 포맷팅 경로를 사용
+  if (UNLIKELY(num_rings == max_record_rings)) {
+    return nullptr;
+  }
+
+  auto* ring = new LogRecordRing();
+  ring->in_use.store(true, memory_order_relaxed);
+
+  record_rings[num_rings] = ring;
+  num_record_rings.store(num_rings + 1, memory_order_release);
+
+  record_ring_owner.ring = ring;
+  return ring;
+}
+
+void Logger::NotifyLoggingThread() {
+  if (logging_thread_sleeping_.load(memory_order_relaxed)) {
+    wake_cv_.notify_one();
+  }
+}
+
+bool Logger::DrainRecordRings() {
+  lock_guard lock(drain_mutex_);
+
+  // 소비 중인 스레드에서만 사용하는 메시지 버퍼
+  thread_local string record_message;
+
+  bool any_work = false;
+  const size_t num_rings = num_record_rings.load(memory_order_acquire);
+
+  for (size_t ring_idx = 0; ring_idx < num_rings; ++ring_idx) {
+    LogRecordRing& ring = *record_rings[ring_idx];
+
+    size_t tail = ring.tail.load(memory_order_relaxed);
+    const size_t head = ring.head.load(memory_order_acquire);
+
+    if (tail == head) {
+      continue;
+    }
+
+    any_work = true;
+
+    while (tail != head) {
+      const LogRecord& record = ring.At(tail);
+      const LogSite& site = *record.site;
+
+      // 생산자 스레드에서 포맷팅을 마친 라인은 그대로 기록
+      if (record.format_fn == nullptr) {
+        const size_t num_slots = GetLineSlots(record.args_size);
+
+        if (LIKELY(num_slots == 1)) {
+          WriteToBuffersFast(site.level, record.args, record.args_size,
+                             record.run_id);
+        } else {
+          record_message.clear();
+
+          for (size_t slot = 0; slot < num_slots; ++slot) {
+            const size_t chunk_size =
+                min(LogRecord::args_capacity,
+                    record.args_size - slot * LogRecord::args_capacity);
+            record_message.append(ring.At(tail + slot).args, chunk_size);
+          }
+
+          WriteToBuffersFast(site.level, record_message.data(),
+                             record_message.size(), record.run_id);
+        }
+
+        tail += num_slots;
+        continue;
+      }
+
+      record_message.clear();
 
+      try {
+        record.format_fn(record, record_message);
+      } catch (const std::exception& e) {
+        record_message = format("로그 포맷팅이 실패했습니다. [{}] ({})",
+                                site.format, e.what());
+      }
+
+      if (UNLIKELY(record_message.size() > max_deferred_message_length)) {
+        record_message.resize(max_deferred_message_length);
+      }
+
+      const size_t msg_len = FormatMessageFast(
+          record_cache, site.level, GetRunTag(record.run_id), site.file,
+          site.line, record_message.c_str(), record.timestamp,
+          record.bar_time);
+
+      if (UNLIKELY(site.log_to_console)) {
+        record_cache[msg_len - 1] = '\0';  // \n 제거
+        ConsoleLog(GetConsoleLevelString(site.level), record_cache);
+        record_cache[msg_len - 1] = '\n';  // 복원
+      }
+
+      WriteToBuffersFast(site.level, record_cache, msg_len, record.run_id);
+      ++tail;
+    }
+
+    // 처리한 슬롯을 한 번에 반환
+    ring.tail.store(tail, memory_order_release);
+  }
+
+  return any_work;
+}
+
+NO_INLINE void Logger::ProcessMultiBuffer() {
   while (!stop_logging_) {
-    bool any_work = false;
+    // 지연 포맷팅 레코드를 먼저 포맷팅하여 로그 버퍼에 기록
+    bool any_work = DrainRecordRings();
 
     // 각 버퍼를 순회하면서 플러시할 데이터가 있는지 확인
     PREFETCH_READ(&info_buffer);
@@ -479,24 +890,27 @@ NO_INLINE void Logger::ProcessMultiBuffer() {
 
     any_work |= FlushBufferIfReady(backtesting_buffer, backtesting_log_);
 
-    // 작업이 없으면 짧은 Sleep (조건 변수보다 빠름)
+    // 등록된 실행들의 전용 백테스팅 로그 버퍼 플러시
+    any_work |= FlushRunBuffersIfReady();
+
+    // 작업이 없으면 생산자가 깨우거나 대기 시간이 지날 때까지 대기
+    // (Sleep(0) 폴링으로 코어 하나를 점유하지 않도록 조건 변수 사용)
     if (!any_work) {
-      consecutive_idle_count++;
-#ifdef _WIN32
-      // Windows: 고정밀 Sleep
-      Sleep(0);  // 즉시 양보만
-#else
-      usleep(sleep_time);
-#endif
-    } else {
-      consecutive_idle_count = 0;  // 작업이 있으면 리셋
+      unique_lock lock(wake_mutex_);
+
+      logging_thread_sleeping_.store(true, memory_order_relaxed);
+      if (!stop_logging_) {
+        wake_cv_.wait_for(lock, idle_wait_time);
+      }
+      logging_thread_sleeping_.store(false, memory_order_relaxed);
     }
   }
 
   FlushAllBuffers();
 }
 
-bool Logger::FlushBufferIfReady(FastLogBuffer& buffer, ofstream& file) {
+template <typename LogFile>
+bool Logger::FlushBufferIfReady(FastLogBuffer& buffer, LogFile& file) {
   // 현재 사용 중인 버퍼의 반대편 버퍼만 체크 (더블 버퍼링 최적화)
   const size_t current_idx = buffer.current_buffer.load(memory_order_acquire);
   const size_t flush_idx = (current_idx + 1) % FastLogBuffer::max_buffers;
@@ -504,31 +918,65 @@ bool Logger::FlushBufferIfReady(FastLogBuffer& buffer, ofstream& file) {
   auto& buf = buffer.buffers[flush_idx];
 
   // ready_to_flush가 true인 버퍼만 플러시
+  // 플러시 대기 중인 버퍼에는 생산자가 쓰지 않으므로 쓰기 락이 필요 없음
   if (buf.ready_to_flush.load(memory_order_acquire)) {
-    if (const size_t data_size = buf.write_pos.load(memory_order_acquire);
-        data_size > 0) {
+    const size_t data_size = buf.write_pos.load(memory_order_acquire);
+
+    if (data_size > 0) {
+      lock_guard lock(file_mutex_);
+
       file.write(buf.data, static_cast<streamsize>(data_size));
       file.flush();
-      buf.reset();
-      return true;
     }
+
+    buf.reset();
+    return data_size > 0;
   }
 
   return false;
 }
 
+bool Logger::FlushRunBuffersIfReady() {
+  if (LIKELY(num_active_runs.load(memory_order_relaxed) == 0)) {
+    return false;
+  }
+
+  lock_guard lock(run_sinks_mutex_);
+
+  bool any_work = false;
+  for (auto& sink : run_sinks) {
+    if (sink.active.load(memory_order_acquire)) {
+      any_work |= FlushBufferIfReady(*sink.buffer, sink.file);
+    }
+  }
+
+  return any_work;
+}
+
 void Logger::FlushAllBuffers() {
+  // 아직 포맷팅되지 않은 레코드까지 로그 버퍼에 기록 후 플러시
+  DrainRecordRings();
+
+  scoped_lock lock(run_sinks_mutex_, write_mutex_, file_mutex_);
+
   for (size_t i = 0; i < FastLogBuffer::max_buffers; ++i) {
     FlushBuffer(debug_buffer, i, debug_log_);
     FlushBuffer(info_buffer, i, info_log_);
     FlushBuffer(warn_buffer, i, warn_log_);
     FlushBuffer(error_buffer, i, error_log_);
     FlushBuffer(backtesting_buffer, i, backtesting_log_);
+
+    for (auto& sink : run_sinks) {
+      if (sink.active.load(memory_order_relaxed)) {
+        FlushBuffer(*sink.buffer, i, sink.file);
+      }
+    }
   }
 }
 
+template <typename LogFile>
 void Logger::FlushBuffer(FastLogBuffer& buffer, const size_t buffer_idx,
-                         ofstream& file) {
+                         LogFile& file) {
   auto& buf = buffer.buffers[buffer_idx];
 
   if (const size_t data_size = buf.write_pos.load(memory_order_acquire);
@@ -546,8 +994,11 @@ FORCE_INLINE void Logger::Log(const LogLevel& log_level, const string& message,
   PREFETCH_WRITE(format_cache);
 
   // 메시지 포맷팅 (thread-local 캐시 사용)
-  const size_t msg_len = FormatMessageFast(format_cache, log_level,
-                                           file.c_str(), line, message.c_str());
+  const size_t msg_len = FormatMessageFast(
+      format_cache, log_level, GetRunTag(thread_run_id), file.c_str(), line,
+      message.c_str(),
+      chrono::system_clock::to_time_t(chrono::system_clock::now()),
+      thread_bar_time);
 
   // 콘솔 출력 (필요한 경우만)
   if (UNLIKELY(log_to_console)) {
@@ -590,8 +1041,8 @@ FORCE_INLINE void Logger::Log(const LogLevel& log_level, const string& message,
     format_cache[msg_len - 1] = '\n';  // 복원
   }
 
-  // 멀티 버퍼에 한 번만 쓰기 (로그 레벨 + 백테스팅 로그 동시 처리)
-  WriteToBuffersFast(log_level, format_cache, msg_len);
+  // 같은 스레드의 지연 로그와 순서가 섞이지 않도록 링 버퍼를 거쳐 기록
+  StageLine(log_level, format_cache, msg_len, thread_run_id);
 }
 
 void Logger::LogNoFormat(const LogLevel& log_level, const string& message,
@@ -637,14 +1088,62 @@ void Logger::LogNoFormat(const LogLevel& log_level, const string& message,
   // 개행 문자 추가 (최적화된 string 생성)
   const string formatted_message = message + "\n";
 
-  // 멀티 버퍼에 한 번만 쓰기 (로그 레벨 + 백테스팅 로그 동시 처리)
-  WriteToBuffersFast(log_level, formatted_message.c_str(),
-                     formatted_message.length());
+  // 같은 스레드의 지연 로그와 순서가 섞이지 않도록 링 버퍼를 거쳐 기록
+  StageLine(log_level, formatted_message.c_str(), formatted_message.length(),
+            thread_run_id);
+}
+
+void Logger::StageLine(const LogLevel log_level, const char* data,
+                       const size_t len, const uint32_t run_id) {
+  LogRecordRing* ring = GetThreadRecordRing();
+
+  if (const size_t num_slots = GetLineSlots(len);
+      LIKELY(ring != nullptr) && num_slots <= max_line_slots) {
+    size_t position;
+    bool reserved = ring->TryReserve(num_slots, position);
+
+    // 가득 찼으면 백그라운드 스레드를 기다리지 않고 직접 소비
+    if (UNLIKELY(!reserved)) {
+      DrainRecordRings();
+      reserved = ring->TryReserve(num_slots, position);
+    }
+
+    if (LIKELY(reserved)) {
+      for (size_t slot = 0; slot < num_slots; ++slot) {
+        const size_t offset = slot * LogRecord::args_capacity;
+        memcpy(ring->At(position + slot).args, data + offset,
+               min(LogRecord::args_capacity, len - offset));
+      }
+
+      LogRecord& record = ring->At(position);
+      record.site = &line_sites[static_cast<int>(log_level)];
+      record.format_fn = nullptr;
+      record.args_size = static_cast<uint32_t>(len);
+      record.run_id = run_id;
+
+      // 일정 개수 이상 쌓였을 때만 백그라운드 스레드를 깨움
+      if (const size_t num_pending = ring->Commit(num_slots);
+          UNLIKELY(num_pending >= LogRecordRing::wake_threshold &&
+                   num_pending - num_slots < LogRecordRing::wake_threshold)) {
+        NotifyLoggingThread();
+      }
+
+      return;
+    }
+  }
+
+  // 링 버퍼를 사용할 수 없으면 대기 중인 레코드를 먼저 기록하여 순서 유지
+  if (ring != nullptr) {
+    DrainRecordRings();
+  }
+
+  WriteToBuffersFast(log_level, data, len, run_id);
 }
 
 FORCE_INLINE void Logger::WriteToBuffersFast(const LogLevel log_level,
                                              const char* RESTRICT data,
-                                             const size_t len) {
+                                             const size_t len,
+                                             const uint32_t run_id) {
   // 프리페치로 버퍼 메타데이터 미리 로드 (브랜치 예측 최적화)
   FastLogBuffer* target_buffer;
   switch (log_level) {
@@ -681,17 +1180,36 @@ FORCE_INLINE void Logger::WriteToBuffersFast(const LogLevel log_level,
     }
   }
 
+  // 링 버퍼를 소비하는 스레드와 링 버퍼를 사용할 수 없는 생산자가 같은
+  // 버퍼에 쓸 수 있으므로 쓰기 락 보유
+  lock_guard lock(write_mutex_);
+
+  // 등록된 실행의 로그는 실행 전용 백테스팅 로그로 라우팅
+  FastLogBuffer* run_buffer = &backtesting_buffer;
+  MappedLogFile* run_file = &backtesting_log_;
+
+  if (LogRunSink* sink = FindRunSink(run_id); UNLIKELY(sink != nullptr)) {
+    run_buffer = sink->buffer.get();
+    run_file = &sink->file;
+  }
+
   // 백테스팅 버퍼 프리페치
-  PREFETCH_WRITE(&backtesting_buffer);
+  PREFETCH_WRITE(run_buffer);
 
   // 레벨별 버퍼에 쓰기 (가장 빠른 경로)
   const bool level_written = target_buffer->write_message(data, len);
 
   // 백테스팅 로그에 쓰기 (동시에 처리)
   const bool backtesting_written =
-      backtesting_log_.is_open() && backtesting_buffer.write_message(data, len);
+      run_file->is_open() && run_buffer->write_message(data, len);
+
+  if (LIKELY(level_written && backtesting_written)) {
+    return;
+  }
 
   // 극한 상황에서만 직접 파일 쓰기 (매우 드물어야 함)
+  lock_guard file_lock(file_mutex_);
+
   if (UNLIKELY(!level_written)) {
     switch (log_level) {
       case INFO_L:
@@ -719,12 +1237,42 @@ FORCE_INLINE void Logger::WriteToBuffersFast(const LogLevel log_level,
     }
   }
 
-  if (UNLIKELY(!backtesting_written && backtesting_log_.is_open())) {
-    backtesting_log_.write(data, static_cast<streamsize>(len));
+  if (UNLIKELY(!backtesting_written && run_file->is_open())) {
+    run_file->write(data, static_cast<streamsize>(len));
+  }
+}
+
+const char* Logger::GetConsoleLevelString(const LogLevel level) {
+  switch (level) {
+    case INFO_L: {
+      return "INFO_L";
+    }
+
+    case BALANCE_L: {
+      return "BALANCE_L";
+    }
+
+    case WARN_L: {
+      return "WARN_L";
+    }
+
+    case ERROR_L: {
+      return "ERROR_L";
+    }
+
+    case DEBUG_L: {
+      return "DEBUG_L";
+    }
+
+    default: {
+      return "INFO_L";
+    }
   }
 }
 
 void Logger::ConsoleLog(const string& level, const string& message) {
+  lock_guard lock(console_mutex);
+
   if (level == "INFO_L") {
     cout << "\033[38;2;200;200;200m" << message << "\033[0m" << endl;  // White
   } else if (level == "BALANCE_L" || level == "DEBUG_L") {
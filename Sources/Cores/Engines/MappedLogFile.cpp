@@ -0,0 +1,501 @@
+// Windows API 충돌 방지
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#undef byte  // Windows에서 정의된 byte 매크로 제거
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// 표준 라이브러리
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+
+// 파일 헤더
+#include "Engines/MappedLogFile.hpp"
+
+namespace backtesting::logger {
+
+// 인덱스 파일 식별자 및 버전
+static constexpr char index_magic[8] = {'B', 'T', 'L', 'O', 'G', 'I', 'D', 'X'};
+static constexpr uint32_t index_version = 2;
+
+// "[YYYY-MM-DD HH:MM:SS] [" 의 길이
+static constexpr size_t level_start_pos = 23;
+
+// 레벨 뒤 바 시각 필드 "[BAR YYYY-MM-DD HH:MM:SS]"의 접두사와 길이
+static constexpr string_view bar_time_prefix = "[BAR ";
+static constexpr size_t bar_time_field_size = 25;
+
+/// 심볼 이름에 사용 가능한 문자인지 확인하는 함수
+static bool IsSymbolChar(const char c) {
+  return (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' ||
+         c == '-';
+}
+
+/// 로그 레벨 문자열을 LogLevel 순서로 변환하는 함수. 알 수 없으면 -1 반환
+static int ParseLevel(const string_view level_text) {
+  if (level_text == "INFO") {
+    return 1;
+  }
+
+  if (level_text == "BALANCE") {
+    return 4;
+  }
+
+  if (level_text == "WARN") {
+    return 2;
+  }
+
+  if (level_text == "ERROR") {
+    return 3;
+  }
+
+  if (level_text == "DEBUG") {
+    return 0;
+  }
+
+  return -1;
+}
+
+MappedLogFile::~MappedLogFile() { close(); }
+
+void MappedLogFile::open(const string& path, const ios::openmode mode) {
+  close();
+
+  path_ = path;
+  const bool truncate = (mode & ios::trunc) != 0;
+
+#ifdef _WIN32
+  const HANDLE file_handle =
+      CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE,
+                  FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+                  truncate ? CREATE_ALWAYS : OPEN_ALWAYS,
+                  FILE_ATTRIBUTE_NORMAL, nullptr);
+
+  if (file_handle == INVALID_HANDLE_VALUE) {
+    return;
+  }
+
+  file_handle_ = file_handle;
+
+  LARGE_INTEGER file_size;
+  GetFileSizeEx(file_handle, &file_size);
+  written_size_ = static_cast<uint64_t>(file_size.QuadPart);
+#else
+  fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | (truncate ? O_TRUNC : 0),
+               0644);
+
+  if (fd_ < 0) {
+    return;
+  }
+
+  struct stat file_stat{};
+  fstat(fd_, &file_stat);
+  written_size_ = static_cast<uint64_t>(file_stat.st_size);
+#endif
+
+  // 기록 위치가 포함된 세그먼트 매핑
+  if (!MapSegment(written_size_ / segment_size)) {
+    close();
+    return;
+  }
+
+  // 비정상 종료로 잘라내지 못한 미리 확장된 영역은 제외하고 이어서 기록
+  const uint64_t segment_offset = segment_idx_ * segment_size;
+  while (written_size_ > segment_offset &&
+         segment_data_[written_size_ - segment_offset - 1] == '\0') {
+    --written_size_;
+  }
+
+  // 사이드카 파일 열기
+  const string& index_path = GetIndexPath(path);
+  const string& symbol_table_path = GetSymbolTablePath(path);
+
+  // 이전 버전의 인덱스에는 이어서 기록하지 않고 새로 시작
+  bool reset_index = truncate || !filesystem::exists(index_path);
+  if (!reset_index) {
+    LogIndexHeader header{};
+    ifstream(index_path, ios::binary)
+        .read(reinterpret_cast<char*>(&header), sizeof(header));
+
+    reset_index = memcmp(header.magic, index_magic, sizeof(index_magic)) != 0 ||
+                  header.version != index_version ||
+                  header.entry_size != sizeof(LogIndexEntry);
+  }
+
+  if (reset_index) {
+    index_file_.open(index_path, ios::binary | ios::out | ios::trunc);
+
+    LogIndexHeader header{};
+    memcpy(header.magic, index_magic, sizeof(index_magic));
+    header.version = index_version;
+    header.entry_size = sizeof(LogIndexEntry);
+    index_file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    ofstream(symbol_table_path, ios::out | ios::trunc).close();
+  } else {
+    index_file_.open(index_path, ios::binary | ios::out | ios::app);
+
+    // 이어서 기록하는 경우 기존 심볼 테이블 복원
+    ifstream symbol_table(symbol_table_path);
+    for (string symbol; getline(symbol_table, symbol);) {
+      symbol_ids_.emplace(symbol, static_cast<uint16_t>(symbols_.size()));
+      symbols_.push_back(symbol);
+    }
+
+    num_saved_symbols_ = symbols_.size();
+  }
+}
+
+bool MappedLogFile::is_open() const { return segment_data_ != nullptr; }
+
+MappedLogFile& MappedLogFile::write(const char* data, const streamsize len) {
+  if (segment_data_ == nullptr || len <= 0) {
+    return *this;
+  }
+
+  const uint64_t start_offset = written_size_;
+  const char* src = data;
+  auto remaining = static_cast<uint64_t>(len);
+
+  while (remaining > 0) {
+    const uint64_t segment_pos = written_size_ - segment_idx_ * segment_size;
+
+    // 현재 세그먼트가 가득 찼으면 다음 세그먼트로 이동
+    if (segment_pos == segment_size) {
+      if (!MapSegment(segment_idx_ + 1)) {
+        return *this;
+      }
+
+      continue;
+    }
+
+    const uint64_t copy_size = min(remaining, segment_size - segment_pos);
+    memcpy(segment_data_ + segment_pos, src, copy_size);
+
+    src += copy_size;
+    remaining -= copy_size;
+    written_size_ += copy_size;
+  }
+
+  IndexLines(data, static_cast<size_t>(len), start_offset);
+
+  return *this;
+}
+
+void MappedLogFile::flush() {
+  if (index_file_.is_open()) {
+    index_file_.flush();
+  }
+
+  SaveSymbols();
+}
+
+void MappedLogFile::close() {
+#ifdef _WIN32
+  if (file_handle_ == nullptr) {
+    return;
+  }
+#else
+  if (fd_ < 0) {
+    return;
+  }
+#endif
+
+  flush();
+  UnmapSegment();
+
+  // 미리 확장한 영역을 잘라내어 실제 기록된 크기로 맞춤
+#ifdef _WIN32
+  const auto file_handle = static_cast<HANDLE>(file_handle_);
+
+  LARGE_INTEGER file_size;
+  file_size.QuadPart = static_cast<LONGLONG>(written_size_);
+  SetFilePointerEx(file_handle, file_size, nullptr, FILE_BEGIN);
+  SetEndOfFile(file_handle);
+
+  CloseHandle(file_handle);
+  file_handle_ = nullptr;
+#else
+  ftruncate(fd_, static_cast<off_t>(written_size_));
+
+  ::close(fd_);
+  fd_ = -1;
+#endif
+
+  index_file_.close();
+
+  symbols_.clear();
+  symbol_ids_.clear();
+  num_saved_symbols_ = 0;
+  pending_line_.clear();
+  written_size_ = 0;
+  segment_idx_ = 0;
+}
+
+void MappedLogFile::Rename(const string& from, const string& to) {
+  filesystem::rename(from, to);
+
+  for (const auto& [from_sidecar, to_sidecar] :
+       {pair{GetIndexPath(from), GetIndexPath(to)},
+        pair{GetSymbolTablePath(from), GetSymbolTablePath(to)}}) {
+    if (filesystem::exists(from_sidecar)) {
+      filesystem::rename(from_sidecar, to_sidecar);
+    }
+  }
+}
+
+string MappedLogFile::GetIndexPath(const string& log_path) {
+  return log_path + ".idx";
+}
+
+string MappedLogFile::GetSymbolTablePath(const string& log_path) {
+  return log_path + ".sym";
+}
+
+bool MappedLogFile::MapSegment(const uint64_t segment_idx) {
+  UnmapSegment();
+
+  const uint64_t segment_offset = segment_idx * segment_size;
+  const uint64_t required_size = segment_offset + segment_size;
+
+#ifdef _WIN32
+  // 매핑 크기가 파일보다 크면 파일이 자동으로 확장됨
+  mapping_handle_ = CreateFileMappingA(
+      static_cast<HANDLE>(file_handle_), nullptr, PAGE_READWRITE,
+      static_cast<DWORD>(required_size >> 32),
+      static_cast<DWORD>(required_size & 0xFFFFFFFF), nullptr);
+
+  if (mapping_handle_ == nullptr) {
+    return false;
+  }
+
+  segment_data_ = static_cast<char*>(MapViewOfFile(
+      static_cast<HANDLE>(mapping_handle_), FILE_MAP_WRITE,
+      static_cast<DWORD>(segment_offset >> 32),
+      static_cast<DWORD>(segment_offset & 0xFFFFFFFF), segment_size));
+
+  if (segment_data_ == nullptr) {
+    CloseHandle(static_cast<HANDLE>(mapping_handle_));
+    mapping_handle_ = nullptr;
+    return false;
+  }
+#else
+  struct stat file_stat{};
+  if (fstat(fd_, &file_stat) != 0) {
+    return false;
+  }
+
+  if (static_cast<uint64_t>(file_stat.st_size) < required_size &&
+      ftruncate(fd_, static_cast<off_t>(required_size)) != 0) {
+    return false;
+  }
+
+  void* segment_data =
+      mmap(nullptr, segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_,
+           static_cast<off_t>(segment_offset));
+
+  if (segment_data == MAP_FAILED) {
+    return false;
+  }
+
+  segment_data_ = static_cast<char*>(segment_data);
+#endif
+
+  segment_idx_ = segment_idx;
+  return true;
+}
+
+void MappedLogFile::UnmapSegment() {
+  if (segment_data_ == nullptr) {
+    return;
+  }
+
+#ifdef _WIN32
+  UnmapViewOfFile(segment_data_);
+  CloseHandle(static_cast<HANDLE>(mapping_handle_));
+  mapping_handle_ = nullptr;
+#else
+  munmap(segment_data_, segment_size);
+#endif
+
+  segment_data_ = nullptr;
+}
+
+void MappedLogFile::IndexLines(const char* data, const size_t len,
+                               const uint64_t offset) {
+  const char* p = data;
+  const char* end = data + len;
+  uint64_t line_offset = offset;
+
+  // 이전 write에서 잘린 라인 이어붙이기
+  if (!pending_line_.empty()) {
+    const auto* newline = static_cast<const char*>(memchr(p, '\n', end - p));
+
+    if (newline == nullptr) {
+      pending_line_.append(p, end - p);
+      return;
+    }
+
+    pending_line_.append(p, newline + 1 - p);
+    IndexLine(pending_line_, pending_line_offset_);
+    pending_line_.clear();
+
+    line_offset += newline + 1 - p;
+    p = newline + 1;
+  }
+
+  while (p < end) {
+    const auto* newline = static_cast<const char*>(memchr(p, '\n', end - p));
+
+    if (newline == nullptr) {
+      pending_line_.assign(p, end - p);
+      pending_line_offset_ = line_offset;
+      return;
+    }
+
+    const auto line_len = static_cast<size_t>(newline + 1 - p);
+    IndexLine(string_view(p, line_len), line_offset);
+
+    line_offset += line_len;
+    p = newline + 1;
+  }
+}
+
+void MappedLogFile::IndexLine(const string_view line, const uint64_t offset) {
+  // "[YYYY-MM-DD HH:MM:SS] [LEVEL]" 형식 확인
+  if (line.size() <= level_start_pos || line[0] != '[' || line[20] != ']' ||
+      line[22] != '[') {
+    return;
+  }
+
+  const size_t level_end = line.find(']', level_start_pos);
+  if (level_end == string_view::npos) {
+    return;
+  }
+
+  const int level =
+      ParseLevel(line.substr(level_start_pos, level_end - level_start_pos));
+  if (level < 0) {
+    return;
+  }
+
+  LogIndexEntry entry{};
+  entry.bar_time = no_bar_time;
+
+  // 백테스팅 진행 중의 로그는 레벨 뒤에 UTC 바 시각이 붙음
+  if (const size_t bar_time_pos = level_end + 2;
+      line.size() > bar_time_pos + bar_time_field_size &&
+      line.substr(bar_time_pos, bar_time_prefix.size()) == bar_time_prefix &&
+      line[bar_time_pos + bar_time_field_size - 1] == ']') {
+    entry.bar_time =
+        ParseBarTime(line.data() + bar_time_pos + bar_time_prefix.size());
+  }
+
+  entry.offset = offset;
+  entry.length = static_cast<uint32_t>(line.size());
+  entry.symbol_id = no_symbol;
+  entry.level = static_cast<uint8_t>(level);
+
+  // 메시지가 "[SYMBOL]" 혹은 "[SYMBOL 1h]"로 시작하면 심볼로 인덱싱
+  if (const size_t message_pos = line.find("] | ", level_end);
+      message_pos != string_view::npos) {
+    const size_t symbol_start = message_pos + 5;
+
+    if (symbol_start < line.size() && line[symbol_start - 1] == '[') {
+      size_t symbol_end = symbol_start;
+      while (symbol_end < line.size() && IsSymbolChar(line[symbol_end])) {
+        ++symbol_end;
+      }
+
+      if (symbol_end > symbol_start && symbol_end < line.size() &&
+          (line[symbol_end] == ']' || line[symbol_end] == ' ')) {
+        entry.symbol_id =
+            GetSymbolId(line.substr(symbol_start, symbol_end - symbol_start));
+      }
+    }
+  }
+
+  index_file_.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+}
+
+int64_t MappedLogFile::ParseBarTime(const char* time_text) {
+  // 같은 바의 로그는 캐시된 결과 사용
+  if (memcmp(time_text, cached_bar_time_text_,
+             sizeof(cached_bar_time_text_)) == 0) {
+    return cached_bar_time_;
+  }
+
+  const auto to_int = [time_text](const int pos, const int len) {
+    int value = 0;
+    for (int i = pos; i < pos + len; ++i) {
+      value = value * 10 + (time_text[i] - '0');
+    }
+
+    return value;
+  };
+
+  // "YYYY-MM-DD HH:MM:SS" 형식의 UTC 시각.
+  // 시간대 설정에 영향받지 않도록 그레고리력 일수 변환으로 직접 계산
+  const int month = to_int(5, 2);
+  const int64_t year = to_int(0, 4) - (month <= 2 ? 1 : 0);
+  const int64_t era = (year >= 0 ? year : year - 399) / 400;
+  const int64_t year_of_era = year - era * 400;
+  const int64_t day_of_year =
+      (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + to_int(8, 2) - 1;
+  const int64_t day_of_era = year_of_era * 365 + year_of_era / 4 -
+                             year_of_era / 100 + day_of_year;
+  const int64_t days = era * 146097 + day_of_era - 719468;
+
+  const int64_t seconds =
+      days * 86400 + to_int(11, 2) * 3600 + to_int(14, 2) * 60 + to_int(17, 2);
+
+  memcpy(cached_bar_time_text_, time_text, sizeof(cached_bar_time_text_));
+  cached_bar_time_ = seconds * 1000;
+
+  return cached_bar_time_;
+}
+
+uint16_t MappedLogFile::GetSymbolId(const string_view symbol) {
+  if (const auto it = symbol_ids_.find(string(symbol));
+      it != symbol_ids_.end()) {
+    return it->second;
+  }
+
+  // 심볼 테이블이 가득 찼으면 심볼 없이 인덱싱
+  if (symbols_.size() >= no_symbol) {
+    return no_symbol;
+  }
+
+  const auto symbol_id = static_cast<uint16_t>(symbols_.size());
+  symbols_.emplace_back(symbol);
+  symbol_ids_.emplace(symbols_.back(), symbol_id);
+
+  return symbol_id;
+}
+
+void MappedLogFile::SaveSymbols() {
+  if (num_saved_symbols_ == symbols_.size() || path_.empty()) {
+    return;
+  }
+
+  ofstream symbol_table(GetSymbolTablePath(path_), ios::out | ios::app);
+  for (size_t symbol_idx = num_saved_symbols_; symbol_idx < symbols_.size();
+       ++symbol_idx) {
+    symbol_table << symbols_[symbol_idx] << '\n';
+  }
+
+  num_saved_symbols_ = symbols_.size();
+}
+
+}  // namespace backtesting::logger
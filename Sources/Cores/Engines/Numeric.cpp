@@ -1,8 +1,30 @@
+// 표준 라이브러리
+#include <stdexcept>
+
 // 파일 헤더
 #include "Engines/Numeric.hpp"
 
 namespace backtesting::numeric {
 
+BACKTESTING_API ComparisonMode ComparisonPolicy::mode_ =
+    ComparisonMode::RELATIVE;
+BACKTESTING_API double ComparisonPolicy::tolerance_ = 0;
+
+void ComparisonPolicy::Set(const ComparisonMode mode, const double tolerance) {
+  if (!kRuntimeMode && mode != ComparisonMode::RELATIVE) {
+    throw runtime_error(
+        "RELATIVE 이외의 비교 방식은 BACKTESTING_RUNTIME_COMPARISON 옵션으로 "
+        "빌드해야 사용할 수 있습니다.");
+  }
+
+  mode_ = mode;
+  tolerance_ = tolerance;
+}
+
+ComparisonMode ComparisonPolicy::GetMode() { return mode_; }
+
+double ComparisonPolicy::GetTolerance() { return tolerance_; }
+
 template class Numeric<float>;
 template class Numeric<double>;
 template class Numeric<long double>;
@@ -15,6 +15,7 @@
 #include "Engines/Engine.hpp"
 #include "Engines/Exception.hpp"
 #include "Engines/Order.hpp"
+#include "Engines/Profiler.hpp"
 #include "Engines/SymbolInfo.hpp"
 #include "Engines/TimeUtils.hpp"
 #include "Engines/Trade.hpp"
@@ -31,29 +32,52 @@ namespace backtesting::order {
 inline string warn_msg;
 
 // 경고 메세지를 로깅 후 false를 리턴하는 매크로
-#define WARN_AND_RET_FALSE()                              \
-  LogFormattedInfo(WARN_L, warn_msg, __FILE__, __LINE__); \
+#define WARN_AND_RET_FALSE()                   \
+  LOG_SYMBOL_DEFERRED(WARN_L, "{}", warn_msg); \
   return false;
 
 // 경고 메세지를 로깅 후 단순 리턴하는 매크로
-#define WARN_AND_RET()                                    \
-  LogFormattedInfo(WARN_L, warn_msg, __FILE__, __LINE__); \
+#define WARN_AND_RET()                         \
+  LOG_SYMBOL_DEFERRED(WARN_L, "{}", warn_msg); \
   return;
 
 // valid 검사 함수들의 리턴값을 검사하여 Invalid하면 원인과 경고 메시지를
 // 로깅 후 false를 리턴하는 매크로
-#define RET_FALSE_IF_INVALID(expr)                       \
-  if (const optional<string>& warn = expr) {             \
-    LogFormattedInfo(WARN_L, *warn, __FILE__, __LINE__); \
-    WARN_AND_RET_FALSE()                                 \
+#define RET_FALSE_IF_INVALID(expr)            \
+  if (const optional<string>& warn = expr) {  \
+    LOG_SYMBOL_DEFERRED(WARN_L, "{}", *warn); \
+    WARN_AND_RET_FALSE()                      \
   }
 
 // valid 검사 함수들의 리턴값을 검사하여 Invalid하면 원인과 경고 메시지를
 // 로깅 후 단순 리턴하는 매크로
-#define RET_IF_INVALID(expr)                             \
-  if (const optional<string>& warn = expr) {             \
-    LogFormattedInfo(WARN_L, *warn, __FILE__, __LINE__); \
-    WARN_AND_RET()                                       \
+#define RET_IF_INVALID(expr)                  \
+  if (const optional<string>& warn = expr) {  \
+    LOG_SYMBOL_DEFERRED(WARN_L, "{}", *warn); \
+    WARN_AND_RET()                            \
+  }
+
+// 체결 경로에서 체결 실패 메시지를 지연 포맷팅으로 로깅하는 매크로
+#define LOG_FILL_FAILED(order_type_str, order_name)                \
+  LOG_SYMBOL_DEFERRED(WARN_L, "{} [{}] 체결 실패", order_type_str, \
+                      order_name)
+
+// 체결 경로의 valid 검사 함수들의 리턴값을 검사하여 Invalid하면 원인과
+// 체결 실패 메시지를 로깅 후 false를 리턴하는 매크로
+#define RET_FALSE_IF_FILL_INVALID(expr, order_type_str, order_name) \
+  if (const optional<string>& warn = expr) {                       \
+    LOG_SYMBOL_DEFERRED(WARN_L, "{}", *warn);                      \
+    LOG_FILL_FAILED(order_type_str, order_name);                   \
+    return false;                                                  \
+  }
+
+// 체결 경로의 valid 검사 함수들의 리턴값을 검사하여 Invalid하면 원인과
+// 체결 실패 메시지를 로깅 후 단순 리턴하는 매크로
+#define RET_IF_FILL_INVALID(expr, order_type_str, order_name) \
+  if (const optional<string>& warn = expr) {                 \
+    LOG_SYMBOL_DEFERRED(WARN_L, "{}", *warn);                \
+    LOG_FILL_FAILED(order_type_str, order_name);             \
+    return;                                                  \
   }
 
 OrderHandler::OrderHandler() = default;
@@ -125,8 +149,7 @@ bool OrderHandler::MarketEntry(const string& entry_name,
 
       entry_now = false;
     } else [[unlikely]] {
-      LogFormattedInfo(WARN_L, "마지막 바에서 시장가 진입 대기 주문 불가",
-                       __FILE__, __LINE__);
+      LOG_SYMBOL_DEFERRED(WARN_L, "마지막 바에서 시장가 진입 대기 주문 불가");
 
       WARN_AND_RET_FALSE()
     }
@@ -213,8 +236,7 @@ bool OrderHandler::LimitEntry(const string& entry_name,
       order_time = next_bar.open_time;
       base_price = next_bar.open;
     } else [[unlikely]] {
-      LogFormattedInfo(WARN_L, "마지막 바에서 지정가 진입 대기 주문 불가",
-                       __FILE__, __LINE__);
+      LOG_SYMBOL_DEFERRED(WARN_L, "마지막 바에서 지정가 진입 대기 주문 불가");
 
       WARN_AND_RET_FALSE()
     }
@@ -277,12 +299,10 @@ bool OrderHandler::LimitEntry(const string& entry_name,
   pending_entries_[symbol_idx].push_back(limit_entry);
 
   const auto& symbol_info = symbol_info_[symbol_idx];
-  LogFormattedInfo(
-      INFO_L,
-      format("지정가 [{}] 주문 (주문가 {} | 주문량 {})", entry_name,
-             ToFixedString(order_price, symbol_info.GetPricePrecision()),
-             ToFixedString(order_size, symbol_info.GetQtyPrecision())),
-      __FILE__, __LINE__);
+  LOG_SYMBOL_DEFERRED(INFO_L, "지정가 [{}] 주문 (주문가 {} | 주문량 {})",
+                      entry_name,
+                      FixedValue{order_price, symbol_info.GetPricePrecision()},
+                      FixedValue{order_size, symbol_info.GetQtyPrecision()});
   engine_->LogBalance();
 
   return true;
@@ -310,8 +330,7 @@ bool OrderHandler::MitEntry(const string& entry_name,
       // On Close 전략일 시 기준 가격은 다음 봉의 Open
       base_price = next_bar.open;
     } else [[unlikely]] {
-      LogFormattedInfo(WARN_L, "마지막 바에서 MIT 진입 대기 주문 불가",
-                       __FILE__, __LINE__);
+      LOG_SYMBOL_DEFERRED(WARN_L, "마지막 바에서 MIT 진입 대기 주문 불가");
 
       WARN_AND_RET_FALSE()
     }
@@ -357,12 +376,10 @@ bool OrderHandler::MitEntry(const string& entry_name,
   pending_entries_[symbol_idx].push_back(mit_entry);
 
   const auto& symbol_info = symbol_info_[symbol_idx];
-  LogFormattedInfo(
-      INFO_L,
-      format("MIT [{}] 대기 주문 (터치가 {} | 주문량 {})", entry_name,
-             ToFixedString(touch_price, symbol_info.GetPricePrecision()),
-             ToFixedString(order_size, symbol_info.GetQtyPrecision())),
-      __FILE__, __LINE__);
+  LOG_SYMBOL_DEFERRED(INFO_L, "MIT [{}] 대기 주문 (터치가 {} | 주문량 {})",
+                      entry_name,
+                      FixedValue{touch_price, symbol_info.GetPricePrecision()},
+                      FixedValue{order_size, symbol_info.GetQtyPrecision()});
 
   return true;
 }
@@ -390,8 +407,7 @@ bool OrderHandler::LitEntry(const string& entry_name,
       // On Close 전략일 시 기준 가격은 다음 봉의 Open
       base_price = next_bar.open;
     } else [[unlikely]] {
-      LogFormattedInfo(WARN_L, "마지막 바에서 LIT 진입 대기 주문 불가",
-                       __FILE__, __LINE__);
+      LOG_SYMBOL_DEFERRED(WARN_L, "마지막 바에서 LIT 진입 대기 주문 불가");
 
       WARN_AND_RET_FALSE()
     }
@@ -443,13 +459,11 @@ bool OrderHandler::LitEntry(const string& entry_name,
 
   const auto& symbol_info = symbol_info_[symbol_idx];
   const auto price_precision = symbol_info.GetPricePrecision();
-  LogFormattedInfo(
-      INFO_L,
-      format("LIT [{}] 대기 주문 (터치가 {} | 주문가 {} | 주문량 {})",
-             entry_name, ToFixedString(touch_price, price_precision),
-             ToFixedString(order_price, price_precision),
-             ToFixedString(order_size, symbol_info.GetQtyPrecision())),
-      __FILE__, __LINE__);
+  LOG_SYMBOL_DEFERRED(
+      INFO_L, "LIT [{}] 대기 주문 (터치가 {} | 주문가 {} | 주문량 {})",
+      entry_name, FixedValue{touch_price, price_precision},
+      FixedValue{order_price, price_precision},
+      FixedValue{order_size, symbol_info.GetQtyPrecision()});
 
   return true;
 }
@@ -477,8 +491,7 @@ bool OrderHandler::TrailingEntry(const string& entry_name,
       // On Close 전략일 시 기준 가격은 다음 봉의 Open
       base_price = next_bar.open;
     } else [[unlikely]] {
-      LogFormattedInfo(WARN_L, "마지막 바에서 트레일링 진입 대기 주문 불가",
-                       __FILE__, __LINE__);
+      LOG_SYMBOL_DEFERRED(WARN_L, "마지막 바에서 트레일링 진입 대기 주문 불가");
 
       WARN_AND_RET_FALSE()
     }
@@ -748,8 +761,7 @@ bool OrderHandler::LimitExit(const string& exit_name, const string& target_name,
       order_time = next_bar.open_time;
       base_price = next_bar.open;
     } else [[unlikely]] {
-      LogFormattedInfo(WARN_L, "마지막 바에서 지정가 청산 대기 주문 불가",
-                       __FILE__, __LINE__);
+      LOG_SYMBOL_DEFERRED(WARN_L, "마지막 바에서 지정가 청산 대기 주문 불가");
 
       WARN_AND_RET_FALSE()
     }
@@ -842,8 +854,7 @@ bool OrderHandler::MitExit(const string& exit_name, const string& target_name,
       // On Close 전략일 시 기준 가격은 다음 봉의 Open
       base_price = next_bar.open;
     } else [[unlikely]] {
-      LogFormattedInfo(WARN_L, "마지막 바에서 MIT 청산 대기 주문 불가",
-                       __FILE__, __LINE__);
+      LOG_SYMBOL_DEFERRED(WARN_L, "마지막 바에서 MIT 청산 대기 주문 불가");
 
       WARN_AND_RET_FALSE()
     }
@@ -934,8 +945,7 @@ bool OrderHandler::LitExit(const string& exit_name, const string& target_name,
       // On Close 전략일 시 기준 가격은 다음 봉의 Open
       base_price = next_bar.open;
     } else [[unlikely]] {
-      LogFormattedInfo(WARN_L, "마지막 바에서 LIT 청산 대기 주문 불가",
-                       __FILE__, __LINE__);
+      LOG_SYMBOL_DEFERRED(WARN_L, "마지막 바에서 LIT 청산 대기 주문 불가");
 
       WARN_AND_RET_FALSE()
     }
@@ -1033,8 +1043,7 @@ bool OrderHandler::TrailingExit(const string& exit_name,
       // On Close 전략일 시 기준 가격은 다음 봉의 Open
       base_price = next_bar.open;
     } else [[unlikely]] {
-      LogFormattedInfo(WARN_L, "마지막 바에서 트레일링 청산 대기 주문 불가",
-                       __FILE__, __LINE__);
+      LOG_SYMBOL_DEFERRED(WARN_L, "마지막 바에서 트레일링 청산 대기 주문 불가");
 
       WARN_AND_RET_FALSE()
     }
@@ -1331,6 +1340,8 @@ void OrderHandler::CheckLiquidation(const BarDataType market_bar_data_type,
 
 void OrderHandler::CheckPendingExits(const int symbol_idx, const double price,
                                      const PriceType price_type) {
+  PROFILE_SCOPE("OrderHandler::CheckPendingExits");
+
   for (const auto& pending_exit : pending_exits_[symbol_idx]) {
     // 주문 타입별로 조건이 만족되면 체결해야 하는 청산 주문 목록에 주문을 추가
     switch (pending_exit->GetExitOrderType()) {
@@ -1394,6 +1405,8 @@ void OrderHandler::CheckPendingExits(const int symbol_idx, const double price,
 
 void OrderHandler::CheckPendingEntries(const int symbol_idx, const double price,
                                        const PriceType price_type) {
+  PROFILE_SCOPE("OrderHandler::CheckPendingEntries");
+
   const auto& pending_entries = pending_entries_[symbol_idx];
   for (int order_idx = 0; order_idx < pending_entries.size(); order_idx++) {
     // 주문 타입별로 조건이 만족되면 체결해야 하는 진입 주문 목록에 주문을 추가
@@ -1459,6 +1472,8 @@ void OrderHandler::CheckPendingEntries(const int symbol_idx, const double price,
 
 void OrderHandler::FillOrder(const FillInfo& order_info, const int symbol_idx,
                              const PriceType price_type) {
+  PROFILE_SCOPE("OrderHandler::FillOrder");
+
   switch (const auto& [order, order_signal, fill_price] = order_info;
           order_signal) {
     case OrderSignal::LIQUIDATION: {
@@ -1757,12 +1772,10 @@ void OrderHandler::FillLiquidation(const shared_ptr<Order>& filled_entry,
       // 청산 대기 주문은 예약 증거금이 필요하지 않기 때문에 삭제만 함
       pending_exits.erase(pending_exits.begin() + order_idx);
 
-      LogFormattedInfo(
-          INFO_L,
-          format("{} [{}] 주문 취소 (원본 진입 강제 청산)",
-                 Order::OrderTypeToString(pending_exit->GetExitOrderType()),
-                 pending_exit->GetExitName()),
-          __FILE__, __LINE__);
+      LOG_SYMBOL_DEFERRED(
+          INFO_L, "{} [{}] 주문 취소 (원본 진입 강제 청산)",
+          Order::OrderTypeToString(pending_exit->GetExitOrderType()),
+          pending_exit->GetExitName());
     }
   }
 
@@ -1781,7 +1794,6 @@ bool OrderHandler::FillMarketEntry(const shared_ptr<Order>& market_entry,
       Order::OrderTypeToString(market_entry->GetEntryOrderType());
   const string& entry_name = market_entry->GetEntryName();
   const auto entry_fee = market_entry->GetEntryFee();
-  warn_msg = format("{} [{}] 체결 실패", order_type_str, entry_name);
 
   // 해당 주문과 반대 방향의 체결 주문이 있으면 모두 청산
   ExitOppositeFilledEntries(entry_direction, market_entry->GetEntryOrderPrice(),
@@ -1792,8 +1804,9 @@ bool OrderHandler::FillMarketEntry(const shared_ptr<Order>& market_entry,
   // 반대 방향 주문을 확실하게 청산하고 목표하는 레버리지로 확실하게 진입할 수
   // 있게 하기 위함과, 목표 레버리지를 진입 시점에 직접 변경하는 것보다 엔진
   // 내부 처리가 편리하기 때문
-  RET_FALSE_IF_INVALID(
-      BaseOrderHandler::AdjustLeverage(market_entry->GetLeverage(), symbol_idx))
+  RET_FALSE_IF_FILL_INVALID(
+      BaseOrderHandler::AdjustLeverage(market_entry->GetLeverage(), symbol_idx),
+      order_type_str, entry_name)
 
   // 시장가 진입 마진을 계산 후 설정
   const double entry_margin = CalculateMargin(
@@ -1807,18 +1820,18 @@ bool OrderHandler::FillMarketEntry(const shared_ptr<Order>& market_entry,
                                 entry_filled_size, entry_margin, symbol_idx));
 
   // 진입 체결 가능 여부 체크 (사용 가능 자금 >= 시장가 진입 마진 + 진입 수수료)
-  RET_FALSE_IF_INVALID(HasEnoughBalance(
-      engine_->GetAvailableBalance(), entry_margin + entry_fee, "사용 가능",
-      format("{} 진입 마진 및 진입 수수료", order_type_str)))
+  RET_FALSE_IF_FILL_INVALID(
+      HasEnoughBalance(engine_->GetAvailableBalance(), entry_margin + entry_fee,
+                       "사용 가능",
+                       format("{} 진입 마진 및 진입 수수료", order_type_str)),
+      order_type_str, entry_name)
 
   // 지갑 자금에서 진입 수수료 차감
   engine_->DecreaseWalletBalance(entry_fee);
 
   // 수수료 차감 로그
-  LogFormattedInfo(INFO_L,
-                   format("{} [{}] 진입 수수료 [{}] 차감", order_type_str,
-                          entry_name, FormatDollar(entry_fee, true)),
-                   __FILE__, __LINE__);
+  LOG_SYMBOL_DEFERRED(INFO_L, "{} [{}] 진입 수수료 [{}] 차감", order_type_str,
+                      entry_name, DollarValue{entry_fee, true});
   engine_->LogBalance();
 
   // 사용한 마진에 시장가 진입 마진 증가
@@ -1833,14 +1846,12 @@ bool OrderHandler::FillMarketEntry(const shared_ptr<Order>& market_entry,
   filled_entries_[symbol_idx].push_back(market_entry);
 
   const auto& symbol_info = symbol_info_[symbol_idx];
-  LogFormattedInfo(
-      INFO_L,
-      format("{} [{}] 체결 (체결가 {} | 체결량 {} | 진입 마진 {})",
-             order_type_str, entry_name,
-             ToFixedString(entry_filled_price, symbol_info.GetPricePrecision()),
-             ToFixedString(entry_filled_size, symbol_info.GetQtyPrecision()),
-             FormatDollar(entry_margin, true)),
-      __FILE__, __LINE__);
+  LOG_SYMBOL_DEFERRED(
+      INFO_L, "{} [{}] 체결 (체결가 {} | 체결량 {} | 진입 마진 {})",
+      order_type_str, entry_name,
+      FixedValue{entry_filled_price, symbol_info.GetPricePrecision()},
+      FixedValue{entry_filled_size, symbol_info.GetQtyPrecision()},
+      DollarValue{entry_margin, true});
   engine_->LogBalance();
 
   return true;
@@ -1903,10 +1914,8 @@ void OrderHandler::ExecuteExit(const shared_ptr<Order>& exit_order,
   engine_->DecreaseWalletBalance(exit_fee);
 
   // 수수료 차감 로그
-  LogFormattedInfo(INFO_L,
-                   format("{} [{}] 청산 수수료 [{}] 차감", order_type_str,
-                          exit_name, FormatDollar(exit_fee, true)),
-                   __FILE__, __LINE__);
+  LOG_SYMBOL_DEFERRED(INFO_L, "{} [{}] 청산 수수료 [{}] 차감", order_type_str,
+                      exit_name, DollarValue{exit_fee, true});
   engine_->LogBalance();
 
   // 원본 진입 찾기 (존재하면 분할 청산, 미존재하면 전량 청산)
@@ -1969,24 +1978,22 @@ void OrderHandler::ExecuteExit(const shared_ptr<Order>& exit_order,
       }
     }
 
-    LogFormattedInfo(
+    LOG_SYMBOL_DEFERRED(
         INFO_L,
-        format(
-            "[{}] 부분 청산으로 인해 잔여 마진 [{}] → [{}], 강제 청산 가격 "
-            "[{}] → [{}], 펀딩비 수령 [{}] → [{}], 펀딩비 지불 [{}] -> [{}] "
-            "조정 (진입 수량 [{}] | 부분 청산 수량 [{}] | 전체 청산 수량 [{}])",
-            entry_name, FormatDollar(left_margin, true),
-            FormatDollar(adjusted_margin, true),
-            ToFixedString(liquidation_price, price_precision),
-            ToFixedString(adjusted_liquidation_price, price_precision),
-            FormatDollar(received_funding_amount, true),
-            FormatDollar(adjusted_received_funding_amount, true),
-            FormatDollar(paid_funding_amount, true),
-            FormatDollar(adjusted_paid_funding_amount, true),
-            ToFixedString(entry_filled_size, qty_precision),
-            ToFixedString(exit_filled_size, qty_precision),
-            ToFixedString(total_exit_filled_size, qty_precision)),
-        __FILE__, __LINE__);
+        "[{}] 부분 청산으로 인해 잔여 마진 [{}] → [{}], 강제 청산 가격 "
+        "[{}] → [{}], 펀딩비 수령 [{}] → [{}], 펀딩비 지불 [{}] -> [{}] "
+        "조정 (진입 수량 [{}] | 부분 청산 수량 [{}] | 전체 청산 수량 [{}])",
+        entry_name, DollarValue{left_margin, true},
+        DollarValue{adjusted_margin, true},
+        FixedValue{liquidation_price, price_precision},
+        FixedValue{adjusted_liquidation_price, price_precision},
+        DollarValue{received_funding_amount, true},
+        DollarValue{adjusted_received_funding_amount, true},
+        DollarValue{paid_funding_amount, true},
+        DollarValue{adjusted_paid_funding_amount, true},
+        FixedValue{entry_filled_size, qty_precision},
+        FixedValue{exit_filled_size, qty_precision},
+        FixedValue{total_exit_filled_size, qty_precision});
 
     // 명목 가치가 감소했는데 레버리지 구간에 의한 현재 레버리지 조정을 하지
     // 않는 이유는, 명목 가치가 감소할수록 레버리지 구간에서 최대 레버리지가
@@ -2023,18 +2030,26 @@ void OrderHandler::ExecuteExit(const shared_ptr<Order>& exit_order,
     engine_->DecreaseWalletBalance(fabs(realized_pnl));
   }
 
-  LogFormattedInfo(
-      IsEqual(exit_order->GetLiquidationFee(), 0.0) ? INFO_L : ERROR_L,
-      format("{} [{}] 체결 ({} [{}] | 체결가 {} | 체결량 {} | 마진 {} | "
-             "손익 {} | 실손익 {})",
-             order_type_str, exit_name,
-             Order::OrderTypeToString(exit_order->GetEntryOrderType()),
-             entry_name, ToFixedString(exit_filled_price, price_precision),
-             ToFixedString(exit_filled_size, qty_precision),
-             FormatDollar(left_margin, true),
-             FormatDollar(calculated_pnl, true),
-             FormatDollar(realized_pnl, true)),
-      __FILE__, __LINE__);
+  // 로그 레벨마다 호출 지점 정보가 정적으로 생성되므로 레벨별로 분기
+#define LOG_EXIT_FILLED(log_level)                                           \
+  LOG_SYMBOL_DEFERRED(                                                       \
+      log_level,                                                             \
+      "{} [{}] 체결 ({} [{}] | 체결가 {} | 체결량 {} | 마진 {} | 손익 {} | " \
+      "실손익 {})",                                                          \
+      order_type_str, exit_name,                                             \
+      Order::OrderTypeToString(exit_order->GetEntryOrderType()), entry_name, \
+      FixedValue{exit_filled_price, price_precision},                        \
+      FixedValue{exit_filled_size, qty_precision},                           \
+      DollarValue{left_margin, true}, DollarValue{calculated_pnl, true},     \
+      DollarValue{realized_pnl, true})
+
+  if (IsEqual(exit_order->GetLiquidationFee(), 0.0)) {
+    LOG_EXIT_FILLED(INFO_L);
+  } else {
+    LOG_EXIT_FILLED(ERROR_L);
+  }
+
+#undef LOG_EXIT_FILLED
   engine_->LogBalance();
 
   // 강제 청산이고 파산 포지션이 아니라면 강제 청산 수수료 부과.
@@ -2059,15 +2074,13 @@ void OrderHandler::ExecuteExit(const shared_ptr<Order>& exit_order,
       exit_order->SetLiquidationFee(real_liquidation_fee);
       engine_->DecreaseWalletBalance(real_liquidation_fee);
 
-      LogFormattedInfo(
+      LOG_SYMBOL_DEFERRED(
           ERROR_L,
-          format(
-              "[{}] 강제 청산 수수료 [{}] 차감 (계산된 강제 청산 수수료 {} | "
-              "청산 후 잔여 마진 {})",
-              entry_name, FormatDollar(real_liquidation_fee, true),
-              FormatDollar(liquidation_fee, true),
-              FormatDollar(left_margin_after_exit, true)),
-          __FILE__, __LINE__);
+          "[{}] 강제 청산 수수료 [{}] 차감 (계산된 강제 청산 수수료 {} | "
+          "청산 후 잔여 마진 {})",
+          entry_name, DollarValue{real_liquidation_fee, true},
+          DollarValue{liquidation_fee, true},
+          DollarValue{left_margin_after_exit, true});
       engine_->LogBalance();
     } else {
       exit_order->SetLiquidationFee(0);
@@ -2209,15 +2222,14 @@ void OrderHandler::FillPendingMarketEntry(const shared_ptr<Order>& market_entry,
                                           const double fill_price,
                                           const PriceType price_type) {
   const auto& entry_name = market_entry->GetEntryName();
-  warn_msg = format("{} [{}] 체결 실패",
-                    Order::OrderTypeToString(market_entry->GetEntryOrderType()),
-                    entry_name);
 
   // 진입 대기 주문에서 삭제
   erase(pending_entries_[symbol_idx], market_entry);
 
   // 해당 진입 이름으로 체결된 주문이 없는지 확인
-  RET_IF_INVALID(IsValidEntryName(entry_name, symbol_idx))
+  RET_IF_FILL_INVALID(
+      IsValidEntryName(entry_name, symbol_idx),
+      Order::OrderTypeToString(market_entry->GetEntryOrderType()), entry_name)
 
   // 현재 바 시간 로딩
   const auto current_open_time = engine_->GetCurrentOpenTime();
@@ -2252,7 +2264,6 @@ void OrderHandler::FillPendingLimitEntry(const shared_ptr<Order>& limit_entry,
   const auto& entry_name = limit_entry->GetEntryName();
   const auto order_type_str =
       Order::OrderTypeToString(limit_entry->GetEntryOrderType());
-  warn_msg = format("{} [{}] 체결 실패", order_type_str, entry_name);
 
   // 진입 대기 주문에서 삭제
   erase(pending_entries_[symbol_idx], limit_entry);
@@ -2261,10 +2272,11 @@ void OrderHandler::FillPendingLimitEntry(const shared_ptr<Order>& limit_entry,
   if (const auto& warn = IsValidEntryName(entry_name, symbol_idx)) {
     // 중복된 진입 이름이 존재하면 체결 실패
     // 사용한 마진(예약 증거금) 감소
-    LogFormattedInfo(WARN_L, *warn, __FILE__, __LINE__);
+    LOG_SYMBOL_DEFERRED(WARN_L, "{}", *warn);
     engine_->DecreaseUsedMargin(limit_entry->GetEntryMargin());
 
-    WARN_AND_RET()
+    LOG_FILL_FAILED(order_type_str, entry_name);
+    return;
   }
 
   // 주문 정보 로딩
@@ -2299,10 +2311,11 @@ void OrderHandler::FillPendingLimitEntry(const shared_ptr<Order>& limit_entry,
           limit_entry->GetLeverage(), symbol_idx)) {
     // 레버리지 변경이 실패하면 체결 실패
     // 사용한 마진(예약 증거금) 감소
-    LogFormattedInfo(WARN_L, *warn, __FILE__, __LINE__);
+    LOG_SYMBOL_DEFERRED(WARN_L, "{}", *warn);
     engine_->DecreaseUsedMargin(limit_entry->GetEntryMargin());
 
-    WARN_AND_RET()
+    LOG_FILL_FAILED(order_type_str, entry_name);
+    return;
   }
 
   // 현재 미실현 손실을 반영한 지정가 진입 마진 재계산
@@ -2319,18 +2332,18 @@ void OrderHandler::FillPendingLimitEntry(const shared_ptr<Order>& limit_entry,
                                 entry_filled_size, entry_margin, symbol_idx));
 
   // 진입 가능 여부 체크 (사용 가능 자금 >= 지정가 진입 마진 + 진입 수수료)
-  RET_IF_INVALID(HasEnoughBalance(
-      engine_->GetAvailableBalance(), entry_margin + entry_fee, "사용 가능",
-      format("{} 진입 마진 및 수수료", order_type_str)))
+  RET_IF_FILL_INVALID(
+      HasEnoughBalance(engine_->GetAvailableBalance(), entry_margin + entry_fee,
+                       "사용 가능",
+                       format("{} 진입 마진 및 수수료", order_type_str)),
+      order_type_str, entry_name)
 
   // 지갑 자금에서 진입 수수료 차감
   engine_->DecreaseWalletBalance(entry_fee);
 
   // 수수료 차감 로그
-  LogFormattedInfo(INFO_L,
-                   format("{} [{}] 진입 수수료 [{}] 차감", order_type_str,
-                          entry_name, FormatDollar(entry_fee, true)),
-                   __FILE__, __LINE__);
+  LOG_SYMBOL_DEFERRED(INFO_L, "{} [{}] 진입 수수료 [{}] 차감", order_type_str,
+                      entry_name, DollarValue{entry_fee, true});
   engine_->LogBalance();
 
   // 사용한 마진에 지정가 진입 마진 증가
@@ -2345,15 +2358,12 @@ void OrderHandler::FillPendingLimitEntry(const shared_ptr<Order>& limit_entry,
   filled_entries_[symbol_idx].push_back(limit_entry);
 
   const auto& symbol_info = symbol_info_[symbol_idx];
-  LogFormattedInfo(
-      INFO_L,
-      format(
-          "{} [{}] 체결 (체결가 {} | 체결량 {} | 진입 마진 {})", order_type_str,
-          entry_name,
-          ToFixedString(slippage_filled_price, symbol_info.GetPricePrecision()),
-          ToFixedString(entry_filled_size, symbol_info.GetQtyPrecision()),
-          FormatDollar(entry_margin, true)),
-      __FILE__, __LINE__);
+  LOG_SYMBOL_DEFERRED(
+      INFO_L, "{} [{}] 체결 (체결가 {} | 체결량 {} | 진입 마진 {})",
+      order_type_str, entry_name,
+      FixedValue{slippage_filled_price, symbol_info.GetPricePrecision()},
+      FixedValue{entry_filled_size, symbol_info.GetQtyPrecision()},
+      DollarValue{entry_margin, true});
   engine_->LogBalance();
 }
 
@@ -2376,7 +2386,7 @@ bool OrderHandler::OrderPendingLitEntry(const shared_ptr<Order>& lit_entry,
   if (const auto& warn =
           HasEnoughBalance(engine_->GetAvailableBalance(), entry_margin,
                            "사용 가능", "LIT 주문 마진")) {
-    LogFormattedInfo(WARN_L, *warn, __FILE__, __LINE__);
+    LOG_SYMBOL_DEFERRED(WARN_L, "{}", *warn);
 
     // 참조로 받으므로 객체 삭제 시 이름 로딩 불가하므로 미리 로딩
     const auto& entry_name = lit_entry->GetEntryName();
@@ -2384,9 +2394,8 @@ bool OrderHandler::OrderPendingLitEntry(const shared_ptr<Order>& lit_entry,
     // 주문 실패 시 대기 주문에서 삭제
     pending_entries.erase(pending_entries.begin() + order_idx);
 
-    LogFormattedInfo(
-        WARN_L, format("LIT [{}] 주문 취소 (사용 가능 자금 부족)", entry_name),
-        __FILE__, __LINE__);
+    LOG_SYMBOL_DEFERRED(WARN_L, "LIT [{}] 주문 취소 (사용 가능 자금 부족)",
+                        entry_name);
 
     // CheckPendingEntries에서 주문 순회 시 order_idx를 무조건 증가시키는데,
     // 이 주문이 삭제되면 주문을 하나 건너뛰게 되므로 1을 감소시켜 인덱스를 유지
@@ -2399,13 +2408,11 @@ bool OrderHandler::OrderPendingLitEntry(const shared_ptr<Order>& lit_entry,
   engine_->IncreaseUsedMargin(entry_margin);
 
   const auto& symbol_info = symbol_info_[symbol_idx];
-  LogFormattedInfo(
-      INFO_L,
-      format("터치로 인해 LIT [{}] 대기 주문 (주문가 {} | 주문량 {})",
-             lit_entry->GetEntryName(),
-             ToFixedString(order_price, symbol_info.GetPricePrecision()),
-             ToFixedString(order_size, symbol_info.GetQtyPrecision())),
-      __FILE__, __LINE__);
+  LOG_SYMBOL_DEFERRED(INFO_L,
+                      "터치로 인해 LIT [{}] 대기 주문 (주문가 {} | 주문량 {})",
+                      lit_entry->GetEntryName(),
+                      FixedValue{order_price, symbol_info.GetPricePrecision()},
+                      FixedValue{order_size, symbol_info.GetQtyPrecision()});
   engine_->LogBalance();
 
   return true;
@@ -0,0 +1,340 @@
+// 표준 라이브러리
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define PROFILER_USE_RDTSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define PROFILER_USE_RDTSC 1
+#else
+#define PROFILER_USE_RDTSC 0
+#endif
+
+// 파일 헤더
+#include "Engines/Profiler.hpp"
+
+// 내부 헤더
+#include "Engines/Logger.hpp"
+
+// 네임 스페이스
+using namespace backtesting::logger;
+
+namespace backtesting::profiler {
+
+namespace {
+
+/// 구간 하나의 누적 통계
+struct SiteStats {
+  uint64_t calls = 0;
+  uint64_t total_ticks = 0;  // 하위 구간을 포함한 시간
+  uint64_t self_ticks = 0;   // 하위 구간을 제외한 시간
+  uint64_t max_ticks = 0;
+};
+
+/// Chrome 트레이스로 저장되는 구간 실행 한 번
+struct TraceEvent {
+  uint64_t start_ticks;
+  uint64_t end_ticks;
+  uint32_t site_id;
+};
+
+/// 스레드별 누적기. 소유 스레드만 기록하므로 락이 필요 없음
+struct ThreadProfile {
+  uint32_t thread_idx = 0;
+  array<SiteStats, Profiler::max_sites> stats{};
+  vector<TraceEvent> events;
+  uint64_t dropped_events = 0;  // 버퍼 초과로 버려진 트레이스 이벤트 수
+};
+
+// 등록된 구간 이름
+mutex sites_mutex;
+array<const char*, Profiler::max_sites> site_names{};
+atomic<uint32_t> num_sites = 0;
+
+// 스레드별 누적기 레지스트리.
+// 종료된 스레드의 누적기도 리포트 전까지 유지되도록 공유 포인터로 보관
+mutex threads_mutex;
+vector<shared_ptr<ThreadProfile>> thread_profiles;
+uint32_t next_thread_idx = 0;
+
+// 시간 보정 기준점
+uint64_t base_ticks = 0;
+chrono::steady_clock::time_point base_time;
+
+thread_local shared_ptr<ThreadProfile> thread_profile;
+thread_local ProfileScope* current_scope = nullptr;
+
+ThreadProfile& GetThreadProfile() {
+  if (!thread_profile) [[unlikely]] {
+    thread_profile = make_shared<ThreadProfile>();
+
+    lock_guard lock(threads_mutex);
+    thread_profile->thread_idx = next_thread_idx++;
+    thread_profiles.push_back(thread_profile);
+  }
+
+  return *thread_profile;
+}
+
+/// Reset 이후 틱을 나노초로 환산하는 비율을 계산하는 함수
+double CalculateNsPerTick(const uint64_t now_ticks) {
+  const auto elapsed_ns =
+      chrono::duration<double, nano>(chrono::steady_clock::now() - base_time)
+          .count();
+  const auto elapsed_ticks = static_cast<double>(now_ticks - base_ticks);
+
+  return elapsed_ticks > 0 ? elapsed_ns / elapsed_ticks : 1.0;
+}
+
+/// JSON 문자열에 들어갈 수 없는 문자를 이스케이프하는 함수
+string EscapeJson(const char* text) {
+  string escaped;
+  for (const char* c = text; *c != '\0'; ++c) {
+    if (*c == '"' || *c == '\\') {
+      escaped += '\\';
+    }
+
+    escaped += *c;
+  }
+
+  return escaped;
+}
+
+}  // namespace
+
+uint32_t Profiler::RegisterSite(const char* name) {
+  lock_guard lock(sites_mutex);
+
+  const uint32_t site_count = num_sites.load(memory_order_relaxed);
+  for (uint32_t site_id = 0; site_id < site_count; ++site_id) {
+    if (strcmp(site_names[site_id], name) == 0) {
+      return site_id;
+    }
+  }
+
+  if (site_count == max_sites) {
+    const string& msg =
+        format("프로파일링 구간은 최대 {}개까지 등록할 수 있습니다.", max_sites);
+    Logger::GetLogger()->Log(ERROR_L, msg, __FILE__, __LINE__, true);
+    throw runtime_error(msg);
+  }
+
+  site_names[site_count] = name;
+  num_sites.store(site_count + 1, memory_order_release);
+
+  return site_count;
+}
+
+void Profiler::Reset() {
+  {
+    lock_guard lock(threads_mutex);
+
+    // 종료된 스레드의 누적기는 제거하고 나머지는 초기화
+    erase_if(thread_profiles, [](const shared_ptr<ThreadProfile>& profile) {
+      return profile.use_count() == 1;
+    });
+
+    for (const auto& profile : thread_profiles) {
+      profile->stats.fill(SiteStats{});
+      profile->events.clear();
+      profile->dropped_events = 0;
+    }
+  }
+
+  base_time = chrono::steady_clock::now();
+  base_ticks = Now();
+}
+
+uint64_t Profiler::Now() {
+#if PROFILER_USE_RDTSC
+  return __rdtsc();
+#else
+  return static_cast<uint64_t>(
+      chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+double Profiler::GetElapsedMs() {
+  const uint64_t now_ticks = Now();
+
+  return static_cast<double>(now_ticks - base_ticks) *
+         CalculateNsPerTick(now_ticks) / 1'000'000.0;
+}
+
+vector<ProfileSiteStats> Profiler::CollectStats() {
+  const double ns_per_tick = CalculateNsPerTick(Now());
+  const uint32_t site_count = num_sites.load(memory_order_acquire);
+
+  // 모든 스레드의 누적기 합산
+  vector<SiteStats> merged(site_count);
+
+  {
+    lock_guard lock(threads_mutex);
+    for (const auto& profile : thread_profiles) {
+      for (uint32_t site_id = 0; site_id < site_count; ++site_id) {
+        const auto& stats = profile->stats[site_id];
+        auto& [calls, total_ticks, self_ticks, max_ticks] = merged[site_id];
+
+        calls += stats.calls;
+        total_ticks += stats.total_ticks;
+        self_ticks += stats.self_ticks;
+        max_ticks = max(max_ticks, stats.max_ticks);
+      }
+    }
+  }
+
+  const auto to_ms = [ns_per_tick](const uint64_t ticks) {
+    return static_cast<double>(ticks) * ns_per_tick / 1'000'000.0;
+  };
+
+  vector<ProfileSiteStats> site_stats;
+  for (uint32_t site_id = 0; site_id < site_count; ++site_id) {
+    if (const auto& [calls, total_ticks, self_ticks, max_ticks] =
+            merged[site_id];
+        calls != 0) {
+      site_stats.push_back({site_names[site_id], calls, to_ms(total_ticks),
+                            to_ms(self_ticks), to_ms(max_ticks) * 1000.0});
+    }
+  }
+
+  // 전체 시간이 긴 구간부터 정렬
+  ranges::sort(site_stats,
+               [](const ProfileSiteStats& lhs, const ProfileSiteStats& rhs) {
+                 return lhs.total_ms > rhs.total_ms;
+               });
+
+  return site_stats;
+}
+
+string Profiler::FormatBreakdown() {
+  const double elapsed_ms = GetElapsedMs();
+
+  string table =
+      format("프로파일링 결과 (경과 시간 {:.3f}ms)\n", elapsed_ms);
+  table += format("{:<36} {:>12} {:>12} {:>12} {:>10} {:>10} {:>7}",
+                  "Scope", "Calls", "Total(ms)", "Self(ms)", "Avg(us)",
+                  "Max(us)", "Total%");
+
+  for (const auto& [name, calls, total_ms, self_ms, max_us] : CollectStats()) {
+    table += format(
+        "\n{:<36} {:>12} {:>12.3f} {:>12.3f} {:>10.3f} {:>10.3f} {:>6.2f}%",
+        name, calls, total_ms, self_ms,
+        total_ms * 1000.0 / static_cast<double>(calls), max_us,
+        elapsed_ms > 0 ? total_ms / elapsed_ms * 100.0 : 0.0);
+  }
+
+  // 버퍼 초과로 트레이스에서 빠진 이벤트 수
+  uint64_t dropped_events = 0;
+
+  {
+    lock_guard lock(threads_mutex);
+    for (const auto& profile : thread_profiles) {
+      dropped_events += profile->dropped_events;
+    }
+  }
+
+  if (dropped_events != 0) {
+    table += format(
+        "\n트레이스 버퍼 초과로 {}개의 이벤트가 트레이스에서 "
+        "제외되었습니다. (통계에는 포함)",
+        dropped_events);
+  }
+
+  return table;
+}
+
+void Profiler::SaveTrace(const string& file_path) {
+  ofstream trace_file(file_path, ios::binary | ios::trunc);
+  if (!trace_file.is_open()) {
+    const string& msg =
+        format("프로파일링 트레이스 파일 [{}]을(를) 열 수 없습니다.", file_path);
+    Logger::GetLogger()->Log(ERROR_L, msg, __FILE__, __LINE__, true);
+    throw runtime_error(msg);
+  }
+
+  const double us_per_tick = CalculateNsPerTick(Now()) / 1000.0;
+  const uint32_t site_count = num_sites.load(memory_order_acquire);
+
+  vector<string> escaped_names(site_count);
+  for (uint32_t site_id = 0; site_id < site_count; ++site_id) {
+    escaped_names[site_id] = EscapeJson(site_names[site_id]);
+  }
+
+  // 이벤트 수가 많을 수 있으므로 JSON 라이브러리 대신 직접 기록
+  string buffer = R"({"displayTimeUnit":"ms","traceEvents":[)";
+  bool first = true;
+
+  lock_guard lock(threads_mutex);
+  for (const auto& profile : thread_profiles) {
+    buffer += format(
+        R"({}{{"name":"thread_name","ph":"M","pid":1,"tid":{},)"
+        R"("args":{{"name":"Thread {}"}}}})",
+        first ? "" : ",", profile->thread_idx, profile->thread_idx);
+    first = false;
+
+    for (const auto& [start_ticks, end_ticks, site_id] : profile->events) {
+      format_to(back_inserter(buffer),
+                R"(,{{"name":"{}","ph":"X","pid":1,"tid":{},)"
+                R"("ts":{:.3f},"dur":{:.3f}}})",
+                escaped_names[site_id], profile->thread_idx,
+                static_cast<double>(start_ticks - base_ticks) * us_per_tick,
+                static_cast<double>(end_ticks - start_ticks) * us_per_tick);
+
+      if (buffer.size() >= 1 << 20) {
+        trace_file.write(buffer.data(),
+                         static_cast<streamsize>(buffer.size()));
+        buffer.clear();
+      }
+    }
+  }
+
+  buffer += "]}";
+  trace_file.write(buffer.data(), static_cast<streamsize>(buffer.size()));
+}
+
+ProfileScope::ProfileScope(const uint32_t site_id)
+    : site_id_(site_id),
+      child_ticks_(0),
+      parent_(current_scope) {
+  current_scope = this;
+  start_ticks_ = Profiler::Now();
+}
+
+ProfileScope::~ProfileScope() {
+  const uint64_t end_ticks = Profiler::Now();
+  const uint64_t elapsed_ticks = end_ticks - start_ticks_;
+
+  auto& [thread_idx, stats, events, dropped_events] = GetThreadProfile();
+  auto& [calls, total_ticks, self_ticks, max_ticks] = stats[site_id_];
+
+  ++calls;
+  total_ticks += elapsed_ticks;
+  self_ticks += elapsed_ticks - min(child_ticks_, elapsed_ticks);
+  max_ticks = max(max_ticks, elapsed_ticks);
+
+  if (events.size() < Profiler::max_trace_events) [[likely]] {
+    events.push_back({start_ticks_, end_ticks, site_id_});
+  } else {
+    ++dropped_events;
+  }
+
+  if (parent_ != nullptr) {
+    parent_->child_ticks_ += elapsed_ticks;
+  }
+
+  current_scope = parent_;
+}
+
+}  // namespace backtesting::profiler
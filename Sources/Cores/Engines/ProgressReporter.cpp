@@ -0,0 +1,147 @@
+// 표준 라이브러리
+#include <algorithm>
+
+// 외부 라이브러리
+#include "nlohmann/json.hpp"
+
+// 파일 헤더
+#include "Engines/ProgressReporter.hpp"
+
+// 네임 스페이스
+using namespace nlohmann;
+
+namespace backtesting::engine {
+
+ProgressReporter::ProgressReporter(const chrono::milliseconds interval,
+                                   ostream& output)
+    : interval_(interval),
+      output_(output),
+      is_started_(false),
+      phase_begin_bars_(0),
+      begin_time_(0),
+      end_time_(0),
+      simulated_time_(0),
+      num_bars_(0),
+      num_trades_(0),
+      wallet_balance_(0) {}
+
+void ProgressReporter::Start(const string& job_id) {
+  const auto now = chrono::steady_clock::now();
+
+  is_started_ = true;
+  job_id_ = job_id;
+  start_time_ = now;
+  phase_start_time_ = now;
+  next_frame_time_ = now;
+
+  phase_.clear();
+  phases_ms_.clear();
+  phase_begin_bars_ = 0;
+
+  begin_time_ = 0;
+  end_time_ = 0;
+  simulated_time_ = 0;
+  num_bars_ = 0;
+  num_trades_ = 0;
+  wallet_balance_ = 0;
+}
+
+void ProgressReporter::BeginPhase(const string& phase) {
+  if (!is_started_) {
+    return;
+  }
+
+  const auto now = chrono::steady_clock::now();
+  EndPhase(now);
+
+  phase_ = phase;
+  phase_start_time_ = now;
+  phase_begin_bars_ = num_bars_;
+
+  Emit(now, false);
+}
+
+void ProgressReporter::SetTimeRange(const int64_t begin_time,
+                                    const int64_t end_time) {
+  begin_time_ = begin_time;
+  end_time_ = end_time;
+}
+
+void ProgressReporter::Finish() {
+  if (!is_started_) {
+    return;
+  }
+
+  const auto now = chrono::steady_clock::now();
+  EndPhase(now);
+
+  Emit(now, true);
+  is_started_ = false;
+}
+
+bool ProgressReporter::IsStarted() const { return is_started_; }
+
+void ProgressReporter::Emit(const chrono::steady_clock::time_point now,
+                            const bool done) {
+  const auto to_ms = [](const chrono::steady_clock::duration duration) {
+    return chrono::duration_cast<chrono::milliseconds>(duration).count();
+  };
+
+  const int64_t phase_elapsed_ms = to_ms(now - phase_start_time_);
+
+  // 기간이 설정되었을 때만 진행률과 남은 예상 시간을 계산
+  double progress = 0;
+  json eta_ms = nullptr;
+  if (end_time_ > begin_time_) {
+    progress = clamp(static_cast<double>(simulated_time_ - begin_time_) /
+                         static_cast<double>(end_time_ - begin_time_),
+                     0.0, 1.0);
+
+    if (progress > 0 && !done) {
+      eta_ms = static_cast<int64_t>(static_cast<double>(phase_elapsed_ms) *
+                                    (1 - progress) / progress);
+    }
+  }
+
+  const size_t phase_bars = num_bars_ - phase_begin_bars_;
+  const double bars_per_second =
+      phase_elapsed_ms > 0 ? static_cast<double>(phase_bars) * 1000 /
+                                 static_cast<double>(phase_elapsed_ms)
+                           : 0;
+
+  ordered_json phases_ms = ordered_json::object();
+  for (const auto& [phase, elapsed_ms] : phases_ms_) {
+    phases_ms[phase] = elapsed_ms;
+  }
+
+  const ordered_json frame = {{"jobId", job_id_},
+                              {"phase", phase_},
+                              {"elapsedMs", to_ms(now - start_time_)},
+                              {"simulatedTime", simulated_time_},
+                              {"progress", progress},
+                              {"bars", num_bars_},
+                              {"barsPerSecond", bars_per_second},
+                              {"trades", num_trades_},
+                              {"walletBalance", wallet_balance_},
+                              {"etaMs", eta_ms},
+                              {"phasesMs", phases_ms},
+                              {"done", done}};
+
+  // 다른 출력과 섞이지 않도록 한 줄을 한 번에 출력
+  output_ << "진행 상황" + frame.dump() + "\n" << flush;
+
+  next_frame_time_ = now + interval_;
+}
+
+void ProgressReporter::EndPhase(const chrono::steady_clock::time_point now) {
+  if (phase_.empty()) {
+    return;
+  }
+
+  phases_ms_.emplace_back(
+      phase_,
+      chrono::duration_cast<chrono::milliseconds>(now - phase_start_time_)
+          .count());
+}
+
+}  // namespace backtesting::engine
@@ -0,0 +1,179 @@
+// 표준 라이브러리
+#include <algorithm>
+#include <utility>
+
+// 파일 헤더
+#include "Engines/ServerJobQueue.hpp"
+
+namespace backtesting::main {
+
+ServerJobQueue::ServerJobQueue(const size_t capacity, Handler handler,
+                               StatusCallback status_callback)
+    : capacity_(capacity),
+      handler_(std::move(handler)),
+      status_callback_(std::move(status_callback)),
+      is_stopping_(false) {
+  worker_ = thread(&ServerJobQueue::WorkerLoop, this);
+}
+
+ServerJobQueue::~ServerJobQueue() { Shutdown(); }
+
+bool ServerJobQueue::Submit(const string& id, const ServerJobType type,
+                            string payload) {
+  lock_guard lock(mutex_);
+
+  ServerJob job{id, type, std::move(payload), make_shared<atomic<bool>>(false)};
+
+  // 같은 아이디가 대기 또는 실행 중이면 취소 대상이 모호해지므로 거부
+  const bool is_duplicate =
+      (running_job_ != nullptr && running_job_->id == id) ||
+      ranges::any_of(queue_, [&id](const auto& queued_job) {
+        return queued_job.id == id;
+      });
+
+  if (is_stopping_ || is_duplicate || queue_.size() >= capacity_) {
+    status_callback_(job, ServerJobStatus::REJECTED);
+    return false;
+  }
+
+  queue_.push_back(std::move(job));
+  status_callback_(queue_.back(), ServerJobStatus::QUEUED);
+
+  cv_.notify_one();
+
+  return true;
+}
+
+bool ServerJobQueue::Cancel(const string& id) {
+  lock_guard lock(mutex_);
+
+  // 실행 중인 작업은 토큰만 설정하고 상태는 작업이 끝날 때 보고
+  if (running_job_ != nullptr && running_job_->id == id) {
+    running_job_->cancel_requested->store(true);
+    return true;
+  }
+
+  const auto it = ranges::find_if(
+      queue_, [&id](const auto& queued_job) { return queued_job.id == id; });
+
+  if (it == queue_.end()) {
+    return false;
+  }
+
+  it->cancel_requested->store(true);
+  status_callback_(*it, ServerJobStatus::CANCELLED);
+  queue_.erase(it);
+
+  return true;
+}
+
+void ServerJobQueue::CancelAll() {
+  lock_guard lock(mutex_);
+
+  if (running_job_ != nullptr) {
+    running_job_->cancel_requested->store(true);
+  }
+
+  for (const auto& queued_job : queue_) {
+    queued_job.cancel_requested->store(true);
+    status_callback_(queued_job, ServerJobStatus::CANCELLED);
+  }
+
+  queue_.clear();
+}
+
+void ServerJobQueue::Shutdown() {
+  {
+    lock_guard lock(mutex_);
+    is_stopping_ = true;
+  }
+
+  CancelAll();
+  cv_.notify_all();
+
+  if (worker_.joinable()) {
+    worker_.join();
+  }
+}
+
+size_t ServerJobQueue::GetNumQueued() const {
+  lock_guard lock(mutex_);
+  return queue_.size();
+}
+
+string ServerJobQueue::GetRunningJobId() const {
+  lock_guard lock(mutex_);
+  return running_job_ != nullptr ? running_job_->id : "";
+}
+
+void ServerJobQueue::WorkerLoop() {
+  while (true) {
+    {
+      unique_lock lock(mutex_);
+      cv_.wait(lock, [this] { return is_stopping_ || !queue_.empty(); });
+
+      if (queue_.empty()) {
+        return;
+      }
+
+      running_job_ = make_unique<ServerJob>(std::move(queue_.front()));
+      queue_.pop_front();
+
+      status_callback_(*running_job_, ServerJobStatus::RUNNING);
+    }
+
+    // 취소 및 조회가 실행 중 작업에 접근할 수 있도록 잠금 없이 실행
+    ServerJobStatus status;
+    try {
+      handler_(*running_job_);
+
+      status = running_job_->cancel_requested->load()
+                   ? ServerJobStatus::CANCELLED
+                   : ServerJobStatus::COMPLETED;
+    } catch (...) {
+      status = ServerJobStatus::FAILED;
+    }
+
+    lock_guard lock(mutex_);
+    status_callback_(*running_job_, status);
+    running_job_.reset();
+  }
+}
+
+string ServerJobTypeToString(const ServerJobType type) {
+  switch (type) {
+    case ServerJobType::RUN_SINGLE_BACKTESTING:
+      return "runSingleBacktesting";
+
+    case ServerJobType::FETCH_OR_UPDATE_BAR_DATA:
+      return "fetchOrUpdateBarData";
+  }
+
+  return "unknown";
+}
+
+string ServerJobStatusToString(const ServerJobStatus status) {
+  switch (status) {
+    case ServerJobStatus::QUEUED:
+      return "queued";
+
+    case ServerJobStatus::RUNNING:
+      return "running";
+
+    case ServerJobStatus::COMPLETED:
+      return "completed";
+
+    case ServerJobStatus::FAILED:
+      return "failed";
+
+    case ServerJobStatus::CANCELLED:
+      return "cancelled";
+
+    case ServerJobStatus::REJECTED:
+      return "rejected";
+  }
+
+  return "unknown";
+}
+
+}  // namespace backtesting::main
@@ -28,9 +28,11 @@ int64_t GetCurrentUtcTimestamp() {
 
 // 최적화된 현재 시간 포맷팅 함수 (로그용)
 size_t FormatCurrentTimeFast(char* buffer) {
-  const auto now = system_clock::now();
-  const time_t now_time_t = system_clock::to_time_t(now);
+  return FormatTimeFast(buffer, system_clock::to_time_t(system_clock::now()));
+}
 
+// 최적화된 지정 시간 포맷팅 함수 (지연 포맷팅 로그용)
+size_t FormatTimeFast(char* buffer, const time_t now_time_t) {
   // 1초 단위로 캐싱
   if (now_time_t == last_cached_second) {
     // 캐시된 시간 복사
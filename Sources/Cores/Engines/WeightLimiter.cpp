@@ -0,0 +1,178 @@
+// 표준 라이브러리
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <format>
+#include <stdexcept>
+#include <thread>
+
+// 파일 헤더
+#include "Engines/WeightLimiter.hpp"
+
+namespace backtesting::fetcher {
+
+namespace {
+
+/**
+ * 헤더 문자열에서 이름이 주어진 이름과 같은 마지막 헤더의 정수 값을
+ * 반환하는 함수. 이름은 대소문자를 구분하지 않으며, 없으면 -1을 반환.
+ * match_prefix가 true이면 이름이 주어진 이름으로 시작하는 헤더를 찾음.
+ *
+ * 리다이렉트로 헤더 묶음이 여러 개이면 마지막 응답의 값을 사용하기 위해
+ * 마지막 헤더를 반환함
+ */
+int64_t FindHeaderValue(const string& response_header, const string& name,
+                        const bool match_prefix) {
+  int64_t value = -1;
+
+  size_t line_begin = 0;
+  while (line_begin < response_header.size()) {
+    size_t line_end = response_header.find('\n', line_begin);
+    if (line_end == string::npos) {
+      line_end = response_header.size();
+    }
+
+    // 이름 길이가 다르면 Retry-After-Extra 같은 다른 헤더이므로 제외
+    const size_t colon = response_header.find(':', line_begin);
+    if (const size_t name_size = colon - line_begin;
+        colon < line_end &&
+        (match_prefix ? name_size >= name.size()
+                      : name_size == name.size()) &&
+        equal(name.begin(), name.end(),
+              response_header.begin() + static_cast<ptrdiff_t>(line_begin),
+              [](const char lhs, const char rhs) {
+                return tolower(static_cast<unsigned char>(lhs)) ==
+                       tolower(static_cast<unsigned char>(rhs));
+              })) {
+      size_t digit = colon + 1;
+      while (digit < line_end &&
+             isspace(static_cast<unsigned char>(response_header[digit]))) {
+        digit++;
+      }
+
+      if (digit < line_end &&
+          isdigit(static_cast<unsigned char>(response_header[digit]))) {
+        value = 0;
+        while (digit < line_end &&
+               isdigit(static_cast<unsigned char>(response_header[digit]))) {
+          value = value * 10 + (response_header[digit++] - '0');
+        }
+      }
+    }
+
+    line_begin = line_end + 1;
+  }
+
+  return value;
+}
+
+}  // namespace
+
+WeightLimiter::WeightLimiter(const int64_t weight_limit,
+                             const double target_ratio, const int64_t window,
+                             const int64_t window_margin)
+    : budget_(max<int64_t>(
+          1, static_cast<int64_t>(static_cast<double>(weight_limit) *
+                                  clamp(target_ratio, 0.0, 1.0)))),
+      window_(max<int64_t>(window, 1)),
+      window_margin_(max<int64_t>(window_margin, 0)),
+      window_idx_(-1),
+      used_weight_(0),
+      blocked_until_(0) {}
+
+void WeightLimiter::Acquire(const int64_t weight) {
+  while (const int64_t wait_time = TryAcquire(weight, GetNow())) {
+    this_thread::sleep_for(chrono::milliseconds(wait_time));
+  }
+}
+
+int64_t WeightLimiter::TryAcquire(const int64_t weight, const int64_t now) {
+  if (weight > budget_) {
+    throw runtime_error(format("요청 Weight({})가 창당 예산({})을 초과합니다.",
+                               weight, budget_));
+  }
+
+  lock_guard lock(mutex_);
+
+  if (now < blocked_until_) {
+    return blocked_until_ - now;
+  }
+
+  // 차단이 끝나면 서버의 사용 weight도 초기화되었으므로 새로 셈
+  if (blocked_until_ != 0) {
+    blocked_until_ = 0;
+    used_weight_ = 0;
+  }
+
+  RollWindow(now);
+
+  if (weight <= 0 || used_weight_ + weight <= budget_) {
+    used_weight_ += max<int64_t>(weight, 0);
+    return 0;
+  }
+
+  // 예산이 모자라면 다음 창이 시작될 때까지 기다림
+  return max<int64_t>(1, (window_idx_ + 1) * window_ + window_margin_ - now);
+}
+
+void WeightLimiter::OnResponse(const long response_code,
+                               const string& response_header,
+                               const int64_t request_time, const int64_t now) {
+  lock_guard lock(mutex_);
+  RollWindow(now);
+
+  if (response_code == 429 || response_code == 418) {
+    // Retry-After가 없으면 다음 창까지 멈춤
+    const int64_t retry_after = ParseRetryAfter(response_header);
+    const int64_t resume_time =
+        retry_after >= 0 ? now + retry_after * 1000
+                         : (window_idx_ + 1) * window_ + window_margin_;
+
+    blocked_until_ = max(blocked_until_, resume_time);
+    used_weight_ = max(used_weight_, budget_);
+
+    return;
+  }
+
+  if (GetWindowIndex(request_time) != window_idx_) {
+    return;
+  }
+
+  // 서버 값이 더 크면 같은 IP의 다른 요청이 사용한 weight가 있는 것
+  used_weight_ = max(used_weight_, ParseUsedWeight(response_header));
+}
+
+int64_t WeightLimiter::GetUsedWeight() const {
+  lock_guard lock(mutex_);
+  return used_weight_;
+}
+
+int64_t WeightLimiter::GetBudget() const { return budget_; }
+
+int64_t WeightLimiter::ParseUsedWeight(const string& response_header) {
+  return FindHeaderValue(response_header, "X-MBX-USED-WEIGHT-", true);
+}
+
+int64_t WeightLimiter::ParseRetryAfter(const string& response_header) {
+  return FindHeaderValue(response_header, "Retry-After", false);
+}
+
+int64_t WeightLimiter::GetNow() {
+  return chrono::duration_cast<chrono::milliseconds>(
+             chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+int64_t WeightLimiter::GetWindowIndex(const int64_t time) const {
+  return (time - window_margin_) / window_;
+}
+
+void WeightLimiter::RollWindow(const int64_t now) {
+  if (const int64_t window_idx = GetWindowIndex(now);
+      window_idx > window_idx_) {
+    window_idx_ = window_idx;
+    used_weight_ = 0;
+  }
+}
+
+}  // namespace backtesting::fetcher
@@ -19,3 +19,10 @@ ConstantValue::ConstantValue(const string& name, const string& timeframe,
 void ConstantValue::Initialize() {}
 
 Numeric<double> ConstantValue::Calculate() { return value_; }
+
+bool ConstantValue::SaveState(IndicatorState& /*state*/) const {
+  // 상수 값만 반환하므로 기록할 상태 없음
+  return true;
+}
+
+bool ConstantValue::LoadState(IndicatorState& /*state*/) { return true; }
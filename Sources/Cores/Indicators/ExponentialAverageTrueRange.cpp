@@ -6,6 +6,7 @@
 #include "Indicators/ExponentialAverageTrueRange.hpp"
 
 // 내부 헤더
+#include "Engines/IndicatorKernels.hpp"
 #include "Engines/Logger.hpp"
 
 ExponentialAverageTrueRange::ExponentialAverageTrueRange(
@@ -43,9 +44,30 @@ void ExponentialAverageTrueRange::Initialize() {
 }
 
 Numeric<double> ExponentialAverageTrueRange::Calculate() {
-  const auto& current_bar =
-      reference_bar_->GetBar(symbol_idx_, bar_->GetCurrentBarIndex());
+  return CalculateNext(
+      reference_bar_->GetBar(symbol_idx_, bar_->GetCurrentBarIndex()));
+}
+
+bool ExponentialAverageTrueRange::CalculateBatch(const span<double> output) {
+  // True Range는 SIMD 커널로 계산하고, 이전 값에 의존하는 평활만 순차 계산
+  const auto& bars = reference_bar_->GetBars(symbol_idx_);
+  kernel::TrueRange(bars, output);
+
+  for (size_t bar_idx = 1; bar_idx < output.size(); ++bar_idx) {
+    output[bar_idx] = SmoothNext(output[bar_idx]);
+  }
+
+  // 커널은 True Range 상태를 갱신하지 않으므로 마지막 바까지 계산한 상태로
+  // 설정
+  if (!bars.empty()) {
+    prev_close_ = bars.back().close;
+    first_bar_ = false;
+  }
+
+  return true;
+}
 
+double ExponentialAverageTrueRange::CalculateNext(const Bar& current_bar) {
   const double high = current_bar.high;
   const double low = current_bar.low;
   const double close = current_bar.close;
@@ -65,6 +87,10 @@ Numeric<double> ExponentialAverageTrueRange::Calculate() {
 
   prev_close_ = close;
 
+  return SmoothNext(tr);
+}
+
+double ExponentialAverageTrueRange::SmoothNext(const double tr) {
   // period 개의 TR 값을 모아 평균을 계산하여 ATR의 초기값으로 사용
   if (!can_calculate_) {
     sum_ += tr;
@@ -83,3 +109,25 @@ Numeric<double> ExponentialAverageTrueRange::Calculate() {
   prev_atr_ = alpha_ * tr + (1.0 - alpha_) * prev_atr_;
   return prev_atr_;
 }
+
+bool ExponentialAverageTrueRange::SaveState(IndicatorState& state) const {
+  state.Write(prev_close_);
+  state.Write(first_bar_);
+  state.Write(count_);
+  state.Write(sum_);
+  state.Write(can_calculate_);
+  state.Write(prev_atr_);
+
+  return true;
+}
+
+bool ExponentialAverageTrueRange::LoadState(IndicatorState& state) {
+  state.Read(prev_close_);
+  state.Read(first_bar_);
+  state.Read(count_);
+  state.Read(sum_);
+  state.Read(can_calculate_);
+  state.Read(prev_atr_);
+
+  return true;
+}
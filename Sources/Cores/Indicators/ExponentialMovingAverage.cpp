@@ -39,8 +39,20 @@ void ExponentialMovingAverage::Initialize() {
 
 Numeric<double> ExponentialMovingAverage::Calculate() {
   // 기준 지표의 현재 값을 읽음
-  const double value = source_[0];
+  return CalculateNext(source_[0]);
+}
+
+bool ExponentialMovingAverage::CalculateBatch(const span<double> output) {
+  const auto& source = GetSeries(source_);
+
+  for (size_t bar_idx = 0; bar_idx < output.size(); ++bar_idx) {
+    output[bar_idx] = CalculateNext(source[bar_idx]);
+  }
+
+  return true;
+}
 
+double ExponentialMovingAverage::CalculateNext(const double value) {
   // 입력값이 유효하지 않으면
   // 1. 값을 누적하지 않고 NaN 반환
   // 2. 이미 계산이 가능한 상태이면 이전 EMA 값을 그대로 반환
@@ -70,3 +82,21 @@ Numeric<double> ExponentialMovingAverage::Calculate() {
   prev_ = alpha_ * value + (1.0 - alpha_) * prev_;
   return prev_;
 }
+
+bool ExponentialMovingAverage::SaveState(IndicatorState& state) const {
+  state.Write(count_);
+  state.Write(sum_);
+  state.Write(can_calculate_);
+  state.Write(prev_);
+
+  return true;
+}
+
+bool ExponentialMovingAverage::LoadState(IndicatorState& state) {
+  state.Read(count_);
+  state.Read(sum_);
+  state.Read(can_calculate_);
+  state.Read(prev_);
+
+  return true;
+}
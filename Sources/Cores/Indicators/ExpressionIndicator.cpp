@@ -0,0 +1,52 @@
+// 파일 헤더
+#include "Indicators/ExpressionIndicator.hpp"
+
+ExpressionIndicator::ExpressionIndicator(const string& name,
+                                         const string& timeframe,
+                                         const Plot& plot,
+                                         const Expression& expression)
+    : Indicator(name, timeframe, plot),
+      program_(expression),
+      sources_(expression.GetSourceIndicators()),
+      symbol_idx_(-1),
+      source_values_(sources_.size()) {}
+
+void ExpressionIndicator::Initialize() {
+  reference_bar_ = bar_->GetBarData(REFERENCE, this->GetTimeframe());
+  symbol_idx_ = bar_->GetCurrentSymbolIndex();
+
+  program_.Reset();
+}
+
+Numeric<double> ExpressionIndicator::Calculate() {
+  for (size_t source_idx = 0; source_idx < sources_.size(); ++source_idx) {
+    source_values_[source_idx] = (*sources_[source_idx])[0];
+  }
+
+  return program_.Step(
+      reference_bar_->GetBar(symbol_idx_, bar_->GetCurrentBarIndex()),
+      source_values_);
+}
+
+bool ExpressionIndicator::CalculateBatch(const span<double> output) {
+  vector<span<const double>> sources;
+  sources.reserve(sources_.size());
+
+  for (const auto* source : sources_) {
+    sources.push_back(GetSeries(*source));
+  }
+
+  program_.Evaluate(reference_bar_->GetBars(symbol_idx_), sources, output);
+
+  return true;
+}
+
+bool ExpressionIndicator::SaveState(IndicatorState& state) const {
+  program_.SaveState(state);
+
+  return true;
+}
+
+bool ExpressionIndicator::LoadState(IndicatorState& state) {
+  return program_.LoadState(state);
+}
@@ -12,3 +12,20 @@ void Low::Initialize() {
 Numeric<double> Low::Calculate() {
   return reference_bar_->GetBar(symbol_idx_, bar_->GetCurrentBarIndex()).low;
 }
+
+bool Low::CalculateBatch(const span<double> output) {
+  const auto& bars = reference_bar_->GetBars(symbol_idx_);
+
+  for (size_t bar_idx = 0; bar_idx < output.size(); ++bar_idx) {
+    output[bar_idx] = bars[bar_idx].low;
+  }
+
+  return true;
+}
+
+bool Low::SaveState(IndicatorState& /*state*/) const {
+  // 바 데이터에서 바로 값을 읽으므로 기록할 상태 없음
+  return true;
+}
+
+bool Low::LoadState(IndicatorState& /*state*/) { return true; }
@@ -1,7 +1,11 @@
+// 표준 라이브러리
+#include <algorithm>
+
 // 파일 헤더
 #include "Indicators/Lowest.hpp"
 
 // 내부 헤더
+#include "Engines/IndicatorKernels.hpp"
 #include "Engines/Logger.hpp"
 
 Lowest::Lowest(const string& name, const string& timeframe, const Plot& plot,
@@ -27,9 +31,31 @@ void Lowest::Initialize() {
   current_idx_ = 0;
 }
 
-Numeric<double> Lowest::Calculate() {
-  double value = source_[0];
+Numeric<double> Lowest::Calculate() { return CalculateNext(source_[0]); }
+
+bool Lowest::CalculateBatch(const span<double> output) {
+  const auto& source = GetSeries(source_);
+
+  // 준비 구간 이후 유효하지 않은 값이 있으면 바마다 계산하는 경로로 대체
+  if (kernel::RollingMin(source, sizet_period_, output)) {
+    // 커널은 상태를 갱신하지 않으므로 마지막 윈도우만 다시 계산하여
+    // 바마다 계산한 경우와 같은 상태로 설정
+    for (size_t bar_idx = output.size() - min(output.size(), sizet_period_);
+         bar_idx < output.size(); ++bar_idx) {
+      CalculateNext(source[bar_idx]);
+    }
 
+    return true;
+  }
+
+  for (size_t bar_idx = 0; bar_idx < output.size(); ++bar_idx) {
+    output[bar_idx] = CalculateNext(source[bar_idx]);
+  }
+
+  return true;
+}
+
+double Lowest::CalculateNext(const double value) {
   // deque는 값이 증가하는 순서로 유지 (앞에는 최솟값)
   while (!dq_.empty() && dq_.back().first >= value) {
     dq_.pop_back();
@@ -54,3 +80,46 @@ Numeric<double> Lowest::Calculate() {
   current_idx_++;
   return dq_.front().first;
 }
+
+bool Lowest::SaveState(IndicatorState& state) const {
+  // 데크는 값과 인덱스를 나눠 기록
+  vector<double> values;
+  vector<size_t> indices;
+  values.reserve(dq_.size());
+  indices.reserve(dq_.size());
+
+  for (const auto& [value, idx] : dq_) {
+    values.push_back(value);
+    indices.push_back(idx);
+  }
+
+  state.Write(count_);
+  state.Write(can_calculate_);
+  state.Write(values);
+  state.Write(indices);
+  state.Write(current_idx_);
+
+  return true;
+}
+
+bool Lowest::LoadState(IndicatorState& state) {
+  vector<double> values;
+  vector<size_t> indices;
+
+  state.Read(count_);
+  state.Read(can_calculate_);
+  state.Read(values);
+  state.Read(indices);
+  state.Read(current_idx_);
+
+  if (values.size() != indices.size()) {
+    return false;
+  }
+
+  dq_.clear();
+  for (size_t i = 0; i < values.size(); ++i) {
+    dq_.emplace_back(values[i], indices[i]);
+  }
+
+  return true;
+}
@@ -97,3 +97,29 @@ double RelativeStrengthIndex::CalculateRsi() const {
 
   return 100.0 - (100.0 / (1.0 + avg_up_ / avg_down_));
 }
+
+bool RelativeStrengthIndex::SaveState(IndicatorState& state) const {
+  state.Write(prev_source_);
+  state.Write(has_prev_source_);
+  state.Write(count_);
+  state.Write(sum_up_);
+  state.Write(sum_down_);
+  state.Write(avg_up_);
+  state.Write(avg_down_);
+  state.Write(can_calculate_);
+
+  return true;
+}
+
+bool RelativeStrengthIndex::LoadState(IndicatorState& state) {
+  state.Read(prev_source_);
+  state.Read(has_prev_source_);
+  state.Read(count_);
+  state.Read(sum_up_);
+  state.Read(sum_down_);
+  state.Read(avg_up_);
+  state.Read(avg_down_);
+  state.Read(can_calculate_);
+
+  return true;
+}
@@ -6,6 +6,7 @@
 #include "Indicators/SimpleAverageTrueRange.hpp"
 
 // 내부 헤더
+#include "Engines/IndicatorKernels.hpp"
 #include "Engines/Logger.hpp"
 
 SimpleAverageTrueRange::SimpleAverageTrueRange(const string& name,
@@ -46,9 +47,39 @@ void SimpleAverageTrueRange::Initialize() {
 }
 
 Numeric<double> SimpleAverageTrueRange::Calculate() {
-  const auto& current_bar =
-      reference_bar_->GetBar(symbol_idx_, bar_->GetCurrentBarIndex());
+  return CalculateNext(
+      reference_bar_->GetBar(symbol_idx_, bar_->GetCurrentBarIndex()));
+}
+
+bool SimpleAverageTrueRange::CalculateBatch(const span<double> output) {
+  const auto& bars = reference_bar_->GetBars(symbol_idx_);
+
+  // 정수 기간이면 True Range와 이동 평균을 SIMD 커널로 계산
+  if (double_period_ == static_cast<double>(sizet_period_)) {
+    vector<double> true_range(output.size());
+    kernel::TrueRange(bars, true_range);
+
+    if (kernel::RollingMean(true_range, sizet_period_, output)) {
+      // 커널은 상태를 갱신하지 않으므로 마지막 윈도우와 직전 바만 다시
+      // 계산하여 바마다 계산한 경우와 같은 상태로 설정
+      for (size_t bar_idx =
+               output.size() - min(output.size(), sizet_period_ + 1);
+           bar_idx < output.size(); ++bar_idx) {
+        CalculateNext(bars[bar_idx]);
+      }
+
+      return true;
+    }
+  }
+
+  for (size_t bar_idx = 0; bar_idx < output.size(); ++bar_idx) {
+    output[bar_idx] = CalculateNext(bars[bar_idx]);
+  }
 
+  return true;
+}
+
+double SimpleAverageTrueRange::CalculateNext(const Bar& current_bar) {
   const double high = current_bar.high;
   const double low = current_bar.low;
   const double close = current_bar.close;
@@ -87,3 +118,27 @@ Numeric<double> SimpleAverageTrueRange::Calculate() {
 
   return sum_ / double_period_;
 }
+
+bool SimpleAverageTrueRange::SaveState(IndicatorState& state) const {
+  state.Write(prev_close_);
+  state.Write(first_bar_);
+  state.Write(count_);
+  state.Write(sum_);
+  state.Write(can_calculate_);
+  state.Write(buffer_);
+  state.Write(buffer_idx_);
+
+  return true;
+}
+
+bool SimpleAverageTrueRange::LoadState(IndicatorState& state) {
+  state.Read(prev_close_);
+  state.Read(first_bar_);
+  state.Read(count_);
+  state.Read(sum_);
+  state.Read(can_calculate_);
+  state.Read(buffer_);
+  state.Read(buffer_idx_);
+
+  return buffer_.size() == sizet_period_ && buffer_idx_ < sizet_period_;
+}
@@ -6,6 +6,7 @@
 #include "Indicators/StandardDeviation.hpp"
 
 // 내부 헤더
+#include "Engines/IndicatorKernels.hpp"
 #include "Engines/Logger.hpp"
 
 StandardDeviation::StandardDeviation(const string& name,
@@ -40,9 +41,34 @@ void StandardDeviation::Initialize() {
 }
 
 Numeric<double> StandardDeviation::Calculate() {
-  // 현재 값 읽기
-  const double value = source_[0];
+  return CalculateNext(source_[0]);
+}
+
+bool StandardDeviation::CalculateBatch(const span<double> output) {
+  const auto& source = GetSeries(source_);
+
+  // 정수 기간이면 SIMD 커널로 계산하고, 실수 기간이거나 준비 구간 이후
+  // 유효하지 않은 값이 있으면 바마다 계산하는 경로로 대체
+  if (double_period_ == static_cast<double>(sizet_period_) &&
+      kernel::RollingStandardDeviation(source, sizet_period_, output)) {
+    // 커널은 상태를 갱신하지 않으므로 마지막 윈도우만 다시 누적하여
+    // 바마다 계산한 경우와 같은 상태로 설정
+    for (size_t bar_idx = output.size() - min(output.size(), sizet_period_);
+         bar_idx < output.size(); ++bar_idx) {
+      CalculateNext(source[bar_idx]);
+    }
+
+    return true;
+  }
+
+  for (size_t bar_idx = 0; bar_idx < output.size(); ++bar_idx) {
+    output[bar_idx] = CalculateNext(source[bar_idx]);
+  }
 
+  return true;
+}
+
+double StandardDeviation::CalculateNext(const double value) {
   // 입력값이 유효하지 않으면
   // 1. 값을 누적하지 않고 NaN 반환
   // 2. 이미 계산이 가능한 상태이면 이전 표준편차값 반환
@@ -95,3 +121,25 @@ Numeric<double> StandardDeviation::Calculate() {
 
   return sqrt(var);
 }
+
+bool StandardDeviation::SaveState(IndicatorState& state) const {
+  state.Write(count_);
+  state.Write(sum_);
+  state.Write(sum_sq_);
+  state.Write(can_calc_);
+  state.Write(buffer_);
+  state.Write(buffer_idx_);
+
+  return true;
+}
+
+bool StandardDeviation::LoadState(IndicatorState& state) {
+  state.Read(count_);
+  state.Read(sum_);
+  state.Read(sum_sq_);
+  state.Read(can_calc_);
+  state.Read(buffer_);
+  state.Read(buffer_idx_);
+
+  return buffer_.size() == sizet_period_ && buffer_idx_ < sizet_period_;
+}
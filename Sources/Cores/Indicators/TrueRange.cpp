@@ -5,6 +5,9 @@
 // 파일 헤더
 #include "Indicators/TrueRange.hpp"
 
+// 내부 헤더
+#include "Engines/IndicatorKernels.hpp"
+
 TrueRange::TrueRange(const string& name, const string& timeframe,
                      const Plot& plot)
     : Indicator(name, timeframe, plot),
@@ -20,9 +23,24 @@ void TrueRange::Initialize() {
 }
 
 Numeric<double> TrueRange::Calculate() {
-  const auto& current_bar =
-      reference_bar_->GetBar(symbol_idx_, bar_->GetCurrentBarIndex());
+  return CalculateNext(
+      reference_bar_->GetBar(symbol_idx_, bar_->GetCurrentBarIndex()));
+}
+
+bool TrueRange::CalculateBatch(const span<double> output) {
+  const auto& bars = reference_bar_->GetBars(symbol_idx_);
+  kernel::TrueRange(bars, output);
+
+  // 커널은 상태를 갱신하지 않으므로 마지막 바까지 계산한 상태로 설정
+  if (!bars.empty()) {
+    prev_close_ = bars.back().close;
+    first_bar_ = false;
+  }
+
+  return true;
+}
 
+double TrueRange::CalculateNext(const Bar& current_bar) {
   const double high = current_bar.high;
   const double low = current_bar.low;
   const double close = current_bar.close;
@@ -43,3 +61,17 @@ Numeric<double> TrueRange::Calculate() {
 
   return max({hl, hc, lc});
 }
+
+bool TrueRange::SaveState(IndicatorState& state) const {
+  state.Write(prev_close_);
+  state.Write(first_bar_);
+
+  return true;
+}
+
+bool TrueRange::LoadState(IndicatorState& state) {
+  state.Read(prev_close_);
+  state.Read(first_bar_);
+
+  return true;
+}
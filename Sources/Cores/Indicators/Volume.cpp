@@ -12,3 +12,20 @@ void Volume::Initialize() {
 Numeric<double> Volume::Calculate() {
   return reference_bar_->GetBar(symbol_idx_, bar_->GetCurrentBarIndex()).volume;
 }
+
+bool Volume::CalculateBatch(const span<double> output) {
+  const auto& bars = reference_bar_->GetBars(symbol_idx_);
+
+  for (size_t bar_idx = 0; bar_idx < output.size(); ++bar_idx) {
+    output[bar_idx] = bars[bar_idx].volume;
+  }
+
+  return true;
+}
+
+bool Volume::SaveState(IndicatorState& /*state*/) const {
+  // 바 데이터에서 바로 값을 읽으므로 기록할 상태 없음
+  return true;
+}
+
+bool Volume::LoadState(IndicatorState& /*state*/) { return true; }
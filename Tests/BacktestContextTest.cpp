@@ -0,0 +1,113 @@
+// 표준 라이브러리
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+// 외부 라이브러리
+#include <gtest/gtest.h>
+
+// 내부 헤더
+#include "Engines/Analyzer.hpp"
+#include "Engines/BacktestContext.hpp"
+#include "Engines/BarHandler.hpp"
+#include "Engines/BaseEngine.hpp"
+#include "Engines/Config.hpp"
+#include "Engines/Engine.hpp"
+#include "Engines/OrderHandler.hpp"
+
+// 네임 스페이스
+using namespace std;
+using namespace backtesting::engine;
+using namespace backtesting::main;
+
+TEST(BacktestContextTest, SwapsInStateAndRestoresDefaults) {
+  const auto default_engine = Engine::GetEngine();
+  const auto default_bar_handler = BarHandler::GetBarHandler();
+  const auto default_order_handler = OrderHandler::GetOrderHandler();
+  const auto default_analyzer = Analyzer::GetAnalyzer();
+  const auto default_config = BaseEngine::GetConfig();
+
+  BacktestContext context;
+  EXPECT_FALSE(context.IsActive());
+  EXPECT_NE(context.GetEngine(), default_engine);
+  EXPECT_NE(context.GetBarHandler(), default_bar_handler);
+  EXPECT_NE(context.GetOrderHandler(), default_order_handler);
+  EXPECT_NE(context.GetAnalyzer(), default_analyzer);
+
+  {
+    const auto scope = context.Activate();
+    EXPECT_TRUE(context.IsActive());
+    EXPECT_EQ(BacktestContext::GetActiveContext(), &context);
+
+    // 싱글톤 접근이 컨텍스트의 상태를 가리킴
+    EXPECT_EQ(Engine::GetEngine(), context.GetEngine());
+    EXPECT_EQ(BarHandler::GetBarHandler(), context.GetBarHandler());
+    EXPECT_EQ(OrderHandler::GetOrderHandler(), context.GetOrderHandler());
+    EXPECT_EQ(Analyzer::GetAnalyzer(), context.GetAnalyzer());
+
+    Config::SetConfig().SetInitialBalance(12345);
+    EXPECT_NE(BaseEngine::GetConfig(), default_config);
+    EXPECT_EQ(BaseEngine::GetConfig(), context.GetConfig());
+  }
+
+  // 비활성화되면 기본 상태가 복구되고 컨텍스트는 설정을 유지함
+  EXPECT_FALSE(context.IsActive());
+  EXPECT_EQ(BacktestContext::GetActiveContext(), nullptr);
+  EXPECT_EQ(Engine::GetEngine(), default_engine);
+  EXPECT_EQ(BarHandler::GetBarHandler(), default_bar_handler);
+  EXPECT_EQ(OrderHandler::GetOrderHandler(), default_order_handler);
+  EXPECT_EQ(Analyzer::GetAnalyzer(), default_analyzer);
+  EXPECT_EQ(BaseEngine::GetConfig(), default_config);
+
+  ASSERT_NE(context.GetConfig(), nullptr);
+  EXPECT_DOUBLE_EQ(context.GetConfig()->GetInitialBalance(), 12345);
+}
+
+TEST(BacktestContextTest, RejectsNestedActivationOnSameThread) {
+  // 생성자도 컨텍스트를 활성화하므로 활성화 전에 모두 생성
+  BacktestContext outer;
+  BacktestContext inner;
+
+  const auto scope = outer.Activate();
+
+  EXPECT_THROW({ const auto nested = inner.Activate(); }, runtime_error);
+  EXPECT_THROW({ const auto nested = outer.Activate(); }, runtime_error);
+
+  // 실패한 활성화는 활성화된 상태를 바꾸지 않음
+  EXPECT_TRUE(outer.IsActive());
+  EXPECT_FALSE(inner.IsActive());
+  EXPECT_EQ(BacktestContext::GetActiveContext(), &outer);
+  EXPECT_EQ(Engine::GetEngine(), outer.GetEngine());
+}
+
+TEST(BacktestContextTest, BlocksOtherThreadUntilScopeEnds) {
+  BacktestContext first;
+  BacktestContext second;
+
+  atomic<bool> second_activated = false;
+  shared_ptr<Engine> second_thread_engine;
+  thread second_thread;
+
+  {
+    const auto scope = first.Activate();
+
+    second_thread = thread([&] {
+      const auto second_scope = second.Activate();
+      second_activated = true;
+      second_thread_engine = Engine::GetEngine();
+    });
+
+    // 앞선 컨텍스트가 활성화된 동안 다른 스레드의 활성화는 대기함
+    this_thread::sleep_for(chrono::milliseconds(100));
+    EXPECT_FALSE(second_activated);
+    EXPECT_EQ(Engine::GetEngine(), first.GetEngine());
+  }
+
+  second_thread.join();
+
+  EXPECT_TRUE(second_activated);
+  EXPECT_EQ(second_thread_engine, second.GetEngine());
+  EXPECT_EQ(BacktestContext::GetActiveContext(), nullptr);
+}
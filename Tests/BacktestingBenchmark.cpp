@@ -0,0 +1,608 @@
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#undef byte  // Windows에서 정의된 byte 매크로 제거
+#else
+#include <sys/resource.h>
+#endif
+
+// 표준 라이브러리
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// 외부 라이브러리
+#include "nlohmann/json.hpp"
+
+// 내부 헤더
+#include "Engines/Backtesting.hpp"
+#include "Engines/Profiler.hpp"
+#include "Engines/Slippage.hpp"
+#include "SyntheticMarketData.hpp"
+
+// 네임 스페이스
+using namespace std;
+using namespace backtesting;
+using namespace backtesting::logger;
+using namespace backtesting::profiler;
+using namespace backtesting::tests;
+using ordered_json = nlohmann::ordered_json;
+
+namespace {
+
+// 전략에서 접수에 성공한 주문 수와 체결 수
+int64_t num_orders = 0;
+int64_t num_fills = 0;
+
+/// 주문 접수 결과를 집계하는 함수
+void CountOrder(const bool submitted) {
+  if (submitted) {
+    ++num_orders;
+  }
+}
+
+/// 명목 가치가 일정하도록 가격에 맞춘 주문 수량을 반환하는 함수
+double GetOrderSize(const double price) {
+  return RoundToStep(1000.0 / price, 0.001);
+}
+
+// =============================================================================
+// 벤치마크 전략
+// =============================================================================
+/// 단기/장기 이동평균 교차 시 시장가로 진입 및 반전하는 전략
+class SmaCrossBenchmark final : public Strategy {
+ public:
+  explicit SmaCrossBenchmark(const string& name)
+      : Strategy(name),
+        fast_sma_(AddIndicator<SimpleMovingAverage>(
+            "fast_sma", trading_timeframe, Null(), close, 10)),
+        slow_sma_(AddIndicator<SimpleMovingAverage>(
+            "slow_sma", trading_timeframe, Null(), close, 40)) {}
+
+  void Initialize() override {}
+
+  void ExecuteOnClose() override {
+    if (fast_sma_[0] > slow_sma_[0] && fast_sma_[1] <= slow_sma_[1]) {
+      CountOrder(order->MarketEntry("SMA 매수", Direction::LONG,
+                                    GetOrderSize(close[0]), 5));
+    } else if (fast_sma_[0] < slow_sma_[0] && fast_sma_[1] >= slow_sma_[1]) {
+      CountOrder(order->MarketEntry("SMA 매도", Direction::SHORT,
+                                    GetOrderSize(close[0]), 5));
+    }
+  }
+
+  void ExecuteAfterEntry() override { ++num_fills; }
+  void ExecuteAfterExit() override { ++num_fills; }
+
+ private:
+  SimpleMovingAverage& fast_sma_;
+  SimpleMovingAverage& slow_sma_;
+};
+
+/// 지정가 진입 후 익절 지정가와 손절 MIT 청산을 동시에 거는 전략
+class BracketBenchmark final : public Strategy {
+ public:
+  explicit BracketBenchmark(const string& name) : Strategy(name) {}
+
+  void Initialize() override {}
+
+  void ExecuteOnClose() override {
+    // 포지션이 없으면 매 바마다 진입 대기 주문을 갱신
+    if (order->GetCurrentPositionSize() == 0) {
+      const double entry_price = close[0] * 0.997;
+      CountOrder(order->LimitEntry("브라켓 매수", Direction::LONG, entry_price,
+                                   GetOrderSize(entry_price), 5));
+    } else if (order->BarsSinceEntry() >= 24) {
+      CountOrder(order->MarketExit("브라켓 타임컷", "브라켓 매수", left_size));
+    }
+  }
+
+  void ExecuteAfterEntry() override {
+    ++num_fills;
+
+    const double entry_price = order->LastEntryPrice();
+    CountOrder(order->LimitExit("브라켓 익절", "브라켓 매수",
+                                entry_price * 1.015, left_size));
+    CountOrder(order->MitExit("브라켓 손절", "브라켓 매수", entry_price * 0.99,
+                              left_size));
+  }
+
+  void ExecuteAfterExit() override { ++num_fills; }
+};
+
+/// 현재가 아래로 지정가 진입 주문을 사다리 형태로 깔고,
+/// 체결된 단계마다 익절 지정가 청산을 거는 전략
+class GridBenchmark final : public Strategy {
+ public:
+  explicit GridBenchmark(const string& name) : Strategy(name) {
+    for (int level = 0; level < num_levels; ++level) {
+      entry_names_[level] = format("그리드 {}", level);
+      exit_names_[level] = format("그리드 {} 익절", level);
+    }
+  }
+
+  void Initialize() override {
+    entry_prices_.assign(bar->GetBarData(TRADING, "")->GetNumSymbols(), {});
+  }
+
+  void ExecuteOnClose() override {
+    auto& entry_prices = entry_prices_[bar->GetCurrentSymbolIndex()];
+
+    for (int level = 0; level < num_levels; ++level) {
+      if (order->HasFilledEntryOrder(entry_names_[level])) {
+        continue;
+      }
+
+      entry_prices[level] = close[0] * (1.0 - grid_step * (level + 1));
+      CountOrder(order->LimitEntry(entry_names_[level], Direction::LONG,
+                                   entry_prices[level],
+                                   GetOrderSize(entry_prices[level]), 5));
+    }
+  }
+
+  void ExecuteAfterEntry() override {
+    ++num_fills;
+
+    const auto& entry_prices = entry_prices_[bar->GetCurrentSymbolIndex()];
+
+    for (int level = 0; level < num_levels; ++level) {
+      if (order->HasFilledEntryOrder(entry_names_[level])) {
+        CountOrder(order->LimitExit(exit_names_[level], entry_names_[level],
+                                    entry_prices[level] * (1.0 + grid_step),
+                                    left_size));
+      }
+    }
+  }
+
+  void ExecuteAfterExit() override { ++num_fills; }
+
+ private:
+  static constexpr int num_levels = 5;
+  static constexpr double grid_step = 0.004;
+
+  array<string, num_levels> entry_names_;
+  array<string, num_levels> exit_names_;
+  vector<array<double, num_levels>> entry_prices_;
+};
+
+/// 상위 타임프레임 지표를 매 바마다 참조하여 추세 방향으로 진입하고
+/// ATR 기반 트레일링으로 청산하는 전략
+class HigherTimeframeBenchmark final : public Strategy {
+ public:
+  explicit HigherTimeframeBenchmark(const string& name)
+      : Strategy(name),
+        daily_close_(AddIndicator<Close>("daily_close", "1d", Null())),
+        daily_sma_(AddIndicator<SimpleMovingAverage>("daily_sma", "1d", Null(),
+                                                     daily_close_, 20)),
+        daily_atr_(AddIndicator<SimpleAverageTrueRange>("daily_atr", "1d",
+                                                        Null(), 14)),
+        ema_(AddIndicator<ExponentialMovingAverage>(
+            "ema", trading_timeframe, Null(), close, 24)) {}
+
+  void Initialize() override {}
+
+  void ExecuteOnClose() override {
+    if (order->GetCurrentPositionSize() != 0 || isnan(daily_atr_[0])) {
+      return;
+    }
+
+    if (close[0] > daily_sma_[0] && close[0] > ema_[0]) {
+      CountOrder(order->MarketEntry("추세 매수", Direction::LONG,
+                                    GetOrderSize(close[0]), 5));
+    } else if (close[0] < daily_sma_[0] && close[0] < ema_[0]) {
+      CountOrder(order->MarketEntry("추세 매도", Direction::SHORT,
+                                    GetOrderSize(close[0]), 5));
+    }
+  }
+
+  void ExecuteAfterEntry() override {
+    ++num_fills;
+
+    const double trail_point = daily_atr_[1] * 0.5;
+    if (order->GetCurrentPositionSize() > 0) {
+      CountOrder(
+          order->TrailingExit("추세 매수 청산", "추세 매수", 0, trail_point,
+                              left_size));
+    } else {
+      CountOrder(
+          order->TrailingExit("추세 매도 청산", "추세 매도", 0, trail_point,
+                              left_size));
+    }
+  }
+
+  void ExecuteAfterExit() override { ++num_fills; }
+
+ private:
+  Close& daily_close_;
+  SimpleMovingAverage& daily_sma_;
+  SimpleAverageTrueRange& daily_atr_;
+  ExponentialMovingAverage& ema_;
+};
+
+// =============================================================================
+// 벤치마크 실행
+// =============================================================================
+/// 벤치마크 설정
+struct BenchmarkOptions {
+  string scenario = "all";
+  string comparison = "relative";  // 전략의 Numeric 비교 방식
+  int indicator_threads = 1;        // 지표 계산 스레드 개수
+  SyntheticMarketConfig market;
+  string work_directory;
+  string output_path = "BacktestingBenchmark.json";
+};
+
+/// 비교 방식 이름을 ComparisonMode로 변환하는 함수
+ComparisonMode ParseComparisonMode(const string& comparison) {
+  if (comparison == "relative") {
+    return ComparisonMode::RELATIVE;
+  }
+
+  if (comparison == "absolute") {
+    return ComparisonMode::ABSOLUTE;
+  }
+
+  if (comparison == "exact") {
+    return ComparisonMode::EXACT;
+  }
+
+  throw invalid_argument(
+      format("알 수 없는 비교 방식 [{}]입니다.", comparison));
+}
+
+/// 시나리오 이름과 전략 추가 함수
+struct Scenario {
+  string name;
+  bool use_reference;  // 참조 바 데이터 사용 여부
+  function<void()> add_strategy;
+};
+
+const vector<Scenario>& GetScenarios() {
+  static const vector<Scenario> scenarios = {
+      {"sma_cross", false,
+       [] { Backtesting::AddStrategy<SmaCrossBenchmark>("SMA Cross"); }},
+      {"bracket", false,
+       [] { Backtesting::AddStrategy<BracketBenchmark>("Bracket"); }},
+      {"grid", false, [] { Backtesting::AddStrategy<GridBenchmark>("Grid"); }},
+      {"htf", true, [] {
+         Backtesting::AddStrategy<HigherTimeframeBenchmark>("Higher Timeframe");
+       }}};
+
+  return scenarios;
+}
+
+/// 프로세스의 최대 상주 메모리를 MB 단위로 반환하는 함수
+double GetPeakRssMb() {
+#ifdef _WIN32
+  PROCESS_MEMORY_COUNTERS counters{};
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+    return static_cast<double>(counters.PeakWorkingSetSize) / (1024 * 1024);
+  }
+
+  return 0;
+#else
+  rusage usage{};
+  getrusage(RUSAGE_SELF, &usage);
+
+  // Linux의 ru_maxrss 단위는 KB
+  return static_cast<double>(usage.ru_maxrss) / 1024;
+#endif
+}
+
+double ElapsedMs(const chrono::steady_clock::time_point start_time) {
+  return chrono::duration<double, milli>(chrono::steady_clock::now() -
+                                         start_time)
+      .count();
+}
+
+/// 시나리오 하나를 현재 프로세스에서 실행하고 결과를 반환하는 함수
+ordered_json RunScenario(const Scenario& scenario,
+                         const SyntheticMarketData& market_data,
+                         const BenchmarkOptions& options,
+                         const double generate_ms) {
+  const auto& market = market_data.GetConfig();
+  const auto& symbol_names = market_data.GetSymbolNames();
+  const bool use_magnifier = !market.magnifier_timeframe.empty();
+  const auto repository_directory =
+      filesystem::path(__FILE__).parent_path().parent_path();
+
+  // 데이터 로딩
+  const auto load_start = chrono::steady_clock::now();
+
+  Backtesting::AddExchangeInfo(market_data.GetExchangeInfoPath());
+  Backtesting::AddLeverageBracket(market_data.GetLeverageBracketPath());
+
+  Backtesting::AddBarData(symbol_names, market.trading_timeframe,
+                          market_data.GetKlinesDirectory(), TRADING);
+
+  if (use_magnifier) {
+    Backtesting::AddBarData(symbol_names, market.magnifier_timeframe,
+                            market_data.GetKlinesDirectory(), MAGNIFIER);
+  }
+
+  if (scenario.use_reference) {
+    Backtesting::AddBarData(symbol_names, market.reference_timeframe,
+                            market_data.GetKlinesDirectory(), REFERENCE);
+  }
+
+  Backtesting::AddBarData(
+      symbol_names,
+      use_magnifier ? market.magnifier_timeframe : market.trading_timeframe,
+      market_data.GetMarkPriceKlinesDirectory(), MARK_PRICE);
+
+  Backtesting::AddFundingRates(symbol_names,
+                               market_data.GetFundingRatesDirectory());
+
+  const double load_ms = ElapsedMs(load_start);
+
+  // 결과 파일은 작업 폴더에 저장하고, 지표와 전략 소스는 저장소에서 탐색
+  Backtesting::SetConfig()
+      .SetProjectDirectory(options.work_directory)
+      .SetIndicatorHeaderDirs(
+          {(repository_directory / "Includes/Indicators").string()})
+      .SetIndicatorSourceDirs(
+          {(repository_directory / "Sources/Cores/Indicators").string()})
+      .SetStrategyHeaderPath(__FILE__)
+      .SetStrategySourcePath(__FILE__)
+      .SetBacktestPeriod()
+      .SetUseBarMagnifier(use_magnifier)
+      .SetInitialBalance(1'000'000)
+      .SetTakerFeePercentage(0.045)
+      .SetMakerFeePercentage(0.018)
+      .SetSlippage(PercentageSlippage(0.01, 0))
+      .SetCheckMarketMaxQty(false)
+      .SetCheckMarketMinQty(false)
+      .SetCheckLimitMaxQty(false)
+      .SetCheckLimitMinQty(false)
+      .SetCheckMinNotionalValue(true)
+      .SetComparisonMode(ParseComparisonMode(options.comparison), 1e-9)
+      .SetIndicatorThreads(options.indicator_threads);
+
+  scenario.add_strategy();
+
+  // 백테스팅
+  const auto backtest_start = chrono::steady_clock::now();
+  Backtesting::RunBacktesting();
+  const double backtest_ms = ElapsedMs(backtest_start);
+
+  const auto num_trading_bars = market.num_symbols * market.num_trading_bars;
+  const double backtest_seconds = backtest_ms / 1000.0;
+
+  ordered_json result = {
+      {"scenario", scenario.name},
+      {"comparison", options.comparison},
+      {"indicator_threads", options.indicator_threads},
+      {"symbols", market.num_symbols},
+      {"trading_bars", num_trading_bars},
+      {"bars_per_sec",
+       static_cast<double>(num_trading_bars) / backtest_seconds},
+      {"orders", num_orders},
+      {"fills", num_fills},
+      {"orders_per_sec", static_cast<double>(num_orders) / backtest_seconds},
+      {"peak_rss_mb", GetPeakRssMb()},
+      {"phases_ms",
+       {{"generate", generate_ms},
+        {"load", load_ms},
+        {"backtest", backtest_ms}}}};
+
+  // 프로파일링 빌드에서는 엔진 내부 구간별 시간도 기록
+  ordered_json profile = ordered_json::array();
+  for (const auto& [name, calls, total_ms, self_ms, max_us] :
+       Profiler::CollectStats()) {
+    profile.push_back({{"scope", name},
+                       {"calls", calls},
+                       {"total_ms", total_ms},
+                       {"self_ms", self_ms},
+                       {"max_us", max_us}});
+  }
+
+  result["profile"] = profile;
+
+  return result;
+}
+
+/// 결과 JSON의 공통 머리를 생성하는 함수
+ordered_json MakeReport(const SyntheticMarketData& market_data) {
+  return {{"benchmark", "BacktestingBenchmark"},
+          {"created_at", GetCurrentLocalDatetime()},
+          {"profiling", BACKTESTING_ENABLE_PROFILING != 0},
+          {"market", market_data.ToJson()},
+          {"results", ordered_json::array()}};
+}
+
+/// 인자를 셸 명령어용으로 따옴표로 감싸는 함수
+string Quote(const string& arg) { return format("\"{}\"", arg); }
+
+/**
+ * 각 시나리오를 별도 프로세스로 실행하고 결과를 합치는 함수.
+ * 엔진 싱글톤 상태와 최대 상주 메모리를 시나리오마다 분리하기 위해
+ * 자기 자신을 --scenario 인자로 다시 실행함
+ */
+int RunAllScenarios(const string& executable_path,
+                    const SyntheticMarketData& market_data,
+                    const BenchmarkOptions& options) {
+  const auto& market = market_data.GetConfig();
+  ordered_json report = MakeReport(market_data);
+  int exit_code = 0;
+
+  for (const auto& scenario : GetScenarios()) {
+    const string& scenario_output =
+        format("{}/{}.json", options.work_directory, scenario.name);
+    filesystem::remove(scenario_output);
+
+    string command = format(
+        "{} --scenario {} --comparison {} --indicator-threads {} --symbols {} "
+        "--bars {} --seed {} --magnifier {} --work-dir {} --output {}",
+        Quote(executable_path), scenario.name, options.comparison,
+        options.indicator_threads, market.num_symbols,
+        market.num_trading_bars, market.seed,
+        market.magnifier_timeframe.empty() ? Quote("")
+                                           : market.magnifier_timeframe,
+        Quote(options.work_directory), Quote(scenario_output));
+
+#ifdef _WIN32
+    // cmd.exe는 명령어가 따옴표로 시작하면 바깥 따옴표를 제거하므로
+    // 한 번 더 감쌈
+    command = Quote(command);
+#endif
+
+    cout << format("[{}] 시나리오 실행 중...", scenario.name) << endl;
+
+    if (const int status = system(command.c_str()); status != 0) {
+      exit_code = 1;
+      report["results"].push_back(
+          {{"scenario", scenario.name},
+           {"error", format("종료 코드 {}", status)}});
+
+      continue;
+    }
+
+    ifstream scenario_file(scenario_output);
+    const auto& scenario_report = ordered_json::parse(scenario_file);
+    report["results"].push_back(scenario_report.at("results").at(0));
+  }
+
+  ofstream(options.output_path) << report.dump(2);
+
+  return exit_code;
+}
+
+void PrintUsage() {
+  cout << "사용법: BacktestingBenchmark [옵션]\n"
+          "  --scenario <all|sma_cross|bracket|grid|htf>  (기본값: all)\n"
+          "  --comparison <relative|absolute|exact>       (기본값: relative)\n"
+          "  --indicator-threads <지표 계산 스레드 수, 0이면 자동> (기본값: 1)\n"
+          "  --symbols <심볼 수>                          (기본값: 4)\n"
+          "  --bars <심볼당 1h 트레이딩 바 수>            (기본값: 8760)\n"
+          "  --magnifier <돋보기 타임프레임, \"\"이면 미사용> (기본값: 1m)\n"
+          "  --seed <난수 시드>                           (기본값: 42)\n"
+          "  --work-dir <데이터 및 결과 폴더>\n"
+          "  --output <결과 JSON 경로>\n";
+}
+
+}  // namespace
+
+/*
+ * 결정적인 합성 시장 데이터로 전체 엔진을 실행하는 재현 가능한 벤치마크.
+ *
+ * SMA 교차, 브라켓 주문, 그리드 사다리, 상위 타임프레임 지표 참조 전략을
+ * 실행하여 초당 처리 바 수, 초당 주문 수, 최대 상주 메모리, 단계별 시간을
+ * JSON으로 기록함. BACKTESTING_ENABLE_PROFILING 빌드에서는 엔진 내부
+ * 구간별 시간도 함께 기록됨. --comparison으로 전략의 Numeric 비교 방식을
+ * 바꿔 실행하면 비교 방식별 전략 콜백 처리량을, --indicator-threads로 지표
+ * 계산 스레드 수를 바꿔 실행하면 지표 계산 단계의 확장성을 비교할 수 있음.
+ * relative 이외의 비교 방식은 BACKTESTING_RUNTIME_COMPARISON 빌드에서만
+ * 실행할 수 있으므로, 기본 빌드의 relative 결과와 비교하면 실행 중 비교 방식
+ * 선택의 비용을 측정할 수 있음.
+ *
+ * 네트워크에 접근하지 않으며, 같은 옵션이면 같은 데이터와 같은 주문 흐름이
+ * 재현되므로 릴리즈 간 결과를 비교하여 성능 저하를 추적할 수 있음
+ */
+int main(const int argc, char* argv[]) {
+  BenchmarkOptions options;
+  options.work_directory =
+      (filesystem::temp_directory_path() / "BacktestingBenchmark").string();
+
+  for (int arg_idx = 1; arg_idx < argc; ++arg_idx) {
+    const string arg = argv[arg_idx];
+
+    if (arg == "--help" || arg == "-h") {
+      PrintUsage();
+      return 0;
+    }
+
+    if (arg_idx + 1 >= argc) {
+      PrintUsage();
+      return 1;
+    }
+
+    const string value = argv[++arg_idx];
+
+    if (arg == "--scenario") {
+      options.scenario = value;
+    } else if (arg == "--comparison") {
+      options.comparison = value;
+    } else if (arg == "--indicator-threads") {
+      options.indicator_threads = stoi(value);
+    } else if (arg == "--symbols") {
+      options.market.num_symbols = stoi(value);
+    } else if (arg == "--bars") {
+      options.market.num_trading_bars = stoll(value);
+    } else if (arg == "--magnifier") {
+      options.market.magnifier_timeframe = value;
+    } else if (arg == "--seed") {
+      options.market.seed = stoull(value);
+    } else if (arg == "--work-dir") {
+      options.work_directory = value;
+    } else if (arg == "--output") {
+      options.output_path = value;
+    } else {
+      PrintUsage();
+      return 1;
+    }
+  }
+
+  try {
+    filesystem::create_directories(options.work_directory);
+
+    // 엔진 로그와 결과는 작업 폴더에 저장하며, BackBoard 저장 및 실행을
+    // 건너뛰기 위해 서버 모드로 실행
+    Logger::SetLogDirectory(options.work_directory + "/Logs");
+    Backtesting::SetServerMode(true);
+
+    const SyntheticMarketData market_data(
+        options.market,
+        format("{}/Data/{}x{}_{}_{}", options.work_directory,
+               options.market.num_symbols, options.market.num_trading_bars,
+               options.market.magnifier_timeframe.empty()
+                   ? "nomag"
+                   : options.market.magnifier_timeframe,
+               options.market.seed));
+
+    const auto generate_start = chrono::steady_clock::now();
+    market_data.Generate();
+    const double generate_ms = ElapsedMs(generate_start);
+
+    if (options.scenario == "all") {
+      return RunAllScenarios(argv[0], market_data, options);
+    }
+
+    const auto scenario = ranges::find(GetScenarios(), options.scenario,
+                                       &Scenario::name);
+    if (scenario == GetScenarios().end()) {
+      PrintUsage();
+      return 1;
+    }
+
+    ordered_json report = MakeReport(market_data);
+    report["results"].push_back(
+        RunScenario(*scenario, market_data, options, generate_ms));
+
+    ofstream(options.output_path) << report.dump(2);
+    cout << report.dump(2) << endl;
+  } catch (const exception& e) {
+    cout << format("벤치마크 실행 중 오류가 발생했습니다: {}", e.what())
+         << endl;
+
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,120 @@
+// 표준 라이브러리
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// 내부 헤더
+#include "Engines/BinanceFetcher.hpp"
+#include "Engines/FetchScheduler.hpp"
+#include "Engines/Logger.hpp"
+#include "Engines/TimeUtils.hpp"
+#include "ExchangeSimulator.hpp"
+
+// 네임 스페이스
+using namespace std;
+using namespace backtesting::fetcher;
+using namespace backtesting::logger;
+using namespace backtesting::tests;
+
+/*
+ * 로컬 거래소 시뮬레이터에서 여러 심볼의 연속 선물 캔들스틱을 받아
+ * BinanceFetcher 요청 파이프라인의 처리량과 weight 제한기의 사용률을
+ * 측정하는 벤치마크.
+ *
+ * 사용법: BinanceFetcherBenchmark [타임프레임] [심볼 수] [심볼당 캔들 수]
+ *                                 [응답 지연 ms] [작업 스레드 수]
+ *
+ * 응답마다 지연에 최대 절반의 무작위 지연을 더함. weight 사용률은 측정
+ * 시간 동안 분당 평균 사용 weight를 시뮬레이터 한도와 비교한 값이며,
+ * 429와 418 응답 수는 한도를 넘긴 요청 수를 나타냄
+ */
+int main(const int argc, char* argv[]) {
+  const string timeframe = argc > 1 ? argv[1] : "1h";
+  const int num_symbols = argc > 2 ? max(1, atoi(argv[2])) : 4;
+  const int64_t num_candles = argc > 3 ? max(1LL, atoll(argv[3])) : 100000;
+  const int64_t latency = argc > 4 ? max(0, atoi(argv[4])) : 20;
+  const int num_workers = argc > 5 ? max(1, atoi(argv[5])) : 4;
+
+  const auto work_directory =
+      filesystem::temp_directory_path() / "BinanceFetcherBenchmark";
+  filesystem::remove_all(work_directory);
+  filesystem::create_directories(work_directory);
+
+  Logger::SetLogDirectory((work_directory / "Logs").string());
+
+  // 현재 시간까지 심볼당 num_candles개의 완성된 캔들을 제공
+  const int64_t interval = backtesting::utils::ParseTimeframe(timeframe);
+  const int64_t now = chrono::duration_cast<chrono::milliseconds>(
+                          chrono::system_clock::now().time_since_epoch())
+                          .count();
+
+  ExchangeSimulatorConfig config;
+  config.num_symbols = num_symbols;
+  config.listing_time = now / interval * interval - num_candles * interval;
+  config.latency = latency;
+  config.latency_jitter = latency / 2;
+
+  ExchangeSimulator simulator(config);
+  BinanceFetcher::SetFuturesEndpoint(simulator.GetEndpoint());
+
+  const BinanceFetcher fetcher("", "", (work_directory / "Data").string());
+
+  vector<FetchJob> jobs;
+  for (const auto& symbol_name : simulator.GetSymbolNames()) {
+    jobs.push_back({FetchJobKind::CONTINUOUS_KLINES, symbol_name, timeframe,
+                    ""});
+  }
+
+  atomic<int> num_failed = 0;
+  const auto start_time = chrono::steady_clock::now();
+
+  FetchScheduler(num_workers)
+      .Run(
+          jobs,
+          [&](const FetchJob& job) {
+            fetcher.FetchContinuousKlines(job.symbol, job.timeframe);
+          },
+          [&](const FetchJob& job, const exception_ptr&) {
+            ++num_failed;
+            cout << format("[{}] 요청이 실패했습니다.", job.symbol) << endl;
+          });
+
+  const double seconds =
+      chrono::duration<double>(chrono::steady_clock::now() - start_time)
+          .count();
+  const auto& stats = simulator.GetStats();
+
+  const double weight_per_minute =
+      static_cast<double>(stats.total_weight) / (seconds / 60.0);
+
+  cout << format(
+              "[{} x {}개 심볼, 심볼당 캔들 {}개, 지연 {}ms, 작업 {}개] "
+              "{:.3f}초 ({:.0f} 캔들/s)",
+              timeframe, num_symbols, num_candles, latency, num_workers,
+              seconds,
+              static_cast<double>(num_candles) * num_symbols / seconds)
+       << endl;
+
+  cout << format(
+              "요청 {}개 | weight {} (분당 {:.0f}, 한도 대비 {:.1f}%) | "
+              "창 최대 weight {} | 429 {}개 | 418 {}개 | 실패 작업 {}개",
+              stats.num_requests, stats.total_weight, weight_per_minute,
+              weight_per_minute / static_cast<double>(config.weight_limit) *
+                  100.0,
+              stats.max_used_weight, stats.num_throttled, stats.num_banned,
+              num_failed.load())
+       << endl;
+
+  simulator.Stop();
+  filesystem::remove_all(work_directory / "Data");
+
+  return num_failed == 0 ? 0 : 1;
+}
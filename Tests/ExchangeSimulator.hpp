@@ -0,0 +1,801 @@
+#pragma once
+
+// 표준 라이브러리
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "Ws2_32.lib")
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+// 외부 라이브러리
+#include "nlohmann/json.hpp"
+
+// 내부 헤더
+#include "Engines/TimeUtils.hpp"
+#include "SyntheticMarketData.hpp"
+
+// 네임 스페이스
+using namespace std;
+using json = nlohmann::json;
+
+namespace backtesting::tests {
+
+/// 거래소 시뮬레이터 설정
+struct ExchangeSimulatorConfig {
+  int num_symbols = 4;                   // SYN000USDT부터 제공할 심볼 수
+  int64_t listing_time = 1577836800000;  // 2020-01-01 00:00:00 UTC
+  uint16_t port = 0;                     // 0이면 빈 포트를 자동으로 사용
+
+  int64_t weight_limit = 2400;    // 한 창에서 사용할 수 있는 REQUEST_WEIGHT
+  int64_t weight_window = 60000;  // 사용 weight가 초기화되는 간격 (ms)
+  int violations_before_ban = 3;  // 418 차단 전까지 허용하는 429 응답 수
+  int64_t ban_duration = 120000;  // 418 차단 기간 (ms)
+
+  int64_t latency = 0;         // 모든 응답 전에 기다리는 시간 (ms)
+  int64_t latency_jitter = 0;  // latency에 더하는 최대 무작위 시간 (ms)
+  uint64_t seed = 42;
+};
+
+/// 시뮬레이터가 처리한 요청 통계
+struct ExchangeSimulatorStats {
+  int64_t num_requests = 0;     // 응답한 전체 요청 수
+  int64_t num_throttled = 0;    // 429 응답 수
+  int64_t num_banned = 0;       // 418 응답 수
+  int64_t total_weight = 0;     // 처리된 요청의 weight 합
+  int64_t max_used_weight = 0;  // 한 창에서 도달한 최대 사용 weight
+};
+
+/**
+ * 네트워크 없이 BinanceFetcher를 시험하기 위한 로컬 바이낸스 선물 HTTP
+ * 서버 클래스.
+ *
+ * 127.0.0.1에서 HTTP/1.1 keep-alive 연결을 받아 time, continuousKlines,
+ * markPriceKlines, fundingRate, exchangeInfo, leverageBracket 엔드 포인트를
+ * 합성 데이터로 응답함. BinanceFetcher::SetFuturesEndpoint에 GetEndpoint를
+ * 넘겨 사용함.
+ *
+ * 캔들은 listing_time부터 현재 시간까지 존재하며 마지막 캔들은 미완성임.
+ * 가격은 심볼, 타임프레임, Open Time만으로 계산하므로 요청 순서나 구간
+ * 분할과 관계없이 같은 캔들은 항상 같은 값을 가짐.
+ *
+ * 모든 응답에 X-MBX-USED-WEIGHT-1M 헤더를 붙이고, 창의 사용 weight가
+ * weight_limit를 넘는 요청은 429로 거부함. 429를 violations_before_ban번
+ * 받은 후에도 한도를 넘기면 ban_duration 동안 모든 요청을 418로 거부함.
+ * 서명과 API 키는 검사하지 않음
+ */
+class ExchangeSimulator final {
+ public:
+  explicit ExchangeSimulator(ExchangeSimulatorConfig config)
+      : config_(move(config)), stop_requested_(false) {
+    for (int symbol_idx = 0; symbol_idx < config_.num_symbols; ++symbol_idx) {
+      symbol_indices_[format("SYN{:03}USDT", symbol_idx)] = symbol_idx;
+    }
+
+#ifdef _WIN32
+    if (WSADATA wsa_data; WSAStartup(MAKEWORD(2, 2), &wsa_data) != 0) {
+      throw runtime_error("WinSock 초기화가 실패했습니다.");
+    }
+#endif
+
+    listen_socket_ = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (listen_socket_ == invalid_socket) {
+      throw runtime_error("시뮬레이터 소켓을 생성하는 데 실패했습니다.");
+    }
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(config_.port);
+
+    socklen_t address_size = sizeof(address);
+    if (bind(listen_socket_, reinterpret_cast<sockaddr*>(&address),
+             address_size) != 0 ||
+        listen(listen_socket_, SOMAXCONN) != 0 ||
+        getsockname(listen_socket_, reinterpret_cast<sockaddr*>(&address),
+                    &address_size) != 0) {
+      CloseSocket(listen_socket_);
+      throw runtime_error(
+          format("시뮬레이터를 [127.0.0.1:{}]에 여는 데 실패했습니다.",
+                 config_.port));
+    }
+
+    port_ = ntohs(address.sin_port);
+    accept_thread_ = thread([this] { Accept(); });
+  }
+
+  ~ExchangeSimulator() { Stop(); }
+
+  ExchangeSimulator(const ExchangeSimulator&) = delete;
+  ExchangeSimulator& operator=(const ExchangeSimulator&) = delete;
+
+  /// 새 연결을 받지 않고 모든 연결을 닫은 후 스레드를 정리하는 함수
+  void Stop() {
+    if (stop_requested_.exchange(true)) {
+      return;
+    }
+
+    // 대기 중인 accept와 recv를 깨움
+    ShutdownSocket(listen_socket_);
+    CloseSocket(listen_socket_);
+
+    {
+      lock_guard lock(connections_mutex_);
+      for (const auto client : clients_) {
+        ShutdownSocket(client);
+      }
+    }
+
+    accept_thread_.join();
+
+    // accept 스레드가 끝났으므로 연결 스레드 목록은 더 이상 바뀌지 않음
+    for (auto& connection : connection_threads_) {
+      connection.join();
+    }
+
+#ifdef _WIN32
+    WSACleanup();
+#endif
+  }
+
+  /// BinanceFetcher::SetFuturesEndpoint에 넘길 주소를 반환하는 함수
+  [[nodiscard]] string GetEndpoint() const {
+    return format("http://127.0.0.1:{}", port_);
+  }
+
+  /// 제공하는 심볼 이름들을 반환하는 함수
+  [[nodiscard]] vector<string> GetSymbolNames() const {
+    vector<string> symbol_names(symbol_indices_.size());
+    for (const auto& [symbol_name, symbol_idx] : symbol_indices_) {
+      symbol_names[symbol_idx] = symbol_name;
+    }
+
+    return symbol_names;
+  }
+
+  [[nodiscard]] const ExchangeSimulatorConfig& GetConfig() const {
+    return config_;
+  }
+
+  [[nodiscard]] ExchangeSimulatorStats GetStats() const {
+    lock_guard lock(weight_mutex_);
+    return stats_;
+  }
+
+  /// 통계와 사용 weight, 차단 상태를 초기화하는 함수
+  void ResetStats() {
+    lock_guard lock(weight_mutex_);
+
+    stats_ = {};
+    used_weight_ = 0;
+    num_violations_ = 0;
+    banned_until_ = 0;
+  }
+
+ private:
+#ifdef _WIN32
+  using Socket = SOCKET;
+  static constexpr Socket invalid_socket = INVALID_SOCKET;
+  static constexpr int send_flags = 0;
+#else
+  using Socket = int;
+  static constexpr Socket invalid_socket = -1;
+  static constexpr int send_flags = MSG_NOSIGNAL;
+#endif
+
+  /// 응답 하나의 상태 코드, 본문과 헤더 값
+  struct Response {
+    int status = 200;
+    string body;
+    int64_t used_weight = 0;
+    int64_t retry_after = -1;  // 초 단위. 음수면 헤더를 붙이지 않음
+  };
+
+  static constexpr int64_t funding_interval = 8LL * 60 * 60 * 1000;  // 8h
+
+  ExchangeSimulatorConfig config_;
+  unordered_map<string, int> symbol_indices_;
+
+  Socket listen_socket_;
+  uint16_t port_ = 0;
+  atomic<bool> stop_requested_;
+
+  thread accept_thread_;
+  vector<thread> connection_threads_;  // accept 스레드만 수정함
+  mutex connections_mutex_;
+  unordered_set<Socket> clients_;
+
+  mutable mutex weight_mutex_;
+  int64_t weight_window_idx_ = 0;
+  int64_t used_weight_ = 0;
+  int num_violations_ = 0;
+  int64_t banned_until_ = 0;
+  ExchangeSimulatorStats stats_;
+
+  static void ShutdownSocket(const Socket socket) {
+#ifdef _WIN32
+    shutdown(socket, SD_BOTH);
+#else
+    shutdown(socket, SHUT_RDWR);
+#endif
+  }
+
+  static void CloseSocket(const Socket socket) {
+#ifdef _WIN32
+    closesocket(socket);
+#else
+    close(socket);
+#endif
+  }
+
+  static int64_t GetServerTime() {
+    return chrono::duration_cast<chrono::milliseconds>(
+               chrono::system_clock::now().time_since_epoch())
+        .count();
+  }
+
+  void Accept() {
+    uint64_t connection_id = 0;
+
+    while (!stop_requested_) {
+      const Socket client = accept(listen_socket_, nullptr, nullptr);
+      if (client == invalid_socket) {
+        continue;
+      }
+
+      {
+        lock_guard lock(connections_mutex_);
+
+        // Stop이 연결 목록을 정리한 후에 받은 연결은 바로 닫음
+        if (stop_requested_) {
+          CloseSocket(client);
+          break;
+        }
+
+        clients_.insert(client);
+      }
+
+      // 작은 응답이 Nagle 알고리즘에 묶여 지연되지 않도록 함
+      constexpr int no_delay = 1;
+      setsockopt(client, IPPROTO_TCP, TCP_NODELAY,
+                 reinterpret_cast<const char*>(&no_delay), sizeof(no_delay));
+
+      connection_threads_.emplace_back(
+          [this, client, id = connection_id++] { Serve(client, id); });
+    }
+  }
+
+  /// 한 연결에서 요청을 연결이 끊길 때까지 순서대로 처리하는 함수
+  void Serve(const Socket client, const uint64_t connection_id) {
+    mt19937_64 rng(config_.seed * 0x9E3779B97F4A7C15ULL + connection_id);
+    string buffer;
+    char chunk[4096];
+
+    while (true) {
+      size_t header_end;
+      while ((header_end = buffer.find("\r\n\r\n")) == string::npos) {
+        const auto received =
+            recv(client, chunk, static_cast<int>(sizeof(chunk)), 0);
+        if (received <= 0) {
+          header_end = string::npos;
+          break;
+        }
+
+        buffer.append(chunk, static_cast<size_t>(received));
+      }
+
+      if (header_end == string::npos) {
+        break;
+      }
+
+      const string request = buffer.substr(0, header_end);
+      buffer.erase(0, header_end + 4);
+
+      const auto& response = Handle(request);
+
+      if (config_.latency > 0 || config_.latency_jitter > 0) {
+        const int64_t jitter =
+            config_.latency_jitter > 0
+                ? static_cast<int64_t>(rng() % (config_.latency_jitter + 1))
+                : 0;
+
+        this_thread::sleep_for(
+            chrono::milliseconds(config_.latency + jitter));
+      }
+
+      if (!SendAll(client, ToHttp(response))) {
+        break;
+      }
+
+      if (request.find("Connection: close") != string::npos) {
+        break;
+      }
+    }
+
+    {
+      lock_guard lock(connections_mutex_);
+      clients_.erase(client);
+    }
+
+    CloseSocket(client);
+  }
+
+  static bool SendAll(const Socket client, const string& data) {
+    size_t sent = 0;
+    while (sent < data.size()) {
+      const auto result =
+          send(client, data.data() + sent,
+               static_cast<int>(data.size() - sent), send_flags);
+      if (result <= 0) {
+        return false;
+      }
+
+      sent += static_cast<size_t>(result);
+    }
+
+    return true;
+  }
+
+  static string ToHttp(const Response& response) {
+    const char* reason = "OK";
+    switch (response.status) {
+      case 400:
+        reason = "Bad Request";
+        break;
+      case 404:
+        reason = "Not Found";
+        break;
+      case 418:
+        reason = "I'm a teapot";
+        break;
+      case 429:
+        reason = "Too Many Requests";
+        break;
+      default:
+        break;
+    }
+
+    string http = format(
+        "HTTP/1.1 {} {}\r\n"
+        "Content-Type: application/json\r\n"
+        "Content-Length: {}\r\n"
+        "X-MBX-USED-WEIGHT-1M: {}\r\n",
+        response.status, reason, response.body.size(), response.used_weight);
+
+    if (response.retry_after >= 0) {
+      http += format("Retry-After: {}\r\n", response.retry_after);
+    }
+
+    http += "Connection: keep-alive\r\n\r\n";
+    http += response.body;
+
+    return http;
+  }
+
+  /// 요청 줄을 해석하여 weight를 검사한 후 응답을 만드는 함수
+  Response Handle(const string& request) {
+    // 예: GET /fapi/v1/time?a=b HTTP/1.1
+    const size_t target_begin = request.find(' ') + 1;
+    const size_t target_end = request.find(' ', target_begin);
+    const string& target =
+        request.substr(target_begin, target_end - target_begin);
+
+    const size_t query_begin = target.find('?');
+    const string& path = target.substr(0, query_begin);
+    const auto& params = query_begin == string::npos
+                             ? unordered_map<string, string>{}
+                             : ParseQuery(target.substr(query_begin + 1));
+
+    Response response;
+
+    int64_t weight = 1;
+    if (path.ends_with("Klines")) {
+      weight = GetKlinesWeight(GetLimit(params, 500, 1500));
+    }
+
+    if (!ConsumeWeight(weight, response)) {
+      return response;
+    }
+
+    try {
+      if (path == "/fapi/v1/time") {
+        response.body = format(R"({{"serverTime":{}}})", GetServerTime());
+      } else if (path == "/fapi/v1/continuousKlines") {
+        response.body = MakeKlines(params, "pair", false);
+      } else if (path == "/fapi/v1/markPriceKlines") {
+        response.body = MakeKlines(params, "symbol", true);
+      } else if (path == "/fapi/v1/fundingRate") {
+        response.body = MakeFundingRates(params);
+      } else if (path == "/fapi/v1/exchangeInfo") {
+        response.body = MakeExchangeInfo().dump();
+      } else if (path == "/fapi/v1/leverageBracket") {
+        json leverage_brackets = json::array();
+        for (const auto& symbol_name : GetSymbolNames()) {
+          leverage_brackets.push_back(
+              SyntheticMarketData::MakeLeverageBracket(symbol_name));
+        }
+
+        response.body = leverage_brackets.dump();
+      } else {
+        response.status = 404;
+        response.body = MakeError(-5000, "Path not found.");
+      }
+    } catch (const invalid_argument& e) {
+      // 잘못된 파라미터는 바이낸스처럼 400과 오류 코드로 응답
+      response.status = 400;
+      response.body = e.what();
+    }
+
+    return response;
+  }
+
+  /**
+   * 현재 창의 사용 weight에 요청 weight를 더하는 함수.
+   *
+   * 한도를 넘거나 차단 중이면 response를 429나 418 응답으로 채우고 false를
+   * 반환함. 거부된 요청의 weight는 더하지 않음
+   */
+  bool ConsumeWeight(const int64_t weight, Response& response) {
+    const int64_t now = GetServerTime();
+
+    lock_guard lock(weight_mutex_);
+    ++stats_.num_requests;
+
+    if (const int64_t window_idx = now / config_.weight_window;
+        window_idx != weight_window_idx_) {
+      weight_window_idx_ = window_idx;
+      used_weight_ = 0;
+    }
+
+    const int64_t window_end = (weight_window_idx_ + 1) * config_.weight_window;
+    response.used_weight = used_weight_;
+
+    // 한도를 넘긴 후에도 계속 요청하면 차단함
+    if (now >= banned_until_ && used_weight_ + weight > config_.weight_limit &&
+        num_violations_ >= config_.violations_before_ban) {
+      num_violations_ = 0;
+      banned_until_ = now + config_.ban_duration;
+    }
+
+    if (now < banned_until_) {
+      ++stats_.num_banned;
+
+      response.status = 418;
+      response.retry_after = (banned_until_ - now + 999) / 1000;
+      response.body = MakeError(
+          -1003, format("Way too many requests; IP banned until {}.",
+                        banned_until_));
+
+      return false;
+    }
+
+    if (used_weight_ + weight > config_.weight_limit) {
+      ++stats_.num_throttled;
+      ++num_violations_;
+
+      response.status = 429;
+      response.retry_after = (window_end - now + 999) / 1000;
+      response.body = MakeError(-1003, "Too many requests.");
+
+      return false;
+    }
+
+    used_weight_ += weight;
+    stats_.total_weight += weight;
+    stats_.max_used_weight = max(stats_.max_used_weight, used_weight_);
+    response.used_weight = used_weight_;
+
+    return true;
+  }
+
+  /// 바이낸스 오류 응답 본문을 만드는 함수
+  static string MakeError(const int code, const string& message) {
+    return json{{"code", code}, {"msg", message}}.dump();
+  }
+
+  /// 캔들 요청의 limit에 따른 바이낸스 weight를 반환하는 함수
+  static int64_t GetKlinesWeight(const int64_t limit) {
+    if (limit < 100) {
+      return 1;
+    }
+
+    if (limit < 500) {
+      return 2;
+    }
+
+    return limit <= 1000 ? 5 : 10;
+  }
+
+  static unordered_map<string, string> ParseQuery(const string& query) {
+    unordered_map<string, string> params;
+
+    size_t begin = 0;
+    while (begin < query.size()) {
+      size_t end = query.find('&', begin);
+      if (end == string::npos) {
+        end = query.size();
+      }
+
+      const string& pair = query.substr(begin, end - begin);
+      if (const size_t equal = pair.find('='); equal != string::npos) {
+        params[pair.substr(0, equal)] = DecodeUrl(pair.substr(equal + 1));
+      }
+
+      begin = end + 1;
+    }
+
+    return params;
+  }
+
+  static string DecodeUrl(const string& value) {
+    string decoded;
+    decoded.reserve(value.size());
+
+    for (size_t idx = 0; idx < value.size(); ++idx) {
+      if (value[idx] == '%' && idx + 2 < value.size()) {
+        decoded +=
+            static_cast<char>(stoi(value.substr(idx + 1, 2), nullptr, 16));
+        idx += 2;
+      } else if (value[idx] == '+') {
+        decoded += ' ';
+      } else {
+        decoded += value[idx];
+      }
+    }
+
+    return decoded;
+  }
+
+  static int64_t GetLimit(const unordered_map<string, string>& params,
+                          const int64_t default_limit,
+                          const int64_t max_limit) {
+    const auto limit_it = params.find("limit");
+    if (limit_it == params.end()) {
+      return default_limit;
+    }
+
+    return clamp(atoll(limit_it->second.c_str()), 1LL,
+                 static_cast<long long>(max_limit));
+  }
+
+  /// 파라미터의 심볼 인덱스를 반환하는 함수. 없는 심볼이면 -1121 오류
+  int GetSymbolIndex(const unordered_map<string, string>& params,
+                     const string& key) const {
+    const auto param_it = params.find(key);
+    if (param_it == params.end()) {
+      throw invalid_argument(MakeError(
+          -1102, format("Mandatory parameter '{}' was not sent.", key)));
+    }
+
+    const auto symbol_it = symbol_indices_.find(param_it->second);
+    if (symbol_it == symbol_indices_.end()) {
+      throw invalid_argument(MakeError(-1121, "Invalid symbol."));
+    }
+
+    return symbol_it->second;
+  }
+
+  /// 시드, 심볼, 시간으로 [0, 1) 범위의 결정적 난수를 만드는 함수
+  [[nodiscard]] double Hash(const int symbol_idx, const int64_t time,
+                            const uint64_t salt) const {
+    // splitmix64
+    uint64_t value = config_.seed ^ (static_cast<uint64_t>(time) * 31) ^
+                     (static_cast<uint64_t>(symbol_idx) << 48) ^ (salt << 56);
+    value += 0x9E3779B97F4A7C15ULL;
+    value = (value ^ value >> 30) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ value >> 27) * 0x94D049BB133111EBULL;
+    value ^= value >> 31;
+
+    return static_cast<double>(value >> 11) * 0x1.0p-53;
+  }
+
+  /// 주어진 시간의 가격을 반환하는 함수.
+  /// 느린 추세와 빠른 주기에 시간별 잡음을 더함
+  [[nodiscard]] double GetPrice(const int symbol_idx,
+                                const int64_t time) const {
+    constexpr double pi = 3.14159265358979323846;
+    const double days = static_cast<double>(time) / 86400000.0;
+
+    return (100.0 + 37.0 * symbol_idx) *
+           exp(0.15 * sin(2.0 * pi * days / 30.0 + symbol_idx) +
+               0.03 * sin(2.0 * pi * days / 1.7) +
+               0.002 * (Hash(symbol_idx, time, 0) - 0.5));
+  }
+
+  /**
+   * 바이낸스 캔들스틱 엔드 포인트 응답을 만드는 함수.
+   *
+   * startTime이 있으면 그 이후 캔들부터 limit개, 없으면 endTime(없으면 현재
+   * 시간) 이전의 마지막 limit개를 반환함
+   */
+  [[nodiscard]] string MakeKlines(const unordered_map<string, string>& params,
+                                  const string& symbol_key,
+                                  const bool mark_price) const {
+    const int symbol_idx = GetSymbolIndex(params, symbol_key);
+
+    const auto interval_it = params.find("interval");
+    int64_t interval = 0;
+    try {
+      interval = interval_it == params.end()
+                     ? 0
+                     : utils::ParseTimeframe(interval_it->second);
+    } catch (const std::exception&) {
+      interval = 0;
+    }
+
+    if (interval <= 0) {
+      throw invalid_argument(MakeError(-1120, "Invalid interval."));
+    }
+
+    const int64_t limit = GetLimit(params, 500, 1500);
+    const int64_t now = GetServerTime();
+    const int64_t listing_time = config_.listing_time;
+
+    // 인덱스는 listing_time부터의 캔들 번호
+    int64_t last_idx = (now - listing_time) / interval;
+    if (const auto end_it = params.find("endTime"); end_it != params.end()) {
+      const int64_t end_time = atoll(end_it->second.c_str());
+      last_idx = min(last_idx, end_time < listing_time
+                                   ? -1
+                                   : (end_time - listing_time) / interval);
+    }
+
+    int64_t first_idx = max<int64_t>(0, last_idx - limit + 1);
+    if (const auto start_it = params.find("startTime");
+        start_it != params.end()) {
+      const int64_t start_time = atoll(start_it->second.c_str());
+      first_idx = start_time <= listing_time
+                      ? 0
+                      : (start_time - listing_time + interval - 1) / interval;
+      last_idx = min(last_idx, first_idx + limit - 1);
+    }
+
+    string body = "[";
+    body.reserve(static_cast<size_t>(max<int64_t>(0, last_idx - first_idx)) *
+                     160 +
+                 2);
+
+    for (int64_t idx = first_idx; idx <= last_idx; ++idx) {
+      const int64_t open_time = listing_time + idx * interval;
+      const int64_t close_time = open_time + interval - 1;
+
+      double open = GetPrice(symbol_idx, open_time);
+      double close = GetPrice(symbol_idx, open_time + interval);
+      double high = max(open, close) *
+                    (1.0 + 0.001 * Hash(symbol_idx, open_time, 1));
+      double low = min(open, close) *
+                   (1.0 - 0.001 * Hash(symbol_idx, open_time, 2));
+      double volume = 0;
+
+      if (mark_price) {
+        const double premium =
+            1.0 + 0.0002 * (Hash(symbol_idx, open_time, 3) - 0.5);
+
+        open *= premium;
+        high *= premium;
+        low *= premium;
+        close *= premium;
+      } else {
+        volume = (0.5 + Hash(symbol_idx, open_time, 4)) *
+                 static_cast<double>(interval) / 60.0;
+      }
+
+      if (idx != first_idx) {
+        body += ',';
+      }
+
+      // [Open Time, Open, High, Low, Close, Volume, Close Time, Quote Volume,
+      //  Trades, Taker Buy Volume, Taker Buy Quote Volume, Ignore]
+      body += format(
+          R"([{},"{:.4f}","{:.4f}","{:.4f}","{:.4f}","{:.3f}",)"
+          R"({},"{:.4f}",{},"{:.3f}","{:.4f}","0"])",
+          open_time, open, high, low, close, volume, close_time,
+          volume * close, static_cast<int64_t>(volume / 10), volume / 2,
+          volume * close / 2);
+    }
+
+    body += ']';
+    return body;
+  }
+
+  /**
+   * 바이낸스 펀딩 비율 엔드 포인트 응답을 만드는 함수.
+   *
+   * startTime이 없거나 0이면 바이낸스처럼 최근 limit개만 반환함
+   */
+  [[nodiscard]] string MakeFundingRates(
+      const unordered_map<string, string>& params) const {
+    const int symbol_idx = GetSymbolIndex(params, "symbol");
+    const string& symbol_name = params.at("symbol");
+
+    const int64_t limit = GetLimit(params, 100, 1000);
+    const int64_t now = GetServerTime();
+
+    // 인덱스는 상장 후 첫 펀딩 시간부터의 펀딩 번호
+    const int64_t first_funding_time =
+        (config_.listing_time + funding_interval - 1) / funding_interval *
+        funding_interval;
+
+    int64_t last_idx = (now - first_funding_time) / funding_interval;
+    if (const auto end_it = params.find("endTime"); end_it != params.end()) {
+      const int64_t end_time = atoll(end_it->second.c_str());
+      last_idx = min(last_idx,
+                     end_time < first_funding_time
+                         ? -1
+                         : (end_time - first_funding_time) / funding_interval);
+    }
+
+    int64_t first_idx = max<int64_t>(0, last_idx - limit + 1);
+    if (const auto start_it = params.find("startTime");
+        start_it != params.end() && atoll(start_it->second.c_str()) > 0) {
+      const int64_t start_time = atoll(start_it->second.c_str());
+      first_idx = start_time <= first_funding_time
+                      ? 0
+                      : (start_time - first_funding_time + funding_interval -
+                         1) /
+                            funding_interval;
+      last_idx = min(last_idx, first_idx + limit - 1);
+    }
+
+    string body = "[";
+    for (int64_t idx = first_idx; idx <= last_idx; ++idx) {
+      const int64_t funding_time = first_funding_time + idx * funding_interval;
+
+      if (idx != first_idx) {
+        body += ',';
+      }
+
+      body += format(
+          R"({{"symbol":"{}","fundingTime":{},)"
+          R"("fundingRate":"{:.8f}","markPrice":"{:.8f}"}})",
+          symbol_name, funding_time,
+          0.0001 + 0.0002 * (Hash(symbol_idx, funding_time, 5) - 0.5),
+          GetPrice(symbol_idx, funding_time));
+    }
+
+    body += ']';
+    return body;
+  }
+
+  [[nodiscard]] json MakeExchangeInfo() const {
+    json symbols = json::array();
+    for (const auto& symbol_name : GetSymbolNames()) {
+      symbols.push_back(SyntheticMarketData::MakeExchangeSymbol(symbol_name));
+    }
+
+    return {{"timezone", "UTC"},
+            {"serverTime", GetServerTime()},
+            {"rateLimits",
+             {{{"rateLimitType", "REQUEST_WEIGHT"},
+               {"interval", "MINUTE"},
+               {"intervalNum", 1},
+               {"limit", config_.weight_limit}}}},
+            {"symbols", symbols}};
+  }
+};
+
+}  // namespace backtesting::tests
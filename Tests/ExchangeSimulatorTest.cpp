@@ -0,0 +1,185 @@
+// 표준 라이브러리
+#include <any>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+// 외부 라이브러리
+#include <gtest/gtest.h>
+#include "arrow/api.h"
+#include "nlohmann/json.hpp"
+
+// 내부 헤더
+#include "Engines/BinanceFetcher.hpp"
+#include "Engines/DataUtils.hpp"
+#include "Engines/KlineDataset.hpp"
+#include "ExchangeSimulator.hpp"
+
+// 네임 스페이스
+using namespace std;
+using namespace backtesting::fetcher;
+using namespace backtesting::tests;
+using namespace backtesting::utils;
+
+namespace {
+
+constexpr int64_t hour = 60LL * 60 * 1000;
+
+/// 보호된 Fetch 함수를 테스트에서 호출하기 위한 클래스
+class RawFetcher final : public BaseFetcher {
+ public:
+  using BaseFetcher::FetchText;
+};
+
+int64_t GetNow() {
+  return chrono::duration_cast<chrono::milliseconds>(
+             chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+class ExchangeSimulatorTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    directory_ = (filesystem::temp_directory_path() / "ExchangeSimulatorTest")
+                     .string();
+    filesystem::remove_all(directory_);
+    filesystem::create_directories(directory_);
+  }
+
+  void TearDown() override {
+    BinanceFetcher::SetFuturesEndpoint("https://fapi.binance.com");
+    filesystem::remove_all(directory_);
+  }
+
+  string directory_;
+};
+
+}  // namespace
+
+TEST_F(ExchangeSimulatorTest, ServesKlinePagesFromStartTime) {
+  ExchangeSimulatorConfig config;
+  config.listing_time = GetNow() / hour * hour - 10 * hour;
+
+  ExchangeSimulator simulator(config);
+  const string& url = simulator.GetEndpoint() + "/fapi/v1/continuousKlines";
+
+  unordered_map<string, string> params = {{"pair", "SYN000USDT"},
+                                          {"contractType", "PERPETUAL"},
+                                          {"interval", "1h"},
+                                          {"startTime", "0"},
+                                          {"limit", "4"}};
+
+  const auto& page = json::parse(RawFetcher::FetchText(url, params).get());
+
+  ASSERT_EQ(page.size(), 4);
+  for (int64_t row = 0; row < 4; row++) {
+    EXPECT_EQ(page[row][0].get<int64_t>(), config.listing_time + row * hour);
+    EXPECT_EQ(page[row][6].get<int64_t>(),
+              config.listing_time + (row + 1) * hour - 1);
+  }
+
+  // 같은 캔들은 다른 구간으로 요청해도 같은 값
+  params["startTime"] = to_string(page[2][0].get<int64_t>());
+  params["limit"] = "1";
+
+  const auto& same_candle =
+      json::parse(RawFetcher::FetchText(url, params).get());
+
+  ASSERT_EQ(same_candle.size(), 1);
+  EXPECT_EQ(same_candle[0], page[2]);
+
+  // limit 4 요청의 weight는 1
+  EXPECT_EQ(simulator.GetStats().total_weight, 2);
+
+  params["pair"] = "NOPEUSDT";
+  EXPECT_THROW(RawFetcher::FetchText(url, params).get(), runtime_error);
+}
+
+TEST_F(ExchangeSimulatorTest, ThrottlesAndBansOverWeightLimit) {
+  ExchangeSimulatorConfig config;
+  config.weight_limit = 3;
+  config.weight_window = 24 * hour;  // 테스트 중 창이 바뀌지 않도록 함
+  config.violations_before_ban = 1;
+
+  ExchangeSimulator simulator(config);
+  const string& url = simulator.GetEndpoint() + "/fapi/v1/time";
+
+  for (int request = 0; request < 3; request++) {
+    EXPECT_NO_THROW(RawFetcher::FetchText(url).get());
+  }
+
+  // 한도를 넘으면 429, 다시 넘으면 418
+  try {
+    RawFetcher::FetchText(url).get();
+    FAIL();
+  } catch (const runtime_error& e) {
+    EXPECT_NE(string(e.what()).find("[429]"), string::npos);
+    EXPECT_NE(string(e.what()).find("X-MBX-USED-WEIGHT-1M: 3"), string::npos);
+    EXPECT_NE(string(e.what()).find("Retry-After:"), string::npos);
+  }
+
+  try {
+    RawFetcher::FetchText(url).get();
+    FAIL();
+  } catch (const runtime_error& e) {
+    EXPECT_NE(string(e.what()).find("[418]"), string::npos);
+  }
+
+  const auto& stats = simulator.GetStats();
+  EXPECT_EQ(stats.num_requests, 5);
+  EXPECT_EQ(stats.num_throttled, 1);
+  EXPECT_EQ(stats.num_banned, 1);
+  EXPECT_EQ(stats.total_weight, 3);
+  EXPECT_EQ(stats.max_used_weight, 3);
+
+  simulator.ResetStats();
+  EXPECT_NO_THROW(RawFetcher::FetchText(url).get());
+}
+
+TEST_F(ExchangeSimulatorTest, FetcherDownloadsSlicedKlinesAndFundingRates) {
+  // 구간 분할이 일어나도록 페이지 40개 분량의 캔들을 제공
+  ExchangeSimulatorConfig config;
+  config.num_symbols = 1;
+  config.listing_time = GetNow() / hour * hour - 40000 * hour;
+
+  ExchangeSimulator simulator(config);
+  BinanceFetcher::SetFuturesEndpoint(simulator.GetEndpoint());
+
+  const BinanceFetcher fetcher("", "", directory_);
+  const string& symbol = simulator.GetSymbolNames().front();
+
+  fetcher.FetchContinuousKlines(symbol, "1h");
+  fetcher.FetchFundingRates(symbol);
+
+  // 미완성인 마지막 캔들은 저장하지 않음. 테스트 중 시간이 바뀌면 1개 늘어남
+  const auto& klines = KlineDataset::ReadBatch(
+                           {format("{}/Continuous Klines/{}/1h/1h.parquet",
+                                   directory_, symbol)},
+                           {})
+                           .front();
+
+  ASSERT_GE(klines->num_rows(), 40000);
+  ASSERT_LE(klines->num_rows(), 40001);
+
+  for (int64_t row = 0; row < klines->num_rows(); row++) {
+    ASSERT_EQ(any_cast<int64_t>(GetCellValue(klines, 0, row)),
+              config.listing_time + row * hour);
+  }
+
+  ifstream funding_rates_file(
+      format("{}/Funding Rates/{}.json", directory_, symbol));
+  const auto& funding_rates = json::parse(funding_rates_file);
+
+  ASSERT_GE(funding_rates.size(), 40000 / 8);
+  EXPECT_EQ(funding_rates.front()["fundingTime"].get<int64_t>(),
+            (config.listing_time + 8 * hour - 1) / (8 * hour) * (8 * hour));
+  EXPECT_TRUE(funding_rates.front()["fundingRate"].is_number());
+
+  const auto& stats = simulator.GetStats();
+  EXPECT_EQ(stats.num_throttled, 0);
+  EXPECT_EQ(stats.num_banned, 0);
+}
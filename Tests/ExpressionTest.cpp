@@ -0,0 +1,118 @@
+// 표준 라이브러리
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// 외부 라이브러리
+#include <gtest/gtest.h>
+
+// 내부 헤더
+#include "Engines/Expression.hpp"
+#include "Engines/IndicatorState.hpp"
+#include "SyntheticMarketData.hpp"
+
+// 네임 스페이스
+using namespace std;
+using namespace backtesting::bar;
+using namespace backtesting::expression;
+using namespace backtesting::indicator;
+using namespace backtesting::tests;
+
+namespace {
+
+vector<double> Evaluate(const Expression& expression,
+                        const vector<Bar>& bars) {
+  CompiledExpression program(expression);
+  vector<double> output(bars.size());
+  program.Evaluate(bars, {}, output);
+
+  return output;
+}
+
+}  // namespace
+
+TEST(ExpressionTest, SmaOfCloseMatchesManualMean) {
+  const auto& bars = SyntheticMarketData::MakeTradingBars(50, 1);
+  const auto& output = Evaluate(Sma(BarClose(), 3), bars);
+
+  EXPECT_TRUE(isnan(output[0]));
+  EXPECT_TRUE(isnan(output[1]));
+  for (size_t i = 2; i < bars.size(); ++i) {
+    const double expected =
+        (bars[i - 2].close + bars[i - 1].close + bars[i].close) / 3;
+    EXPECT_NEAR(output[i], expected, 1e-9) << i;
+  }
+}
+
+TEST(ExpressionTest, TrueRangeMatchesDefinition) {
+  const auto& bars = SyntheticMarketData::MakeTradingBars(50, 2);
+  const auto& output = Evaluate(BarTrueRange(), bars);
+
+  EXPECT_TRUE(isnan(output[0]));
+  for (size_t i = 1; i < bars.size(); ++i) {
+    const double prev_close = bars[i - 1].close;
+    const double expected =
+        max({bars[i].high - bars[i].low, abs(bars[i].high - prev_close),
+             abs(bars[i].low - prev_close)});
+    EXPECT_DOUBLE_EQ(output[i], expected) << i;
+  }
+}
+
+TEST(ExpressionTest, RollingExtremesMatchWindow) {
+  const auto& bars = SyntheticMarketData::MakeTradingBars(80, 3);
+  const auto& highest = Evaluate(RollingMax(BarHigh(), 5), bars);
+  const auto& lowest = Evaluate(RollingMin(BarLow(), 5), bars);
+
+  for (size_t i = 4; i < bars.size(); ++i) {
+    double expected_high = bars[i].high;
+    double expected_low = bars[i].low;
+    for (size_t j = i - 4; j < i; ++j) {
+      expected_high = max(expected_high, bars[j].high);
+      expected_low = min(expected_low, bars[j].low);
+    }
+
+    EXPECT_EQ(highest[i], expected_high) << i;
+    EXPECT_EQ(lowest[i], expected_low) << i;
+  }
+}
+
+TEST(ExpressionTest, MergesCommonSubexpressions) {
+  const auto& tr = BarTrueRange();
+  const CompiledExpression shared(Sma(tr, 14) / Sma(tr, 14));
+  const CompiledExpression single(Sma(tr, 14));
+
+  // 같은 서명의 부분식은 명령 하나로 합쳐지므로 나눗셈 명령만 추가됨
+  EXPECT_EQ(shared.GetNumInstructions(), single.GetNumInstructions() + 1);
+  EXPECT_EQ(Sma(BarClose(), 14).GetSignature(),
+            Sma(BarClose(), 14).GetSignature());
+  EXPECT_NE(Sma(BarClose(), 14).GetSignature(),
+            Sma(BarClose(), 15).GetSignature());
+}
+
+TEST(ExpressionTest, ResumesFromSavedState) {
+  const auto& bars = SyntheticMarketData::MakeTradingBars(120, 4);
+  const auto& expression =
+      Ema(BarClose(), 10) - StdDev(Shift(BarClose(), 2), 20);
+  const auto& expected = Evaluate(expression, bars);
+
+  // 앞부분을 계산한 상태를 저장하고, 새 프로그램에서 복구하여 이어서 계산
+  CompiledExpression first(expression);
+  vector<double> head(70);
+  first.Evaluate(span(bars).first(70), {}, head);
+
+  IndicatorState writer;
+  first.SaveState(writer);
+  IndicatorState reader(writer.Release());
+
+  CompiledExpression second(expression);
+  ASSERT_TRUE(second.LoadState(reader));
+
+  vector<double> tail(bars.size() - 70);
+  second.Evaluate(span(bars).subspan(70), {}, tail);
+
+  for (size_t i = 0; i < tail.size(); ++i) {
+    EXPECT_EQ(tail[i], expected[70 + i]) << i;
+  }
+}
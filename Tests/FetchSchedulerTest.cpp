@@ -0,0 +1,166 @@
+// 표준 라이브러리
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 외부 라이브러리
+#include <gtest/gtest.h>
+
+// 내부 헤더
+#include "Engines/FetchScheduler.hpp"
+
+// 네임 스페이스
+using namespace std;
+using namespace backtesting::fetcher;
+
+namespace {
+
+vector<FetchJob> MakeJobs(const int num_jobs) {
+  vector<FetchJob> jobs;
+  for (int i = 0; i < num_jobs; i++) {
+    jobs.push_back({FetchJobKind::CONTINUOUS_KLINES, to_string(i), "1h", ""});
+  }
+
+  return jobs;
+}
+
+}  // namespace
+
+TEST(FetchSchedulerTest, RunsAllJobsWithinWorkerLimit) {
+  constexpr size_t num_workers = 3;
+  const auto& jobs = MakeJobs(20);
+
+  atomic<int> num_running = 0;
+  atomic<int> max_running = 0;
+  mutex symbols_mutex;
+  vector<string> symbols;
+
+  const size_t num_started = FetchScheduler(num_workers).Run(
+      jobs,
+      [&](const FetchJob& job) {
+        const int running = ++num_running;
+
+        int expected = max_running;
+        while (running > expected &&
+               !max_running.compare_exchange_weak(expected, running)) {
+        }
+
+        this_thread::sleep_for(chrono::milliseconds(2));
+
+        {
+          lock_guard lock(symbols_mutex);
+          symbols.push_back(job.symbol);
+        }
+
+        --num_running;
+      },
+      [](const FetchJob&, const exception_ptr&) { FAIL(); });
+
+  EXPECT_EQ(num_started, jobs.size());
+  EXPECT_EQ(symbols.size(), jobs.size());
+  EXPECT_LE(max_running, static_cast<int>(num_workers));
+  EXPECT_GT(max_running, 1);
+}
+
+TEST(FetchSchedulerTest, ReportsFailuresAndContinues) {
+  const auto& jobs = MakeJobs(5);
+
+  atomic<int> num_completed = 0;
+  vector<string> failed_symbols;
+  mutex failed_mutex;
+
+  FetchScheduler(2).Run(
+      jobs,
+      [&](const FetchJob& job) {
+        if (job.symbol == "1" || job.symbol == "3") {
+          throw runtime_error("요청 실패");
+        }
+
+        ++num_completed;
+      },
+      [&](const FetchJob& job, const exception_ptr& error) {
+        EXPECT_THROW(rethrow_exception(error), runtime_error);
+
+        lock_guard lock(failed_mutex);
+        failed_symbols.push_back(job.symbol);
+      });
+
+  EXPECT_EQ(num_completed, 3);
+  EXPECT_EQ(failed_symbols.size(), 2);
+}
+
+TEST(FetchSchedulerTest, StopsStartingJobsWhenRequested) {
+  const auto& jobs = MakeJobs(10);
+  atomic<bool> stop_requested = false;
+
+  const size_t num_started = FetchScheduler(1).Run(
+      jobs,
+      [&](const FetchJob& job) {
+        if (job.symbol == "2") {
+          stop_requested = true;
+        }
+      },
+      [](const FetchJob&, const exception_ptr&) {},
+      [&] { return stop_requested.load(); });
+
+  EXPECT_EQ(num_started, 3);
+}
+
+TEST(FetchSchedulerTest, RemovesJobsWithSameTarget) {
+  const vector<FetchJob> jobs = {
+      {FetchJobKind::CONTINUOUS_KLINES, "BTCUSDT", "1h", "Data/Klines"},
+      {FetchJobKind::CONTINUOUS_KLINES, "BTCUSDT", "1h", "Data/./Klines/"},
+      {FetchJobKind::CONTINUOUS_KLINES, "BTCUSDT", "1m", "Data/Klines"},
+      {FetchJobKind::MARK_PRICE_KLINES, "BTCUSDT", "1h", "Data/Klines"},
+      {FetchJobKind::FUNDING_RATES, "BTCUSDT", "", "Data/Funding"},
+      {FetchJobKind::CONTINUOUS_KLINES, "ETHUSDT", "1h", "Data/Klines"},
+      {FetchJobKind::FUNDING_RATES, "BTCUSDT", "", "Data/Funding"}};
+
+  // 같은 파일을 쓰는 두 번째 작업들만 제거되고 순서는 유지됨
+  const auto& unique_jobs = FetchScheduler::RemoveDuplicateJobs(jobs);
+  ASSERT_EQ(unique_jobs.size(), 5);
+
+  vector<string> targets;
+  for (const auto& job : unique_jobs) {
+    targets.push_back(job.symbol + " " + job.timeframe);
+  }
+
+  EXPECT_EQ(targets, (vector<string>{"BTCUSDT 1h", "BTCUSDT 1m", "BTCUSDT 1h",
+                                     "BTCUSDT ", "ETHUSDT 1h"}));
+  EXPECT_EQ(unique_jobs[2].kind, FetchJobKind::MARK_PRICE_KLINES);
+}
+
+TEST(FetchSchedulerTest, PlansPageAlignedSlices) {
+  constexpr int64_t interval = 60'000;
+  constexpr int64_t page_size = 1000;
+  constexpr int64_t page_span = interval * page_size;
+
+  // 100 페이지 기간은 최대 구간 수로 나뉘고, 구간은 빈틈없이 이어짐
+  const auto& slices = FetchScheduler::PlanTimeSlices(
+      0, 100 * page_span - 1, interval, page_size, 4, 8);
+
+  ASSERT_EQ(slices.size(), 4);
+  EXPECT_EQ(slices.front().first, 0);
+  EXPECT_EQ(slices.back().second, 100 * page_span - 1);
+
+  for (size_t i = 0; i < slices.size(); i++) {
+    EXPECT_EQ(slices[i].first % page_span, 0);
+
+    if (i > 0) {
+      EXPECT_EQ(slices[i].first, slices[i - 1].second + 1);
+    }
+  }
+
+  // 구간별 최소 페이지 수보다 짧은 기간은 나누지 않음
+  EXPECT_EQ(FetchScheduler::PlanTimeSlices(0, 10 * page_span, interval,
+                                           page_size, 4, 8)
+                .size(),
+            1);
+
+  EXPECT_TRUE(FetchScheduler::PlanTimeSlices(10, 0, interval, page_size, 4, 8)
+                  .empty());
+}
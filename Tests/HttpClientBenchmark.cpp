@@ -0,0 +1,135 @@
+// 표준 라이브러리
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <exception>
+#include <format>
+#include <future>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+// 내부 헤더
+#include "Engines/BaseFetcher.hpp"
+
+// 네임 스페이스
+using namespace std;
+using namespace backtesting::fetcher;
+
+namespace {
+
+/// 보호된 Fetch 함수를 벤치마크에서 호출하기 위한 클래스
+class BenchmarkFetcher final : public BaseFetcher {
+ public:
+  using BaseFetcher::FetchText;
+};
+
+/// 프로세스가 사용한 CPU 시간을 초 단위로 반환하는 함수
+double GetProcessCpuSeconds() {
+#ifdef _WIN32
+  FILETIME creation_time, exit_time, kernel_time, user_time;
+  GetProcessTimes(GetCurrentProcess(), &creation_time, &exit_time,
+                  &kernel_time, &user_time);
+
+  const auto& to_seconds = [](const FILETIME& time) {
+    return static_cast<double>(
+               static_cast<uint64_t>(time.dwHighDateTime) << 32 |
+               time.dwLowDateTime) /
+           1e7;
+  };
+
+  return to_seconds(kernel_time) + to_seconds(user_time);
+#else
+  return static_cast<double>(clock()) / CLOCKS_PER_SEC;
+#endif
+}
+
+}  // namespace
+
+/*
+ * 로컬 대역 서버에 같은 요청을 반복하여 HTTP 작업 스레드 풀의 처리량과
+ * 요청당 CPU 시간을 측정하는 벤치마크.
+ *
+ * 사용법: HttpClientBenchmark [URL] [요청 수] [동시 요청 수]
+ *
+ * URL은 바이낸스 응답을 흉내 내는 로컬 HTTP(S) 서버 주소를 사용함.
+ * HTTPS 서버는 신뢰할 수 있는 인증서를 사용해야 함.
+ * 첫 요청으로 연결을 맺은 후 측정하며, 요청은 동시 요청 수만큼씩 묶어 보냄
+ */
+int main(const int argc, char* argv[]) {
+  if (argc < 2) {
+    cout << "사용법: HttpClientBenchmark [URL] [요청 수] [동시 요청 수]"
+         << endl;
+    return 1;
+  }
+
+  const string url = argv[1];
+  const int num_requests = argc > 2 ? atoi(argv[2]) : 2000;
+  const int num_in_flight = argc > 3 ? max(1, atoi(argv[3])) : 16;
+
+  // 연결 준비
+  try {
+    BenchmarkFetcher::FetchText(url).get();
+  } catch (const exception& e) {
+    cout << format("[{}] 요청이 실패했습니다: {}", url, e.what()) << endl;
+    return 1;
+  }
+
+  const double start_cpu_seconds = GetProcessCpuSeconds();
+  const auto start_time = chrono::steady_clock::now();
+
+  int num_failed = 0;
+  size_t num_bytes = 0;
+
+  vector<future<string>> in_flight;
+  in_flight.reserve(num_in_flight);
+
+  const auto& collect = [&](future<string>& response) {
+    try {
+      num_bytes += response.get().size();
+    } catch (const exception&) {
+      ++num_failed;
+    }
+  };
+
+  for (int request_idx = 0; request_idx < num_requests; ++request_idx) {
+    if (static_cast<int>(in_flight.size()) == num_in_flight) {
+      for (auto& response : in_flight) {
+        collect(response);
+      }
+
+      in_flight.clear();
+    }
+
+    in_flight.push_back(BenchmarkFetcher::FetchText(url));
+  }
+
+  for (auto& response : in_flight) {
+    collect(response);
+  }
+
+  const double seconds =
+      chrono::duration<double>(chrono::steady_clock::now() - start_time)
+          .count();
+  const double cpu_seconds = GetProcessCpuSeconds() - start_cpu_seconds;
+
+  cout << format(
+              "요청 {}개 (동시 {}개) | {:.3f}초 ({:.0f} req/s) | "
+              "요청당 CPU {:.1f}µs | 응답 {:.1f}KB/요청 | 실패 {}개",
+              num_requests, num_in_flight, seconds, num_requests / seconds,
+              cpu_seconds / num_requests * 1e6,
+              static_cast<double>(num_bytes) / num_requests / 1024,
+              num_failed)
+       << endl;
+
+  return num_failed == 0 ? 0 : 1;
+}
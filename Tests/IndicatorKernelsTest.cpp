@@ -0,0 +1,412 @@
+// 표준 라이브러리
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <memory>
+#include <random>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+
+// 외부 라이브러리
+#include <gtest/gtest.h>
+
+// 내부 헤더
+#include "Engines/IndicatorKernels.hpp"
+#include "Engines/Numeric.hpp"
+#include "Indicators/Close.hpp"
+#include "Indicators/Highest.hpp"
+#include "Indicators/Lowest.hpp"
+#include "Indicators/SimpleMovingAverage.hpp"
+#include "Indicators/StandardDeviation.hpp"
+#include "Indicators/TrueRange.hpp"
+#include "SyntheticMarketData.hpp"
+
+// 네임 스페이스
+using namespace std;
+using namespace backtesting::bar;
+using namespace backtesting::indicator;
+using namespace backtesting::kernel;
+using namespace backtesting::numeric;
+using namespace backtesting::plot;
+using namespace backtesting::tests;
+
+namespace backtesting::indicator {
+
+/// 엔진 없이 지표를 생성하고 바마다 계산하는 경로를 호출하는 테스트 접근
+/// 클래스
+class IndicatorTestAccess {
+ public:
+  /// Strategy::AddIndicator와 같이 생성 카운터를 증가시킨 후 지표를 생성하는
+  /// 함수
+  template <typename CustomIndicator, typename... Args>
+  static unique_ptr<CustomIndicator> Create(Args&&... args) {
+    Indicator::IncreaseCreationCounter();
+    return make_unique<CustomIndicator>("Test", "1m", Null(),
+                                        std::forward<Args>(args)...);
+  }
+
+  /// 입력 순서대로 지표의 CalculateNext를 호출한 결과를 반환하는 함수
+  template <typename CustomIndicator, typename Input>
+  static vector<double> CalculateEach(CustomIndicator& indicator,
+                                      const vector<Input>& inputs) {
+    vector<double> output;
+    output.reserve(inputs.size());
+
+    for (const auto& input : inputs) {
+      output.push_back(indicator.CalculateNext(input));
+    }
+
+    return output;
+  }
+};
+
+}  // namespace backtesting::indicator
+
+namespace {
+
+// =============================================================================
+// 커널이 대체하는 내장 지표의 바마다 계산한 결과
+// =============================================================================
+/// 지표를 새로 생성하여 입력 시계열을 바마다 계산한 결과를 반환하는 함수
+template <typename CustomIndicator>
+vector<double> CalculatePerBar(const vector<double>& input,
+                               const size_t period) {
+  const auto& source = IndicatorTestAccess::Create<Close>();
+  const auto& indicator = IndicatorTestAccess::Create<CustomIndicator>(
+      *source, static_cast<double>(period));
+
+  return IndicatorTestAccess::CalculateEach(*indicator, input);
+}
+
+vector<double> CalculateTrueRangePerBar(const vector<Bar>& bars) {
+  const auto& indicator = IndicatorTestAccess::Create<::TrueRange>();
+  return IndicatorTestAccess::CalculateEach(*indicator, bars);
+}
+
+// =============================================================================
+// 테스트 데이터
+// =============================================================================
+/// 랜덤 워크 가격 시계열을 생성하는 함수. 앞쪽 warmup개는 NaN
+vector<double> MakeSeries(const size_t size, const size_t warmup,
+                          const double base_price, const uint64_t seed) {
+  mt19937_64 engine(seed);
+  normal_distribution distribution(0.0, 0.01);
+
+  vector<double> series(size, NAN);
+  double price = base_price;
+  for (size_t i = warmup; i < size; ++i) {
+    price *= exp(distribution(engine));
+
+    // 같은 값이 반복되는 구간을 만들어 최댓값/최솟값의 동률 처리도 검사
+    series[i] = i % 17 < 3 ? round(price) : price;
+  }
+
+  return series;
+}
+
+/// 커널의 SIMD 수준별로 테스트를 실행하기 위한 픽스처
+class IndicatorKernelsTest : public testing::TestWithParam<SimdLevel> {
+ protected:
+  void SetUp() override {
+    if (GetParam() > DetectSimdLevel()) {
+      GTEST_SKIP() << format("현재 CPU는 [{}] 커널을 지원하지 않습니다.",
+                             SimdLevelToString(GetParam()));
+    }
+
+    SetSimdLevel(GetParam());
+  }
+
+  void TearDown() override { SetSimdLevel(DetectSimdLevel()); }
+};
+
+/// 두 시계열이 비트 단위로 같은지 검사하는 함수
+void ExpectBitEqual(const vector<double>& expected,
+                    const vector<double>& actual) {
+  ASSERT_EQ(expected.size(), actual.size());
+
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(bit_cast<uint64_t>(expected[i]), bit_cast<uint64_t>(actual[i]))
+        << format("인덱스 {}: 기대값 {} / 실제값 {}", i, expected[i],
+                  actual[i]);
+  }
+}
+
+/**
+ * 바마다 계산하는 지표와 커널의 허용 오차를 반환하는 함수.
+ *
+ * 지표는 누적 합에 값을 더하고 빼며 갱신하므로 반올림 오차가 바마다 최대
+ * 2^-53 × 누적 합 크기씩 쌓이고, 커널은 윈도우마다 합을 새로 구하므로
+ * 오차가 쌓이지 않음. 따라서 윈도우 값 크기의 평균에 대한 상대 오차로
+ * (바 인덱스 + 1) × ulps × 2^-52까지 허용
+ *
+ * @param input 입력 시계열
+ * @param bar_idx 윈도우의 마지막 바 인덱스
+ * @param period 윈도우 크기
+ * @param ulps 바 하나당 허용할 상대 오차 (2^-52 단위)
+ * @param squared 값 대신 제곱의 크기를 기준으로 할지 여부
+ */
+double DriftTolerance(const vector<double>& input, const size_t bar_idx,
+                      const size_t period, const double ulps,
+                      const bool squared) {
+  double scale = 0;
+  for (size_t i = bar_idx + 1 - period; i <= bar_idx; ++i) {
+    scale += squared ? input[i] * input[i] : abs(input[i]);
+  }
+
+  return static_cast<double>(bar_idx + 1) * ulps * 0x1p-52 * scale /
+         static_cast<double>(period);
+}
+
+/// 평균이 NaN 위치가 같고 상대 허용 오차 이내인지 검사하는 함수
+void ExpectMeanNear(const vector<double>& expected,
+                    const vector<double>& actual, const vector<double>& input,
+                    const size_t period) {
+  ASSERT_EQ(expected.size(), actual.size());
+
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(isnan(expected[i]), isnan(actual[i])) << format("인덱스 {}", i);
+
+    if (!isnan(expected[i])) {
+      ASSERT_NEAR(expected[i], actual[i],
+                  DriftTolerance(input, i, period, 1, false))
+          << format("인덱스 {}", i);
+    }
+  }
+}
+
+/**
+ * 표준편차를 분산 단위로 비교하는 함수.
+ *
+ * 분산은 제곱 평균에서 평균의 제곱을 빼서 구하므로 오차는 제곱의 크기를
+ * 기준으로 하며, 두 누적 합의 오차가 더해지고 평균의 제곱에서 증폭되므로
+ * 바 하나당 16 ulps까지 허용. 분산이 0에 가까우면 음수 분산이 NaN이 될 수
+ * 있으므로 첫 윈도우 완성 이후의 NaN은 0으로 간주
+ *
+ * @param expected 지표가 바마다 계산한 표준편차
+ * @param actual 커널이 계산한 표준편차
+ * @param input 입력 시계열
+ * @param period 윈도우 크기
+ * @param first_output 첫 윈도우가 완성되는 바 인덱스
+ */
+void ExpectVarianceNear(const vector<double>& expected,
+                        const vector<double>& actual,
+                        const vector<double>& input, const size_t period,
+                        const size_t first_output) {
+  ASSERT_EQ(expected.size(), actual.size());
+
+  for (size_t i = 0; i < expected.size(); ++i) {
+    if (i < first_output) {
+      ASSERT_TRUE(isnan(expected[i])) << format("인덱스 {}", i);
+      ASSERT_TRUE(isnan(actual[i])) << format("인덱스 {}", i);
+      continue;
+    }
+
+    const double expected_variance =
+        isnan(expected[i]) ? 0 : expected[i] * expected[i];
+    const double actual_variance =
+        isnan(actual[i]) ? 0 : actual[i] * actual[i];
+
+    ASSERT_NEAR(expected_variance, actual_variance,
+                DriftTolerance(input, i, period, 16, true))
+        << format("인덱스 {}", i);
+  }
+}
+
+/// 지정한 비교 방식의 교차 커널 결과가 Comparison<Mode>로 바마다 판정한
+/// 결과와 같은지 검사하는 함수
+template <ComparisonMode Mode>
+void ExpectCrossMatchesComparison(const vector<double>& lhs,
+                                  const vector<double>& rhs,
+                                  const double tolerance) {
+  using Compare = Comparison<Mode>;
+
+  vector<uint8_t> over(lhs.size());
+  vector<uint8_t> under(lhs.size());
+  CrossOver(lhs, rhs, over, Mode, tolerance);
+  CrossUnder(lhs, rhs, under, Mode, tolerance);
+
+  EXPECT_EQ(over[0], 0);
+  EXPECT_EQ(under[0], 0);
+
+  for (size_t i = 1; i < lhs.size(); ++i) {
+    EXPECT_EQ(over[i], Compare::IsGreater(lhs[i], rhs[i], tolerance) &&
+                           Compare::IsLessOrEqual(lhs[i - 1], rhs[i - 1],
+                                                  tolerance))
+        << format("모드 [{}] 인덱스 [{}]", static_cast<int>(Mode), i);
+    EXPECT_EQ(under[i], Compare::IsLess(lhs[i], rhs[i], tolerance) &&
+                            Compare::IsGreaterOrEqual(lhs[i - 1], rhs[i - 1],
+                                                      tolerance))
+        << format("모드 [{}] 인덱스 [{}]", static_cast<int>(Mode), i);
+  }
+}
+
+constexpr size_t series_size = 20'000;
+constexpr size_t periods[] = {1, 2, 3, 5, 14, 20, 64, 200};
+
+}  // namespace
+
+TEST_P(IndicatorKernelsTest, RollingMeanMatchesSimpleMovingAverage) {
+  for (const size_t warmup : {0, 1, 39}) {
+    const auto& input = MakeSeries(series_size, warmup, 30000, warmup + 1);
+
+    for (const size_t period : periods) {
+      vector<double> output(input.size());
+      ASSERT_TRUE(RollingMean(input, period, output));
+
+      ExpectMeanNear(CalculatePerBar<SimpleMovingAverage>(input, period),
+                     output, input, period);
+    }
+  }
+}
+
+TEST_P(IndicatorKernelsTest, RollingStandardDeviationMatchesIndicator) {
+  for (const size_t warmup : {0, 1, 39}) {
+    const auto& input = MakeSeries(series_size, warmup, 30000, warmup + 2);
+
+    for (const size_t period : periods) {
+      vector<double> output(input.size());
+      ASSERT_TRUE(RollingStandardDeviation(input, period, output));
+
+      ExpectVarianceNear(CalculatePerBar<StandardDeviation>(input, period),
+                         output, input, period, warmup + period - 1);
+    }
+  }
+}
+
+TEST_P(IndicatorKernelsTest, RollingMaxMatchesHighestBitwise) {
+  for (const size_t warmup : {0, 1, 39}) {
+    const auto& input = MakeSeries(series_size, warmup, 100, warmup + 3);
+
+    for (const size_t period : periods) {
+      vector<double> output(input.size());
+      ASSERT_TRUE(RollingMax(input, period, output));
+
+      ExpectBitEqual(CalculatePerBar<Highest>(input, period), output);
+    }
+  }
+}
+
+TEST_P(IndicatorKernelsTest, RollingMinMatchesLowestBitwise) {
+  for (const size_t warmup : {0, 1, 39}) {
+    const auto& input = MakeSeries(series_size, warmup, 100, warmup + 4);
+
+    for (const size_t period : periods) {
+      vector<double> output(input.size());
+      ASSERT_TRUE(RollingMin(input, period, output));
+
+      ExpectBitEqual(CalculatePerBar<Lowest>(input, period), output);
+    }
+  }
+}
+
+TEST_P(IndicatorKernelsTest, TrueRangeMatchesIndicatorBitwise) {
+  for (const size_t size : {size_t{0}, size_t{1}, size_t{2}, size_t{5},
+                            size_t{9}, size_t{17}, series_size}) {
+    const auto& bars = SyntheticMarketData::MakeTradingBars(
+        static_cast<int64_t>(size), size + 5);
+
+    vector<double> output(bars.size());
+    kernel::TrueRange(bars, output);
+
+    // 첫 바는 이전 종가가 없으므로 지표와 커널 모두 NaN
+    if (!bars.empty()) {
+      EXPECT_TRUE(isnan(output[0]));
+    }
+
+    ExpectBitEqual(CalculateTrueRangePerBar(bars), output);
+  }
+}
+
+TEST_P(IndicatorKernelsTest, RollingKernelsHandleShortInput) {
+  // 첫 윈도우가 완성되지 않는 입력은 모두 NaN
+  const auto& input = MakeSeries(10, 3, 100, 6);
+
+  vector<double> output(input.size());
+  ASSERT_TRUE(RollingMean(input, 8, output));
+  EXPECT_TRUE(ranges::all_of(output, [](const double v) { return isnan(v); }));
+
+  ASSERT_TRUE(RollingMax(input, 8, output));
+  EXPECT_TRUE(ranges::all_of(output, [](const double v) { return isnan(v); }));
+}
+
+TEST_P(IndicatorKernelsTest, RollingKernelsRejectNonFiniteInput) {
+  // 준비 구간 이후의 NaN과 무한대는 바마다 계산하는 경로로 대체해야 함
+  auto input = MakeSeries(100, 5, 100, 7);
+  vector<double> output(input.size());
+
+  input[50] = NAN;
+  EXPECT_FALSE(RollingMean(input, 10, output));
+  EXPECT_FALSE(RollingStandardDeviation(input, 10, output));
+  EXPECT_FALSE(RollingMax(input, 10, output));
+  EXPECT_FALSE(RollingMin(input, 10, output));
+
+  input[50] = INFINITY;
+  EXPECT_FALSE(RollingMean(input, 10, output));
+  EXPECT_FALSE(RollingMax(input, 10, output));
+
+  EXPECT_FALSE(RollingMean(input, 0, output));
+}
+
+TEST_P(IndicatorKernelsTest, CrossKernelsMatchNumericComparison) {
+  // 오차 이내의 차이, 같은 값, NaN, 무한대가 섞인 두 시계열
+  auto lhs = MakeSeries(1000, 10, 100, 8);
+  auto rhs = MakeSeries(1000, 10, 100, 9);
+  for (size_t i = 10; i < lhs.size(); i += 7) {
+    rhs[i] = lhs[i] * (1 + (i % 3 == 0 ? 1e-13 : 0)) + (i % 5 == 0 ? 0.01 : 0);
+  }
+
+  lhs[500] = NAN;
+  rhs[700] = INFINITY;
+  lhs[701] = INFINITY;
+  rhs[701] = INFINITY;
+
+  // 비교 방식을 지정한 커널은 빌드 옵션과 관계없이 모든 비교 방식을 지원함
+  ExpectCrossMatchesComparison<ComparisonMode::RELATIVE>(lhs, rhs, 0);
+  ExpectCrossMatchesComparison<ComparisonMode::ABSOLUTE>(lhs, rhs, 0.02);
+  ExpectCrossMatchesComparison<ComparisonMode::EXACT>(lhs, rhs, 0);
+
+  // 비교 방식을 지정하지 않은 커널은 현재 비교 방식의 Numeric 비교와 같음
+  vector<uint8_t> over(lhs.size());
+  vector<uint8_t> under(lhs.size());
+  CrossOver(lhs, rhs, over);
+  CrossUnder(lhs, rhs, under);
+
+  for (size_t i = 1; i < lhs.size(); ++i) {
+    const Numeric current(lhs[i]);
+    const Numeric prev(lhs[i - 1]);
+
+    EXPECT_EQ(over[i], current > rhs[i] && prev <= rhs[i - 1])
+        << format("인덱스 [{}]", i);
+    EXPECT_EQ(under[i], current < rhs[i] && prev >= rhs[i - 1])
+        << format("인덱스 [{}]", i);
+  }
+}
+
+TEST(ComparisonPolicyTest, FollowsRuntimeComparisonBuildOption) {
+  if constexpr (ComparisonPolicy::kRuntimeMode) {
+    ComparisonPolicy::Set(ComparisonMode::EXACT, 0);
+    EXPECT_EQ(ComparisonPolicy::GetMode(), ComparisonMode::EXACT);
+    EXPECT_TRUE(Numeric(1.0) != 1.0 + 1e-13);
+
+    ComparisonPolicy::Set(ComparisonMode::RELATIVE, 0);
+  } else {
+    // 비교 방식이 RELATIVE로 고정되어 다른 비교 방식은 설정할 수 없음
+    EXPECT_THROW(ComparisonPolicy::Set(ComparisonMode::EXACT, 0),
+                 runtime_error);
+    EXPECT_NO_THROW(ComparisonPolicy::Set(ComparisonMode::RELATIVE, 0));
+  }
+
+  EXPECT_EQ(ComparisonPolicy::GetMode(), ComparisonMode::RELATIVE);
+  EXPECT_TRUE(Numeric(1.0) == 1.0 + 1e-13);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    SimdLevels, IndicatorKernelsTest,
+    testing::Values(SimdLevel::SCALAR, SimdLevel::AVX2, SimdLevel::AVX512),
+    [](const testing::TestParamInfo<SimdLevel>& info) {
+      return info.param == SimdLevel::AVX512 ? string("AVX512")
+                                             : SimdLevelToString(info.param);
+    });
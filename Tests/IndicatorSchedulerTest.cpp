@@ -0,0 +1,135 @@
+// 표준 라이브러리
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// 외부 라이브러리
+#include <gtest/gtest.h>
+
+// 내부 헤더
+#include "Engines/IndicatorScheduler.hpp"
+
+// 네임 스페이스
+using namespace std;
+using namespace backtesting::indicator;
+
+namespace {
+
+// 모든 작업이 끝날 때까지 대기
+void WaitAll(IndicatorScheduler& scheduler) {
+  while (!scheduler.WaitFor(chrono::milliseconds(10))) {
+  }
+}
+
+}  // namespace
+
+TEST(IndicatorSchedulerTest, RunsTasksAfterDependencies) {
+  // 지표 3개 × 심볼 4개: 심볼은 순서대로, 의존 지표의 같은 심볼 이후 실행
+  constexpr size_t num_indicators = 3;
+  constexpr size_t num_symbols = 4;
+
+  IndicatorScheduler scheduler;
+  mutex order_mutex;
+  vector<size_t> order;
+  vector<vector<size_t>> tasks(num_indicators);
+
+  for (size_t indicator_idx = 0; indicator_idx < num_indicators;
+       ++indicator_idx) {
+    for (size_t symbol_idx = 0; symbol_idx < num_symbols; ++symbol_idx) {
+      vector<size_t> dependencies;
+      if (symbol_idx > 0) {
+        dependencies.push_back(tasks[indicator_idx].back());
+      }
+
+      if (indicator_idx > 0) {
+        dependencies.push_back(tasks[indicator_idx - 1][symbol_idx]);
+      }
+
+      const size_t task_idx = indicator_idx * num_symbols + symbol_idx;
+      tasks[indicator_idx].push_back(scheduler.AddTask(
+          [&, task_idx] {
+            lock_guard lock(order_mutex);
+            order.push_back(task_idx);
+          },
+          dependencies));
+    }
+  }
+
+  scheduler.Start(4);
+  WaitAll(scheduler);
+
+  ASSERT_EQ(order.size(), num_indicators * num_symbols);
+
+  vector<size_t> positions(order.size());
+  for (size_t position = 0; position < order.size(); ++position) {
+    positions[order[position]] = position;
+  }
+
+  for (size_t indicator_idx = 0; indicator_idx < num_indicators;
+       ++indicator_idx) {
+    for (size_t symbol_idx = 0; symbol_idx < num_symbols; ++symbol_idx) {
+      const size_t task_idx = indicator_idx * num_symbols + symbol_idx;
+
+      if (symbol_idx > 0) {
+        EXPECT_LT(positions[task_idx - 1], positions[task_idx]);
+      }
+
+      if (indicator_idx > 0) {
+        EXPECT_LT(positions[task_idx - num_symbols], positions[task_idx]);
+      }
+    }
+  }
+}
+
+TEST(IndicatorSchedulerTest, RethrowsFirstErrorAndSkipsDependents) {
+  IndicatorScheduler scheduler;
+  atomic<int> num_dependent_runs = 0;
+
+  const size_t failing = scheduler.AddTask(
+      [] { throw runtime_error("계산 실패"); }, {});
+  scheduler.AddTask([&] { ++num_dependent_runs; }, {failing});
+
+  scheduler.Start(2);
+
+  EXPECT_THROW(WaitAll(scheduler), runtime_error);
+  EXPECT_EQ(num_dependent_runs, 0);
+}
+
+TEST(IndicatorSchedulerTest, RejectsForwardDependencies) {
+  IndicatorScheduler scheduler;
+
+  EXPECT_THROW(scheduler.AddTask([] {}, {0}), runtime_error);
+}
+
+TEST(IndicatorSchedulerTest, CancelSkipsTasksNotStarted) {
+  IndicatorScheduler scheduler;
+  atomic<bool> release = false;
+  atomic<int> num_runs = 0;
+
+  const size_t blocking = scheduler.AddTask(
+      [&] {
+        while (!release) {
+          this_thread::yield();
+        }
+
+        ++num_runs;
+      },
+      {});
+  scheduler.AddTask([&] { ++num_runs; }, {blocking});
+
+  scheduler.Start(1);
+  EXPECT_FALSE(scheduler.WaitFor(chrono::milliseconds(10)));
+
+  // 실행 중인 작업은 끝까지 실행되고 대기 중인 작업은 실행되지 않음
+  thread releaser([&] {
+    this_thread::sleep_for(chrono::milliseconds(10));
+    release = true;
+  });
+  scheduler.Cancel();
+  releaser.join();
+
+  EXPECT_EQ(num_runs, 1);
+}
@@ -0,0 +1,132 @@
+// 표준 라이브러리
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// 외부 라이브러리
+#include <gtest/gtest.h>
+
+// 내부 헤더
+#include "Engines/IndicatorState.hpp"
+
+// 네임 스페이스
+using namespace std;
+using namespace backtesting::indicator;
+namespace fs = filesystem;
+
+namespace {
+
+// 테스트마다 임시 폴더에 스냅샷 파일을 만들고 삭제
+class IndicatorSnapshotTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    directory_ = fs::temp_directory_path() /
+                 ("IndicatorSnapshotTest_" +
+                  string(testing::UnitTest::GetInstance()
+                             ->current_test_info()
+                             ->name()));
+    fs::create_directories(directory_);
+    path_ = (directory_ / "snapshot.state").string();
+  }
+
+  void TearDown() override {
+    error_code ec;
+    fs::remove_all(directory_, ec);
+  }
+
+  fs::path directory_;
+  string path_;
+};
+
+IndicatorSnapshot MakeSnapshot() {
+  IndicatorSnapshot snapshot;
+  snapshot.output_key = "SMA|1h|output";
+  snapshot.symbols.push_back({100, 0x1234, {1, 2, 3}});
+  snapshot.symbols.push_back({0, 0x5678, {}});
+
+  return snapshot;
+}
+
+}  // namespace
+
+TEST(IndicatorStateTest, RoundTripsValuesAndVectors) {
+  IndicatorState writer;
+  writer.Write(42);
+  writer.Write(3.5);
+  writer.Write(true);
+  writer.Write(vector<double>{1.0, 2.0, 3.0});
+  writer.Write(vector<size_t>{});
+
+  IndicatorState reader(writer.Release());
+
+  int count;
+  double sum;
+  bool can_calculate;
+  vector<double> buffer;
+  vector<size_t> indices = {7};
+
+  reader.Read(count);
+  reader.Read(sum);
+  reader.Read(can_calculate);
+  reader.Read(buffer);
+  reader.Read(indices);
+
+  EXPECT_EQ(count, 42);
+  EXPECT_EQ(sum, 3.5);
+  EXPECT_TRUE(can_calculate);
+  EXPECT_EQ(buffer, (vector{1.0, 2.0, 3.0}));
+  EXPECT_TRUE(indices.empty());
+}
+
+TEST(IndicatorStateTest, ThrowsWhenReadingPastEnd) {
+  IndicatorState writer;
+  writer.Write(1.0);
+
+  IndicatorState reader(writer.Release());
+
+  double value;
+  reader.Read(value);
+  EXPECT_THROW(reader.Read(value), runtime_error);
+}
+
+TEST(IndicatorStateTest, ThrowsWhenVectorSizeIsCorrupted) {
+  IndicatorState writer;
+  writer.Write(static_cast<uint64_t>(1) << 40);
+
+  IndicatorState reader(writer.Release());
+
+  vector<double> values;
+  EXPECT_THROW(reader.Read(values), runtime_error);
+}
+
+TEST_F(IndicatorSnapshotTest, SavesAndLoads) {
+  ASSERT_TRUE(MakeSnapshot().Save(path_, "key"));
+
+  const auto& snapshot = IndicatorSnapshot::Load(path_, "key");
+  ASSERT_NE(snapshot, nullptr);
+
+  EXPECT_EQ(snapshot->output_key, "SMA|1h|output");
+  ASSERT_EQ(snapshot->symbols.size(), 2);
+  EXPECT_EQ(snapshot->symbols[0].num_bars, 100);
+  EXPECT_EQ(snapshot->symbols[0].bars_hash, 0x1234);
+  EXPECT_EQ(snapshot->symbols[0].state, (vector<uint8_t>{1, 2, 3}));
+  EXPECT_EQ(snapshot->symbols[1].num_bars, 0);
+  EXPECT_TRUE(snapshot->symbols[1].state.empty());
+}
+
+TEST_F(IndicatorSnapshotTest, RejectsDifferentKey) {
+  ASSERT_TRUE(MakeSnapshot().Save(path_, "key"));
+
+  EXPECT_EQ(IndicatorSnapshot::Load(path_, "other"), nullptr);
+}
+
+TEST_F(IndicatorSnapshotTest, RejectsMissingAndTruncatedFiles) {
+  EXPECT_EQ(IndicatorSnapshot::Load(path_, "key"), nullptr);
+
+  ASSERT_TRUE(MakeSnapshot().Save(path_, "key"));
+  fs::resize_file(path_, fs::file_size(path_) - 1);
+
+  EXPECT_EQ(IndicatorSnapshot::Load(path_, "key"), nullptr);
+}
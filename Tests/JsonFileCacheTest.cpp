@@ -0,0 +1,94 @@
+// 표준 라이브러리
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+// 외부 라이브러리
+#include <gtest/gtest.h>
+
+// 내부 헤더
+#include "Engines/JsonFileCache.hpp"
+
+// 네임 스페이스
+using namespace std;
+using namespace backtesting::engine;
+
+namespace {
+
+class JsonFileCacheTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    JsonFileCache::Clear();
+
+    path_ = (filesystem::temp_directory_path() / "JsonFileCacheTest.json")
+                .string();
+  }
+
+  void TearDown() override {
+    JsonFileCache::Clear();
+    filesystem::remove(path_);
+  }
+
+  void Write(const string& content) const {
+    ofstream file(path_, ios::trunc);
+    file << content;
+  }
+
+  string path_;
+};
+
+}  // namespace
+
+TEST_F(JsonFileCacheTest, ReusesUnchangedFile) {
+  Write(R"([{"symbol": "BTCUSDT"}, {"symbol": "ETHUSDT"}])");
+
+  int num_indexed = 0;
+  const auto indexer = [&num_indexed](const json& data) {
+    num_indexed++;
+
+    unordered_map<string, size_t> symbol_indices;
+    for (size_t idx = 0; idx < data.size(); idx++) {
+      symbol_indices.emplace(data[idx].at("symbol").get<string>(), idx);
+    }
+
+    return symbol_indices;
+  };
+
+  bool reused = true;
+  const auto first = JsonFileCache::Load(path_, "테스트", indexer, &reused);
+  EXPECT_FALSE(reused);
+  EXPECT_EQ(first->symbol_indices.at("ETHUSDT"), 1);
+
+  const auto second = JsonFileCache::Load(path_, "테스트", indexer, &reused);
+  EXPECT_TRUE(reused);
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(num_indexed, 1);
+}
+
+TEST_F(JsonFileCacheTest, ReparsesChangedFile) {
+  Write(R"({"value": 1})");
+  const auto first = JsonFileCache::Load(path_, "테스트");
+
+  // 크기와 수정 시각이 모두 바뀌도록 덮어씀
+  Write(R"({"value": 20})");
+  filesystem::last_write_time(
+      path_, filesystem::last_write_time(path_) + chrono::seconds(1));
+
+  bool reused = true;
+  const auto second = JsonFileCache::Load(path_, "테스트", nullptr, &reused);
+
+  EXPECT_FALSE(reused);
+  EXPECT_EQ(first->data.at("value"), 1);
+  EXPECT_EQ(second->data.at("value"), 20);
+}
+
+TEST_F(JsonFileCacheTest, ThrowsOnMissingOrEmptyFile) {
+  EXPECT_THROW(static_cast<void>(JsonFileCache::Load(path_, "테스트")),
+               runtime_error);
+
+  Write("");
+  EXPECT_THROW(static_cast<void>(JsonFileCache::Load(path_, "테스트")),
+               runtime_error);
+}
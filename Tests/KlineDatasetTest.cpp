@@ -0,0 +1,154 @@
+// 표준 라이브러리
+#include <any>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// 외부 라이브러리
+#include <gtest/gtest.h>
+#include "arrow/api.h"
+
+// 내부 헤더
+#include "Engines/DataUtils.hpp"
+#include "Engines/KlineDataset.hpp"
+
+// 네임 스페이스
+using namespace std;
+using namespace backtesting::utils;
+
+namespace {
+
+constexpr int64_t interval = 60'000;
+
+class KlineDatasetTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    directory_ = (filesystem::temp_directory_path() / "KlineDatasetTest")
+                     .string();
+    filesystem::remove_all(directory_);
+    filesystem::create_directories(directory_);
+
+    base_path_ = directory_ + "/1m.parquet";
+  }
+
+  void TearDown() override { filesystem::remove_all(directory_); }
+
+  /// 첫 Open Time부터 1분 간격의 캔들을 주어진 개수만큼 만드는 함수
+  static shared_ptr<arrow::Table> MakeKlines(const int64_t first_open_time,
+                                             const int64_t num_rows) {
+    arrow::Int64Builder open_time;
+    arrow::DoubleBuilder price;
+    arrow::Int64Builder close_time;
+
+    for (int64_t row = 0; row < num_rows; row++) {
+      const int64_t time = first_open_time + row * interval;
+
+      EXPECT_TRUE(open_time.Append(time).ok());
+      EXPECT_TRUE(price.Append(static_cast<double>(row)).ok());
+      EXPECT_TRUE(close_time.Append(time + interval - 1).ok());
+    }
+
+    shared_ptr<arrow::Array> open_time_array;
+    shared_ptr<arrow::Array> price_array;
+    shared_ptr<arrow::Array> close_time_array;
+    EXPECT_TRUE(open_time.Finish(&open_time_array).ok());
+    EXPECT_TRUE(price.Finish(&price_array).ok());
+    EXPECT_TRUE(close_time.Finish(&close_time_array).ok());
+
+    const auto& schema = arrow::schema(
+        {arrow::field("Open Time", arrow::int64()),
+         arrow::field("Open", arrow::float64()),
+         arrow::field("High", arrow::float64()),
+         arrow::field("Low", arrow::float64()),
+         arrow::field("Close", arrow::float64()),
+         arrow::field("Volume", arrow::float64()),
+         arrow::field("Close Time", arrow::int64())});
+
+    return arrow::Table::Make(
+        schema, {open_time_array, price_array, price_array, price_array,
+                 price_array, price_array, close_time_array});
+  }
+
+  /// 데이터셋을 읽어 Open Time이 끊김 없이 이어지는지 확인하는 함수
+  void ExpectContinuous(const int64_t num_rows) const {
+    const auto& table = KlineDataset::ReadBatch({base_path_}, {}).front();
+
+    ASSERT_EQ(table->num_rows(), num_rows);
+    ASSERT_EQ(table->column(0)->num_chunks(), 1);
+
+    for (int64_t row = 0; row < num_rows; row++) {
+      EXPECT_EQ(any_cast<int64_t>(GetCellValue(table, 0, row)),
+                row * interval);
+    }
+  }
+
+  string directory_;
+  string base_path_;
+};
+
+}  // namespace
+
+TEST_F(KlineDatasetTest, AppendsFragmentsWithoutRewritingBase) {
+  KlineDataset::WriteBase(MakeKlines(0, 100), base_path_, false, false);
+  const auto base_write_time = filesystem::last_write_time(base_path_);
+
+  KlineDataset::Append(MakeKlines(100 * interval, 10), base_path_, false,
+                       false);
+  KlineDataset::Append(MakeKlines(110 * interval, 5), base_path_, false,
+                       false);
+
+  // 기본 파일은 그대로이고 추가분은 조각으로 기록됨
+  EXPECT_EQ(filesystem::last_write_time(base_path_), base_write_time);
+
+  const auto& manifest = KlineDataset::LoadManifest(base_path_);
+  EXPECT_EQ(manifest.base.num_rows, 100);
+  ASSERT_EQ(manifest.fragments.size(), 2);
+  EXPECT_EQ(manifest.GetNumRows(), 115);
+  EXPECT_EQ(manifest.GetLastPart().last_open_time, 114 * interval);
+  EXPECT_EQ(manifest.GetLastPart().last_close_time, 115 * interval - 1);
+
+  ExpectContinuous(115);
+}
+
+TEST_F(KlineDatasetTest, RejectsOverlappingAppend) {
+  KlineDataset::WriteBase(MakeKlines(0, 10), base_path_, false, false);
+
+  EXPECT_THROW(KlineDataset::Append(MakeKlines(9 * interval, 2), base_path_,
+                                    false, false),
+               runtime_error);
+
+  EXPECT_TRUE(KlineDataset::LoadManifest(base_path_).fragments.empty());
+}
+
+TEST_F(KlineDatasetTest, CompactsWhenFragmentsReachLimit) {
+  KlineDataset::WriteBase(MakeKlines(0, 10), base_path_, false, false);
+
+  for (size_t i = 0; i < KlineDataset::max_fragments; i++) {
+    KlineDataset::Append(
+        MakeKlines(static_cast<int64_t>(10 + i) * interval, 1), base_path_,
+        false, false);
+  }
+
+  const auto& manifest = KlineDataset::LoadManifest(base_path_);
+  EXPECT_TRUE(manifest.fragments.empty());
+  EXPECT_EQ(manifest.base.num_rows, 10 + KlineDataset::max_fragments);
+  EXPECT_FALSE(
+      filesystem::exists(KlineDataset::GetFragmentDirectory(base_path_)));
+
+  ExpectContinuous(10 + KlineDataset::max_fragments);
+}
+
+TEST_F(KlineDatasetTest, ReadsFileWithoutManifest) {
+  // 매니페스트 없이 저장된 기존 파일은 기본 파일만으로 읽힘
+  TableToParquet(MakeKlines(0, 20), directory_, "1m.parquet", false, false);
+  ExpectContinuous(20);
+
+  // 업데이트 시 시간 열만 읽어 매니페스트를 만든 후 조각을 추가함
+  KlineDataset::Append(MakeKlines(20 * interval, 3), base_path_, false, false);
+
+  EXPECT_TRUE(filesystem::exists(KlineDataset::GetManifestPath(base_path_)));
+  ExpectContinuous(23);
+}
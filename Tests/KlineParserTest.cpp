@@ -0,0 +1,70 @@
+// 표준 라이브러리
+#include <stdexcept>
+#include <string>
+
+// 외부 라이브러리
+#include <gtest/gtest.h>
+
+// 내부 헤더
+#include "Engines/KlineParser.hpp"
+
+// 네임 스페이스
+using namespace std;
+using namespace backtesting::fetcher;
+
+TEST(KlineParserTest, ParsesKlinesIntoColumns) {
+  // 8번째 이후 필드는 무시되고 가격은 문자열과 숫자 모두 허용
+  const string& body =
+      R"([[1000,"1.5","2.25","0.5","1.75","100",1999,"150.0",10,"50","75"],)"
+      R"( [2000, 1.75, 3, 1, 2.5, "200.5", 2999]])";
+
+  KlineColumns columns;
+  ASSERT_TRUE(ParseKlines(body, columns));
+
+  ASSERT_EQ(columns.Size(), 2);
+  EXPECT_EQ(columns.open_time, (vector<int64_t>{1000, 2000}));
+  EXPECT_EQ(columns.open, (vector{1.5, 1.75}));
+  EXPECT_EQ(columns.high, (vector{2.25, 3.0}));
+  EXPECT_EQ(columns.low, (vector{0.5, 1.0}));
+  EXPECT_EQ(columns.close, (vector{1.75, 2.5}));
+  EXPECT_EQ(columns.volume, (vector{100.0, 200.5}));
+  EXPECT_EQ(columns.close_time, (vector<int64_t>{1999, 2999}));
+
+  // 다음 페이지는 기존 열 뒤에 추가됨
+  ASSERT_TRUE(ParseKlines(R"([[3000,"1","1","1","1","1",3999]])", columns));
+  EXPECT_EQ(columns.Size(), 3);
+  EXPECT_EQ(columns.close_time.back(), 3999);
+
+  columns.PopBack();
+  EXPECT_EQ(columns.Size(), 2);
+  EXPECT_EQ(columns.open.size(), 2);
+}
+
+TEST(KlineParserTest, ReportsEmptyAndErrorResponses) {
+  KlineColumns columns;
+
+  EXPECT_TRUE(ParseKlines("[]", columns));
+  EXPECT_TRUE(columns.Empty());
+
+  EXPECT_FALSE(ParseKlines(R"({"code":-1121,"msg":"Invalid symbol."})",
+                           columns));
+  EXPECT_TRUE(columns.Empty());
+}
+
+TEST(KlineParserTest, RejectsMalformedKlines) {
+  KlineColumns columns;
+
+  // 필드 수 부족
+  EXPECT_THROW(ParseKlines(R"([[1000,"1","1","1","1","1"]])", columns),
+               runtime_error);
+
+  // 숫자로 변환할 수 없는 가격
+  EXPECT_THROW(ParseKlines(R"([[1000,"1","x","1","1","1",1999]])", columns),
+               runtime_error);
+
+  // 잘린 응답
+  EXPECT_THROW(ParseKlines(R"([[1000,"1","1")", columns), runtime_error);
+
+  // 잘못된 캔들은 열에 추가되지 않음
+  EXPECT_TRUE(columns.Empty());
+}
@@ -0,0 +1,143 @@
+﻿// 표준 라이브러리
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 내부 헤더
+#include "Engines/Logger.hpp"
+
+// 네임 스페이스
+using namespace std;
+using namespace backtesting::logger;
+
+/*
+ * N개의 생산자 스레드가 각자 실행을 등록하고 동시에 로그를 기록하는
+ * 스트레스 벤치마크.
+ *
+ * 사용법: LoggerStressBenchmark [생산자 수] [생산자당 로그 수]
+ *
+ * 짝수 번째 로그는 LOG_DEFERRED, 홀수 번째 로그는 Log로 기록하여
+ * 두 경로를 섞은 뒤, 실행별 백테스팅 로그 파일에 모든 로그가 정확히 한 번씩
+ * 온전한 라인으로 기록되었는지 검증함
+ */
+int main(const int argc, char* argv[]) {
+  const int num_producers =
+      argc > 1 ? atoi(argv[1])
+               : static_cast<int>(max(2u, thread::hardware_concurrency()));
+  const int logs_per_producer = argc > 2 ? atoi(argv[2]) : 100000;
+
+  const auto log_directory =
+      filesystem::temp_directory_path() / "LoggerStressBenchmark";
+  filesystem::remove_all(log_directory);
+
+  Logger::SetLogDirectory(log_directory.string());
+  const auto& logger = Logger::GetLogger();
+
+  // 생산자마다 실행 등록
+  vector<uint32_t> run_ids(num_producers);
+  vector<filesystem::path> run_log_paths(num_producers);
+
+  for (int producer_idx = 0; producer_idx < num_producers; ++producer_idx) {
+    run_log_paths[producer_idx] =
+        log_directory / format("run-{}", producer_idx) / "backtesting.log";
+    run_ids[producer_idx] = logger->RegisterRun(
+        format("run-{}", producer_idx), run_log_paths[producer_idx].string());
+  }
+
+  // 동시 로깅
+  const auto start_time = chrono::steady_clock::now();
+
+  vector<thread> producers;
+  producers.reserve(num_producers);
+
+  for (int producer_idx = 0; producer_idx < num_producers; ++producer_idx) {
+    producers.emplace_back([&, producer_idx] {
+      LogRunScope run_scope(run_ids[producer_idx]);
+
+      for (int seq = 0; seq < logs_per_producer; ++seq) {
+        if (seq % 2 == 0) {
+          LOG_DEFERRED(logger, INFO_L, "producer {} seq {} value {}",
+                       producer_idx, seq, seq * 0.5);
+        } else {
+          logger->Log(INFO_L,
+                      format("producer {} seq {} value {}", producer_idx, seq,
+                             seq * 0.5),
+                      __FILE__, __LINE__);
+        }
+      }
+    });
+  }
+
+  for (auto& producer : producers) {
+    producer.join();
+  }
+
+  const auto produce_time = chrono::steady_clock::now() - start_time;
+
+  // 실행별 로그 파일 기록 완료
+  for (const auto run_id : run_ids) {
+    logger->UnregisterRun(run_id);
+  }
+
+  const auto total_time = chrono::steady_clock::now() - start_time;
+
+  // 검증
+  bool all_passed = true;
+
+  for (int producer_idx = 0; producer_idx < num_producers; ++producer_idx) {
+    ifstream run_log(run_log_paths[producer_idx]);
+    const string run_tag = format("[run-{}]", producer_idx);
+    const string prefix = format("producer {} seq ", producer_idx);
+
+    vector<bool> seen(logs_per_producer, false);
+    int num_lines = 0;
+    int num_broken = 0;
+
+    for (string line; getline(run_log, line);) {
+      ++num_lines;
+
+      const size_t prefix_pos = line.find(prefix);
+      if (line.find(run_tag) == string::npos || prefix_pos == string::npos) {
+        ++num_broken;
+        continue;
+      }
+
+      const int seq = atoi(line.c_str() + prefix_pos + prefix.size());
+      if (seq < 0 || seq >= logs_per_producer || seen[seq]) {
+        ++num_broken;
+        continue;
+      }
+
+      seen[seq] = true;
+    }
+
+    if (num_lines != logs_per_producer || num_broken != 0) {
+      all_passed = false;
+      cout << format("[run-{}] 실패: 라인 {}개 (기대 {}개), 손상 {}개",
+                     producer_idx, num_lines, logs_per_producer, num_broken)
+           << endl;
+    }
+  }
+
+  const double produce_seconds =
+      chrono::duration<double>(produce_time).count();
+  const double total_seconds = chrono::duration<double>(total_time).count();
+  const double total_logs =
+      static_cast<double>(num_producers) * logs_per_producer;
+
+  cout << format(
+              "생산자 {}개 × {}개 로그 | 생산 {:.3f}초 ({:.0f} logs/s) | "
+              "기록 완료 {:.3f}초 ({:.0f} logs/s) | 검증 {}",
+              num_producers, logs_per_producer, produce_seconds,
+              total_logs / produce_seconds, total_seconds,
+              total_logs / total_seconds, all_passed ? "성공" : "실패")
+       << endl;
+
+  return all_passed ? 0 : 1;
+}
@@ -0,0 +1,177 @@
+// 표준 라이브러리
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// 내부 헤더
+#include "Engines/IndicatorKernels.hpp"
+#include "Engines/Numeric.hpp"
+
+// 네임 스페이스
+using namespace std;
+using namespace backtesting::kernel;
+using namespace backtesting::numeric;
+
+namespace {
+
+/// 서로 자주 교차하는 두 이동 평균 형태의 시계열을 생성하는 함수
+void MakeSeries(const size_t size, vector<double>& fast,
+                vector<double>& slow) {
+  mt19937_64 engine(42);
+  normal_distribution distribution(0.0, 0.01);
+
+  fast.resize(size);
+  slow.resize(size);
+
+  double price = 100;
+  double fast_value = price;
+  double slow_value = price;
+  for (size_t i = 0; i < size; ++i) {
+    price *= exp(distribution(engine));
+    fast_value += (price - fast_value) / 10;
+    slow_value += (price - slow_value) / 40;
+
+    fast[i] = fast_value;
+    slow[i] = slow_value;
+  }
+}
+
+/// 전략에서 바마다 Numeric으로 교차를 판정하는 경로
+int64_t CountCrossPerBar(const vector<double>& fast,
+                         const vector<double>& slow) {
+  int64_t count = 0;
+  for (size_t i = 1; i < fast.size(); ++i) {
+    const Numeric current(fast[i]);
+    const Numeric prev(fast[i - 1]);
+
+    count += current > slow[i] && prev <= slow[i - 1];
+    count += current < slow[i] && prev >= slow[i - 1];
+  }
+
+  return count;
+}
+
+/// 교차 커널로 모든 바를 한 번에 판정하는 경로
+int64_t CountCrossBatch(const vector<double>& fast, const vector<double>& slow,
+                        vector<uint8_t>& over, vector<uint8_t>& under) {
+  CrossOver(fast, slow, over);
+  CrossUnder(fast, slow, under);
+
+  int64_t count = 0;
+  for (size_t i = 0; i < fast.size(); ++i) {
+    count += over[i] + under[i];
+  }
+
+  return count;
+}
+
+template <typename Function>
+double MeasureNsPerBar(const size_t num_bars, const int repeats,
+                       Function&& function) {
+  const auto start_time = chrono::steady_clock::now();
+  for (int repeat = 0; repeat < repeats; ++repeat) {
+    function();
+  }
+
+  return chrono::duration<double, nano>(chrono::steady_clock::now() -
+                                        start_time)
+             .count() /
+         (static_cast<double>(num_bars) * repeats);
+}
+
+string ModeToString(const ComparisonMode mode) {
+  switch (mode) {
+    case ComparisonMode::EXACT: {
+      return "EXACT";
+    }
+
+    case ComparisonMode::ABSOLUTE: {
+      return "ABSOLUTE";
+    }
+
+    default: {
+      return "RELATIVE";
+    }
+  }
+}
+
+}  // namespace
+
+/*
+ * Numeric 비교 방식별 교차 판정 처리량 벤치마크.
+ *
+ * 사용법: NumericComparisonBenchmark [바 수] [반복 수]
+ *
+ * 전략 콜백에서 바마다 Numeric 비교 연산자로 상향 및 하향 교차를 판정하는
+ * 경로와, CrossOver/CrossUnder 커널로 모든 바를 한 번에 판정하는 경로의
+ * 바당 시간을 비교 방식과 SIMD 수준별로 출력함. 같은 비교 방식에서 두 경로의
+ * 교차 횟수가 다르면 실패로 종료함. 기본 빌드에서는 RELATIVE만 측정하며,
+ * BACKTESTING_RUNTIME_COMPARISON 빌드와 비교하면 비교 방식 분기의 비용을
+ * 측정할 수 있음
+ */
+int main(const int argc, char* argv[]) {
+  const size_t num_bars = argc > 1 ? strtoull(argv[1], nullptr, 10) : 1000000;
+  const int repeats = argc > 2 ? atoi(argv[2]) : 20;
+
+  vector<double> fast;
+  vector<double> slow;
+  MakeSeries(num_bars, fast, slow);
+
+  vector<uint8_t> over(num_bars);
+  vector<uint8_t> under(num_bars);
+
+  int exit_code = 0;
+  for (const auto mode : {ComparisonMode::RELATIVE, ComparisonMode::ABSOLUTE,
+                          ComparisonMode::EXACT}) {
+    // RELATIVE 고정 빌드에서는 다른 비교 방식을 설정할 수 없음
+    if (!ComparisonPolicy::kRuntimeMode && mode != ComparisonMode::RELATIVE) {
+      cout << format("[{:<8}] BACKTESTING_RUNTIME_COMPARISON 빌드가 아니므로 "
+                     "건너뜀\n",
+                     ModeToString(mode));
+      continue;
+    }
+
+    ComparisonPolicy::Set(mode, 1e-9);
+
+    int64_t per_bar_count = 0;
+    const double per_bar_ns = MeasureNsPerBar(num_bars, repeats, [&] {
+      per_bar_count = CountCrossPerBar(fast, slow);
+    });
+
+    cout << format("[{:<8}] 바마다 비교: {:.3f} ns/bar (교차 {}회)\n",
+                   ModeToString(mode), per_bar_ns, per_bar_count);
+
+    for (const auto simd_level :
+         {SimdLevel::SCALAR, SimdLevel::AVX2, SimdLevel::AVX512}) {
+      if (simd_level > DetectSimdLevel()) {
+        continue;
+      }
+
+      SetSimdLevel(simd_level);
+
+      int64_t batch_count = 0;
+      const double batch_ns = MeasureNsPerBar(num_bars, repeats, [&] {
+        batch_count = CountCrossBatch(fast, slow, over, under);
+      });
+
+      cout << format("[{:<8}] 교차 커널 {:<7}: {:.3f} ns/bar (교차 {}회)\n",
+                     ModeToString(mode), SimdLevelToString(simd_level),
+                     batch_ns, batch_count);
+
+      if (batch_count != per_bar_count) {
+        exit_code = 1;
+      }
+    }
+  }
+
+  SetSimdLevel(DetectSimdLevel());
+  ComparisonPolicy::Set(ComparisonMode::RELATIVE, 0);
+
+  return exit_code;
+}
@@ -0,0 +1,138 @@
+// 표준 라이브러리
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// 외부 라이브러리
+#include <gtest/gtest.h>
+
+#include "nlohmann/json.hpp"
+
+// 내부 헤더
+#include "Engines/ProgressReporter.hpp"
+
+// 네임 스페이스
+using namespace std;
+using namespace backtesting::engine;
+using namespace nlohmann;
+
+namespace {
+
+// 출력된 프레임 줄들을 접두사를 제거한 Json으로 파싱
+vector<ordered_json> ParseFrames(const string& output) {
+  const string prefix = "진행 상황";
+
+  vector<ordered_json> frames;
+  istringstream stream(output);
+  string line;
+  while (getline(stream, line)) {
+    EXPECT_EQ(line.rfind(prefix, 0), 0);
+    frames.push_back(ordered_json::parse(line.substr(prefix.size())));
+  }
+
+  return frames;
+}
+
+}  // namespace
+
+TEST(ProgressReporterTest, OutputsNothingBeforeStart) {
+  ostringstream output;
+  ProgressReporter reporter(chrono::milliseconds(0), output);
+
+  reporter.BeginPhase("initialize");
+  reporter.Update(1, 1, 0, 100);
+  reporter.Finish();
+
+  EXPECT_FALSE(reporter.IsStarted());
+  EXPECT_TRUE(output.str().empty());
+}
+
+TEST(ProgressReporterTest, ThrottlesUpdatesByInterval) {
+  ostringstream output;
+  ProgressReporter reporter(chrono::hours(1), output);
+
+  reporter.Start();
+  reporter.BeginPhase("backtesting");
+
+  // 단계 시작 프레임 이후의 갱신은 간격이 지나지 않아 출력되지 않음
+  for (int i = 1; i <= 1000; i++) {
+    reporter.Update(i, i, 0, 100);
+  }
+
+  EXPECT_EQ(ParseFrames(output.str()).size(), 1);
+}
+
+TEST(ProgressReporterTest, FinishReportsLatestThrottledUpdate) {
+  ostringstream output;
+  ProgressReporter reporter(chrono::hours(1), output);
+
+  reporter.Start();
+  reporter.SetTimeRange(0, 100);
+  reporter.BeginPhase("backtesting");
+
+  // 간격이 지나지 않아 출력되지 않은 갱신도 마지막 프레임에 반영됨
+  reporter.Update(40, 4, 1, 1000);
+  reporter.Update(70, 7, 2, 1100);
+  reporter.Update(100, 10, 3, 1234.5);
+  reporter.BeginPhase("save");
+  reporter.Finish();
+
+  const auto& frames = ParseFrames(output.str());
+  ASSERT_EQ(frames.size(), 3);
+
+  // 단계 변경 프레임은 최신 값을 출력
+  EXPECT_EQ(frames[1]["phase"], "save");
+  EXPECT_EQ(frames[1]["bars"], 10);
+
+  const auto& last = frames.back();
+  EXPECT_TRUE(last["done"].get<bool>());
+  EXPECT_EQ(last["simulatedTime"], 100);
+  EXPECT_DOUBLE_EQ(last["progress"].get<double>(), 1.0);
+  EXPECT_EQ(last["bars"], 10);
+  EXPECT_EQ(last["trades"], 3);
+  EXPECT_DOUBLE_EQ(last["walletBalance"].get<double>(), 1234.5);
+}
+
+TEST(ProgressReporterTest, ReportsProgressAndPhases) {
+  ostringstream output;
+  ProgressReporter reporter(chrono::milliseconds(0), output);
+
+  reporter.Start("job-1");
+  reporter.BeginPhase("initialize");
+  reporter.SetTimeRange(0, 100);
+  reporter.BeginPhase("backtesting");
+  reporter.Update(25, 10, 2, 1500.5);
+  reporter.BeginPhase("save");
+  reporter.Finish();
+
+  const auto& frames = ParseFrames(output.str());
+  ASSERT_EQ(frames.size(), 5);
+
+  // 모든 프레임은 작업 아이디로 구분됨
+  for (const auto& frame : frames) {
+    EXPECT_EQ(frame["jobId"], "job-1");
+  }
+
+  const auto& update = frames[2];
+  EXPECT_EQ(update["phase"], "backtesting");
+  EXPECT_EQ(update["simulatedTime"], 25);
+  EXPECT_DOUBLE_EQ(update["progress"].get<double>(), 0.25);
+  EXPECT_EQ(update["bars"], 10);
+  EXPECT_EQ(update["trades"], 2);
+  EXPECT_DOUBLE_EQ(update["walletBalance"].get<double>(), 1500.5);
+  EXPECT_FALSE(update["done"].get<bool>());
+
+  // 마지막 프레임은 끝난 모든 단계의 소요 시간을 순서대로 포함
+  const auto& last = frames.back();
+  EXPECT_TRUE(last["done"].get<bool>());
+  EXPECT_TRUE(last["etaMs"].is_null());
+
+  vector<string> phases;
+  for (const auto& [phase, elapsed_ms] : last["phasesMs"].items()) {
+    phases.push_back(phase);
+  }
+
+  EXPECT_EQ(phases, (vector<string>{"initialize", "backtesting", "save"}));
+  EXPECT_FALSE(reporter.IsStarted());
+}
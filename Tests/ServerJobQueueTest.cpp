@@ -0,0 +1,253 @@
+// 표준 라이브러리
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// 외부 라이브러리
+#include <gtest/gtest.h>
+
+// 내부 헤더
+#include "Engines/Backtesting.hpp"
+#include "Engines/ServerJobQueue.hpp"
+
+// 네임 스페이스
+using namespace std;
+using namespace backtesting::main;
+
+namespace {
+
+// 작업 상태 변경을 기록하고 특정 상태가 될 때까지 대기
+class StatusRecorder {
+ public:
+  void Record(const ServerJob& job, const ServerJobStatus status) {
+    lock_guard lock(mutex_);
+    statuses_.emplace_back(job.id, status);
+    cv_.notify_all();
+  }
+
+  void WaitFor(const string& id, const ServerJobStatus status) {
+    unique_lock lock(mutex_);
+    ASSERT_TRUE(cv_.wait_for(lock, chrono::seconds(5), [&] {
+      return ranges::find(statuses_, pair(id, status)) != statuses_.end();
+    }));
+  }
+
+  vector<pair<string, ServerJobStatus>> Get() {
+    lock_guard lock(mutex_);
+    return statuses_;
+  }
+
+ private:
+  mutex mutex_;
+  condition_variable cv_;
+  vector<pair<string, ServerJobStatus>> statuses_;
+};
+
+// 해제될 때까지 작업 실행을 붙잡아 두는 관문
+class Gate {
+ public:
+  void Wait() {
+    unique_lock lock(mutex_);
+    cv_.wait(lock, [this] { return is_open_; });
+  }
+
+  void Open() {
+    lock_guard lock(mutex_);
+    is_open_ = true;
+    cv_.notify_all();
+  }
+
+ private:
+  mutex mutex_;
+  condition_variable cv_;
+  bool is_open_ = false;
+};
+
+}  // namespace
+
+TEST(ServerJobQueueTest, RunsJobsInArrivalOrder) {
+  StatusRecorder recorder;
+  mutex order_mutex;
+  vector<string> order;
+
+  ServerJobQueue queue(
+      8,
+      [&](const ServerJob& job) {
+        lock_guard lock(order_mutex);
+        order.push_back(job.id + ":" + job.payload);
+      },
+      [&](const ServerJob& job, const ServerJobStatus status) {
+        recorder.Record(job, status);
+      });
+
+  EXPECT_TRUE(queue.Submit("a", ServerJobType::RUN_SINGLE_BACKTESTING, "1"));
+  EXPECT_TRUE(queue.Submit("b", ServerJobType::FETCH_OR_UPDATE_BAR_DATA, "2"));
+  EXPECT_TRUE(queue.Submit("c", ServerJobType::RUN_SINGLE_BACKTESTING, "3"));
+
+  recorder.WaitFor("c", ServerJobStatus::COMPLETED);
+
+  EXPECT_EQ(order, (vector<string>{"a:1", "b:2", "c:3"}));
+
+  // 작업마다 대기 → 실행 → 완료 순서로 보고
+  vector<ServerJobStatus> a_statuses;
+  for (const auto& [id, status] : recorder.Get()) {
+    if (id == "a") {
+      a_statuses.push_back(status);
+    }
+  }
+
+  EXPECT_EQ(a_statuses,
+            (vector{ServerJobStatus::QUEUED, ServerJobStatus::RUNNING,
+                    ServerJobStatus::COMPLETED}));
+}
+
+TEST(ServerJobQueueTest, RejectsWhenFullOrDuplicate) {
+  StatusRecorder recorder;
+  Gate gate;
+
+  ServerJobQueue queue(
+      1, [&](const ServerJob&) { gate.Wait(); },
+      [&](const ServerJob& job, const ServerJobStatus status) {
+        recorder.Record(job, status);
+      });
+
+  // 실행 중인 작업은 대기 개수에 포함되지 않음
+  ASSERT_TRUE(queue.Submit("a", ServerJobType::RUN_SINGLE_BACKTESTING, ""));
+  recorder.WaitFor("a", ServerJobStatus::RUNNING);
+
+  EXPECT_FALSE(queue.Submit("a", ServerJobType::RUN_SINGLE_BACKTESTING, ""));
+  EXPECT_TRUE(queue.Submit("b", ServerJobType::RUN_SINGLE_BACKTESTING, ""));
+  EXPECT_FALSE(queue.Submit("c", ServerJobType::RUN_SINGLE_BACKTESTING, ""));
+  EXPECT_EQ(queue.GetNumQueued(), 1);
+
+  gate.Open();
+  recorder.WaitFor("b", ServerJobStatus::COMPLETED);
+
+  const auto& statuses = recorder.Get();
+  const auto is_rejected = [&statuses](const string& id) {
+    return ranges::find(statuses, pair(id, ServerJobStatus::REJECTED)) !=
+           statuses.end();
+  };
+
+  EXPECT_TRUE(is_rejected("a"));
+  EXPECT_TRUE(is_rejected("c"));
+}
+
+TEST(ServerJobQueueTest, CancelsQueuedAndRunningJobs) {
+  StatusRecorder recorder;
+  atomic<bool> b_ran = false;
+
+  ServerJobQueue queue(
+      8,
+      [&](const ServerJob& job) {
+        if (job.id == "b") {
+          b_ran = true;
+          return;
+        }
+
+        // 실행 중인 작업은 취소 토큰을 확인하여 스스로 중지
+        while (!job.cancel_requested->load()) {
+          this_thread::sleep_for(chrono::milliseconds(1));
+        }
+      },
+      [&](const ServerJob& job, const ServerJobStatus status) {
+        recorder.Record(job, status);
+      });
+
+  ASSERT_TRUE(queue.Submit("a", ServerJobType::RUN_SINGLE_BACKTESTING, ""));
+  ASSERT_TRUE(queue.Submit("b", ServerJobType::RUN_SINGLE_BACKTESTING, ""));
+  recorder.WaitFor("a", ServerJobStatus::RUNNING);
+
+  EXPECT_TRUE(queue.Cancel("b"));
+  EXPECT_FALSE(queue.Cancel("missing"));
+  EXPECT_EQ(queue.GetRunningJobId(), "a");
+
+  EXPECT_TRUE(queue.Cancel("a"));
+  recorder.WaitFor("a", ServerJobStatus::CANCELLED);
+
+  EXPECT_FALSE(b_ran);
+  EXPECT_EQ(queue.GetRunningJobId(), "");
+}
+
+TEST(ServerJobQueueTest, ReportsFailedJobsAndContinues) {
+  StatusRecorder recorder;
+
+  ServerJobQueue queue(
+      8,
+      [](const ServerJob& job) {
+        if (job.id == "a") {
+          throw runtime_error("실패");
+        }
+      },
+      [&](const ServerJob& job, const ServerJobStatus status) {
+        recorder.Record(job, status);
+      });
+
+  ASSERT_TRUE(queue.Submit("a", ServerJobType::RUN_SINGLE_BACKTESTING, ""));
+  ASSERT_TRUE(queue.Submit("b", ServerJobType::RUN_SINGLE_BACKTESTING, ""));
+
+  recorder.WaitFor("a", ServerJobStatus::FAILED);
+  recorder.WaitFor("b", ServerJobStatus::COMPLETED);
+}
+
+TEST(ServerJobQueueTest, ReportsFailedServerJobs) {
+  StatusRecorder recorder;
+  Backtesting::SetServerMode(true);
+
+  {
+    ServerJobQueue queue(
+        8, Backtesting::RunServerJob,
+        [&](const ServerJob& job, const ServerJobStatus status) {
+          recorder.Record(job, status);
+        });
+
+    // 빈 Json은 두 작업 모두 실행 중 예외를 던지며, 서버 작업 실행 함수가
+    // 예외를 전파하므로 작업 큐가 FAILED를 보고함
+    ASSERT_TRUE(queue.Submit("a", ServerJobType::RUN_SINGLE_BACKTESTING, ""));
+    ASSERT_TRUE(
+        queue.Submit("b", ServerJobType::FETCH_OR_UPDATE_BAR_DATA, ""));
+
+    recorder.WaitFor("a", ServerJobStatus::FAILED);
+    recorder.WaitFor("b", ServerJobStatus::FAILED);
+
+    // 실패한 작업의 아이디와 취소 토큰은 정리됨
+    EXPECT_EQ(Backtesting::GetRunningJobId(), "");
+    EXPECT_FALSE(Backtesting::IsStopRequested());
+  }
+
+  Backtesting::SetServerMode(false);
+}
+
+TEST(ServerJobQueueTest, ShutdownCancelsRemainingJobs) {
+  StatusRecorder recorder;
+
+  {
+    ServerJobQueue queue(
+        8,
+        [](const ServerJob& job) {
+          while (!job.cancel_requested->load()) {
+            this_thread::sleep_for(chrono::milliseconds(1));
+          }
+        },
+        [&](const ServerJob& job, const ServerJobStatus status) {
+          recorder.Record(job, status);
+        });
+
+    ASSERT_TRUE(queue.Submit("a", ServerJobType::RUN_SINGLE_BACKTESTING, ""));
+    ASSERT_TRUE(queue.Submit("b", ServerJobType::RUN_SINGLE_BACKTESTING, ""));
+    recorder.WaitFor("a", ServerJobStatus::RUNNING);
+
+    queue.Shutdown();
+    EXPECT_FALSE(queue.Submit("c", ServerJobType::RUN_SINGLE_BACKTESTING, ""));
+  }
+
+  recorder.WaitFor("a", ServerJobStatus::CANCELLED);
+  recorder.WaitFor("b", ServerJobStatus::CANCELLED);
+}
@@ -0,0 +1,451 @@
+#pragma once
+
+// 표준 라이브러리
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// 외부 라이브러리
+#include "arrow/api.h"
+#include "nlohmann/json.hpp"
+
+// 내부 헤더
+#include "Engines/BarData.hpp"
+#include "Engines/DataUtils.hpp"
+#include "Engines/TimeUtils.hpp"
+
+// 네임 스페이스
+using namespace std;
+using json = nlohmann::json;
+
+namespace backtesting::tests {
+
+/// 합성 시장 데이터 생성 설정
+struct SyntheticMarketConfig {
+  int num_symbols = 4;             // 심볼 수
+  int64_t num_trading_bars = 8760;  // 심볼당 트레이딩 바 수
+  string trading_timeframe = "1h";
+  string magnifier_timeframe = "1m";  // 빈 문자열이면 돋보기 바 미생성
+  string reference_timeframe = "1d";  // 빈 문자열이면 참조 바 미생성
+  int64_t start_time = 1672531200000;  // 2023-01-01 00:00:00 UTC
+  uint64_t seed = 42;
+};
+
+/// 한 타임프레임의 OHLCV 바 묶음
+struct SyntheticBars {
+  vector<int64_t> open_time;
+  vector<double> open;
+  vector<double> high;
+  vector<double> low;
+  vector<double> close;
+  vector<double> volume;
+  vector<int64_t> close_time;
+};
+
+/**
+ * 네트워크 없이 결정적인 OHLCV, 마크 가격, 펀딩 비율, 거래소 정보,
+ * 레버리지 구간 데이터를 생성하여 Backtesting::Add* 함수들이 읽는 폴더
+ * 구조로 저장하는 클래스.
+ *
+ * 가격은 심볼별 시드의 mt19937_64에서 직접 만든 정규 난수로 가장 작은
+ * 타임프레임의 로그 수익률을 생성한 뒤 상위 타임프레임으로 집계함.
+ * 표준 분포 클래스는 구현마다 결과가 다르므로 사용하지 않으며,
+ * 따라서 같은 설정이면 플랫폼과 관계없이 같은 데이터가 생성됨
+ */
+class SyntheticMarketData final {
+ public:
+  SyntheticMarketData(SyntheticMarketConfig config, string data_directory)
+      : config_(move(config)), data_directory_(move(data_directory)) {
+    for (int symbol_idx = 0; symbol_idx < config_.num_symbols; ++symbol_idx) {
+      symbol_names_.push_back(format("SYN{:03}USDT", symbol_idx));
+    }
+  }
+
+  /// 데이터를 생성하여 저장하는 함수.
+  /// 같은 설정으로 이미 생성된 데이터가 있으면 생성을 건너뜀
+  void Generate() const {
+    const string& marker_path = data_directory_ + "/synthetic.json";
+    const json& marker = ToJson();
+
+    if (ifstream marker_file(marker_path); marker_file.is_open()) {
+      if (json::parse(marker_file, nullptr, false) == marker) {
+        return;
+      }
+    }
+
+    filesystem::remove_all(data_directory_);
+    filesystem::create_directories(GetFundingRatesDirectory());
+
+    const int64_t trading_ms = utils::ParseTimeframe(config_.trading_timeframe);
+    const bool use_magnifier = !config_.magnifier_timeframe.empty();
+
+    // 가장 작은 타임프레임에서 가격을 생성
+    const string& base_timeframe = GetBaseTimeframe();
+    const int64_t base_ms = utils::ParseTimeframe(base_timeframe);
+    const int64_t num_base_bars =
+        config_.num_trading_bars * (trading_ms / base_ms);
+
+    json exchange_symbols = json::array();
+    json leverage_brackets = json::array();
+
+    for (int symbol_idx = 0; symbol_idx < config_.num_symbols; ++symbol_idx) {
+      const string& symbol_name = symbol_names_[symbol_idx];
+      mt19937_64 rng = MakeSymbolRng(symbol_idx);
+
+      const auto& base_bars = GenerateBaseBars(rng, symbol_idx, base_ms,
+                                               num_base_bars);
+
+      // 트레이딩, 돋보기, 참조 바 저장
+      SaveBars(Aggregate(base_bars, base_ms, trading_ms),
+               format("{}/{}/{}", GetKlinesDirectory(), symbol_name,
+                      config_.trading_timeframe),
+               config_.trading_timeframe + ".parquet");
+
+      if (use_magnifier) {
+        SaveBars(base_bars,
+                 format("{}/{}/{}", GetKlinesDirectory(), symbol_name,
+                        config_.magnifier_timeframe),
+                 config_.magnifier_timeframe + ".parquet");
+      }
+
+      if (!config_.reference_timeframe.empty()) {
+        SaveBars(Aggregate(base_bars, base_ms,
+                           utils::ParseTimeframe(config_.reference_timeframe)),
+                 format("{}/{}/{}", GetKlinesDirectory(), symbol_name,
+                        config_.reference_timeframe),
+                 config_.reference_timeframe + ".parquet");
+      }
+
+      // 마크 가격은 체결 확인 바와 같은 타임프레임으로 저장
+      SaveBars(GenerateMarkPriceBars(rng, base_bars),
+               format("{}/{}", GetMarkPriceKlinesDirectory(), symbol_name),
+               base_timeframe + ".parquet");
+
+      SaveFundingRates(rng, symbol_name, base_bars);
+
+      exchange_symbols.push_back(MakeExchangeSymbol(symbol_name));
+      leverage_brackets.push_back(MakeLeverageBracket(symbol_name));
+    }
+
+    ofstream(GetExchangeInfoPath()) << json{{"symbols", exchange_symbols}};
+    ofstream(GetLeverageBracketPath()) << leverage_brackets;
+
+    // 생성 완료 표시는 마지막에 저장
+    ofstream(marker_path) << marker;
+  }
+
+  /// 파일로 저장하지 않고 한 심볼의 트레이딩 바를 생성하는 함수.
+  /// Generate가 저장하는 트레이딩 바와 같은 값을 반환함
+  [[nodiscard]] vector<bar::Bar> GenerateTradingBars(
+      const int symbol_idx) const {
+    const int64_t trading_ms = utils::ParseTimeframe(config_.trading_timeframe);
+    const int64_t base_ms = utils::ParseTimeframe(GetBaseTimeframe());
+
+    mt19937_64 rng = MakeSymbolRng(symbol_idx);
+    const auto& trading_bars = Aggregate(
+        GenerateBaseBars(rng, symbol_idx, base_ms,
+                         config_.num_trading_bars * (trading_ms / base_ms)),
+        base_ms, trading_ms);
+
+    vector<bar::Bar> bars(trading_bars.open.size());
+    for (size_t bar_idx = 0; bar_idx < bars.size(); ++bar_idx) {
+      bars[bar_idx] = bar::Bar(
+          trading_bars.open_time[bar_idx], trading_bars.open[bar_idx],
+          trading_bars.high[bar_idx], trading_bars.low[bar_idx],
+          trading_bars.close[bar_idx], trading_bars.volume[bar_idx],
+          trading_bars.close_time[bar_idx]);
+    }
+
+    return bars;
+  }
+
+  /// 1분봉 한 심볼의 트레이딩 바를 메모리에 생성하는 함수.
+  /// 파일이 필요 없는 지표, 표현식 테스트의 입력으로 사용
+  [[nodiscard]] static vector<bar::Bar> MakeTradingBars(const int64_t num_bars,
+                                                        const uint64_t seed) {
+    SyntheticMarketConfig config;
+    config.num_symbols = 1;
+    config.num_trading_bars = num_bars;
+    config.trading_timeframe = "1m";
+    config.magnifier_timeframe = "";
+    config.reference_timeframe = "";
+    config.seed = seed;
+
+    return SyntheticMarketData(move(config), "").GenerateTradingBars(0);
+  }
+
+  [[nodiscard]] const vector<string>& GetSymbolNames() const {
+    return symbol_names_;
+  }
+
+  [[nodiscard]] const SyntheticMarketConfig& GetConfig() const {
+    return config_;
+  }
+
+  [[nodiscard]] string GetKlinesDirectory() const {
+    return data_directory_ + "/Continuous Klines";
+  }
+
+  [[nodiscard]] string GetMarkPriceKlinesDirectory() const {
+    return data_directory_ + "/Mark Price Klines";
+  }
+
+  [[nodiscard]] string GetFundingRatesDirectory() const {
+    return data_directory_ + "/Funding Rates";
+  }
+
+  [[nodiscard]] string GetExchangeInfoPath() const {
+    return data_directory_ + "/exchange_info.json";
+  }
+
+  [[nodiscard]] string GetLeverageBracketPath() const {
+    return data_directory_ + "/leverage_bracket.json";
+  }
+
+  /// 생성 설정을 JSON으로 반환하는 함수
+  [[nodiscard]] json ToJson() const {
+    return {{"num_symbols", config_.num_symbols},
+            {"num_trading_bars", config_.num_trading_bars},
+            {"trading_timeframe", config_.trading_timeframe},
+            {"magnifier_timeframe", config_.magnifier_timeframe},
+            {"reference_timeframe", config_.reference_timeframe},
+            {"start_time", config_.start_time},
+            {"seed", config_.seed}};
+  }
+
+  /// 모든 수량 검사를 통과하는 거래소 정보 심볼 객체를 생성하는 함수
+  static json MakeExchangeSymbol(const string& symbol_name) {
+    return {{"symbol", symbol_name},
+            {"contractType", "PERPETUAL"},
+            {"liquidationFee", "0.012500"},
+            {"filters",
+             {{{"filterType", "PRICE_FILTER"}, {"tickSize", "0.01"}},
+              {{"filterType", "LOT_SIZE"},
+               {"maxQty", "1000000"},
+               {"minQty", "0.001"}},
+              {{"filterType", "MARKET_LOT_SIZE"},
+               {"maxQty", "1000000"},
+               {"minQty", "0.001"},
+               {"stepSize", "0.001"}},
+              {{"filterType", "MIN_NOTIONAL"}, {"notional", "5"}}}}};
+  }
+
+  /// 단일 구간의 레버리지 구간 객체를 생성하는 함수
+  static json MakeLeverageBracket(const string& symbol_name) {
+    return {{"symbol", symbol_name},
+            {"brackets",
+             {{{"bracket", 1},
+               {"initialLeverage", 125},
+               {"notionalCap", 1e12},
+               {"notionalFloor", 0.0},
+               {"maintMarginRatio", 0.004},
+               {"cum", 0.0}}}}};
+  }
+
+ private:
+  SyntheticMarketConfig config_;
+  string data_directory_;
+  vector<string> symbol_names_;
+
+  static constexpr int64_t funding_interval = 8LL * 60 * 60 * 1000;  // 8h
+
+  /// 가격을 생성하는 가장 작은 타임프레임을 반환하는 함수
+  [[nodiscard]] const string& GetBaseTimeframe() const {
+    return config_.magnifier_timeframe.empty() ? config_.trading_timeframe
+                                               : config_.magnifier_timeframe;
+  }
+
+  /// 심볼별 시드로 초기화한 난수 생성기를 반환하는 함수
+  [[nodiscard]] mt19937_64 MakeSymbolRng(const int symbol_idx) const {
+    return mt19937_64(config_.seed * 0x9E3779B97F4A7C15ULL + symbol_idx);
+  }
+
+  /// [0, 1) 범위의 균등 난수를 반환하는 함수
+  static double NextUniform(mt19937_64& rng) {
+    return static_cast<double>(rng() >> 11) * 0x1.0p-53;
+  }
+
+  /// Box-Muller 변환으로 표준 정규 난수를 반환하는 함수
+  static double NextNormal(mt19937_64& rng) {
+    const double u1 = max(NextUniform(rng), 1e-300);
+    const double u2 = NextUniform(rng);
+
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * 3.14159265358979323846 * u2);
+  }
+
+  /// 가장 작은 타임프레임의 바를 생성하는 함수.
+  /// 느린 사인 추세를 더해 이동평균 교차가 주기적으로 발생하도록 함
+  [[nodiscard]] SyntheticBars GenerateBaseBars(mt19937_64& rng,
+                                               const int symbol_idx,
+                                               const int64_t base_ms,
+                                               const int64_t num_bars) const {
+    SyntheticBars bars;
+    bars.open_time.resize(num_bars);
+    bars.open.resize(num_bars);
+    bars.high.resize(num_bars);
+    bars.low.resize(num_bars);
+    bars.close.resize(num_bars);
+    bars.volume.resize(num_bars);
+    bars.close_time.resize(num_bars);
+
+    // 1분 기준 변동성을 바 길이에 맞게 조정
+    const double sigma = 0.0008 * sqrt(static_cast<double>(base_ms) / 60000.0);
+    const double trend_period = 3.0 * 24 * 60 * 60 * 1000 / base_ms;  // 3일
+    double price = 100.0 + 37.0 * symbol_idx;
+
+    for (int64_t bar_idx = 0; bar_idx < num_bars; ++bar_idx) {
+      const double trend =
+          0.2 * sigma * sin(2.0 * 3.14159265358979323846 * bar_idx /
+                            trend_period);
+      const double open = price;
+      const double close = open * exp(trend + sigma * NextNormal(rng));
+      const double wick = open * sigma * 0.5;
+
+      bars.open_time[bar_idx] = config_.start_time + bar_idx * base_ms;
+      bars.open[bar_idx] = open;
+      bars.high[bar_idx] =
+          max(open, close) + wick * fabs(NextNormal(rng));
+      bars.low[bar_idx] = min(open, close) - wick * fabs(NextNormal(rng));
+      bars.close[bar_idx] = close;
+      bars.volume[bar_idx] = 1000.0 * (0.5 + NextUniform(rng));
+      bars.close_time[bar_idx] = bars.open_time[bar_idx] + base_ms - 1;
+
+      price = close;
+    }
+
+    return bars;
+  }
+
+  /// 작은 타임프레임의 바를 큰 타임프레임으로 집계하는 함수
+  [[nodiscard]] static SyntheticBars Aggregate(const SyntheticBars& base_bars,
+                                               const int64_t base_ms,
+                                               const int64_t target_ms) {
+    if (target_ms == base_ms) {
+      return base_bars;
+    }
+
+    const size_t group_size = target_ms / base_ms;
+    const size_t num_bars = base_bars.open.size() / group_size;
+
+    SyntheticBars bars;
+    for (size_t bar_idx = 0; bar_idx < num_bars; ++bar_idx) {
+      const size_t begin = bar_idx * group_size;
+      const size_t end = begin + group_size;
+
+      double high = base_bars.high[begin];
+      double low = base_bars.low[begin];
+      double volume = 0;
+
+      for (size_t idx = begin; idx < end; ++idx) {
+        high = max(high, base_bars.high[idx]);
+        low = min(low, base_bars.low[idx]);
+        volume += base_bars.volume[idx];
+      }
+
+      bars.open_time.push_back(base_bars.open_time[begin]);
+      bars.open.push_back(base_bars.open[begin]);
+      bars.high.push_back(high);
+      bars.low.push_back(low);
+      bars.close.push_back(base_bars.close[end - 1]);
+      bars.volume.push_back(volume);
+      bars.close_time.push_back(base_bars.open_time[begin] + target_ms - 1);
+    }
+
+    return bars;
+  }
+
+  /// 시장 가격에 작은 프리미엄을 더해 마크 가격 바를 생성하는 함수
+  [[nodiscard]] static SyntheticBars GenerateMarkPriceBars(
+      mt19937_64& rng, const SyntheticBars& base_bars) {
+    SyntheticBars bars = base_bars;
+
+    for (size_t bar_idx = 0; bar_idx < bars.open.size(); ++bar_idx) {
+      const double premium = 1.0 + 0.0002 * NextNormal(rng);
+
+      bars.open[bar_idx] *= premium;
+      bars.high[bar_idx] *= premium;
+      bars.low[bar_idx] *= premium;
+      bars.close[bar_idx] *= premium;
+      bars.volume[bar_idx] = 0;
+    }
+
+    return bars;
+  }
+
+  /// 8시간 간격의 펀딩 비율을 저장하는 함수
+  void SaveFundingRates(mt19937_64& rng, const string& symbol_name,
+                        const SyntheticBars& base_bars) const {
+    const int64_t base_ms =
+        base_bars.close_time[0] - base_bars.open_time[0] + 1;
+    json funding_rates = json::array();
+
+    for (int64_t funding_time = config_.start_time;
+         funding_time <= base_bars.close_time.back();
+         funding_time += funding_interval) {
+      const auto bar_idx = (funding_time - config_.start_time) / base_ms;
+
+      funding_rates.push_back(
+          {{"symbol", symbol_name},
+           {"fundingTime", funding_time},
+           {"fundingRate", 0.0001 + 0.0001 * NextNormal(rng)},
+           {"markPrice", utils::ToFixedString(base_bars.open[bar_idx], 8)}});
+    }
+
+    ofstream(format("{}/{}.json", GetFundingRatesDirectory(), symbol_name))
+        << funding_rates;
+  }
+
+  /// 바 데이터를 BinanceFetcher와 같은 스키마의 Parquet 파일로 저장하는 함수
+  static void SaveBars(const SyntheticBars& bars,
+                       const string& directory_path, const string& file_name) {
+    arrow::Int64Builder open_time_builder;
+    arrow::DoubleBuilder open_builder;
+    arrow::DoubleBuilder high_builder;
+    arrow::DoubleBuilder low_builder;
+    arrow::DoubleBuilder close_builder;
+    arrow::DoubleBuilder volume_builder;
+    arrow::Int64Builder close_time_builder;
+
+    vector<shared_ptr<arrow::Array>> arrays(7);
+
+    if (!open_time_builder.AppendValues(bars.open_time).ok() ||
+        !open_builder.AppendValues(bars.open).ok() ||
+        !high_builder.AppendValues(bars.high).ok() ||
+        !low_builder.AppendValues(bars.low).ok() ||
+        !close_builder.AppendValues(bars.close).ok() ||
+        !volume_builder.AppendValues(bars.volume).ok() ||
+        !close_time_builder.AppendValues(bars.close_time).ok() ||
+        !open_time_builder.Finish(&arrays[0]).ok() ||
+        !open_builder.Finish(&arrays[1]).ok() ||
+        !high_builder.Finish(&arrays[2]).ok() ||
+        !low_builder.Finish(&arrays[3]).ok() ||
+        !close_builder.Finish(&arrays[4]).ok() ||
+        !volume_builder.Finish(&arrays[5]).ok() ||
+        !close_time_builder.Finish(&arrays[6]).ok()) {
+      throw runtime_error(
+          format("[{}/{}] 합성 바 데이터를 생성하는 데 실패했습니다.",
+                 directory_path, file_name));
+    }
+
+    const auto& schema = arrow::schema(
+        {arrow::field("Open Time", arrow::int64()),
+         arrow::field("Open", arrow::float64()),
+         arrow::field("High", arrow::float64()),
+         arrow::field("Low", arrow::float64()),
+         arrow::field("Close", arrow::float64()),
+         arrow::field("Volume", arrow::float64()),
+         arrow::field("Close Time", arrow::int64())});
+
+    utils::TableToParquet(arrow::Table::Make(schema, arrays), directory_path,
+                          file_name, false, false);
+  }
+};
+
+}  // namespace backtesting::tests
@@ -0,0 +1,106 @@
+// 표준 라이브러리
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+// 외부 라이브러리
+#include <gtest/gtest.h>
+
+// 내부 헤더
+#include "Engines/WeightLimiter.hpp"
+
+// 네임 스페이스
+using namespace std;
+using namespace backtesting::fetcher;
+
+namespace {
+
+constexpr int64_t window = 60000;
+constexpr int64_t margin = 1000;
+
+// 창 10의 시작 시간
+constexpr int64_t start = 10 * window + margin;
+
+string MakeHeader(const int64_t used_weight) {
+  return "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n"
+         "x-mbx-used-weight-1m: " +
+         to_string(used_weight) + "\r\n\r\n";
+}
+
+}  // namespace
+
+TEST(WeightLimiterTest, AdmitsUpToBudgetAndWaitsForNextWindow) {
+  WeightLimiter limiter(100, 0.9, window, margin);
+  ASSERT_EQ(limiter.GetBudget(), 90);
+
+  EXPECT_EQ(limiter.TryAcquire(50, start), 0);
+  EXPECT_EQ(limiter.TryAcquire(40, start + 10), 0);
+  EXPECT_EQ(limiter.GetUsedWeight(), 90);
+
+  // 예산을 넘으면 다음 창 시작까지 기다림
+  EXPECT_EQ(limiter.TryAcquire(1, start + 20000), window - 20000);
+  EXPECT_EQ(limiter.GetUsedWeight(), 90);
+
+  EXPECT_EQ(limiter.TryAcquire(1, start + window), 0);
+  EXPECT_EQ(limiter.GetUsedWeight(), 1);
+
+  EXPECT_THROW(static_cast<void>(limiter.TryAcquire(91, start)),
+               runtime_error);
+}
+
+TEST(WeightLimiterTest, FollowsServerUsedWeightInSameWindow) {
+  WeightLimiter limiter(100, 0.9, window, margin);
+
+  ASSERT_EQ(limiter.TryAcquire(5, start), 0);
+
+  // 다른 요청이 사용한 weight가 서버 값에 포함됨
+  limiter.OnResponse(200, MakeHeader(80), start, start + 100);
+  EXPECT_EQ(limiter.GetUsedWeight(), 80);
+
+  // 작은 값은 아직 응답받지 못한 예약을 지우지 않음
+  limiter.OnResponse(200, MakeHeader(10), start, start + 200);
+  EXPECT_EQ(limiter.GetUsedWeight(), 80);
+
+  EXPECT_EQ(limiter.TryAcquire(10, start + 300), 0);
+  EXPECT_GT(limiter.TryAcquire(1, start + 300), 0);
+
+  // 이전 창에 보낸 요청의 값은 새 창에 반영하지 않음
+  limiter.OnResponse(200, MakeHeader(90), start + window - 1,
+                     start + window + 100);
+  EXPECT_EQ(limiter.GetUsedWeight(), 0);
+}
+
+TEST(WeightLimiterTest, BlocksForRetryAfterOnRateLimit) {
+  WeightLimiter limiter(100, 0.9, window, margin);
+
+  limiter.OnResponse(429,
+                     "HTTP/1.1 429 Too Many Requests\r\nRetry-After: 7\r\n",
+                     start, start);
+  EXPECT_EQ(limiter.GetUsedWeight(), limiter.GetBudget());
+
+  // Retry-After 동안 기다리고, 끝나면 같은 창이어도 다시 허가
+  EXPECT_EQ(limiter.TryAcquire(1, start + 1000), 6000);
+  EXPECT_EQ(limiter.TryAcquire(1, start + 7000), 0);
+
+  // Retry-After가 없으면 다음 창까지 멈춤
+  limiter.OnResponse(418, "HTTP/1.1 418 I'm a teapot\r\n", start + 8000,
+                     start + 8000);
+  EXPECT_EQ(limiter.TryAcquire(1, start + 8000), window - 8000);
+}
+
+TEST(WeightLimiterTest, ParsesHeaders) {
+  EXPECT_EQ(WeightLimiter::ParseUsedWeight(MakeHeader(1234)), 1234);
+  EXPECT_EQ(WeightLimiter::ParseUsedWeight("Content-Length: 10\r\n"), -1);
+
+  // 리다이렉트 등으로 헤더 묶음이 여러 개이면 마지막 값을 사용
+  EXPECT_EQ(WeightLimiter::ParseUsedWeight(MakeHeader(3) + MakeHeader(4)), 4);
+
+  EXPECT_EQ(WeightLimiter::ParseRetryAfter("retry-after:  120\r\n"), 120);
+  EXPECT_EQ(WeightLimiter::ParseRetryAfter(MakeHeader(1)), -1);
+
+  // Retry-After로 시작하는 다른 이름의 헤더는 사용하지 않음
+  EXPECT_EQ(WeightLimiter::ParseRetryAfter("Retry-After-Extra: 5\r\n"), -1);
+  EXPECT_EQ(WeightLimiter::ParseRetryAfter("Retry-After-Extra: 5\r\n"
+                                           "Retry-After: 7\r\n"),
+            7);
+}